@@ -0,0 +1,111 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/geometry/LinearOctree.h"
+#include "open3d/geometry/Octree.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/io/PointCloudIO.h"
+
+namespace open3d {
+namespace benchmarks {
+
+class OctreeFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        pcd = open3d::io::CreatePointCloudFromFile(TEST_DATA_DIR
+                                                   "/fragment.pcd");
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    std::shared_ptr<open3d::geometry::PointCloud> pcd;
+};
+
+// Pointer based insertion, one tree walk per point.
+BENCHMARK_DEFINE_F(OctreeFixture, InsertPoints)(benchmark::State& state) {
+    const size_t max_depth = state.range(0);
+    auto linear_octree =
+            geometry::LinearOctree::CreateFromPointCloud(*pcd, max_depth);
+    for (auto _ : state) {
+        geometry::Octree octree(max_depth, linear_octree->origin_,
+                                linear_octree->size_);
+        for (size_t idx = 0; idx < pcd->points_.size(); idx++) {
+            octree.InsertPoint(pcd->points_[idx],
+                               geometry::OctreeColorLeafNode::GetInitFunction(),
+                               geometry::OctreeColorLeafNode::GetUpdateFunction(
+                                       pcd->colors_[idx]));
+        }
+    }
+}
+
+BENCHMARK_DEFINE_F(OctreeFixture, ConvertFromPointCloud)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        geometry::Octree octree(state.range(0));
+        octree.ConvertFromPointCloud(*pcd);
+    }
+}
+
+BENCHMARK_DEFINE_F(OctreeFixture, LinearOctreeFromPointCloud)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        geometry::LinearOctree::CreateFromPointCloud(*pcd, state.range(0));
+    }
+}
+
+BENCHMARK_DEFINE_F(OctreeFixture, LinearOctreeLocateLeaf)
+(benchmark::State& state) {
+    auto octree =
+            geometry::LinearOctree::CreateFromPointCloud(*pcd, state.range(0));
+    for (auto _ : state) {
+        for (const Eigen::Vector3d& point : pcd->points_) {
+            benchmark::DoNotOptimize(octree->LocateLeaf(point));
+        }
+    }
+}
+
+BENCHMARK_REGISTER_F(OctreeFixture, InsertPoints)
+        ->Args({6})
+        ->Args({10})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(OctreeFixture, ConvertFromPointCloud)
+        ->Args({6})
+        ->Args({10})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(OctreeFixture, LinearOctreeFromPointCloud)
+        ->Args({6})
+        ->Args({10})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(OctreeFixture, LinearOctreeLocateLeaf)
+        ->Args({6})
+        ->Args({10})
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
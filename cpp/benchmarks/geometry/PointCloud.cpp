@@ -0,0 +1,62 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/io/PointCloudIO.h"
+
+namespace open3d {
+namespace benchmarks {
+
+class PointCloudFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        pcd = open3d::io::CreatePointCloudFromFile(TEST_DATA_DIR
+                                                   "/fragment.pcd");
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    std::shared_ptr<open3d::geometry::PointCloud> pcd;
+};
+
+BENCHMARK_DEFINE_F(PointCloudFixture, ClusterDBSCAN)(benchmark::State& state) {
+    const double eps = state.range(0) * 0.001;
+    for (auto _ : state) {
+        pcd->ClusterDBSCAN(eps, 10);
+    }
+}
+
+BENCHMARK_REGISTER_F(PointCloudFixture, ClusterDBSCAN)
+        ->Args({5})
+        ->Args({20})
+        ->Args({50})
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -0,0 +1,77 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/io/TriangleMeshIO.h"
+
+namespace open3d {
+namespace benchmarks {
+
+class SimplifyQuadricDecimationFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        trimesh = io::CreateMeshFromFile(TEST_DATA_DIR "/knot.ply")
+                          ->SubdivideLoop(3);
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+
+    std::shared_ptr<geometry::TriangleMesh> trimesh;
+};
+
+// The argument is the percentage of triangles that are kept.
+BENCHMARK_DEFINE_F(SimplifyQuadricDecimationFixture, Serial)
+(benchmark::State& state) {
+    int target = int(trimesh->triangles_.size() * state.range(0) / 100);
+    for (auto _ : state) {
+        trimesh->SimplifyQuadricDecimation(target);
+    }
+}
+
+BENCHMARK_DEFINE_F(SimplifyQuadricDecimationFixture, Parallel)
+(benchmark::State& state) {
+    int target = int(trimesh->triangles_.size() * state.range(0) / 100);
+    for (auto _ : state) {
+        trimesh->SimplifyQuadricDecimation(
+                target, std::numeric_limits<double>::infinity(), 1.0, true);
+    }
+}
+
+BENCHMARK_REGISTER_F(SimplifyQuadricDecimationFixture, Serial)
+        ->Arg(50)
+        ->Arg(10)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(SimplifyQuadricDecimationFixture, Parallel)
+        ->Arg(50)
+        ->Arg(10)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
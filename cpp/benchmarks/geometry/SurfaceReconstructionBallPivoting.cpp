@@ -0,0 +1,79 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/io/TriangleMeshIO.h"
+
+namespace open3d {
+namespace benchmarks {
+
+class BallPivotingFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        auto trimesh = io::CreateMeshFromFile(TEST_DATA_DIR "/knot.ply");
+        trimesh->ComputeVertexNormals();
+        int n_points = int(state.range(0));
+        pcd = trimesh->SamplePointsUniformly(n_points);
+        double spacing = std::sqrt(trimesh->GetSurfaceArea() / n_points);
+        radii = {spacing, 2 * spacing};
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+
+    std::shared_ptr<geometry::PointCloud> pcd;
+    std::vector<double> radii;
+};
+
+// The argument is the number of points sampled from the mesh.
+BENCHMARK_DEFINE_F(BallPivotingFixture, Serial)(benchmark::State& state) {
+    for (auto _ : state) {
+        geometry::TriangleMesh::CreateFromPointCloudBallPivoting(*pcd, radii);
+    }
+}
+
+BENCHMARK_DEFINE_F(BallPivotingFixture, Parallel)(benchmark::State& state) {
+    for (auto _ : state) {
+        geometry::TriangleMesh::CreateFromPointCloudBallPivoting(*pcd, radii,
+                                                                 true);
+    }
+}
+
+BENCHMARK_REGISTER_F(BallPivotingFixture, Serial)
+        ->Arg(20000)
+        ->Arg(80000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(BallPivotingFixture, Parallel)
+        ->Arg(20000)
+        ->Arg(80000)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
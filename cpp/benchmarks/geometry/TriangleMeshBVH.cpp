@@ -0,0 +1,98 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/TriangleMeshBVH.h"
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/io/TriangleMeshIO.h"
+
+namespace open3d {
+namespace benchmarks {
+
+class TriangleMeshBVHFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        trimesh = open3d::io::CreateMeshFromFile(TEST_DATA_DIR "/knot.ply");
+        bvh = std::make_shared<geometry::TriangleMeshBVH>(*trimesh);
+
+        // Rays from a sphere around the mesh towards its center.
+        const Eigen::Vector3d center = trimesh->GetCenter();
+        const double radius = 2.0 * (trimesh->GetMaxBound() - center).norm();
+        auto sphere = geometry::TriangleMesh::CreateSphere(radius, 100);
+        for (const Eigen::Vector3d& v : sphere->vertices_) {
+            origins.push_back(center + v);
+            directions.push_back(-v);
+        }
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    std::shared_ptr<geometry::TriangleMesh> trimesh;
+    std::shared_ptr<geometry::TriangleMeshBVH> bvh;
+    std::vector<Eigen::Vector3d> origins;
+    std::vector<Eigen::Vector3d> directions;
+};
+
+BENCHMARK_DEFINE_F(TriangleMeshBVHFixture, Build)(benchmark::State& state) {
+    for (auto _ : state) {
+        geometry::TriangleMeshBVH bvh(*trimesh);
+    }
+}
+
+BENCHMARK_DEFINE_F(TriangleMeshBVHFixture, CastRays)(benchmark::State& state) {
+    for (auto _ : state) {
+        bvh->CastRays(origins, directions);
+    }
+}
+
+BENCHMARK_DEFINE_F(TriangleMeshBVHFixture, ComputeDistance)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        bvh->ComputeDistance(origins);
+    }
+}
+
+BENCHMARK_DEFINE_F(TriangleMeshBVHFixture, IsSelfIntersecting)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        trimesh->IsSelfIntersecting();
+    }
+}
+
+BENCHMARK_REGISTER_F(TriangleMeshBVHFixture, Build)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(TriangleMeshBVHFixture, CastRays)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(TriangleMeshBVHFixture, ComputeDistance)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(TriangleMeshBVHFixture, IsSelfIntersecting)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
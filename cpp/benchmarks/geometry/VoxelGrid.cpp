@@ -0,0 +1,81 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/VoxelGrid.h"
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/io/TriangleMeshIO.h"
+
+namespace open3d {
+namespace benchmarks {
+
+class VoxelGridFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        trimesh = open3d::io::CreateMeshFromFile(TEST_DATA_DIR "/knot.ply");
+        extent = (trimesh->GetMaxBound() - trimesh->GetMinBound()).maxCoeff();
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    std::shared_ptr<geometry::TriangleMesh> trimesh;
+    double extent;
+};
+
+// The argument is the number of voxels along the longest side.
+BENCHMARK_DEFINE_F(VoxelGridFixture, CreateFromTriangleMesh)
+(benchmark::State& state) {
+    const double voxel_size = extent / state.range(0);
+    for (auto _ : state) {
+        geometry::VoxelGrid::CreateFromTriangleMesh(*trimesh, voxel_size);
+    }
+}
+
+BENCHMARK_DEFINE_F(VoxelGridFixture, CreateFromTriangleMeshSolid)
+(benchmark::State& state) {
+    const double voxel_size = extent / state.range(0);
+    for (auto _ : state) {
+        geometry::VoxelGrid::CreateFromTriangleMesh(*trimesh, voxel_size,
+                                                    true);
+    }
+}
+
+BENCHMARK_REGISTER_F(VoxelGridFixture, CreateFromTriangleMesh)
+        ->Arg(64)
+        ->Arg(256)
+        ->Arg(1024)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(VoxelGridFixture, CreateFromTriangleMeshSolid)
+        ->Arg(64)
+        ->Arg(256)
+        ->Arg(1024)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -177,5 +177,31 @@ static void BM_TestPCGrid0_Args(benchmark::internal::Benchmark *b) {
 
 BENCHMARK(BM_TestPCGrid0)->MinTime(0.1)->Apply(BM_TestPCGrid0_Args);
 
+// Read only, the file is written once per size.
+static void BM_ReadPointCloud(::benchmark::State &state) {
+    int pc_args_id = state.range(0);
+    int size = state.range(1);
+    test_pc_grid0.Setup(size);
+    test_pc_grid0.WriteRead(pc_args_id);
+    const auto &args = g_pc_args[pc_args_id];
+    for (auto _ : state) {
+        geometry::PointCloud pc;
+        ReadPointCloud(args.filename, pc, {"auto", false, false, false});
+    }
+}
+
+static void BM_ReadPointCloud_Args(benchmark::internal::Benchmark *b) {
+    // Binary PLY and the ASCII formats parsed by AsciiRowReader.
+    for (int i : {3, 5, 6, 7, 8}) {
+        for (int j = 1024 * 1024; j <= 8 * 1024 * 1024; j *= 8) {
+            b->Args({i, j});
+        }
+    }
+}
+
+BENCHMARK(BM_ReadPointCloud)
+        ->Apply(BM_ReadPointCloud_Args)
+        ->Unit(benchmark::kMillisecond);
+
 }  // namespace benchmarks
 }  // namespace open3d
@@ -0,0 +1,87 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/pipelines/registration/FastGlobalRegistration.h"
+
+#include <benchmark/benchmark.h>
+
+#include <Eigen/Geometry>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/pipelines/registration/Feature.h"
+#include "open3d/pipelines/registration/Registration.h"
+
+namespace open3d {
+namespace benchmarks {
+
+using pipelines::registration::Feature;
+
+class FastGlobalRegistrationFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        target = io::CreatePointCloudFromFile(TEST_DATA_DIR
+                                              "/ColoredICP/frag_115.ply")
+                         ->VoxelDownSample(0.05);
+        target->EstimateNormals(geometry::KDTreeSearchParamHybrid(0.1, 30));
+
+        Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+        transformation.block<3, 3>(0, 0) =
+                Eigen::AngleAxisd(0.5, Eigen::Vector3d(1, 2, 3).normalized())
+                        .toRotationMatrix();
+        transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.3, -0.2, 0.1);
+        source = std::make_shared<geometry::PointCloud>(*target);
+        source->Transform(transformation.inverse());
+
+        const geometry::KDTreeSearchParamHybrid search_param(0.25, 100);
+        source_fpfh = pipelines::registration::ComputeFPFHFeature(
+                *source, search_param);
+        target_fpfh = pipelines::registration::ComputeFPFHFeature(
+                *target, search_param);
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    std::shared_ptr<geometry::PointCloud> source;
+    std::shared_ptr<geometry::PointCloud> target;
+    std::shared_ptr<Feature> source_fpfh;
+    std::shared_ptr<Feature> target_fpfh;
+};
+
+BENCHMARK_DEFINE_F(FastGlobalRegistrationFixture, FastGlobalRegistration)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        pipelines::registration::FastGlobalRegistration(
+                *source, *target, *source_fpfh, *target_fpfh);
+    }
+}
+
+BENCHMARK_REGISTER_F(FastGlobalRegistrationFixture, FastGlobalRegistration)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
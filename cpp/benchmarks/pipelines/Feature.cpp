@@ -0,0 +1,117 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/pipelines/registration/Feature.h"
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/io/PointCloudIO.h"
+
+namespace open3d {
+namespace benchmarks {
+
+using pipelines::registration::CorrespondenceSet;
+using pipelines::registration::Feature;
+using pipelines::registration::FeatureMatchingMethod;
+using pipelines::registration::FeatureMatchingOption;
+
+class FeatureMatchingFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        const geometry::KDTreeSearchParamHybrid search_param(0.25, 100);
+        auto source = io::CreatePointCloudFromFile(TEST_DATA_DIR
+                                                   "/Feature/cloud_bin_0.pcd")
+                              ->VoxelDownSample(0.05);
+        source->EstimateNormals(geometry::KDTreeSearchParamHybrid(0.1, 30));
+        auto target = io::CreatePointCloudFromFile(TEST_DATA_DIR
+                                                   "/Feature/cloud_bin_1.pcd")
+                              ->VoxelDownSample(0.05);
+        target->EstimateNormals(geometry::KDTreeSearchParamHybrid(0.1, 30));
+        source_fpfh = pipelines::registration::ComputeFPFHFeature(
+                *source, search_param);
+        target_fpfh = pipelines::registration::ComputeFPFHFeature(
+                *target, search_param);
+        exact = pipelines::registration::CorrespondencesFromFeatures(
+                *source_fpfh, *target_fpfh);
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+
+    // Runs the matching and reports the fraction of exact matches found.
+    void Run(benchmark::State& state, const FeatureMatchingOption& option) {
+        CorrespondenceSet corres;
+        for (auto _ : state) {
+            corres = pipelines::registration::CorrespondencesFromFeatures(
+                    *source_fpfh, *target_fpfh, false, option);
+        }
+        int num_correct = 0;
+        for (size_t k = 0; k < corres.size(); ++k) {
+            num_correct += corres[k] == exact[k];
+        }
+        state.counters["recall"] = double(num_correct) / exact.size();
+    }
+
+    std::shared_ptr<Feature> source_fpfh;
+    std::shared_ptr<Feature> target_fpfh;
+    CorrespondenceSet exact;
+};
+
+// The argument is the allowed relative distance error in percent.
+BENCHMARK_DEFINE_F(FeatureMatchingFixture, KDTree)(benchmark::State& state) {
+    Run(state, FeatureMatchingOption(FeatureMatchingMethod::KDTree,
+                                     state.range(0) / 100.0));
+}
+
+// The argument is the number of leaves visited per query.
+BENCHMARK_DEFINE_F(FeatureMatchingFixture, KDForest)
+(benchmark::State& state) {
+    Run(state, FeatureMatchingOption(FeatureMatchingMethod::KDForest, 0.0, 4,
+                                     int(state.range(0))));
+}
+
+BENCHMARK_DEFINE_F(FeatureMatchingFixture, BruteForce)
+(benchmark::State& state) {
+    Run(state, FeatureMatchingOption(FeatureMatchingMethod::BruteForce));
+}
+
+BENCHMARK_REGISTER_F(FeatureMatchingFixture, KDTree)
+        ->Arg(0)
+        ->Arg(50)
+        ->Arg(200)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(FeatureMatchingFixture, KDForest)
+        ->Arg(32)
+        ->Arg(128)
+        ->Arg(512)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(FeatureMatchingFixture, BruteForce)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
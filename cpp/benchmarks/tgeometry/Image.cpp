@@ -0,0 +1,125 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/Image.h"
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/io/ImageIO.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+static Image LoadImage(const std::string& name, const core::Device& device) {
+    std::shared_ptr<open3d::geometry::Image> image_legacy =
+            io::CreateImageFromFile(std::string(TEST_DATA_DIR) + "/RGBD/" +
+                                    name);
+    return Image::FromLegacyImage(*image_legacy, device);
+}
+
+void FilterGaussian(benchmark::State& state, const core::Device& device) {
+    Image color = LoadImage("color/00000.jpg", device);
+    for (auto _ : state) {
+        Image filtered = color.FilterGaussian(5, 1.0f);
+    }
+}
+
+void FilterBilateral(benchmark::State& state, const core::Device& device) {
+    Image depth = LoadImage("depth/00000.png", device)
+                          .ClipTransform(1000.0f, 0.0f, 3.0f);
+    for (auto _ : state) {
+        Image filtered = depth.FilterBilateral(5, 0.05f, 3.0f);
+    }
+}
+
+void FilterSobel(benchmark::State& state, const core::Device& device) {
+    Image gray = LoadImage("color/00000.jpg", device)
+                         .To(core::Dtype::Float32, 1.0 / 255.0)
+                         .RGBToGray();
+    for (auto _ : state) {
+        auto gradients = gray.FilterSobel(3);
+    }
+}
+
+void PyrDown(benchmark::State& state, const core::Device& device) {
+    Image color = LoadImage("color/00000.jpg", device);
+    for (auto _ : state) {
+        Image level = color;
+        for (int i = 0; i < 3; ++i) {
+            level = level.PyrDown();
+        }
+    }
+}
+
+void CreateNormalMap(benchmark::State& state, const core::Device& device) {
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    core::Tensor intrinsic_t = core::Tensor(
+            std::vector<double>({focal_length.first, 0, principal_point.first,
+                                 0, focal_length.second,
+                                 principal_point.second, 0, 0, 1}),
+            {3, 3}, core::Dtype::Float64);
+
+    Image depth = LoadImage("depth/00000.png", device);
+    for (auto _ : state) {
+        Image normal_map = depth.ClipTransform(1000.0f, 0.0f, 3.0f)
+                                   .CreateVertexMap(intrinsic_t)
+                                   .CreateNormalMap();
+    }
+}
+
+BENCHMARK_CAPTURE(FilterGaussian, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(FilterBilateral, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(FilterSobel, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(PyrDown, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CreateNormalMap, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(FilterGaussian, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(FilterBilateral, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(FilterSobel, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(PyrDown, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CreateNormalMap, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
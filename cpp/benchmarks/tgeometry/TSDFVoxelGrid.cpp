@@ -0,0 +1,113 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/TSDFVoxelGrid.h"
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/io/ImageIO.h"
+#include "open3d/io/PinholeCameraTrajectoryIO.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+void Integrate(benchmark::State& state,
+               const core::Device& device,
+               TSDFVoxelGrid::AllocationMode mode) {
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    core::Tensor intrinsic_t = core::Tensor(
+            std::vector<float>({static_cast<float>(focal_length.first), 0,
+                                static_cast<float>(principal_point.first), 0,
+                                static_cast<float>(focal_length.second),
+                                static_cast<float>(principal_point.second), 0,
+                                0, 1}),
+            {3, 3}, core::Dtype::Float32);
+
+    auto trajectory = io::CreatePinholeCameraTrajectoryFromFile(
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log");
+
+    std::vector<Image> depths;
+    std::vector<core::Tensor> extrinsics;
+    for (size_t i = 0; i < trajectory->parameters_.size(); ++i) {
+        std::shared_ptr<open3d::geometry::Image> depth_legacy =
+                io::CreateImageFromFile(
+                        fmt::format("{}/RGBD/depth/{:05d}.png",
+                                    std::string(TEST_DATA_DIR), i));
+        depths.push_back(Image::FromLegacyImage(*depth_legacy, device));
+
+        Eigen::Matrix4f extrinsic =
+                trajectory->parameters_[i].extrinsic_.cast<float>();
+        extrinsics.push_back(
+                core::eigen_converter::EigenMatrixToTensor(extrinsic).Copy(
+                        device));
+    }
+
+    for (auto _ : state) {
+        TSDFVoxelGrid voxel_grid({{"tsdf", core::Dtype::Float32},
+                                  {"weight", core::Dtype::UInt16}},
+                                 0.008f, 0.04f, 16, 1000, device);
+        voxel_grid.SetAllocationMode(mode);
+        for (size_t i = 0; i < depths.size(); ++i) {
+            voxel_grid.Integrate(depths[i], intrinsic_t, extrinsics[i]);
+        }
+    }
+}
+
+BENCHMARK_CAPTURE(Integrate,
+                  CPU_PointNeighborhood,
+                  core::Device("CPU:0"),
+                  TSDFVoxelGrid::AllocationMode::PointNeighborhood)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(Integrate,
+                  CPU_RayMarching,
+                  core::Device("CPU:0"),
+                  TSDFVoxelGrid::AllocationMode::RayMarching)
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(Integrate,
+                  CUDA_PointNeighborhood,
+                  core::Device("CUDA:0"),
+                  TSDFVoxelGrid::AllocationMode::PointNeighborhood)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(Integrate,
+                  CUDA_RayMarching,
+                  core::Device("CUDA:0"),
+                  TSDFVoxelGrid::AllocationMode::RayMarching)
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,106 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/odometry/RGBDOdometry.h"
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/io/ImageIO.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace odometry {
+
+static geometry::RGBDImage ReadRGBDImage(int index,
+                                         const core::Device& device) {
+    std::shared_ptr<open3d::geometry::Image> depth_legacy =
+            io::CreateImageFromFile(fmt::format("{}/RGBD/depth/{:05d}.png",
+                                                std::string(TEST_DATA_DIR),
+                                                index));
+    std::shared_ptr<open3d::geometry::Image> color_legacy =
+            io::CreateImageFromFile(fmt::format("{}/RGBD/color/{:05d}.jpg",
+                                                std::string(TEST_DATA_DIR),
+                                                index));
+    return geometry::RGBDImage(
+            geometry::Image::FromLegacyImage(*color_legacy, device),
+            geometry::Image::FromLegacyImage(*depth_legacy, device));
+}
+
+// Per-frame cost of frame-to-frame tracking: one pyramid construction and one
+// multi-scale odometry call, the target pyramid being reused.
+static void RGBDOdometry(benchmark::State& state,
+                         const core::Device& device,
+                         const Method& method) {
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    core::Tensor intrinsics = core::eigen_converter::EigenMatrixToTensor(
+            intrinsic.intrinsic_matrix_);
+    OdometryOption option;
+    int num_levels =
+            static_cast<int>(option.iteration_number_per_pyramid_level_.size());
+
+    geometry::RGBDImage source = ReadRGBDImage(1, device);
+    RGBDPyramid target =
+            CreateRGBDPyramid(ReadRGBDImage(0, device), intrinsics, num_levels,
+                              option);
+
+    for (auto _ : state) {
+        RGBDPyramid source_pyramid =
+                CreateRGBDPyramid(source, intrinsics, num_levels, option);
+        OdometryResult result = RGBDOdometryMultiScale(
+                source_pyramid, target,
+                core::Tensor::Eye(4, core::Dtype::Float64,
+                                  core::Device("CPU:0")),
+                option, method);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+BENCHMARK_CAPTURE(RGBDOdometry,
+                  CPU_PointToPlane,
+                  core::Device("CPU:0"),
+                  Method::PointToPlane)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(RGBDOdometry,
+                  CPU_Intensity,
+                  core::Device("CPU:0"),
+                  Method::Intensity)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(RGBDOdometry,
+                  CPU_Hybrid,
+                  core::Device("CPU:0"),
+                  Method::Hybrid)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace odometry
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,169 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/Registration.h"
+
+#include <benchmark/benchmark.h>
+
+#include <Eigen/Geometry>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/io/PointCloudIO.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+static const double kMaxCorrespondenceDistance = 0.02;
+
+static geometry::PointCloud ReadTarget() {
+    open3d::geometry::PointCloud legacy_pcd;
+    io::ReadPointCloud(std::string(TEST_DATA_DIR) + "/ColoredICP/frag_115.ply",
+                       legacy_pcd);
+    return geometry::PointCloud::FromLegacyPointCloud(legacy_pcd);
+}
+
+static geometry::PointCloud CreateSource(const geometry::PointCloud &target) {
+    Eigen::Matrix4d T = Eigen::Matrix4d::Identity();
+    T.block<3, 3>(0, 0) = Eigen::AngleAxisd(0.02, Eigen::Vector3d::UnitY())
+                                  .toRotationMatrix();
+    T.block<3, 1>(0, 3) = Eigen::Vector3d(0.005, -0.003, 0.004);
+    geometry::PointCloud source(target.GetPoints().Copy());
+    source.Transform(core::eigen_converter::EigenMatrixToTensor(T).To(
+            target.GetPoints().GetDtype()));
+    return source;
+}
+
+static void RegistrationICP(benchmark::State &state,
+                            const TransformationEstimationType &type) {
+    geometry::PointCloud target = ReadTarget();
+    geometry::PointCloud source = CreateSource(target);
+    TransformationEstimationPointToPoint point_to_point;
+    TransformationEstimationPointToPlane point_to_plane;
+    const TransformationEstimation &estimation =
+            type == TransformationEstimationType::PointToPlane
+                    ? static_cast<const TransformationEstimation &>(
+                              point_to_plane)
+                    : point_to_point;
+    core::Tensor init =
+            core::Tensor::Eye(4, core::Dtype::Float64, core::Device("CPU:0"));
+
+    for (auto _ : state) {
+        RegistrationResult result =
+                RegistrationICP(source, target, kMaxCorrespondenceDistance,
+                                init, estimation);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+// Same as above, but the target index is built once outside the loop, as when
+// registering a sequence of scans against one map.
+static void RegistrationICPReuseIndex(
+        benchmark::State &state, const TransformationEstimationType &type) {
+    geometry::PointCloud target = ReadTarget();
+    geometry::PointCloud source = CreateSource(target);
+    TransformationEstimationPointToPoint point_to_point;
+    TransformationEstimationPointToPlane point_to_plane;
+    const TransformationEstimation &estimation =
+            type == TransformationEstimationType::PointToPlane
+                    ? static_cast<const TransformationEstimation &>(
+                              point_to_plane)
+                    : point_to_point;
+    core::Tensor init =
+            core::Tensor::Eye(4, core::Dtype::Float64, core::Device("CPU:0"));
+    core::nns::NearestNeighborSearch target_nns(target.GetPoints());
+    target_nns.KnnIndex();
+
+    for (auto _ : state) {
+        RegistrationResult result =
+                RegistrationICP(source, target, target_nns,
+                                kMaxCorrespondenceDistance, init, estimation);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+static const std::vector<double> kVoxelSizes = {0.02, 0.01, 0.005};
+static const std::vector<double> kMaxCorrespondenceDistances = {0.06, 0.03,
+                                                                0.015};
+
+// Coarse-to-fine ICP. With reuse_pyramid, the downsampled targets and their
+// indices are built once outside the loop.
+static void RegistrationMultiScaleICP(benchmark::State &state,
+                                      bool reuse_pyramid) {
+    geometry::PointCloud target = ReadTarget();
+    geometry::PointCloud source = CreateSource(target);
+    TransformationEstimationPointToPlane estimation;
+    std::vector<ICPConvergenceCriteria> criterias(kVoxelSizes.size());
+    core::Tensor init =
+            core::Tensor::Eye(4, core::Dtype::Float64, core::Device("CPU:0"));
+    PointCloudPyramid target_pyramid =
+            CreatePointCloudPyramid(target, kVoxelSizes);
+
+    for (auto _ : state) {
+        RegistrationResult result =
+                reuse_pyramid
+                        ? RegistrationMultiScaleICP(
+                                  source, target_pyramid, criterias,
+                                  kMaxCorrespondenceDistances, init, estimation)
+                        : RegistrationMultiScaleICP(
+                                  source, target, kVoxelSizes, criterias,
+                                  kMaxCorrespondenceDistances, init,
+                                  estimation);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+BENCHMARK_CAPTURE(RegistrationICP,
+                  CPU_PointToPoint,
+                  TransformationEstimationType::PointToPoint)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(RegistrationICP,
+                  CPU_PointToPlane,
+                  TransformationEstimationType::PointToPlane)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(RegistrationICPReuseIndex,
+                  CPU_PointToPoint,
+                  TransformationEstimationType::PointToPoint)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(RegistrationICPReuseIndex,
+                  CPU_PointToPlane,
+                  TransformationEstimationType::PointToPlane)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(RegistrationMultiScaleICP, CPU, false)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(RegistrationMultiScaleICP, CPU_ReusePyramid, true)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -34,6 +34,23 @@ namespace open3d {
 namespace core {
 namespace eigen_converter {
 
+Eigen::MatrixXd TensorToEigenMatrixXd(const core::Tensor &tensor) {
+    if (tensor.NumDims() != 2) {
+        utility::LogError("Expected a 2D tensor, but got shape {}.",
+                          tensor.GetShape().ToString());
+    }
+    int64_t rows = tensor.GetShape()[0];
+    int64_t cols = tensor.GetShape()[1];
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
+            matrix_row_major(rows, cols);
+    core::Tensor t = tensor.Contiguous().To(core::Dtype::Float64,
+                                            /*copy=*/false);
+    MemoryManager::MemcpyToHost(matrix_row_major.data(), t.GetDataPtr(),
+                                t.GetDevice(),
+                                t.GetDtype().ByteSize() * t.NumElements());
+    return matrix_row_major;
+}
+
 template <typename T>
 static std::vector<Eigen::Matrix<T, 3, 1>> TensorToEigenVector3xVector(
         const core::Tensor &tensor) {
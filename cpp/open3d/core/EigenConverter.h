@@ -50,6 +50,13 @@ core::Tensor EigenMatrixToTensor(const Eigen::Matrix<T, M, N, A> &matrix) {
                         dtype);
 }
 
+/// Converts a 2D tensor to an Eigen::MatrixXd of the same shape. Regardless of
+/// the tensor dtype and device, the output will be converted to double on CPU.
+///
+/// \param tensor A 2D tensor, e.g. a 4x4 transformation.
+/// \return An Eigen::MatrixXd converted from the tensor.
+Eigen::MatrixXd TensorToEigenMatrixXd(const core::Tensor &tensor);
+
 /// Converts a tensor of shape (N, 3) to std::vector<Eigen::Vector3d>. An
 /// exception will be thrown if the tensor shape is not (N, 3). Regardless of
 /// the tensor dtype, the output will be converted to to double.
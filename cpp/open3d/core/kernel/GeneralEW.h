@@ -38,6 +38,7 @@ enum class GeneralEWOpCode {
     Unproject,
     TSDFIntegrate,
     TSDFTouch,
+    DepthTouch,
     TSDFPointExtraction,
     TSDFMeshExtraction,
     RayCasting
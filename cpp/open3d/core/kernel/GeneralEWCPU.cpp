@@ -135,6 +135,9 @@ void GeneralEWCPU(const std::unordered_map<std::string, Tensor>& srcs,
         case GeneralEWOpCode::TSDFTouch:
             CPUTSDFTouchKernel(srcs, dsts);
             break;
+        case GeneralEWOpCode::DepthTouch:
+            CPUDepthTouchKernel(srcs, dsts);
+            break;
         case GeneralEWOpCode::TSDFIntegrate:
             CPUTSDFIntegrateKernel(srcs, dsts);
             break;
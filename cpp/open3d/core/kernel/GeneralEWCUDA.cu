@@ -131,6 +131,9 @@ void GeneralEWCUDA(const std::unordered_map<std::string, Tensor>& srcs,
         case GeneralEWOpCode::TSDFTouch:
             CUDATSDFTouchKernel(srcs, dsts);
             break;
+        case GeneralEWOpCode::DepthTouch:
+            CUDADepthTouchKernel(srcs, dsts);
+            break;
         case GeneralEWOpCode::TSDFIntegrate:
             CUDATSDFIntegrateKernel(srcs, dsts);
             break;
@@ -324,6 +324,310 @@ void CPUUnprojectKernel
     dsts.emplace("points", points.Slice(0, 0, total_pts_count));
 }
 
+// Packed block coordinate for the lock-free block set used in DepthTouch.
+// Each coordinate occupies 21 bits (range [-2^20, 2^20)), and the packed key is
+// offset by 1 so that 0 can be used as the empty slot marker.
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+using BlockKeySlot = unsigned long long;
+#else
+using BlockKeySlot = std::atomic<uint64_t>;
+#endif
+
+inline OPEN3D_DEVICE uint64_t PackBlockKey(int xb, int yb, int zb) {
+    constexpr int64_t kOffset = 1 << 20;
+    constexpr uint64_t kMask = (1 << 21) - 1;
+    return (((static_cast<uint64_t>(xb + kOffset) & kMask) << 42) |
+            ((static_cast<uint64_t>(yb + kOffset) & kMask) << 21) |
+            (static_cast<uint64_t>(zb + kOffset) & kMask)) +
+           1;
+}
+
+// Insert a block coordinate into an open-addressing set with linear probing.
+// Returns true only for the thread that inserted the key first.
+inline OPEN3D_DEVICE bool DeviceInsertBlockKey(BlockKeySlot* slots,
+                                               uint64_t mask,
+                                               int xb,
+                                               int yb,
+                                               int zb) {
+    uint64_t key = PackBlockKey(xb, yb, zb);
+
+    // 64-bit finalizer of MurmurHash3.
+    uint64_t h = key;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+
+    for (uint64_t probe = 0; probe <= mask; ++probe) {
+        uint64_t slot = (h + probe) & mask;
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        uint64_t prev = atomicCAS(&slots[slot], 0ULL,
+                                  static_cast<unsigned long long>(key));
+#else
+        uint64_t prev = 0;
+        slots[slot].compare_exchange_strong(prev, key);
+#endif
+        if (prev == 0) return true;
+        if (prev == key) return false;
+    }
+    return false;
+}
+
+// Maximum number of candidate block coordinates of the pixels that one
+// DepthTouch launch processes at once, i.e. 48 MB of Int32 coordinates plus a
+// 64 MB set in addition to the blocks touched by the previous pixels.
+static constexpr int64_t kMaxBlockCandidates = 1 << 22;
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void CUDADepthTouchKernel
+#else
+void CPUDepthTouchKernel
+#endif
+        (const std::unordered_map<std::string, Tensor>& srcs,
+         std::unordered_map<std::string, Tensor>& dsts) {
+    static std::vector<std::string> src_attrs = {
+            "depth",      "intrinsics", "extrinsics", "depth_scale",
+            "depth_max",  "stride",     "voxel_size", "resolution",
+            "sdf_trunc",  "ray_march",
+    };
+    for (auto& k : src_attrs) {
+        if (srcs.count(k) == 0) {
+            utility::LogError(
+                    "[DepthTouchKernel] expected Tensor {} in srcs, but "
+                    "did not receive",
+                    k);
+        }
+    }
+
+    // Input
+    Tensor depth = srcs.at("depth");
+    Tensor intrinsics = srcs.at("intrinsics").To(core::Dtype::Float32);
+    Tensor extrinsics = srcs.at("extrinsics").To(core::Dtype::Float32);
+    float depth_scale = srcs.at("depth_scale").Item<float>();
+    float depth_max = srcs.at("depth_max").Item<float>();
+    int64_t stride = srcs.at("stride").Item<int64_t>();
+    float voxel_size = srcs.at("voxel_size").Item<float>();
+    int64_t resolution = srcs.at("resolution").Item<int64_t>();
+    float sdf_trunc = srcs.at("sdf_trunc").Item<float>();
+    bool ray_march = srcs.at("ray_march").Item<int64_t>() != 0;
+
+    float block_size = voxel_size * resolution;
+    Device device = depth.GetDevice();
+
+    NDArrayIndexer depth_indexer(depth, 2);
+    TransformIndexer ti(intrinsics, extrinsics.Inverse(), 1.0f);
+
+    // Upper bound of blocks touched by one pixel: a band of length 2 * trunc
+    // crosses at most (ceil(2 * trunc / block_size)) boundaries per axis in
+    // the ray marching mode, and spans at most (ceil(2 * trunc / block_size)
+    // + 1) blocks per axis in the cube mode.
+    int64_t span = static_cast<int64_t>(std::ceil(2 * sdf_trunc / block_size));
+    int64_t max_blocks_per_pixel =
+            ray_march ? 3 * span + 1 : (span + 1) * (span + 1) * (span + 1);
+    if (max_blocks_per_pixel > kMaxBlockCandidates) {
+        utility::LogError(
+                "[DepthTouchKernel] sdf_trunc {} is too large for block size "
+                "{}, a single pixel may touch {} blocks.",
+                sdf_trunc, block_size, max_blocks_per_pixel);
+    }
+
+    int64_t rows_strided = depth_indexer.GetShape(0) / stride;
+    int64_t cols_strided = depth_indexer.GetShape(1) / stride;
+    int64_t n = rows_strided * cols_strided;
+
+    // The pixels are processed in chunks whose worst case of touched blocks
+    // fits in kMaxBlockCandidates. The output and the set hold the unique
+    // blocks of the previous chunks plus the worst case of the current chunk,
+    // and grow when a chunk does not fit. Every newly inserted key is written
+    // straight into the output tensor, so no serial pass over the set is
+    // required.
+    const int64_t chunk_size = kMaxBlockCandidates / max_blocks_per_pixel;
+    int64_t max_blocks = 0;
+    Tensor block_coords({0, 3}, core::Dtype::Int32, device);
+    int* block_coords_ptr = nullptr;
+    uint64_t mask = 0;
+    BlockKeySlot* slots_ptr = nullptr;
+    int64_t total_block_count = 0;
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    Tensor slots;
+    Tensor count(std::vector<int>{0}, {}, core::Dtype::Int32, device);
+    int* count_ptr = static_cast<int*>(count.GetDataPtr());
+#else
+    std::vector<BlockKeySlot> slots;
+    std::atomic<int> count_atomic(0);
+    std::atomic<int>* count_ptr = &count_atomic;
+#endif
+
+    for (int64_t begin = 0; begin < n; begin += chunk_size) {
+        const int64_t chunk_end = std::min(begin + chunk_size, n);
+        const int64_t required =
+                total_block_count + (chunk_end - begin) * max_blocks_per_pixel;
+        if (required > max_blocks) {
+            max_blocks = std::max(required, 2 * max_blocks);
+            Tensor grown({max_blocks, 3}, core::Dtype::Int32, device);
+            if (total_block_count > 0) {
+                grown.Slice(0, 0, total_block_count) =
+                        block_coords.Slice(0, 0, total_block_count);
+            }
+            block_coords = grown;
+            block_coords_ptr = static_cast<int*>(block_coords.GetDataPtr());
+
+            // Capacity of the set: power of 2 with a load factor <= 0.5.
+            uint64_t capacity = 1;
+            while (capacity < static_cast<uint64_t>(2 * max_blocks)) {
+                capacity <<= 1;
+            }
+            mask = capacity - 1;
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+            slots = Tensor::Zeros({static_cast<int64_t>(capacity)},
+                                  core::Dtype::Int64, device);
+            slots_ptr = static_cast<BlockKeySlot*>(slots.GetDataPtr());
+#else
+            slots = std::vector<BlockKeySlot>(capacity);
+            slots_ptr = slots.data();
+#endif
+
+            // Insert the blocks of the previous chunks into the new set.
+            if (total_block_count > 0) {
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+                CUDALauncher::LaunchGeneralKernel(
+                        total_block_count,
+                        [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+                CPULauncher::LaunchGeneralKernel(
+                        total_block_count, [&](int64_t workload_idx) {
+#endif
+                            const int* coord =
+                                    block_coords_ptr + 3 * workload_idx;
+                            DeviceInsertBlockKey(slots_ptr, mask, coord[0],
+                                                 coord[1], coord[2]);
+                        });
+            }
+        }
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        CUDALauncher::LaunchGeneralKernel(
+                chunk_end - begin, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+#else
+        CPULauncher::LaunchGeneralKernel(
+                chunk_end - begin, [&](int64_t workload_idx) {
+#endif
+                    auto touch = [&] OPEN3D_DEVICE(int xb, int yb, int zb) {
+                        if (DeviceInsertBlockKey(slots_ptr, mask, xb, yb, zb)) {
+                            int idx = OPEN3D_ATOMIC_ADD(count_ptr, 1);
+                            block_coords_ptr[3 * idx + 0] = xb;
+                            block_coords_ptr[3 * idx + 1] = yb;
+                            block_coords_ptr[3 * idx + 2] = zb;
+                        }
+                    };
+
+                    int64_t pixel_idx = begin + workload_idx;
+                    int64_t y = (pixel_idx / cols_strided) * stride;
+                    int64_t x = (pixel_idx % cols_strided) * stride;
+
+                    float d = (*static_cast<uint16_t*>(
+                                      depth_indexer.GetDataPtrFromCoord(x,
+                                                                        y))) /
+                              depth_scale;
+                    if (d <= 0 || d >= depth_max) {
+                        return;
+                    }
+
+                    if (!ray_march) {
+                        // Blocks within sdf_trunc of the observed surface
+                        // point.
+                        float x_c = 0, y_c = 0, z_c = 0;
+                        ti.Unproject(static_cast<float>(x),
+                                     static_cast<float>(y), d, &x_c, &y_c,
+                                     &z_c);
+                        float x_g, y_g, z_g;
+                        ti.RigidTransform(x_c, y_c, z_c, &x_g, &y_g, &z_g);
+
+                        int xb_lo = static_cast<int>(
+                                floorf((x_g - sdf_trunc) / block_size));
+                        int xb_hi = static_cast<int>(
+                                floorf((x_g + sdf_trunc) / block_size));
+                        int yb_lo = static_cast<int>(
+                                floorf((y_g - sdf_trunc) / block_size));
+                        int yb_hi = static_cast<int>(
+                                floorf((y_g + sdf_trunc) / block_size));
+                        int zb_lo = static_cast<int>(
+                                floorf((z_g - sdf_trunc) / block_size));
+                        int zb_hi = static_cast<int>(
+                                floorf((z_g + sdf_trunc) / block_size));
+                        for (int xb = xb_lo; xb <= xb_hi; ++xb) {
+                            for (int yb = yb_lo; yb <= yb_hi; ++yb) {
+                                for (int zb = zb_lo; zb <= zb_hi; ++zb) {
+                                    touch(xb, yb, zb);
+                                }
+                            }
+                        }
+                        return;
+                    }
+
+                    // Ray marching: traverse the blocks crossed by the segment
+                    // of the viewing ray within [d - trunc, d + trunc] (3D
+                    // DDA).
+                    float x_r = 0, y_r = 0, z_r = 0;
+                    ti.Unproject(static_cast<float>(x), static_cast<float>(y),
+                                 1.0f, &x_r, &y_r, &z_r);
+                    float t_trunc =
+                            sdf_trunc / sqrtf(x_r * x_r + y_r * y_r + 1.0f);
+                    float t0 = d - t_trunc > 0 ? d - t_trunc : 0;
+                    float t1 = d + t_trunc;
+
+                    float x0, y0, z0, x1, y1, z1;
+                    ti.RigidTransform(x_r * t0, y_r * t0, t0, &x0, &y0, &z0);
+                    ti.RigidTransform(x_r * t1, y_r * t1, t1, &x1, &y1, &z1);
+                    float a[3] = {x0 / block_size, y0 / block_size,
+                                  z0 / block_size};
+                    float b[3] = {x1 / block_size, y1 / block_size,
+                                  z1 / block_size};
+
+                    int curr[3], step[3], total = 0;
+                    float t_max[3], t_delta[3];
+                    for (int i = 0; i < 3; ++i) {
+                        curr[i] = static_cast<int>(floorf(a[i]));
+                        int end = static_cast<int>(floorf(b[i]));
+                        total += end > curr[i] ? end - curr[i] : curr[i] - end;
+
+                        float delta = b[i] - a[i];
+                        if (delta > 0) {
+                            step[i] = 1;
+                            t_delta[i] = 1.0f / delta;
+                            t_max[i] = (curr[i] + 1 - a[i]) * t_delta[i];
+                        } else if (delta < 0) {
+                            step[i] = -1;
+                            t_delta[i] = -1.0f / delta;
+                            t_max[i] = (a[i] - curr[i]) * t_delta[i];
+                        } else {
+                            step[i] = 0;
+                            t_delta[i] = 0;
+                            t_max[i] = 2.0f;
+                        }
+                    }
+
+                    for (int k = 0; k <= total; ++k) {
+                        touch(curr[0], curr[1], curr[2]);
+                        int axis = t_max[0] < t_max[1]
+                                           ? (t_max[0] < t_max[2] ? 0 : 2)
+                                           : (t_max[1] < t_max[2] ? 1 : 2);
+                        curr[axis] += step[axis];
+                        t_max[axis] += t_delta[axis];
+                    }
+                });
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+        total_block_count = count.Item<int>();
+#else
+        total_block_count = (*count_ptr).load();
+#endif
+    }
+    dsts.emplace("block_coords", block_coords.Slice(0, 0, total_block_count));
+}
+
 #if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
 void CUDATSDFIntegrateKernel
 #else
@@ -31,7 +31,9 @@
 
 #include "open3d/geometry/KDTreeFlann.h"
 
+#include <algorithm>
 #include <flann/flann.hpp>
+#include <limits>
 
 #include "open3d/geometry/HalfEdgeTriangleMesh.h"
 #include "open3d/geometry/PointCloud.h"
@@ -132,6 +134,43 @@ int KDTreeFlann::SearchKNN(const T &query,
     return k;
 }
 
+int KDTreeFlann::SearchKNN(const Eigen::MatrixXd &queries,
+                           int knn,
+                           Eigen::MatrixXi &indices,
+                           Eigen::MatrixXd &distance2) const {
+    if (data_.empty() || dataset_size_ <= 0 ||
+        size_t(queries.rows()) != dimension_ || knn < 0) {
+        return -1;
+    }
+    // Column-major knn x N matrices have the layout of row-major N x knn
+    // matrices expected by flann. Unfilled entries keep the initial values.
+    const int64_t num_queries = queries.cols();
+    indices.resize(knn, num_queries);
+    distance2.setConstant(knn, num_queries,
+                          std::numeric_limits<double>::infinity());
+    // Blocks of queries are searched in parallel, each with a single flann
+    // call.
+    const int64_t block_size = 1024;
+    const int64_t num_blocks = (num_queries + block_size - 1) / block_size;
+    int k = 0;
+#pragma omp parallel for schedule(dynamic) reduction(+ : k)
+    for (int64_t b = 0; b < num_blocks; ++b) {
+        const int64_t begin = b * block_size;
+        const int64_t count = std::min(block_size, num_queries - begin);
+        flann::Matrix<double> query_flann((double *)queries.col(begin).data(),
+                                          count, dimension_);
+        flann::Matrix<int> indices_flann(indices.col(begin).data(), count,
+                                         knn);
+        flann::Matrix<double> dists_flann(distance2.col(begin).data(), count,
+                                          knn);
+        k += flann_index_->knnSearch(query_flann, indices_flann, dists_flann,
+                                     knn, flann::SearchParams(-1, 0.0));
+    }
+    indices = (distance2.array() == std::numeric_limits<double>::infinity())
+                      .select(-1, indices);
+    return k;
+}
+
 template <typename T>
 int KDTreeFlann::SearchRadius(const T &query,
                               double radius,
@@ -98,6 +98,19 @@ public:
                   std::vector<int> &indices,
                   std::vector<double> &distance2) const;
 
+    /// \brief Searches the nearest neighbors of many queries in parallel.
+    ///
+    /// \param queries Query points stored as columns.
+    /// \param knn Number of nearest neighbors per query.
+    /// \param indices Column i holds the neighbors of query i. Entries
+    /// without a neighbor are -1.
+    /// \param distance2 Squared distances in the layout of \p indices.
+    /// \return Total number of neighbors found, -1 on invalid input.
+    int SearchKNN(const Eigen::MatrixXd &queries,
+                  int knn,
+                  Eigen::MatrixXi &indices,
+                  Eigen::MatrixXd &distance2) const;
+
     template <typename T>
     int SearchRadius(const T &query,
                      double radius,
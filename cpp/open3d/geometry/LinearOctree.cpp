@@ -0,0 +1,502 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/LinearOctree.h"
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <limits>
+
+#include "open3d/core/kernel/ParallelUtil.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Sorts each thread's chunk, then merges the chunks pairwise in parallel.
+template <typename T>
+void ParallelSort(std::vector<T> &values) {
+    const int num_chunks = core::kernel::GetMaxThreads();
+    if (num_chunks <= 1 || values.size() < (1 << 16)) {
+        std::sort(values.begin(), values.end());
+        return;
+    }
+    std::vector<size_t> bounds(num_chunks + 1);
+    for (int i = 0; i <= num_chunks; ++i) {
+        bounds[i] = values.size() * i / num_chunks;
+    }
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < num_chunks; ++i) {
+        std::sort(values.begin() + bounds[i], values.begin() + bounds[i + 1]);
+    }
+    for (int width = 1; width < num_chunks; width *= 2) {
+#pragma omp parallel for schedule(static)
+        for (int i = 0; i < num_chunks; i += 2 * width) {
+            const int mid = std::min(i + width, num_chunks);
+            const int end = std::min(i + 2 * width, num_chunks);
+            if (mid < end) {
+                std::inplace_merge(values.begin() + bounds[i],
+                                   values.begin() + bounds[mid],
+                                   values.begin() + bounds[end]);
+            }
+        }
+    }
+}
+
+int CountChildren(uint8_t child_mask) {
+    int count = 0;
+    for (; child_mask != 0; child_mask &= child_mask - 1) {
+        ++count;
+    }
+    return count;
+}
+
+Eigen::Vector3i DecodeGridIndex(uint64_t code, size_t depth) {
+    Eigen::Vector3i index(0, 0, 0);
+    for (size_t level = 0; level < depth; ++level) {
+        const uint64_t child_index = (code >> (3 * level)) & 7;
+        index(0) |= int(child_index & 1) << level;
+        index(1) |= int((child_index >> 1) & 1) << level;
+        index(2) |= int((child_index >> 2) & 1) << level;
+    }
+    return index;
+}
+
+uint64_t EncodeGridIndex(const Eigen::Vector3i &index, size_t depth) {
+    uint64_t code = 0;
+    for (size_t level = 0; level < depth; ++level) {
+        const uint64_t child_index = ((index(0) >> level) & 1) |
+                                     (((index(1) >> level) & 1) << 1) |
+                                     (((index(2) >> level) & 1) << 2);
+        code |= child_index << (3 * level);
+    }
+    return code;
+}
+
+/// Slab test of a ray against the box [min_bound, max_bound], NaNs from
+/// rays parallel to a slab leave the interval unchanged.
+bool RayBox(const Eigen::Vector3d &origin,
+            const Eigen::Vector3d &inv_direction,
+            const Eigen::Vector3d &min_bound,
+            const Eigen::Vector3d &max_bound,
+            double &t_enter) {
+    double t0 = 0;
+    double t1 = std::numeric_limits<double>::infinity();
+    for (int i = 0; i < 3; ++i) {
+        double t_near = (min_bound(i) - origin(i)) * inv_direction(i);
+        double t_far = (max_bound(i) - origin(i)) * inv_direction(i);
+        if (t_near > t_far) {
+            std::swap(t_near, t_far);
+        }
+        t0 = t_near > t0 ? t_near : t0;
+        t1 = t_far < t1 ? t_far : t1;
+    }
+    t_enter = t0;
+    return t0 <= t1;
+}
+
+std::shared_ptr<OctreeNode> ToOctreeNode(const LinearOctree &octree,
+                                         size_t node_index,
+                                         size_t depth) {
+    const LinearOctree::Node &node = octree.GetNodes()[node_index];
+    if (depth == octree.max_depth_) {
+        auto leaf_node = std::make_shared<OctreeColorLeafNode>();
+        leaf_node->color_ = octree.leaf_colors_[node.first_child_];
+        return leaf_node;
+    }
+    auto internal_node = std::make_shared<OctreeInternalNode>();
+    size_t child_node_index = node.first_child_;
+    for (int child_index = 0; child_index < 8; ++child_index) {
+        if (node.child_mask_ & (1 << child_index)) {
+            internal_node->children_[child_index] =
+                    ToOctreeNode(octree, child_node_index++, depth + 1);
+        }
+    }
+    return internal_node;
+}
+
+void CollectLeaves(const std::shared_ptr<OctreeNode> &node,
+                   size_t depth,
+                   uint64_t code,
+                   size_t max_depth,
+                   std::vector<uint64_t> &leaf_codes,
+                   std::vector<Eigen::Vector3d> &leaf_colors) {
+    if (node == nullptr) {
+        return;
+    } else if (auto internal_node =
+                       std::dynamic_pointer_cast<OctreeInternalNode>(node)) {
+        if (depth >= max_depth) {
+            utility::LogError("Internal node below max depth {}.", max_depth);
+        }
+        for (uint64_t child_index = 0; child_index < 8; ++child_index) {
+            CollectLeaves(internal_node->children_[child_index], depth + 1,
+                          (code << 3) | child_index, max_depth, leaf_codes,
+                          leaf_colors);
+        }
+    } else if (auto leaf_node =
+                       std::dynamic_pointer_cast<OctreeColorLeafNode>(node)) {
+        if (depth != max_depth) {
+            utility::LogError("Leaf node at depth {}, expected max depth {}.",
+                              depth, max_depth);
+        }
+        leaf_codes.push_back(code);
+        leaf_colors.push_back(leaf_node->color_);
+    } else {
+        utility::LogError("Only OctreeColorLeafNode leaves are supported.");
+    }
+}
+
+}  // unnamed namespace
+
+constexpr size_t LinearOctree::kMaxDepth;
+
+LinearOctree::LinearOctree(size_t max_depth,
+                           const Eigen::Vector3d &origin,
+                           double size)
+    : origin_(origin), size_(size), max_depth_(max_depth) {
+    if (max_depth_ > kMaxDepth) {
+        utility::LogError("max_depth {} exceeds the maximum of {}.",
+                          max_depth_, kMaxDepth);
+    }
+    level_offsets_.assign(max_depth_ + 2, 0);
+}
+
+std::shared_ptr<LinearOctree> LinearOctree::CreateFromPointCloud(
+        const PointCloud &point_cloud, size_t max_depth, double size_expand) {
+    if (size_expand > 1 || size_expand < 0) {
+        utility::LogError("size_expand shall be between 0 and 1");
+    }
+    Eigen::Array3d min_bound = point_cloud.GetMinBound();
+    Eigen::Array3d max_bound = point_cloud.GetMaxBound();
+    Eigen::Array3d center = (min_bound + max_bound) / 2;
+    Eigen::Array3d half_sizes = center - min_bound;
+    double max_half_size = half_sizes.maxCoeff();
+    Eigen::Vector3d origin = min_bound.min(center - max_half_size);
+    double size = max_half_size == 0 ? size_expand
+                                     : max_half_size * 2 * (1 + size_expand);
+    auto octree = std::make_shared<LinearOctree>(max_depth, origin, size);
+    octree->SetPoints(point_cloud.points_, point_cloud.colors_);
+    return octree;
+}
+
+std::shared_ptr<LinearOctree> LinearOctree::CreateFromOctree(
+        const Octree &octree) {
+    auto linear_octree = std::make_shared<LinearOctree>(
+            octree.max_depth_, octree.origin_, octree.size_);
+    // Children are visited in order, so the codes come out sorted.
+    std::vector<uint64_t> leaf_codes;
+    CollectLeaves(octree.root_node_, 0, 0, octree.max_depth_, leaf_codes,
+                  linear_octree->leaf_colors_);
+    linear_octree->BuildLevels(leaf_codes);
+    return linear_octree;
+}
+
+void LinearOctree::SetPoints(const std::vector<Eigen::Vector3d> &points,
+                             const std::vector<Eigen::Vector3d> &colors) {
+    if (max_depth_ > kMaxDepth) {
+        utility::LogError("max_depth {} exceeds the maximum of {}.",
+                          max_depth_, kMaxDepth);
+    }
+    if (!colors.empty() && colors.size() != points.size()) {
+        utility::LogError("Number of colors ({}) and points ({}) differ.",
+                          colors.size(), points.size());
+    }
+    // Out of bound points get the largest code and are dropped after
+    // sorting. Sorting by point index second keeps the last point of a leaf
+    // last.
+    const uint64_t invalid_code = std::numeric_limits<uint64_t>::max();
+    std::vector<std::pair<uint64_t, int>> codes(points.size());
+#pragma omp parallel for schedule(static)
+    for (int idx = 0; idx < int(points.size()); ++idx) {
+        uint64_t code;
+        codes[idx] = std::make_pair(
+                ComputeLeafCode(points[idx], code) ? code : invalid_code, idx);
+    }
+    ParallelSort(codes);
+
+    std::vector<uint64_t> leaf_codes;
+    leaf_colors_.clear();
+    for (size_t i = 0; i < codes.size() && codes[i].first != invalid_code;
+         ++i) {
+        if (i + 1 < codes.size() && codes[i + 1].first == codes[i].first) {
+            continue;
+        }
+        leaf_codes.push_back(codes[i].first);
+        leaf_colors_.push_back(colors.empty() ? Eigen::Vector3d::Zero()
+                                              : colors[codes[i].second]);
+    }
+    BuildLevels(leaf_codes);
+}
+
+void LinearOctree::BuildLevels(const std::vector<uint64_t> &leaf_codes) {
+    nodes_.clear();
+    level_offsets_.assign(max_depth_ + 2, 0);
+    if (leaf_codes.empty()) {
+        return;
+    }
+    // Parents are found bottom-up, first_child_ is relative to the level
+    // below until the levels are concatenated.
+    std::vector<std::vector<Node>> levels(max_depth_ + 1);
+    levels[max_depth_].resize(leaf_codes.size());
+    for (size_t i = 0; i < leaf_codes.size(); ++i) {
+        levels[max_depth_][i] = {leaf_codes[i], int32_t(i), 0};
+    }
+    for (size_t depth = max_depth_; depth > 0; --depth) {
+        std::vector<Node> &parents = levels[depth - 1];
+        const std::vector<Node> &children = levels[depth];
+        for (size_t i = 0; i < children.size(); ++i) {
+            const uint64_t parent_code = children[i].code_ >> 3;
+            if (parents.empty() || parents.back().code_ != parent_code) {
+                parents.push_back({parent_code, int32_t(i), 0});
+            }
+            parents.back().child_mask_ |= uint8_t(1 << (children[i].code_ & 7));
+        }
+    }
+    for (size_t depth = 0; depth <= max_depth_; ++depth) {
+        level_offsets_[depth + 1] =
+                level_offsets_[depth] + levels[depth].size();
+    }
+    nodes_.reserve(level_offsets_[max_depth_ + 1]);
+    for (size_t depth = 0; depth <= max_depth_; ++depth) {
+        for (Node node : levels[depth]) {
+            if (depth < max_depth_) {
+                node.first_child_ += int32_t(level_offsets_[depth + 1]);
+            }
+            nodes_.push_back(node);
+        }
+    }
+}
+
+bool LinearOctree::ComputeLeafCode(const Eigen::Vector3d &point,
+                                   uint64_t &code) const {
+    // Same arithmetic as Octree::InsertPoint, so that points on child
+    // boundaries go to the same leaves.
+    if (!Octree::IsPointInBound(point, origin_, size_)) {
+        return false;
+    }
+    Eigen::Vector3d node_origin = origin_;
+    double node_size = size_;
+    code = 0;
+    for (size_t depth = 0; depth < max_depth_; ++depth) {
+        const double child_size = node_size / 2.0;
+        size_t x_index = point(0) < node_origin(0) + child_size ? 0 : 1;
+        size_t y_index = point(1) < node_origin(1) + child_size ? 0 : 1;
+        size_t z_index = point(2) < node_origin(2) + child_size ? 0 : 1;
+        node_origin = node_origin + Eigen::Vector3d(x_index * child_size,
+                                                    y_index * child_size,
+                                                    z_index * child_size);
+        node_size = child_size;
+        if (!Octree::IsPointInBound(point, node_origin, node_size)) {
+            return false;
+        }
+        code = (code << 3) | (x_index + y_index * 2 + z_index * 4);
+    }
+    return true;
+}
+
+void LinearOctree::GetNodeBounds(uint64_t code,
+                                 size_t depth,
+                                 Eigen::Vector3d &node_origin,
+                                 double &node_size) const {
+    node_origin = origin_;
+    node_size = size_;
+    for (size_t level = 1; level <= depth; ++level) {
+        const uint64_t child_index = (code >> (3 * (depth - level))) & 7;
+        node_size = node_size / 2.0;
+        node_origin = node_origin + Eigen::Vector3d(double(child_index & 1),
+                                                    double((child_index >> 1) &
+                                                           1),
+                                                    double(child_index >> 2)) *
+                                            node_size;
+    }
+}
+
+int LinearOctree::FindLeaf(uint64_t code) const {
+    if (nodes_.empty()) {
+        return -1;
+    }
+    auto begin = nodes_.begin() + level_offsets_[max_depth_];
+    auto end = nodes_.begin() + level_offsets_[max_depth_ + 1];
+    auto it = std::lower_bound(begin, end, code,
+                               [](const Node &node, uint64_t value) {
+                                   return node.code_ < value;
+                               });
+    return it != end && it->code_ == code ? it->first_child_ : -1;
+}
+
+std::shared_ptr<Octree> LinearOctree::ToOctree() const {
+    auto octree = std::make_shared<Octree>(max_depth_, origin_, size_);
+    if (!nodes_.empty()) {
+        octree->root_node_ = ToOctreeNode(*this, 0, 0);
+    }
+    return octree;
+}
+
+bool LinearOctree::ConvertToJsonValue(Json::Value &value) const {
+    return ToOctree()->ConvertToJsonValue(value);
+}
+
+bool LinearOctree::ConvertFromJsonValue(const Json::Value &value) {
+    Octree octree;
+    if (!octree.ConvertFromJsonValue(value)) {
+        return false;
+    }
+    *this = *CreateFromOctree(octree);
+    return true;
+}
+
+int LinearOctree::LocateLeaf(const Eigen::Vector3d &point) const {
+    uint64_t code;
+    return ComputeLeafCode(point, code) ? FindLeaf(code) : -1;
+}
+
+OctreeNodeInfo LinearOctree::GetLeafNodeInfo(int leaf_index) const {
+    const Node &leaf = nodes_[level_offsets_[max_depth_] + leaf_index];
+    Eigen::Vector3d node_origin;
+    double node_size;
+    GetNodeBounds(leaf.code_, max_depth_, node_origin, node_size);
+    return OctreeNodeInfo(node_origin, node_size, max_depth_,
+                          max_depth_ == 0 ? 0 : size_t(leaf.code_ & 7));
+}
+
+int LinearOctree::SearchNeighborLeaves(int leaf_index,
+                                       std::vector<int> &neighbors) const {
+    neighbors.clear();
+    const Node &leaf = nodes_[level_offsets_[max_depth_] + leaf_index];
+    const Eigen::Vector3i index = DecodeGridIndex(leaf.code_, max_depth_);
+    const int resolution = 1 << max_depth_;
+    for (int dz = -1; dz <= 1; ++dz) {
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                const Eigen::Vector3i neighbor_index =
+                        index + Eigen::Vector3i(dx, dy, dz);
+                if ((dx == 0 && dy == 0 && dz == 0) ||
+                    (neighbor_index.array() < 0).any() ||
+                    (neighbor_index.array() >= resolution).any()) {
+                    continue;
+                }
+                const int neighbor =
+                        FindLeaf(EncodeGridIndex(neighbor_index, max_depth_));
+                if (neighbor >= 0) {
+                    neighbors.push_back(neighbor);
+                }
+            }
+        }
+    }
+    return int(neighbors.size());
+}
+
+int LinearOctree::SearchAABB(const Eigen::Vector3d &min_bound,
+                             const Eigen::Vector3d &max_bound,
+                             std::vector<int> &leaf_indices) const {
+    leaf_indices.clear();
+    if (nodes_.empty()) {
+        return 0;
+    }
+    // Children are pushed in reverse, so leaves come out in Morton order.
+    std::vector<std::pair<size_t, size_t>> stack = {{0, 0}};
+    while (!stack.empty()) {
+        const size_t node_index = stack.back().first;
+        const size_t depth = stack.back().second;
+        stack.pop_back();
+        const Node &node = nodes_[node_index];
+        Eigen::Vector3d node_origin;
+        double node_size;
+        GetNodeBounds(node.code_, depth, node_origin, node_size);
+        if ((node_origin.array() > max_bound.array()).any() ||
+            (node_origin.array() + node_size < min_bound.array()).any()) {
+            continue;
+        }
+        if (depth == max_depth_) {
+            leaf_indices.push_back(node.first_child_);
+            continue;
+        }
+        const int num_children = CountChildren(node.child_mask_);
+        for (int i = num_children - 1; i >= 0; --i) {
+            stack.emplace_back(node.first_child_ + i, depth + 1);
+        }
+    }
+    return int(leaf_indices.size());
+}
+
+int LinearOctree::CastRay(const Eigen::Vector3d &origin,
+                          const Eigen::Vector3d &direction,
+                          double &t) const {
+    t = std::numeric_limits<double>::infinity();
+    if (nodes_.empty()) {
+        return -1;
+    }
+    const Eigen::Vector3d inv_direction = direction.cwiseInverse();
+    struct Entry {
+        size_t node_index_;
+        size_t depth_;
+        double t_enter_;
+    };
+    double t_enter;
+    if (!RayBox(origin, inv_direction, origin_,
+                origin_ + Eigen::Vector3d::Constant(size_), t_enter)) {
+        return -1;
+    }
+    // Children partition their parent, so visiting them in order of entry
+    // along the ray reaches the leaves front to back.
+    std::vector<Entry> stack = {{0, 0, t_enter}};
+    while (!stack.empty()) {
+        const Entry entry = stack.back();
+        stack.pop_back();
+        const Node &node = nodes_[entry.node_index_];
+        if (entry.depth_ == max_depth_) {
+            t = entry.t_enter_;
+            return node.first_child_;
+        }
+        Entry children[8];
+        int num_hit = 0;
+        const int num_children = CountChildren(node.child_mask_);
+        for (int i = 0; i < num_children; ++i) {
+            const size_t child_index = node.first_child_ + i;
+            Eigen::Vector3d child_origin;
+            double child_size;
+            GetNodeBounds(nodes_[child_index].code_, entry.depth_ + 1,
+                          child_origin, child_size);
+            if (RayBox(origin, inv_direction, child_origin,
+                       child_origin + Eigen::Vector3d::Constant(child_size),
+                       t_enter)) {
+                children[num_hit++] = {child_index, entry.depth_ + 1, t_enter};
+            }
+        }
+        std::sort(children, children + num_hit,
+                  [](const Entry &a, const Entry &b) {
+                      return a.t_enter_ > b.t_enter_;
+                  });
+        stack.insert(stack.end(), children, children + num_hit);
+    }
+    return -1;
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,184 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "open3d/geometry/Octree.h"
+#include "open3d/utility/IJsonConvertible.h"
+
+namespace open3d {
+namespace geometry {
+
+class PointCloud;
+
+/// \class LinearOctree
+///
+/// \brief Pointer-free octree with color leaves, stored level by level in
+/// Morton order.
+///
+/// Each node is identified by its Morton code, the concatenation of the
+/// child indices (see OctreeInternalNode) on the path from the root, three
+/// bits per level. The nodes of a level are sorted by code, so the children
+/// of a node are adjacent in the next level. Leaves are all at max_depth_,
+/// their colors are stored in leaf order.
+///
+/// Points are assigned to leaves exactly like Octree::InsertPoint does, so
+/// converting to an Octree gives the same tree as inserting the points one
+/// by one. The JSON format is the one of Octree.
+class LinearOctree : public utility::IJsonConvertible {
+public:
+    /// \brief Node of 16 bytes.
+    struct Node {
+        /// Morton code of the node, 3 bits per level below the root.
+        uint64_t code_;
+        /// Index of the first child in the nodes array for inner nodes,
+        /// index of the leaf for leaves.
+        int32_t first_child_;
+        /// Bit i is set if child i exists. 0 for leaves.
+        uint8_t child_mask_;
+    };
+
+    /// Maximum depth supported by 64-bit Morton codes.
+    static constexpr size_t kMaxDepth = 21;
+
+    /// \brief Default Constructor.
+    LinearOctree() : origin_(0, 0, 0), size_(0), max_depth_(0) {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_depth Sets the value of the max depth of the octree.
+    /// \param origin Sets the global min bound of the octree.
+    /// \param size Sets the outer bounding box edge size for the whole octree.
+    LinearOctree(size_t max_depth, const Eigen::Vector3d &origin, double size);
+    ~LinearOctree() override {}
+
+public:
+    /// \brief Factory function to create an octree from a point cloud with
+    /// the same bounds as Octree::ConvertFromPointCloud.
+    ///
+    /// \param point_cloud Input point cloud.
+    /// \param max_depth Max depth of the octree.
+    /// \param size_expand A small expansion size such that the octree is
+    /// slightly bigger than the original point cloud bounds to accomodate all
+    /// points.
+    static std::shared_ptr<LinearOctree> CreateFromPointCloud(
+            const PointCloud &point_cloud,
+            size_t max_depth,
+            double size_expand = 0.01);
+
+    /// \brief Factory function to create an octree from an Octree with
+    /// OctreeColorLeafNode leaves at max depth.
+    static std::shared_ptr<LinearOctree> CreateFromOctree(const Octree &octree);
+
+    /// \brief Replaces the leaves with the given points, keeping the bounds.
+    ///
+    /// Codes are computed and sorted in parallel. When several points fall
+    /// into the same leaf, the color of the last one is kept. Points out of
+    /// bounds are ignored.
+    ///
+    /// \param points Coordinates of the points.
+    /// \param colors Colors of the points, may be empty.
+    void SetPoints(const std::vector<Eigen::Vector3d> &points,
+                   const std::vector<Eigen::Vector3d> &colors);
+
+    /// Converts to the shared pointer based Octree.
+    std::shared_ptr<Octree> ToOctree() const;
+
+    bool ConvertToJsonValue(Json::Value &value) const override;
+    bool ConvertFromJsonValue(const Json::Value &value) override;
+
+    bool IsEmpty() const { return nodes_.empty(); }
+    size_t NumLeaves() const { return leaf_colors_.size(); }
+
+    /// Returns all nodes, level by level. The root is the first node.
+    const std::vector<Node> &GetNodes() const { return nodes_; }
+    /// Returns the index of the first node of \p depth, for depth 0 to
+    /// max_depth_ + 1.
+    size_t GetLevelOffset(size_t depth) const { return level_offsets_[depth]; }
+
+    /// Returns the index of the leaf containing \p point, -1 if none.
+    int LocateLeaf(const Eigen::Vector3d &point) const;
+
+    /// Returns the origin, size, depth and child index of a leaf.
+    OctreeNodeInfo GetLeafNodeInfo(int leaf_index) const;
+
+    /// \brief Finds the existing leaves among the 26 neighbours of a leaf.
+    ///
+    /// \return The number of neighbours found.
+    int SearchNeighborLeaves(int leaf_index, std::vector<int> &neighbors) const;
+
+    /// \brief Finds all leaves overlapping the box given by \p min_bound and
+    /// \p max_bound, in Morton order.
+    ///
+    /// \return The number of leaves found.
+    int SearchAABB(const Eigen::Vector3d &min_bound,
+                   const Eigen::Vector3d &max_bound,
+                   std::vector<int> &leaf_indices) const;
+
+    /// \brief Returns the first leaf hit by the ray origin + t * direction,
+    /// t >= 0, or -1. \p t is set to the ray parameter where the ray enters
+    /// the leaf.
+    int CastRay(const Eigen::Vector3d &origin,
+                const Eigen::Vector3d &direction,
+                double &t) const;
+
+public:
+    /// Global min bound (include). A point is within bound iff
+    /// origin_ <= point < origin_ + size_.
+    Eigen::Vector3d origin_;
+    /// Outer bounding box edge size for the whole octree.
+    double size_;
+    /// Depth of the leaves, the root has depth 0.
+    size_t max_depth_;
+    /// Color of each leaf, in leaf order.
+    std::vector<Eigen::Vector3d> leaf_colors_;
+
+private:
+    /// Builds the inner levels from the sorted leaf codes.
+    void BuildLevels(const std::vector<uint64_t> &leaf_codes);
+
+    /// Computes the leaf code of \p point, returns false if out of bounds.
+    bool ComputeLeafCode(const Eigen::Vector3d &point, uint64_t &code) const;
+
+    /// Returns the min bound and size of the node with \p code at \p depth.
+    void GetNodeBounds(uint64_t code,
+                       size_t depth,
+                       Eigen::Vector3d &node_origin,
+                       double &node_size) const;
+
+    /// Returns the index of the leaf with \p code, -1 if it does not exist.
+    int FindLeaf(uint64_t code) const;
+
+    std::vector<Node> nodes_;
+    std::vector<size_t> level_offsets_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
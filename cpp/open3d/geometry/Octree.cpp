@@ -33,6 +33,7 @@
 #include <unordered_map>
 
 #include "open3d/geometry/BoundingVolume.h"
+#include "open3d/geometry/LinearOctree.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/VoxelGrid.h"
 #include "open3d/utility/Console.h"
@@ -411,13 +412,11 @@ void Octree::ConvertFromPointCloud(const geometry::PointCloud& point_cloud,
         size_ = max_half_size * 2 * (1 + size_expand);
     }
 
-    // Insert points
-    for (size_t idx = 0; idx < point_cloud.points_.size(); idx++) {
-        InsertPoint(point_cloud.points_[idx],
-                    geometry::OctreeColorLeafNode::GetInitFunction(),
-                    geometry::OctreeColorLeafNode::GetUpdateFunction(
-                            point_cloud.colors_[idx]));
-    }
+    // Sorting the Morton codes of the points gives the same leaves as
+    // inserting them one by one, without a tree walk per point.
+    LinearOctree linear_octree(max_depth_, origin_, size_);
+    linear_octree.SetPoints(point_cloud.points_, point_cloud.colors_);
+    root_node_ = linear_octree.ToOctree()->root_node_;
 }
 
 void Octree::InsertPoint(
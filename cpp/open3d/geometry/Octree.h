@@ -229,6 +229,10 @@ public:
 public:
     /// \brief Convert octree from point cloud.
     ///
+    /// The leaves are computed by sorting the Morton codes of the points in
+    /// parallel, see LinearOctree. Use LinearOctree directly to avoid building
+    /// the pointer based tree.
+    ///
     /// \param point_cloud Input point cloud.
     /// \param size_expand A small expansion size such that the octree is
     /// slightly bigger than the original point cloud bounds to accomodate all
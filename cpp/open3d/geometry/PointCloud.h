@@ -279,7 +279,12 @@ public:
     /// in Large Spatial Databases with Noise", 1996
     ///
     /// Returns a list of point labels, -1 indicates noise according to
-    /// the algorithm.
+    /// the algorithm. Clusters are numbered in order of their first core
+    /// point and border points join the neighbouring cluster with the
+    /// smallest label, so the labels are deterministic.
+    ///
+    /// Points are bucketed into a grid with cell diagonal \p eps and core
+    /// cells are merged in parallel, no neighbourhoods are stored.
     ///
     /// \param eps Density parameter that is used to find neighbouring points.
     /// \param min_points Minimum number of points to form a cluster.
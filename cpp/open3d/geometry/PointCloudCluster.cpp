@@ -25,82 +25,335 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
-#include <unordered_set>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <unordered_map>
 
-#include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Helper.h"
 
 namespace open3d {
 namespace geometry {
 
-std::vector<int> PointCloud::ClusterDBSCAN(double eps,
-                                           size_t min_points,
-                                           bool print_progress) const {
-    KDTreeFlann kdtree(*this);
-
-    // precompute all neighbours
-    utility::LogDebug("Precompute Neighbours");
-    utility::ConsoleProgressBar progress_bar(
-            points_.size(), "Precompute Neighbours", print_progress);
-    std::vector<std::vector<int>> nbs(points_.size());
-#pragma omp parallel for schedule(static)
-    for (int idx = 0; idx < int(points_.size()); ++idx) {
-        std::vector<double> dists2;
-        kdtree.SearchRadius(points_[idx], eps, nbs[idx], dists2);
+namespace {
 
-#pragma omp critical
-        { ++progress_bar; }
+/// Lock-free union-find over grid cells. Roots are only ever linked below
+/// smaller roots, so concurrent Unite calls produce the same partition
+/// regardless of the order in which they are executed.
+class AtomicUnionFind {
+public:
+    explicit AtomicUnionFind(int size) : parent_(size) {
+        for (int i = 0; i < size; ++i) {
+            parent_[i].store(i, std::memory_order_relaxed);
+        }
     }
-    utility::LogDebug("Done Precompute Neighbours");
 
-    // set all labels to undefined (-2)
-    utility::LogDebug("Compute Clusters");
-    progress_bar.reset(points_.size(), "Clustering", print_progress);
-    std::vector<int> labels(points_.size(), -2);
-    int cluster_label = 0;
-    for (size_t idx = 0; idx < points_.size(); ++idx) {
-        if (labels[idx] != -2) {  // label is not undefined
-            continue;
+    int Find(int x) {
+        int p = parent_[x].load();
+        while (p != x) {
+            // Path halving, a failed exchange is harmless.
+            int gp = parent_[p].load();
+            if (gp != p) {
+                parent_[x].compare_exchange_weak(p, gp);
+            }
+            x = p;
+            p = parent_[x].load();
         }
+        return x;
+    }
 
-        // check density
-        if (nbs[idx].size() < min_points) {
-            labels[idx] = -1;
-            continue;
+    void Unite(int a, int b) {
+        while (true) {
+            a = Find(a);
+            b = Find(b);
+            if (a == b) {
+                return;
+            }
+            if (a > b) {
+                std::swap(a, b);
+            }
+            int expected = b;
+            if (parent_[b].compare_exchange_strong(expected, a)) {
+                return;
+            }
         }
+    }
 
-        std::unordered_set<int> nbs_next(nbs[idx].begin(), nbs[idx].end());
-        std::unordered_set<int> nbs_visited;
-        nbs_visited.insert(int(idx));
+private:
+    std::vector<std::atomic<int>> parent_;
+};
 
-        labels[idx] = cluster_label;
-        ++progress_bar;
-        while (!nbs_next.empty()) {
-            int nb = *nbs_next.begin();
-            nbs_next.erase(nbs_next.begin());
-            nbs_visited.insert(nb);
+}  // unnamed namespace
 
-            if (labels[nb] == -1) {  // noise label
-                labels[nb] = cluster_label;
-                ++progress_bar;
+std::vector<int> PointCloud::ClusterDBSCAN(double eps,
+                                           size_t min_points,
+                                           bool print_progress) const {
+    const int num_points = int(points_.size());
+    std::vector<int> labels(num_points, -1);
+    if (num_points == 0) {
+        return labels;
+    }
+    if (eps <= 0) {
+        // No point has any neighbours within eps, not even itself.
+        if (min_points == 0) {
+            for (int idx = 0; idx < num_points; ++idx) {
+                labels[idx] = idx;
             }
-            if (labels[nb] != -2) {  // not undefined label
-                continue;
+        }
+        return labels;
+    }
+
+    // Bucket the points into a grid with cell diagonal eps, so that all
+    // points sharing a cell are neighbours of each other. Cells are numbered
+    // in order of their first point and list their points in index order.
+    utility::LogDebug("Compute Grid");
+    const double cell_size = eps / std::sqrt(3.0);
+    const double eps2 = eps * eps;
+    const Eigen::Vector3d min_bound = GetMinBound();
+    std::unordered_map<Eigen::Vector3i, int,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            cell_map;
+    std::vector<Eigen::Vector3i> cell_keys;
+    std::vector<int> point_cell(num_points);
+    for (int idx = 0; idx < num_points; ++idx) {
+        Eigen::Vector3i key = ((points_[idx] - min_bound) / cell_size)
+                                      .array()
+                                      .floor()
+                                      .cast<int>();
+        auto it = cell_map.emplace(key, int(cell_keys.size()));
+        if (it.second) {
+            cell_keys.push_back(key);
+        }
+        point_cell[idx] = it.first->second;
+    }
+    const int num_cells = int(cell_keys.size());
+    std::vector<int> cell_begin(num_cells + 1, 0);
+    for (int idx = 0; idx < num_points; ++idx) {
+        cell_begin[point_cell[idx] + 1]++;
+    }
+    for (int c = 0; c < num_cells; ++c) {
+        cell_begin[c + 1] += cell_begin[c];
+    }
+    std::vector<int> cell_points(num_points);
+    {
+        std::vector<int> cell_fill(cell_begin.begin(), cell_begin.end() - 1);
+        for (int idx = 0; idx < num_points; ++idx) {
+            cell_points[cell_fill[point_cell[idx]]++] = idx;
+        }
+    }
+
+    // Points within eps of each other are at most two cells apart along
+    // each axis. Sorting the cells into columns along z finds all cells of
+    // such a 5x5x5 block with one lookup per column.
+    cell_map.clear();
+    std::vector<int> sorted_cells(num_cells);
+    for (int c = 0; c < num_cells; ++c) {
+        sorted_cells[c] = c;
+    }
+    std::sort(sorted_cells.begin(), sorted_cells.end(), [&](int a, int b) {
+        return std::lexicographical_compare(
+                cell_keys[a].data(), cell_keys[a].data() + 3,
+                cell_keys[b].data(), cell_keys[b].data() + 3);
+    });
+    std::unordered_map<Eigen::Vector2i, std::pair<int, int>,
+                       utility::hash_eigen<Eigen::Vector2i>>
+            columns;
+    for (int begin = 0, end = 0; begin < num_cells; begin = end) {
+        const Eigen::Vector2i column = cell_keys[sorted_cells[begin]].head<2>();
+        while (end < num_cells &&
+               cell_keys[sorted_cells[end]].head<2>() == column) {
+            ++end;
+        }
+        columns.emplace(column, std::make_pair(begin, end));
+    }
+    auto get_neighbour_cells = [&](int c, std::vector<int> &nb_cells) {
+        nb_cells.clear();
+        const Eigen::Vector3i &key = cell_keys[c];
+        for (int dx = -2; dx <= 2; ++dx) {
+            for (int dy = -2; dy <= 2; ++dy) {
+                auto it = columns.find(
+                        Eigen::Vector2i(key(0) + dx, key(1) + dy));
+                if (it == columns.end()) {
+                    continue;
+                }
+                auto nb = std::lower_bound(
+                        sorted_cells.begin() + it->second.first,
+                        sorted_cells.begin() + it->second.second,
+                        key(2) - 2, [&](int cell, int z) {
+                            return cell_keys[cell](2) < z;
+                        });
+                auto nb_end = sorted_cells.begin() + it->second.second;
+                for (; nb != nb_end && cell_keys[*nb](2) <= key(2) + 2; ++nb) {
+                    nb_cells.push_back(*nb);
+                }
             }
-            labels[nb] = cluster_label;
-            ++progress_bar;
+        }
+    };
 
-            if (nbs[nb].size() >= min_points) {
-                for (int qnb : nbs[nb]) {
-                    if (nbs_visited.count(qnb) == 0) {
-                        nbs_next.insert(qnb);
+    // A point is a core point if at least min_points points, including
+    // itself, lie within eps. Counting stops as soon as the threshold is hit.
+    utility::LogDebug("Compute Core Points");
+    utility::ConsoleProgressBar progress_bar(num_cells, "Find Core Points",
+                                             print_progress);
+    std::vector<uint8_t> is_core(num_points, 0);
+    std::vector<uint8_t> cell_has_core(num_cells, 0);
+#pragma omp parallel
+    {
+        std::vector<int> nb_cells;
+#pragma omp for schedule(dynamic, 64)
+        for (int c = 0; c < num_cells; ++c) {
+            const int begin = cell_begin[c];
+            const int end = cell_begin[c + 1];
+            if (size_t(end - begin) >= min_points) {
+                for (int k = begin; k < end; ++k) {
+                    is_core[cell_points[k]] = 1;
+                }
+                cell_has_core[c] = 1;
+            } else {
+                get_neighbour_cells(c, nb_cells);
+                for (int k = begin; k < end; ++k) {
+                    const Eigen::Vector3d &p = points_[cell_points[k]];
+                    size_t count = size_t(end - begin);
+                    for (size_t n = 0;
+                         n < nb_cells.size() && count < min_points; ++n) {
+                        if (nb_cells[n] == c) {
+                            continue;
+                        }
+                        for (int l = cell_begin[nb_cells[n]];
+                             l < cell_begin[nb_cells[n] + 1] &&
+                             count < min_points;
+                             ++l) {
+                            if ((points_[cell_points[l]] - p).squaredNorm() <
+                                eps2) {
+                                ++count;
+                            }
+                        }
                     }
+                    if (count >= min_points) {
+                        is_core[cell_points[k]] = 1;
+                        cell_has_core[c] = 1;
+                    }
+                }
+            }
+            if (print_progress) {
+#pragma omp critical
+                { ++progress_bar; }
+            }
+        }
+    }
+
+    // Merge neighbouring cells that have a pair of core points within eps.
+    // All core points of a cell are neighbours, so the cells' connected
+    // components are exactly the clusters.
+    utility::LogDebug("Merge Core Cells");
+    progress_bar.reset(num_cells, "Merge Core Cells", print_progress);
+    AtomicUnionFind cells_union(num_cells);
+#pragma omp parallel
+    {
+        std::vector<int> nb_cells;
+#pragma omp for schedule(dynamic, 64)
+        for (int c = 0; c < num_cells; ++c) {
+            if (cell_has_core[c]) {
+                get_neighbour_cells(c, nb_cells);
+                for (int nc : nb_cells) {
+                    if (nc <= c || !cell_has_core[nc] ||
+                        cells_union.Find(c) == cells_union.Find(nc)) {
+                        continue;
+                    }
+                    bool connected = false;
+                    for (int k = cell_begin[c];
+                         k < cell_begin[c + 1] && !connected; ++k) {
+                        if (!is_core[cell_points[k]]) {
+                            continue;
+                        }
+                        const Eigen::Vector3d &p = points_[cell_points[k]];
+                        for (int l = cell_begin[nc];
+                             l < cell_begin[nc + 1] && !connected; ++l) {
+                            connected = is_core[cell_points[l]] &&
+                                        (points_[cell_points[l]] - p)
+                                                        .squaredNorm() < eps2;
+                        }
+                    }
+                    if (connected) {
+                        cells_union.Unite(c, nc);
+                    }
+                }
+            }
+            if (print_progress) {
+#pragma omp critical
+                { ++progress_bar; }
+            }
+        }
+    }
+
+    // Number the clusters in order of their first core point, which gives
+    // the same labels as a sequential scan over the points.
+    std::vector<int> cell_label(num_cells, -1);
+    std::vector<int> root_label(num_cells, -1);
+    int cluster_label = 0;
+    for (int idx = 0; idx < num_points; ++idx) {
+        if (is_core[idx]) {
+            const int c = point_cell[idx];
+            if (cell_label[c] < 0) {
+                int &label = root_label[cells_union.Find(c)];
+                if (label < 0) {
+                    label = cluster_label++;
                 }
+                cell_label[c] = label;
             }
+            labels[idx] = cell_label[c];
         }
+    }
 
-        cluster_label++;
+    // Border points join the cluster with the smallest label among their
+    // neighbouring core points, all other points remain noise.
+    utility::LogDebug("Assign Border Points");
+    progress_bar.reset(num_cells, "Assign Border Points", print_progress);
+#pragma omp parallel
+    {
+        std::vector<int> nb_cells;
+#pragma omp for schedule(dynamic, 64)
+        for (int c = 0; c < num_cells; ++c) {
+            const int begin = cell_begin[c];
+            const int end = cell_begin[c + 1];
+            bool has_border = false;
+            for (int k = begin; k < end && !has_border; ++k) {
+                has_border = !is_core[cell_points[k]];
+            }
+            if (has_border) {
+                get_neighbour_cells(c, nb_cells);
+                for (int k = begin; k < end; ++k) {
+                    const int idx = cell_points[k];
+                    if (is_core[idx]) {
+                        continue;
+                    }
+                    const Eigen::Vector3d &p = points_[idx];
+                    int label = cell_label[c];
+                    for (int nc : nb_cells) {
+                        if (cell_label[nc] < 0 ||
+                            (label >= 0 && cell_label[nc] >= label)) {
+                            continue;
+                        }
+                        for (int l = cell_begin[nc]; l < cell_begin[nc + 1];
+                             ++l) {
+                            if (is_core[cell_points[l]] &&
+                                (points_[cell_points[l]] - p).squaredNorm() <
+                                        eps2) {
+                                label = cell_label[nc];
+                                break;
+                            }
+                        }
+                    }
+                    labels[idx] = label;
+                }
+            }
+            if (print_progress) {
+#pragma omp critical
+                { ++progress_bar; }
+            }
+        }
     }
 
     utility::LogDebug("Done Compute Clusters: {:d}", cluster_label);
@@ -25,8 +25,9 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
-#include <iostream>
-#include <list>
+#include <algorithm>
+#include <deque>
+#include <numeric>
 
 #include "open3d/geometry/IntersectionTest.h"
 #include "open3d/geometry/KDTreeFlann.h"
@@ -37,30 +38,17 @@
 namespace open3d {
 namespace geometry {
 
-class BallPivotingVertex;
-class BallPivotingEdge;
-class BallPivotingTriangle;
-
-typedef BallPivotingVertex* BallPivotingVertexPtr;
-typedef std::shared_ptr<BallPivotingEdge> BallPivotingEdgePtr;
-typedef std::shared_ptr<BallPivotingTriangle> BallPivotingTrianglePtr;
+// Vertices, edges and triangles are stored in pools owned by BallPivoting and
+// refer to each other by their index in the pools.
 
 class BallPivotingVertex {
 public:
     enum Type { Orphan = 0, Front = 1, Inner = 2 };
 
-    BallPivotingVertex(int idx,
-                       const Eigen::Vector3d& point,
-                       const Eigen::Vector3d& normal)
-        : idx_(idx), point_(point), normal_(normal), type_(Orphan) {}
-
-    void UpdateType();
+    BallPivotingVertex() : type_(Orphan) {}
 
 public:
-    int idx_;
-    const Eigen::Vector3d& point_;
-    const Eigen::Vector3d& normal_;
-    std::unordered_set<BallPivotingEdgePtr> edges_;
+    std::vector<int> edges_;
     Type type_;
 };
 
@@ -68,123 +56,58 @@ class BallPivotingEdge {
 public:
     enum Type { Border = 0, Front = 1, Inner = 2 };
 
-    BallPivotingEdge(BallPivotingVertexPtr source, BallPivotingVertexPtr target)
-        : source_(source), target_(target), type_(Type::Front) {}
-
-    void AddAdjacentTriangle(BallPivotingTrianglePtr triangle);
-    BallPivotingVertexPtr GetOppositeVertex();
+    BallPivotingEdge(int source, int target)
+        : source_(source),
+          target_(target),
+          triangle0_(-1),
+          triangle1_(-1),
+          type_(Type::Front) {}
 
 public:
-    BallPivotingVertexPtr source_;
-    BallPivotingVertexPtr target_;
-    BallPivotingTrianglePtr triangle0_;
-    BallPivotingTrianglePtr triangle1_;
+    int source_;
+    int target_;
+    int triangle0_;
+    int triangle1_;
     Type type_;
 };
 
 class BallPivotingTriangle {
 public:
-    BallPivotingTriangle(BallPivotingVertexPtr vert0,
-                         BallPivotingVertexPtr vert1,
-                         BallPivotingVertexPtr vert2,
-                         Eigen::Vector3d ball_center)
+    BallPivotingTriangle(int vert0,
+                         int vert1,
+                         int vert2,
+                         const Eigen::Vector3d& ball_center)
         : vert0_(vert0),
           vert1_(vert1),
           vert2_(vert2),
           ball_center_(ball_center) {}
 
 public:
-    BallPivotingVertexPtr vert0_;
-    BallPivotingVertexPtr vert1_;
-    BallPivotingVertexPtr vert2_;
+    int vert0_;
+    int vert1_;
+    int vert2_;
     Eigen::Vector3d ball_center_;
 };
 
-void BallPivotingVertex::UpdateType() {
-    if (edges_.empty()) {
-        type_ = Type::Orphan;
-    } else {
-        for (const BallPivotingEdgePtr& edge : edges_) {
-            if (edge->type_ != BallPivotingEdge::Type::Inner) {
-                type_ = Type::Front;
-                return;
-            }
-        }
-        type_ = Type::Inner;
-    }
-}
-
-void BallPivotingEdge::AddAdjacentTriangle(BallPivotingTrianglePtr triangle) {
-    if (triangle != triangle0_ && triangle != triangle1_) {
-        if (triangle0_ == nullptr) {
-            triangle0_ = triangle;
-            type_ = Type::Front;
-            // update orientation
-            BallPivotingVertexPtr opp = GetOppositeVertex();
-            Eigen::Vector3d tr_norm =
-                    (target_->point_ - source_->point_)
-                            .cross(opp->point_ - source_->point_);
-            tr_norm /= tr_norm.norm();
-            Eigen::Vector3d pt_norm =
-                    source_->normal_ + target_->normal_ + opp->normal_;
-            pt_norm /= pt_norm.norm();
-            if (pt_norm.dot(tr_norm) < 0) {
-                std::swap(target_, source_);
-            }
-        } else if (triangle1_ == nullptr) {
-            triangle1_ = triangle;
-            type_ = Type::Inner;
-        } else {
-            utility::LogDebug("!!! This case should not happen");
-        }
-    }
-}
-
-BallPivotingVertexPtr BallPivotingEdge::GetOppositeVertex() {
-    if (triangle0_ != nullptr) {
-        if (triangle0_->vert0_->idx_ != source_->idx_ &&
-            triangle0_->vert0_->idx_ != target_->idx_) {
-            return triangle0_->vert0_;
-        } else if (triangle0_->vert1_->idx_ != source_->idx_ &&
-                   triangle0_->vert1_->idx_ != target_->idx_) {
-            return triangle0_->vert1_;
-        } else {
-            return triangle0_->vert2_;
-        }
-    } else {
-        return nullptr;
-    }
-}
-
 class BallPivoting {
 public:
     BallPivoting(const PointCloud& pcd)
-        : has_normals_(pcd.HasNormals()), kdtree_(pcd) {
-        mesh_ = std::make_shared<TriangleMesh>();
-        mesh_->vertices_ = pcd.points_;
-        mesh_->vertex_normals_ = pcd.normals_;
-        mesh_->vertex_colors_ = pcd.colors_;
-        for (size_t vidx = 0; vidx < pcd.points_.size(); ++vidx) {
-            vertices.emplace_back(new BallPivotingVertex(static_cast<int>(vidx),
-                                                         pcd.points_[vidx],
-                                                         pcd.normals_[vidx]));
-        }
-    }
+        : has_normals_(pcd.HasNormals()),
+          kdtree_(pcd),
+          points_(pcd.points_),
+          normals_(pcd.normals_),
+          vertices_(pcd.points_.size()) {}
 
-    virtual ~BallPivoting() {
-        for (auto vert : vertices) {
-            delete vert;
-        }
-    }
+    virtual ~BallPivoting() {}
 
     bool ComputeBallCenter(int vidx1,
                            int vidx2,
                            int vidx3,
                            double radius,
-                           Eigen::Vector3d& center) {
-        const Eigen::Vector3d& v1 = vertices[vidx1]->point_;
-        const Eigen::Vector3d& v2 = vertices[vidx2]->point_;
-        const Eigen::Vector3d& v3 = vertices[vidx3]->point_;
+                           Eigen::Vector3d& center) const {
+        const Eigen::Vector3d& v1 = points_[vidx1];
+        const Eigen::Vector3d& v2 = points_[vidx2];
+        const Eigen::Vector3d& v3 = points_[vidx3];
         double c = (v2 - v1).squaredNorm();
         double b = (v1 - v3).squaredNorm();
         double a = (v3 - v2).squaredNorm();
@@ -215,9 +138,8 @@ public:
         if (height >= 0.0) {
             Eigen::Vector3d tr_norm = (v2 - v1).cross(v3 - v1);
             tr_norm /= tr_norm.norm();
-            Eigen::Vector3d pt_norm = vertices[vidx1]->normal_ +
-                                      vertices[vidx2]->normal_ +
-                                      vertices[vidx3]->normal_;
+            Eigen::Vector3d pt_norm =
+                    normals_[vidx1] + normals_[vidx2] + normals_[vidx3];
             pt_norm /= pt_norm.norm();
             if (tr_norm.dot(pt_norm) < 0) {
                 tr_norm *= -1;
@@ -230,72 +152,111 @@ public:
         return false;
     }
 
-    BallPivotingEdgePtr GetLinkingEdge(const BallPivotingVertexPtr& v0,
-                                       const BallPivotingVertexPtr& v1) {
-        for (BallPivotingEdgePtr edge0 : v0->edges_) {
-            for (BallPivotingEdgePtr edge1 : v1->edges_) {
-                if (edge0->source_->idx_ == edge1->source_->idx_ &&
-                    edge0->target_->idx_ == edge1->target_->idx_) {
-                    return edge0;
+    void UpdateVertexType(int vidx) {
+        BallPivotingVertex& vertex = vertices_[vidx];
+        if (vertex.edges_.empty()) {
+            vertex.type_ = BallPivotingVertex::Type::Orphan;
+        } else {
+            for (int eidx : vertex.edges_) {
+                if (edges_[eidx].type_ != BallPivotingEdge::Type::Inner) {
+                    vertex.type_ = BallPivotingVertex::Type::Front;
+                    return;
                 }
             }
+            vertex.type_ = BallPivotingVertex::Type::Inner;
         }
-        return nullptr;
     }
 
-    void CreateTriangle(const BallPivotingVertexPtr& v0,
-                        const BallPivotingVertexPtr& v1,
-                        const BallPivotingVertexPtr& v2,
-                        const Eigen::Vector3d& center) {
-        utility::LogDebug(
-                "[CreateTriangle] with v0.idx={}, v1.idx={}, v2.idx={}",
-                v0->idx_, v1->idx_, v2->idx_);
-        BallPivotingTrianglePtr triangle =
-                std::make_shared<BallPivotingTriangle>(v0, v1, v2, center);
-
-        BallPivotingEdgePtr e0 = GetLinkingEdge(v0, v1);
-        if (e0 == nullptr) {
-            e0 = std::make_shared<BallPivotingEdge>(v0, v1);
-        }
-        e0->AddAdjacentTriangle(triangle);
-        v0->edges_.insert(e0);
-        v1->edges_.insert(e0);
-
-        BallPivotingEdgePtr e1 = GetLinkingEdge(v1, v2);
-        if (e1 == nullptr) {
-            e1 = std::make_shared<BallPivotingEdge>(v1, v2);
-        }
-        e1->AddAdjacentTriangle(triangle);
-        v1->edges_.insert(e1);
-        v2->edges_.insert(e1);
-
-        BallPivotingEdgePtr e2 = GetLinkingEdge(v2, v0);
-        if (e2 == nullptr) {
-            e2 = std::make_shared<BallPivotingEdge>(v2, v0);
-        }
-        e2->AddAdjacentTriangle(triangle);
-        v2->edges_.insert(e2);
-        v0->edges_.insert(e2);
-
-        v0->UpdateType();
-        v1->UpdateType();
-        v2->UpdateType();
-
-        Eigen::Vector3d face_normal =
-                ComputeFaceNormal(v0->point_, v1->point_, v2->point_);
-        if (face_normal.dot(v0->normal_) > -1e-16) {
-            mesh_->triangles_.emplace_back(
-                    Eigen::Vector3i(v0->idx_, v1->idx_, v2->idx_));
+    int GetOppositeVertex(int eidx) const {
+        const BallPivotingEdge& edge = edges_[eidx];
+        if (edge.triangle0_ >= 0) {
+            const BallPivotingTriangle& triangle = triangles_[edge.triangle0_];
+            if (triangle.vert0_ != edge.source_ &&
+                triangle.vert0_ != edge.target_) {
+                return triangle.vert0_;
+            } else if (triangle.vert1_ != edge.source_ &&
+                       triangle.vert1_ != edge.target_) {
+                return triangle.vert1_;
+            } else {
+                return triangle.vert2_;
+            }
         } else {
-            mesh_->triangles_.emplace_back(
-                    Eigen::Vector3i(v0->idx_, v2->idx_, v1->idx_));
+            return -1;
+        }
+    }
+
+    void AddAdjacentTriangle(int eidx, int tidx) {
+        BallPivotingEdge& edge = edges_[eidx];
+        if (tidx != edge.triangle0_ && tidx != edge.triangle1_) {
+            if (edge.triangle0_ < 0) {
+                edge.triangle0_ = tidx;
+                edge.type_ = BallPivotingEdge::Type::Front;
+                // update orientation
+                int opp = GetOppositeVertex(eidx);
+                Eigen::Vector3d tr_norm =
+                        (points_[edge.target_] - points_[edge.source_])
+                                .cross(points_[opp] - points_[edge.source_]);
+                tr_norm /= tr_norm.norm();
+                Eigen::Vector3d pt_norm = normals_[edge.source_] +
+                                          normals_[edge.target_] +
+                                          normals_[opp];
+                pt_norm /= pt_norm.norm();
+                if (pt_norm.dot(tr_norm) < 0) {
+                    std::swap(edge.target_, edge.source_);
+                }
+            } else if (edge.triangle1_ < 0) {
+                edge.triangle1_ = tidx;
+                edge.type_ = BallPivotingEdge::Type::Inner;
+            } else {
+                utility::LogDebug("!!! This case should not happen");
+            }
+        }
+    }
+
+    /// Returns the edge between \p v0 and \p v1, or -1.
+    int GetLinkingEdge(int v0, int v1) const {
+        for (int eidx : vertices_[v0].edges_) {
+            const BallPivotingEdge& edge = edges_[eidx];
+            if (edge.source_ == v1 || edge.target_ == v1) {
+                return eidx;
+            }
+        }
+        return -1;
+    }
+
+    /// Returns the edge between \p v0 and \p v1, which is created if needed,
+    /// and adds the triangle \p tidx to it.
+    int LinkEdge(int v0, int v1, int tidx) {
+        int eidx = GetLinkingEdge(v0, v1);
+        if (eidx < 0) {
+            eidx = int(edges_.size());
+            edges_.emplace_back(v0, v1);
+            vertices_[v0].edges_.push_back(eidx);
+            vertices_[v1].edges_.push_back(eidx);
         }
-        mesh_->triangle_normals_.push_back(face_normal);
+        AddAdjacentTriangle(eidx, tidx);
+        return eidx;
+    }
+
+    void CreateTriangle(int v0, int v1, int v2, const Eigen::Vector3d& center) {
+        utility::LogDebug(
+                "[CreateTriangle] with v0.idx={}, v1.idx={}, v2.idx={}", v0,
+                v1, v2);
+        const int tidx = int(triangles_.size());
+        triangles_.emplace_back(v0, v1, v2, center);
+
+        LinkEdge(v0, v1, tidx);
+        LinkEdge(v1, v2, tidx);
+        LinkEdge(v2, v0, tidx);
+
+        UpdateVertexType(v0);
+        UpdateVertexType(v1);
+        UpdateVertexType(v2);
     }
 
     Eigen::Vector3d ComputeFaceNormal(const Eigen::Vector3d& v0,
                                       const Eigen::Vector3d& v1,
-                                      const Eigen::Vector3d& v2) {
+                                      const Eigen::Vector3d& v2) const {
         Eigen::Vector3d normal = (v1 - v0).cross(v2 - v0);
         double norm = normal.norm();
         if (norm > 0) {
@@ -304,121 +265,84 @@ public:
         return normal;
     }
 
-    bool IsCompatible(const BallPivotingVertexPtr& v0,
-                      const BallPivotingVertexPtr& v1,
-                      const BallPivotingVertexPtr& v2) {
+    bool IsCompatible(int v0, int v1, int v2) const {
         utility::LogDebug("[IsCompatible] v0.idx={}, v1.idx={}, v2.idx={}",
-                          v0->idx_, v1->idx_, v2->idx_);
+                          v0, v1, v2);
         Eigen::Vector3d normal =
-                ComputeFaceNormal(v0->point_, v1->point_, v2->point_);
-        if (normal.dot(v0->normal_) < -1e-16) {
+                ComputeFaceNormal(points_[v0], points_[v1], points_[v2]);
+        if (normal.dot(normals_[v0]) < -1e-16) {
             normal *= -1;
         }
-        bool ret = normal.dot(v0->normal_) > -1e-16 &&
-                   normal.dot(v1->normal_) > -1e-16 &&
-                   normal.dot(v2->normal_) > -1e-16;
+        bool ret = normal.dot(normals_[v0]) > -1e-16 &&
+                   normal.dot(normals_[v1]) > -1e-16 &&
+                   normal.dot(normals_[v2]) > -1e-16;
         utility::LogDebug("[IsCompatible] returns = {}", ret);
         return ret;
     }
 
-    BallPivotingVertexPtr FindCandidateVertex(
-            const BallPivotingEdgePtr& edge,
-            double radius,
-            Eigen::Vector3d& candidate_center) {
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), radius={}",
-                          edge->source_->idx_, edge->target_->idx_, radius);
-        BallPivotingVertexPtr src = edge->source_;
-        BallPivotingVertexPtr tgt = edge->target_;
-
-        const BallPivotingVertexPtr opp = edge->GetOppositeVertex();
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), opp={}",
-                          src->idx_, tgt->idx_, opp->idx_);
-        utility::LogDebug("[FindCandidateVertex] src={} => {}", src->idx_,
-                          src->point_.transpose());
-        utility::LogDebug("[FindCandidateVertex] tgt={} => {}", tgt->idx_,
-                          tgt->point_.transpose());
-        utility::LogDebug("[FindCandidateVertex] src={} => {}", opp->idx_,
-                          opp->point_.transpose());
-
-        Eigen::Vector3d mp = 0.5 * (src->point_ + tgt->point_);
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), mp={}",
-                          edge->source_->idx_, edge->target_->idx_,
-                          mp.transpose());
-
-        BallPivotingTrianglePtr triangle = edge->triangle0_;
-        const Eigen::Vector3d& center = triangle->ball_center_;
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), center={}",
-                          edge->source_->idx_, edge->target_->idx_,
-                          center.transpose());
-
-        Eigen::Vector3d v = tgt->point_ - src->point_;
+    int FindCandidateVertex(int eidx,
+                            double radius,
+                            Eigen::Vector3d& candidate_center) {
+        const BallPivotingEdge& edge = edges_[eidx];
+        const int src = edge.source_;
+        const int tgt = edge.target_;
+        const int opp = GetOppositeVertex(eidx);
+        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), opp={}", src,
+                          tgt, opp);
+
+        Eigen::Vector3d mp = 0.5 * (points_[src] + points_[tgt]);
+        const Eigen::Vector3d& center =
+                triangles_[edge.triangle0_].ball_center_;
+
+        Eigen::Vector3d v = points_[tgt] - points_[src];
         v /= v.norm();
 
         Eigen::Vector3d a = center - mp;
         a /= a.norm();
 
-        std::vector<int> indices;
-        std::vector<double> dists2;
-        kdtree_.SearchRadius(mp, 2 * radius, indices, dists2);
+        kdtree_.SearchRadius(mp, 2 * radius, indices_, dists2_);
         utility::LogDebug("[FindCandidateVertex] found {} potential candidates",
-                          indices.size());
-
-        BallPivotingVertexPtr min_candidate = nullptr;
-        double min_angle = 2 * M_PI;
-        for (auto nbidx : indices) {
-            utility::LogDebug("[FindCandidateVertex] nbidx {:d}", nbidx);
-            const BallPivotingVertexPtr& candidate = vertices[nbidx];
-            if (candidate->idx_ == src->idx_ || candidate->idx_ == tgt->idx_ ||
-                candidate->idx_ == opp->idx_) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} is a triangle "
-                        "vertex of the edge",
-                        candidate->idx_);
+                          indices_.size());
+
+        // The pivoting angle of every candidate is computed first. The
+        // candidates are then tested for an empty ball in the order of
+        // increasing angles, so that usually only the first one is tested.
+        candidates_.clear();
+        for (int nbidx : indices_) {
+            if (nbidx == src || nbidx == tgt || nbidx == opp) {
                 continue;
             }
-            utility::LogDebug("[FindCandidateVertex] candidate={:d} => {}",
-                              candidate->idx_, candidate->point_.transpose());
 
             bool coplanar = IntersectionTest::PointsCoplanar(
-                    src->point_, tgt->point_, opp->point_, candidate->point_);
+                    points_[src], points_[tgt], points_[opp], points_[nbidx]);
             if (coplanar && (IntersectionTest::LineSegmentsMinimumDistance(
-                                     mp, candidate->point_, src->point_,
-                                     opp->point_) < 1e-12 ||
+                                     mp, points_[nbidx], points_[src],
+                                     points_[opp]) < 1e-12 ||
                              IntersectionTest::LineSegmentsMinimumDistance(
-                                     mp, candidate->point_, tgt->point_,
-                                     opp->point_) < 1e-12)) {
+                                     mp, points_[nbidx], points_[tgt],
+                                     points_[opp]) < 1e-12)) {
                 utility::LogDebug(
                         "[FindCandidateVertex] candidate {:d} is intersecting "
                         "the existing triangle",
-                        candidate->idx_);
+                        nbidx);
                 continue;
             }
 
             Eigen::Vector3d new_center;
-            if (!ComputeBallCenter(src->idx_, tgt->idx_, candidate->idx_,
-                                   radius, new_center)) {
+            if (!ComputeBallCenter(src, tgt, nbidx, radius, new_center)) {
                 utility::LogDebug(
                         "[FindCandidateVertex] candidate {:d} can not compute "
                         "ball",
-                        candidate->idx_);
+                        nbidx);
                 continue;
             }
-            utility::LogDebug("[FindCandidateVertex] candidate {:d} center={}",
-                              candidate->idx_, new_center.transpose());
 
             Eigen::Vector3d b = new_center - mp;
             b /= b.norm();
-            utility::LogDebug(
-                    "[FindCandidateVertex] candidate {:d} v={}, a={}, b={}",
-                    candidate->idx_, v.transpose(), a.transpose(),
-                    b.transpose());
 
             double cosinus = a.dot(b);
             cosinus = std::min(cosinus, 1.0);
             cosinus = std::max(cosinus, -1.0);
-            utility::LogDebug(
-                    "[FindCandidateVertex] candidate {:d} cosinus={:f}",
-                    candidate->idx_, cosinus);
 
             double angle = std::acos(cosinus);
 
@@ -426,123 +350,118 @@ public:
             if (c.dot(v) < 0) {
                 angle = 2 * M_PI - angle;
             }
-
-            if (angle >= min_angle) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} angle {:f} > "
-                        "min_angle {:f}",
-                        candidate->idx_, angle, min_angle);
-                continue;
+            if (angle < 2 * M_PI) {
+                candidates_.push_back({angle, nbidx, new_center});
             }
+        }
 
+        // A stable order keeps the first candidate among equal angles.
+        std::stable_sort(candidates_.begin(), candidates_.end(),
+                         [](const Candidate& c0, const Candidate& c1) {
+                             return c0.angle_ < c1.angle_;
+                         });
+        for (const Candidate& c : candidates_) {
+            const int candidate = c.vidx_;
+            const Eigen::Vector3d& new_center = c.center_;
             bool empty_ball = true;
-            for (auto nbidx2 : indices) {
-                const BallPivotingVertexPtr& nb = vertices[nbidx2];
-                if (nb->idx_ == src->idx_ || nb->idx_ == tgt->idx_ ||
-                    nb->idx_ == candidate->idx_) {
+            for (int nbidx2 : indices_) {
+                if (nbidx2 == src || nbidx2 == tgt || nbidx2 == candidate) {
                     continue;
                 }
-                if ((new_center - nb->point_).norm() < radius - 1e-16) {
-                    utility::LogDebug(
-                            "[FindCandidateVertex] candidate {:d} not an empty "
-                            "ball",
-                            candidate->idx_);
+                if ((new_center - points_[nbidx2]).norm() < radius - 1e-16) {
                     empty_ball = false;
                     break;
                 }
             }
-
             if (empty_ball) {
-                utility::LogDebug("[FindCandidateVertex] candidate {:d} works",
-                                  candidate->idx_);
-                min_angle = angle;
-                min_candidate = vertices[nbidx];
+                utility::LogDebug("[FindCandidateVertex] returns {:d}",
+                                  candidate);
                 candidate_center = new_center;
+                return candidate;
             }
         }
 
-        if (min_candidate == nullptr) {
-            utility::LogDebug("[FindCandidateVertex] returns nullptr");
-        } else {
-            utility::LogDebug("[FindCandidateVertex] returns {:d}",
-                              min_candidate->idx_);
-        }
-        return min_candidate;
+        utility::LogDebug("[FindCandidateVertex] returns nullptr");
+        return -1;
     }
 
     void ExpandTriangulation(double radius) {
         utility::LogDebug("[ExpandTriangulation] radius={}", radius);
         while (!edge_front_.empty()) {
-            BallPivotingEdgePtr edge = edge_front_.front();
+            const int eidx = edge_front_.front();
             edge_front_.pop_front();
-            if (edge->type_ != BallPivotingEdge::Front) {
+            if (edges_[eidx].type_ != BallPivotingEdge::Front) {
                 continue;
             }
 
             Eigen::Vector3d center;
-            BallPivotingVertexPtr candidate =
-                    FindCandidateVertex(edge, radius, center);
-            if (candidate == nullptr ||
-                candidate->type_ == BallPivotingVertex::Type::Inner ||
-                !IsCompatible(candidate, edge->source_, edge->target_)) {
-                edge->type_ = BallPivotingEdge::Type::Border;
-                border_edges_.push_back(edge);
+            const int candidate = FindCandidateVertex(eidx, radius, center);
+            const int src = edges_[eidx].source_;
+            const int tgt = edges_[eidx].target_;
+            if (candidate < 0 ||
+                vertices_[candidate].type_ ==
+                        BallPivotingVertex::Type::Inner ||
+                !IsCompatible(candidate, src, tgt)) {
+                edges_[eidx].type_ = BallPivotingEdge::Type::Border;
+                border_edges_.push_back(eidx);
                 continue;
             }
 
-            BallPivotingEdgePtr e0 = GetLinkingEdge(candidate, edge->source_);
-            BallPivotingEdgePtr e1 = GetLinkingEdge(candidate, edge->target_);
-            if ((e0 != nullptr && e0->type_ != BallPivotingEdge::Type::Front) ||
-                (e1 != nullptr && e1->type_ != BallPivotingEdge::Type::Front)) {
-                edge->type_ = BallPivotingEdge::Type::Border;
-                border_edges_.push_back(edge);
+            int e0 = GetLinkingEdge(candidate, src);
+            int e1 = GetLinkingEdge(candidate, tgt);
+            if ((e0 >= 0 &&
+                 edges_[e0].type_ != BallPivotingEdge::Type::Front) ||
+                (e1 >= 0 &&
+                 edges_[e1].type_ != BallPivotingEdge::Type::Front)) {
+                edges_[eidx].type_ = BallPivotingEdge::Type::Border;
+                border_edges_.push_back(eidx);
                 continue;
             }
 
-            CreateTriangle(edge->source_, edge->target_, candidate, center);
+            CreateTriangle(src, tgt, candidate, center);
 
-            e0 = GetLinkingEdge(candidate, edge->source_);
-            e1 = GetLinkingEdge(candidate, edge->target_);
-            if (e0->type_ == BallPivotingEdge::Type::Front) {
+            e0 = GetLinkingEdge(candidate, src);
+            e1 = GetLinkingEdge(candidate, tgt);
+            if (edges_[e0].type_ == BallPivotingEdge::Type::Front) {
                 edge_front_.push_front(e0);
             }
-            if (e1->type_ == BallPivotingEdge::Type::Front) {
+            if (edges_[e1].type_ == BallPivotingEdge::Type::Front) {
                 edge_front_.push_front(e1);
             }
         }
     }
 
-    bool TryTriangleSeed(const BallPivotingVertexPtr& v0,
-                         const BallPivotingVertexPtr& v1,
-                         const BallPivotingVertexPtr& v2,
+    bool TryTriangleSeed(int v0,
+                         int v1,
+                         int v2,
                          const std::vector<int>& nb_indices,
                          double radius,
-                         Eigen::Vector3d& center) {
+                         Eigen::Vector3d& center) const {
         utility::LogDebug(
                 "[TryTriangleSeed] v0.idx={}, v1.idx={}, v2.idx={}, "
                 "radius={}",
-                v0->idx_, v1->idx_, v2->idx_, radius);
+                v0, v1, v2, radius);
 
         if (!IsCompatible(v0, v1, v2)) {
             return false;
         }
 
-        BallPivotingEdgePtr e0 = GetLinkingEdge(v0, v2);
-        BallPivotingEdgePtr e1 = GetLinkingEdge(v1, v2);
-        if (e0 != nullptr && e0->type_ == BallPivotingEdge::Type::Inner) {
+        int e0 = GetLinkingEdge(v0, v2);
+        int e1 = GetLinkingEdge(v1, v2);
+        if (e0 >= 0 && edges_[e0].type_ == BallPivotingEdge::Type::Inner) {
             utility::LogDebug(
                     "[TryTriangleSeed] returns {} because e0 is inner edge",
                     false);
             return false;
         }
-        if (e1 != nullptr && e1->type_ == BallPivotingEdge::Type::Inner) {
+        if (e1 >= 0 && edges_[e1].type_ == BallPivotingEdge::Type::Inner) {
             utility::LogDebug(
                     "[TryTriangleSeed] returns {} because e1 is inner edge",
                     false);
             return false;
         }
 
-        if (!ComputeBallCenter(v0->idx_, v1->idx_, v2->idx_, radius, center)) {
+        if (!ComputeBallCenter(v0, v1, v2, radius, center)) {
             utility::LogDebug(
                     "[TryTriangleSeed] returns {} could not compute ball "
                     "center",
@@ -551,13 +470,11 @@ public:
         }
 
         // test if no other point is within the ball
-        for (const auto& nbidx : nb_indices) {
-            const BallPivotingVertexPtr& v = vertices[nbidx];
-            if (v->idx_ == v0->idx_ || v->idx_ == v1->idx_ ||
-                v->idx_ == v2->idx_) {
+        for (int nbidx : nb_indices) {
+            if (nbidx == v0 || nbidx == v1 || nbidx == v2) {
                 continue;
             }
-            if ((center - v->point_).norm() < radius - 1e-16) {
+            if ((center - points_[nbidx]).norm() < radius - 1e-16) {
                 utility::LogDebug(
                         "[TryTriangleSeed] returns {} computed ball is not "
                         "empty",
@@ -570,58 +487,57 @@ public:
         return true;
     }
 
-    bool TrySeed(BallPivotingVertexPtr& v, double radius) {
-        utility::LogDebug("[TrySeed] with v.idx={}, radius={}", v->idx_,
-                          radius);
+    bool TrySeed(int v, double radius) {
+        utility::LogDebug("[TrySeed] with v.idx={}, radius={}", v, radius);
         std::vector<int> indices;
         std::vector<double> dists2;
-        kdtree_.SearchRadius(v->point_, 2 * radius, indices, dists2);
+        kdtree_.SearchRadius(points_[v], 2 * radius, indices, dists2);
         if (indices.size() < 3u) {
             return false;
         }
 
         for (size_t nbidx0 = 0; nbidx0 < indices.size(); ++nbidx0) {
-            const BallPivotingVertexPtr& nb0 = vertices[indices[nbidx0]];
-            if (nb0->type_ != BallPivotingVertex::Type::Orphan) {
+            const int nb0 = indices[nbidx0];
+            if (vertices_[nb0].type_ != BallPivotingVertex::Type::Orphan) {
                 continue;
             }
-            if (nb0->idx_ == v->idx_) {
+            if (nb0 == v) {
                 continue;
             }
 
-            int candidate_vidx2 = -1;
+            int nb1 = -1;
             Eigen::Vector3d center;
             for (size_t nbidx1 = nbidx0 + 1; nbidx1 < indices.size();
                  ++nbidx1) {
-                const BallPivotingVertexPtr& nb1 = vertices[indices[nbidx1]];
-                if (nb1->type_ != BallPivotingVertex::Type::Orphan) {
+                const int candidate = indices[nbidx1];
+                if (vertices_[candidate].type_ !=
+                    BallPivotingVertex::Type::Orphan) {
                     continue;
                 }
-                if (nb1->idx_ == v->idx_) {
+                if (candidate == v) {
                     continue;
                 }
-                if (TryTriangleSeed(v, nb0, nb1, indices, radius, center)) {
-                    candidate_vidx2 = nb1->idx_;
+                if (TryTriangleSeed(v, nb0, candidate, indices, radius,
+                                    center)) {
+                    nb1 = candidate;
                     break;
                 }
             }
 
-            if (candidate_vidx2 >= 0) {
-                const BallPivotingVertexPtr& nb1 = vertices[candidate_vidx2];
-
-                BallPivotingEdgePtr e0 = GetLinkingEdge(v, nb1);
-                if (e0 != nullptr &&
-                    e0->type_ != BallPivotingEdge::Type::Front) {
+            if (nb1 >= 0) {
+                int e0 = GetLinkingEdge(v, nb1);
+                if (e0 >= 0 &&
+                    edges_[e0].type_ != BallPivotingEdge::Type::Front) {
                     continue;
                 }
-                BallPivotingEdgePtr e1 = GetLinkingEdge(nb0, nb1);
-                if (e1 != nullptr &&
-                    e1->type_ != BallPivotingEdge::Type::Front) {
+                int e1 = GetLinkingEdge(nb0, nb1);
+                if (e1 >= 0 &&
+                    edges_[e1].type_ != BallPivotingEdge::Type::Front) {
                     continue;
                 }
-                BallPivotingEdgePtr e2 = GetLinkingEdge(v, nb0);
-                if (e2 != nullptr &&
-                    e2->type_ != BallPivotingEdge::Type::Front) {
+                int e2 = GetLinkingEdge(v, nb0);
+                if (e2 >= 0 &&
+                    edges_[e2].type_ != BallPivotingEdge::Type::Front) {
                     continue;
                 }
 
@@ -630,13 +546,13 @@ public:
                 e0 = GetLinkingEdge(v, nb1);
                 e1 = GetLinkingEdge(nb0, nb1);
                 e2 = GetLinkingEdge(v, nb0);
-                if (e0->type_ == BallPivotingEdge::Type::Front) {
+                if (edges_[e0].type_ == BallPivotingEdge::Type::Front) {
                     edge_front_.push_front(e0);
                 }
-                if (e1->type_ == BallPivotingEdge::Type::Front) {
+                if (edges_[e1].type_ == BallPivotingEdge::Type::Front) {
                     edge_front_.push_front(e1);
                 }
-                if (e2->type_ == BallPivotingEdge::Type::Front) {
+                if (edges_[e2].type_ == BallPivotingEdge::Type::Front) {
                     edge_front_.push_front(e2);
                 }
 
@@ -654,25 +570,38 @@ public:
     }
 
     void FindSeedTriangle(double radius) {
-        for (size_t vidx = 0; vidx < vertices.size(); ++vidx) {
+        for (size_t vidx = 0; vidx < vertices_.size(); ++vidx) {
             utility::LogDebug("[FindSeedTriangle] with radius={}, vidx={}",
                               radius, vidx);
-            if (vertices[vidx]->type_ == BallPivotingVertex::Type::Orphan) {
-                if (TrySeed(vertices[vidx], radius)) {
+            if (vertices_[vidx].type_ == BallPivotingVertex::Type::Orphan) {
+                if (TrySeed(int(vidx), radius)) {
                     ExpandTriangulation(radius);
                 }
             }
         }
     }
 
-    std::shared_ptr<TriangleMesh> Run(const std::vector<double>& radii) {
+    /// Adds a triangle found by another BallPivoting. Its edges with a single
+    /// triangle are pivoted again by the next call to Run, which then also
+    /// seeds the remaining orphan vertices with the first radius.
+    void AddTriangle(const BallPivotingTriangle& triangle) {
+        CreateTriangle(triangle.vert0_, triangle.vert1_, triangle.vert2_,
+                       triangle.ball_center_);
+    }
+
+    void Run(const std::vector<double>& radii) {
         if (!has_normals_) {
             utility::LogError("ReconstructBallPivoting requires normals");
         }
 
-        mesh_->triangles_.clear();
+        for (int eidx = 0; eidx < int(edges_.size()); ++eidx) {
+            if (edges_[eidx].type_ == BallPivotingEdge::Type::Front) {
+                edge_front_.push_back(eidx);
+            }
+        }
 
-        for (double radius : radii) {
+        for (size_t ridx = 0; ridx < radii.size(); ++ridx) {
+            const double radius = radii[ridx];
             utility::LogDebug("[Run] ################################");
             utility::LogDebug("[Run] change to radius {:.4f}", radius);
             if (radius <= 0) {
@@ -681,28 +610,25 @@ public:
             }
 
             // update radius => update border edges
-            for (auto it = border_edges_.begin(); it != border_edges_.end();) {
-                BallPivotingEdgePtr edge = *it;
-                BallPivotingTrianglePtr triangle = edge->triangle0_;
+            size_t num_border_edges = 0;
+            for (int eidx : border_edges_) {
+                BallPivotingEdge& edge = edges_[eidx];
+                const BallPivotingTriangle& triangle =
+                        triangles_[edge.triangle0_];
                 utility::LogDebug(
                         "[Run] try edge {:d}-{:d} of triangle {:d}-{:d}-{:d}",
-                        edge->source_->idx_, edge->target_->idx_,
-                        triangle->vert0_->idx_, triangle->vert1_->idx_,
-                        triangle->vert2_->idx_);
+                        edge.source_, edge.target_, triangle.vert0_,
+                        triangle.vert1_, triangle.vert2_);
 
                 Eigen::Vector3d center;
-                if (ComputeBallCenter(triangle->vert0_->idx_,
-                                      triangle->vert1_->idx_,
-                                      triangle->vert2_->idx_, radius, center)) {
+                if (ComputeBallCenter(triangle.vert0_, triangle.vert1_,
+                                      triangle.vert2_, radius, center)) {
                     utility::LogDebug("[Run]   yes, we can work on this");
-                    std::vector<int> indices;
-                    std::vector<double> dists2;
-                    kdtree_.SearchRadius(center, radius, indices, dists2);
+                    kdtree_.SearchRadius(center, radius, indices_, dists2_);
                     bool empty_ball = true;
-                    for (auto idx : indices) {
-                        if (idx != triangle->vert0_->idx_ &&
-                            idx != triangle->vert1_->idx_ &&
-                            idx != triangle->vert2_->idx_) {
+                    for (int idx : indices_) {
+                        if (idx != triangle.vert0_ && idx != triangle.vert1_ &&
+                            idx != triangle.vert2_) {
                             utility::LogDebug(
                                     "[Run]   but no, the ball is not empty");
                             empty_ball = false;
@@ -714,42 +640,242 @@ public:
                         utility::LogDebug(
                                 "[Run]   yeah, add edge to edge_front_: {:d}",
                                 edge_front_.size());
-                        edge->type_ = BallPivotingEdge::Type::Front;
-                        edge_front_.push_back(edge);
-                        it = border_edges_.erase(it);
+                        edge.type_ = BallPivotingEdge::Type::Front;
+                        edge_front_.push_back(eidx);
                         continue;
                     }
                 }
-                ++it;
+                border_edges_[num_border_edges++] = eidx;
             }
+            border_edges_.resize(num_border_edges);
 
             // do the reconstruction
             if (edge_front_.empty()) {
                 FindSeedTriangle(radius);
             } else {
                 ExpandTriangulation(radius);
+                // The front of added triangles misses components without
+                // any added triangle, seed them as with an empty front.
+                if (ridx == 0) {
+                    FindSeedTriangle(radius);
+                }
             }
 
-            utility::LogDebug("[Run] mesh_ has {:d} triangles",
-                              mesh_->triangles_.size());
+            utility::LogDebug("[Run] has {:d} triangles", triangles_.size());
             utility::LogDebug("[Run] ################################");
         }
-        return mesh_;
+    }
+
+    /// Returns the triangles in the order they were created.
+    const std::vector<BallPivotingTriangle>& GetTriangles() const {
+        return triangles_;
+    }
+
+    /// Writes the triangles to a mesh with the vertices of \p pcd.
+    std::shared_ptr<TriangleMesh> CreateMesh(const PointCloud& pcd) const {
+        auto mesh = std::make_shared<TriangleMesh>();
+        mesh->vertices_ = pcd.points_;
+        mesh->vertex_normals_ = pcd.normals_;
+        mesh->vertex_colors_ = pcd.colors_;
+        mesh->triangles_.reserve(triangles_.size());
+        mesh->triangle_normals_.reserve(triangles_.size());
+        for (const BallPivotingTriangle& triangle : triangles_) {
+            const int v0 = triangle.vert0_;
+            const int v1 = triangle.vert1_;
+            const int v2 = triangle.vert2_;
+            Eigen::Vector3d face_normal =
+                    ComputeFaceNormal(points_[v0], points_[v1], points_[v2]);
+            if (face_normal.dot(normals_[v0]) > -1e-16) {
+                mesh->triangles_.emplace_back(v0, v1, v2);
+            } else {
+                mesh->triangles_.emplace_back(v0, v2, v1);
+            }
+            mesh->triangle_normals_.push_back(face_normal);
+        }
+        return mesh;
     }
 
 private:
+    /// A vertex that the ball reaches when pivoting around an edge.
+    struct Candidate {
+        double angle_;
+        int vidx_;
+        Eigen::Vector3d center_;
+    };
+
     bool has_normals_;
     KDTreeFlann kdtree_;
-    std::list<BallPivotingEdgePtr> edge_front_;
-    std::list<BallPivotingEdgePtr> border_edges_;
-    std::vector<BallPivotingVertexPtr> vertices;
-    std::shared_ptr<TriangleMesh> mesh_;
+    const std::vector<Eigen::Vector3d>& points_;
+    const std::vector<Eigen::Vector3d>& normals_;
+    std::vector<BallPivotingVertex> vertices_;
+    std::vector<BallPivotingEdge> edges_;
+    std::vector<BallPivotingTriangle> triangles_;
+    std::deque<int> edge_front_;
+    std::vector<int> border_edges_;
+    // Buffers reused by the searches.
+    std::vector<int> indices_;
+    std::vector<double> dists2_;
+    std::vector<Candidate> candidates_;
+};
+
+/// A region of space whose points are reconstructed independently.
+struct BallPivotingRegion {
+    Eigen::Vector3d min_bound_;
+    Eigen::Vector3d max_bound_;
+    /// Points inside the region, which are assigned to no other region.
+    std::vector<int> indices_;
 };
 
+/// Splits \p region at the median of its longest side until the regions hold
+/// at most \p max_points points or are narrower than \p min_size.
+static void SplitBallPivotingRegion(const std::vector<Eigen::Vector3d>& points,
+                                    BallPivotingRegion region,
+                                    size_t max_points,
+                                    double min_size,
+                                    std::vector<BallPivotingRegion>& regions) {
+    int axis;
+    const double size =
+            (region.max_bound_ - region.min_bound_).maxCoeff(&axis);
+    if (region.indices_.size() <= max_points || size < 2 * min_size) {
+        regions.push_back(std::move(region));
+        return;
+    }
+    const size_t median = region.indices_.size() / 2;
+    std::nth_element(region.indices_.begin(),
+                     region.indices_.begin() + median, region.indices_.end(),
+                     [&](int i, int j) {
+                         return points[i](axis) < points[j](axis);
+                     });
+    // Keeps both halves at least min_size wide.
+    const double split = std::min(
+            std::max(points[region.indices_[median]](axis),
+                     region.min_bound_(axis) + min_size),
+            region.max_bound_(axis) - min_size);
+    BallPivotingRegion lower, upper;
+    lower.min_bound_ = upper.min_bound_ = region.min_bound_;
+    lower.max_bound_ = upper.max_bound_ = region.max_bound_;
+    lower.max_bound_(axis) = upper.min_bound_(axis) = split;
+    for (int idx : region.indices_) {
+        if (points[idx](axis) < split) {
+            lower.indices_.push_back(idx);
+        } else {
+            upper.indices_.push_back(idx);
+        }
+    }
+    std::sort(lower.indices_.begin(), lower.indices_.end());
+    std::sort(upper.indices_.begin(), upper.indices_.end());
+    region = BallPivotingRegion();
+    SplitBallPivotingRegion(points, std::move(lower), max_points, min_size,
+                            regions);
+    SplitBallPivotingRegion(points, std::move(upper), max_points, min_size,
+                            regions);
+}
+
 std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudBallPivoting(
-        const PointCloud& pcd, const std::vector<double>& radii) {
+        const PointCloud& pcd,
+        const std::vector<double>& radii,
+        bool parallel /* = false*/) {
+    if (!parallel) {
+        BallPivoting bp(pcd);
+        bp.Run(radii);
+        return bp.CreateMesh(pcd);
+    }
+
+    if (!pcd.HasNormals()) {
+        utility::LogError("ReconstructBallPivoting requires normals");
+    }
+    double max_radius = 0;
+    for (double radius : radii) {
+        if (radius <= 0) {
+            utility::LogError("got an invalid, negative radius as parameter");
+        }
+        max_radius = std::max(max_radius, radius);
+    }
+
+    // A triangle whose vertices are all inside a region has its ball within
+    // 2 * max_radius of the region. The points up to this margin around the
+    // region are therefore enough to find the triangle and to check that its
+    // ball is empty.
+    const double margin = 2 * max_radius;
+    BallPivotingRegion root;
+    root.min_bound_ = pcd.GetMinBound();
+    root.max_bound_ = pcd.GetMaxBound();
+    root.indices_.resize(pcd.points_.size());
+    std::iota(root.indices_.begin(), root.indices_.end(), 0);
+    std::vector<BallPivotingRegion> regions;
+    SplitBallPivotingRegion(pcd.points_, std::move(root), 10000, 4 * margin,
+                            regions);
+    utility::LogDebug("[CreateFromPointCloudBallPivoting] {:d} regions",
+                      regions.size());
+
+    std::vector<int> point_region(pcd.points_.size());
+    for (int r = 0; r < int(regions.size()); ++r) {
+        for (int idx : regions[r].indices_) {
+            point_region[idx] = r;
+        }
+    }
+
+    // Keeps the triangles whose vertices are all inside one region.
+    std::vector<std::vector<BallPivotingTriangle>> region_triangles(
+            regions.size());
+#pragma omp parallel for schedule(dynamic)
+    for (int r = 0; r < int(regions.size()); ++r) {
+        if (regions[r].indices_.empty()) {
+            continue;
+        }
+        const Eigen::Vector3d min_bound =
+                regions[r].min_bound_ - Eigen::Vector3d::Constant(margin);
+        const Eigen::Vector3d max_bound =
+                regions[r].max_bound_ + Eigen::Vector3d::Constant(margin);
+        // The regions tile the bounds of the point cloud, so the points
+        // around this region are in the regions that overlap the margin.
+        std::vector<int> region_to_pcd;
+        for (const BallPivotingRegion& other : regions) {
+            if ((other.min_bound_.array() > max_bound.array()).any() ||
+                (other.max_bound_.array() < min_bound.array()).any()) {
+                continue;
+            }
+            for (int idx : other.indices_) {
+                const Eigen::Vector3d& point = pcd.points_[idx];
+                if ((point.array() >= min_bound.array()).all() &&
+                    (point.array() <= max_bound.array()).all()) {
+                    region_to_pcd.push_back(idx);
+                }
+            }
+        }
+        std::sort(region_to_pcd.begin(), region_to_pcd.end());
+        PointCloud region_pcd;
+        region_pcd.points_.reserve(region_to_pcd.size());
+        region_pcd.normals_.reserve(region_to_pcd.size());
+        for (int idx : region_to_pcd) {
+            region_pcd.points_.push_back(pcd.points_[idx]);
+            region_pcd.normals_.push_back(pcd.normals_[idx]);
+        }
+
+        BallPivoting bp(region_pcd);
+        bp.Run(radii);
+        for (const BallPivotingTriangle& triangle : bp.GetTriangles()) {
+            const int v0 = region_to_pcd[triangle.vert0_];
+            const int v1 = region_to_pcd[triangle.vert1_];
+            const int v2 = region_to_pcd[triangle.vert2_];
+            if (point_region[v0] == r && point_region[v1] == r &&
+                point_region[v2] == r) {
+                region_triangles[r].emplace_back(v0, v1, v2,
+                                                 triangle.ball_center_);
+            }
+        }
+    }
+
+    // The fronts between the regions are closed by pivoting the open edges of
+    // the region triangles over all points.
     BallPivoting bp(pcd);
-    return bp.Run(radii);
+    for (const auto& triangles : region_triangles) {
+        for (const BallPivotingTriangle& triangle : triangles) {
+            bp.AddTriangle(triangle);
+        }
+    }
+    bp.Run(radii);
+    return bp.CreateMesh(pcd);
 }
 
 }  // namespace geometry
@@ -27,6 +27,7 @@
 #include "open3d/geometry/TriangleMesh.h"
 
 #include <Eigen/Dense>
+#include <atomic>
 #include <numeric>
 #include <queue>
 #include <random>
@@ -37,6 +38,7 @@
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/Qhull.h"
+#include "open3d/geometry/TriangleMeshBVH.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
@@ -1342,33 +1344,58 @@ bool TriangleMesh::IsVertexManifold() const {
 
 std::vector<Eigen::Vector2i> TriangleMesh::GetSelfIntersectingTriangles()
         const {
+    TriangleMeshBVH bvh(*this);
     std::vector<Eigen::Vector2i> self_intersecting_triangles;
-    for (size_t tidx0 = 0; tidx0 < triangles_.size() - 1; ++tidx0) {
-        const Eigen::Vector3i &tria_p = triangles_[tidx0];
-        const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
-        const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
-        const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
-        for (size_t tidx1 = tidx0 + 1; tidx1 < triangles_.size(); ++tidx1) {
-            const Eigen::Vector3i &tria_q = triangles_[tidx1];
-            // check if neighbour triangle
-            if (tria_p(0) == tria_q(0) || tria_p(0) == tria_q(1) ||
-                tria_p(0) == tria_q(2) || tria_p(1) == tria_q(0) ||
-                tria_p(1) == tria_q(1) || tria_p(1) == tria_q(2) ||
-                tria_p(2) == tria_q(0) || tria_p(2) == tria_q(1) ||
-                tria_p(2) == tria_q(2)) {
-                continue;
-            }
+#pragma omp parallel
+    {
+        std::vector<Eigen::Vector2i> local_intersecting_triangles;
+        std::vector<int> candidates;
+#pragma omp for schedule(dynamic, 64)
+        for (int tidx0 = 0; tidx0 < int(triangles_.size()); ++tidx0) {
+            const Eigen::Vector3i &tria_p = triangles_[tidx0];
+            const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
+            const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
+            const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
+            bvh.SearchAABB(p0.cwiseMin(p1).cwiseMin(p2),
+                           p0.cwiseMax(p1).cwiseMax(p2), candidates);
+            for (int tidx1 : candidates) {
+                if (tidx1 <= tidx0) {
+                    continue;
+                }
+                const Eigen::Vector3i &tria_q = triangles_[tidx1];
+                // check if neighbour triangle
+                if (tria_p(0) == tria_q(0) || tria_p(0) == tria_q(1) ||
+                    tria_p(0) == tria_q(2) || tria_p(1) == tria_q(0) ||
+                    tria_p(1) == tria_q(1) || tria_p(1) == tria_q(2) ||
+                    tria_p(2) == tria_q(0) || tria_p(2) == tria_q(1) ||
+                    tria_p(2) == tria_q(2)) {
+                    continue;
+                }
 
-            // check for intersection
-            const Eigen::Vector3d &q0 = vertices_[tria_q(0)];
-            const Eigen::Vector3d &q1 = vertices_[tria_q(1)];
-            const Eigen::Vector3d &q2 = vertices_[tria_q(2)];
-            if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0, q1, q2)) {
-                self_intersecting_triangles.push_back(
-                        Eigen::Vector2i(tidx0, tidx1));
+                // check for intersection
+                const Eigen::Vector3d &q0 = vertices_[tria_q(0)];
+                const Eigen::Vector3d &q1 = vertices_[tria_q(1)];
+                const Eigen::Vector3d &q2 = vertices_[tria_q(2)];
+                if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0, q1,
+                                                         q2)) {
+                    local_intersecting_triangles.push_back(
+                            Eigen::Vector2i(tidx0, tidx1));
+                }
             }
         }
+#pragma omp critical
+        {
+            self_intersecting_triangles.insert(
+                    self_intersecting_triangles.end(),
+                    local_intersecting_triangles.begin(),
+                    local_intersecting_triangles.end());
+        }
     }
+    std::sort(self_intersecting_triangles.begin(),
+              self_intersecting_triangles.end(),
+              [](const Eigen::Vector2i &a, const Eigen::Vector2i &b) {
+                  return a(0) < b(0) || (a(0) == b(0) && a(1) < b(1));
+              });
     return self_intersecting_triangles;
 }
 
@@ -1385,22 +1412,41 @@ bool TriangleMesh::IsIntersecting(const TriangleMesh &other) const {
     if (!IsBoundingBoxIntersecting(other)) {
         return false;
     }
-    for (size_t tidx0 = 0; tidx0 < triangles_.size(); ++tidx0) {
-        const Eigen::Vector3i &tria_p = triangles_[tidx0];
-        const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
-        const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
-        const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
-        for (size_t tidx1 = 0; tidx1 < other.triangles_.size(); ++tidx1) {
-            const Eigen::Vector3i &tria_q = other.triangles_[tidx1];
-            const Eigen::Vector3d &q0 = other.vertices_[tria_q(0)];
-            const Eigen::Vector3d &q1 = other.vertices_[tria_q(1)];
-            const Eigen::Vector3d &q2 = other.vertices_[tria_q(2)];
-            if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0, q1, q2)) {
-                return true;
+    // Build the hierarchy over the larger mesh and query the smaller one.
+    const bool other_larger = other.triangles_.size() > triangles_.size();
+    const TriangleMesh &tree_mesh = other_larger ? other : *this;
+    const TriangleMesh &query_mesh = other_larger ? *this : other;
+    TriangleMeshBVH bvh(tree_mesh);
+    std::atomic<bool> intersecting(false);
+#pragma omp parallel
+    {
+        std::vector<int> candidates;
+#pragma omp for schedule(dynamic, 64)
+        for (int tidx0 = 0; tidx0 < int(query_mesh.triangles_.size());
+             ++tidx0) {
+            if (intersecting) {
+                continue;
+            }
+            const Eigen::Vector3i &tria_p = query_mesh.triangles_[tidx0];
+            const Eigen::Vector3d &p0 = query_mesh.vertices_[tria_p(0)];
+            const Eigen::Vector3d &p1 = query_mesh.vertices_[tria_p(1)];
+            const Eigen::Vector3d &p2 = query_mesh.vertices_[tria_p(2)];
+            bvh.SearchAABB(p0.cwiseMin(p1).cwiseMin(p2),
+                           p0.cwiseMax(p1).cwiseMax(p2), candidates);
+            for (int tidx1 : candidates) {
+                const Eigen::Vector3i &tria_q = tree_mesh.triangles_[tidx1];
+                const Eigen::Vector3d &q0 = tree_mesh.vertices_[tria_q(0)];
+                const Eigen::Vector3d &q1 = tree_mesh.vertices_[tria_q(1)];
+                const Eigen::Vector3d &q2 = tree_mesh.vertices_[tria_q(2)];
+                if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0, q1,
+                                                         q2)) {
+                    intersecting = true;
+                    break;
+                }
             }
         }
     }
-    return false;
+    return intersecting;
 }
 
 std::tuple<std::vector<int>, std::vector<size_t>, std::vector<double>>
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <tuple>
@@ -254,11 +255,13 @@ public:
     bool IsVertexManifold() const;
 
     /// Function that returns a list of triangles that are intersecting the
-    /// mesh.
+    /// mesh. The pairs are sorted, only triangles with overlapping bounding
+    /// boxes are tested, using a TriangleMeshBVH.
     std::vector<Eigen::Vector2i> GetSelfIntersectingTriangles() const;
 
     /// Function that tests if the triangle mesh is self-intersecting.
-    /// Tests each triangle pair for intersection.
+    /// Tests each triangle pair with overlapping bounding boxes for
+    /// intersection.
     bool IsSelfIntersecting() const;
 
     /// Function that tests if the bounding boxes of the triangle meshes are
@@ -266,7 +269,8 @@ public:
     bool IsBoundingBoxIntersecting(const TriangleMesh &other) const;
 
     /// Function that tests if the triangle mesh intersects another triangle
-    /// mesh. Tests each triangle against each other triangle.
+    /// mesh. Tests each triangle against the triangles of the other mesh
+    /// with overlapping bounding boxes, using a TriangleMeshBVH.
     bool IsIntersecting(const TriangleMesh &other) const;
 
     /// Function that tests if the given triangle mesh is orientable, i.e.
@@ -422,13 +426,18 @@ public:
     /// the simplified mesh should have. It is not guaranteed that this number
     /// will be reached.
     /// \param maximum_error defines the maximum error where a vertex is allowed
-    /// to be merged
+    /// to be merged. With a target of zero triangles the simplification only
+    /// stops at this error.
     /// \param boundary_weight a weight applied to edge vertices used to
     /// preserve boundaries
+    /// \param parallel If true, every round collapses the edges that are the
+    /// cheapest in their neighborhood in parallel, instead of one edge at a
+    /// time. These collapses keep the mesh manifold.
     std::shared_ptr<TriangleMesh> SimplifyQuadricDecimation(
             int target_number_of_triangles,
-            double maximum_error,
-            double boundary_weight) const;
+            double maximum_error = std::numeric_limits<double>::infinity(),
+            double boundary_weight = 1.0,
+            bool parallel = false) const;
 
     /// Function to select points from \p input TriangleMesh into
     /// output TriangleMesh
@@ -547,8 +556,14 @@ public:
     /// reconstructed. Has to contain normals.
     /// \param radii defines the radii of
     /// the ball that are used for the surface reconstruction.
+    /// \param parallel If true, the point cloud is split into spatially
+    /// disjoint regions that are reconstructed in parallel. The open edges
+    /// between the regions are then pivoted over the whole point cloud. The
+    /// result can differ slightly from the serial reconstruction.
     static std::shared_ptr<TriangleMesh> CreateFromPointCloudBallPivoting(
-            const PointCloud &pcd, const std::vector<double> &radii);
+            const PointCloud &pcd,
+            const std::vector<double> &radii,
+            bool parallel = false);
 
     /// \brief Function that computes a triangle mesh from an oriented
     /// PointCloud pcd. This implements the Screened Poisson Reconstruction
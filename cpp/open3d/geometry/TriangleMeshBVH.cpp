@@ -0,0 +1,566 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/TriangleMeshBVH.h"
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+constexpr int kNumBins = 16;
+constexpr int kMaxLeafSize = 4;
+/// Bounds the traversal stack, see kStackSize.
+constexpr int kMaxDepth = 60;
+constexpr int kStackSize = 64;
+/// Cost of visiting a node relative to a triangle test.
+constexpr double kTraversalCost = 0.125;
+
+float RoundDown(double value) {
+    float rounded = float(value);
+    return double(rounded) > value
+                   ? std::nextafter(rounded,
+                                    -std::numeric_limits<float>::infinity())
+                   : rounded;
+}
+
+float RoundUp(double value) {
+    float rounded = float(value);
+    return double(rounded) < value
+                   ? std::nextafter(rounded,
+                                    std::numeric_limits<float>::infinity())
+                   : rounded;
+}
+
+struct Bounds {
+    Eigen::Vector3d min_bound_ =
+            Eigen::Vector3d::Constant(std::numeric_limits<double>::infinity());
+    Eigen::Vector3d max_bound_ = Eigen::Vector3d::Constant(
+            -std::numeric_limits<double>::infinity());
+
+    void Grow(const Eigen::Vector3d &min_bound,
+              const Eigen::Vector3d &max_bound) {
+        min_bound_ = min_bound_.cwiseMin(min_bound);
+        max_bound_ = max_bound_.cwiseMax(max_bound);
+    }
+
+    void Grow(const Bounds &other) {
+        Grow(other.min_bound_, other.max_bound_);
+    }
+
+    /// Half of the surface area, 0 for empty bounds.
+    double HalfArea() const {
+        if ((max_bound_.array() < min_bound_.array()).any()) {
+            return 0;
+        }
+        Eigen::Vector3d extent = max_bound_ - min_bound_;
+        return extent(0) * extent(1) + extent(1) * extent(2) +
+               extent(2) * extent(0);
+    }
+};
+
+/// Slab test, returns the entry parameter in \p t_enter. Rays parallel to a
+/// slab whose origin lies on the slab plane produce NaNs, which leave the
+/// interval unchanged.
+bool RayBox(const TriangleMeshBVH::Node &node,
+            const Eigen::Vector3d &origin,
+            const Eigen::Vector3d &inv_direction,
+            double t_max,
+            double &t_enter) {
+    double t0 = 0;
+    double t1 = t_max;
+    for (int i = 0; i < 3; ++i) {
+        double t_near = (node.min_bound_[i] - origin(i)) * inv_direction(i);
+        double t_far = (node.max_bound_[i] - origin(i)) * inv_direction(i);
+        if (t_near > t_far) {
+            std::swap(t_near, t_far);
+        }
+        // Guards against rounding for rays grazing the box.
+        t_far *= 1 + 4 * std::numeric_limits<double>::epsilon();
+        t0 = t_near > t0 ? t_near : t0;
+        t1 = t_far < t1 ? t_far : t1;
+    }
+    t_enter = t0;
+    return t0 <= t1;
+}
+
+double PointBoxDistance2(const TriangleMeshBVH::Node &node,
+                         const Eigen::Vector3d &point) {
+    double distance2 = 0;
+    for (int i = 0; i < 3; ++i) {
+        double d = std::max(std::max(node.min_bound_[i] - point(i), 0.0),
+                            point(i) - node.max_bound_[i]);
+        distance2 += d * d;
+    }
+    return distance2;
+}
+
+bool BoxesOverlap(const TriangleMeshBVH::Node &node,
+                  const Eigen::Vector3d &min_bound,
+                  const Eigen::Vector3d &max_bound) {
+    for (int i = 0; i < 3; ++i) {
+        if (node.min_bound_[i] > max_bound(i) ||
+            node.max_bound_[i] < min_bound(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Moller-Trumbore ray triangle intersection.
+bool RayTriangle(const Eigen::Vector3d &origin,
+                 const Eigen::Vector3d &direction,
+                 const Eigen::Vector3d &v0,
+                 const Eigen::Vector3d &v1,
+                 const Eigen::Vector3d &v2,
+                 double t_max,
+                 double &t,
+                 double &u,
+                 double &v) {
+    const Eigen::Vector3d e1 = v1 - v0;
+    const Eigen::Vector3d e2 = v2 - v0;
+    const Eigen::Vector3d p = direction.cross(e2);
+    const double det = e1.dot(p);
+    if (det == 0) {
+        return false;
+    }
+    const double inv_det = 1.0 / det;
+    const Eigen::Vector3d s = origin - v0;
+    u = s.dot(p) * inv_det;
+    if (u < 0 || u > 1) {
+        return false;
+    }
+    const Eigen::Vector3d q = s.cross(e1);
+    v = direction.dot(q) * inv_det;
+    if (v < 0 || u + v > 1) {
+        return false;
+    }
+    t = e2.dot(q) * inv_det;
+    return t >= 0 && t <= t_max;
+}
+
+/// Closest point on a triangle, following Ericson, "Real-Time Collision
+/// Detection", 2004, Section 5.1.5.
+Eigen::Vector3d ClosestPointOnTriangle(const Eigen::Vector3d &p,
+                                       const Eigen::Vector3d &a,
+                                       const Eigen::Vector3d &b,
+                                       const Eigen::Vector3d &c) {
+    const Eigen::Vector3d ab = b - a;
+    const Eigen::Vector3d ac = c - a;
+    const Eigen::Vector3d ap = p - a;
+    const double d1 = ab.dot(ap);
+    const double d2 = ac.dot(ap);
+    if (d1 <= 0 && d2 <= 0) {
+        return a;
+    }
+    const Eigen::Vector3d bp = p - b;
+    const double d3 = ab.dot(bp);
+    const double d4 = ac.dot(bp);
+    if (d3 >= 0 && d4 <= d3) {
+        return b;
+    }
+    const double vc = d1 * d4 - d3 * d2;
+    if (vc <= 0 && d1 >= 0 && d3 <= 0) {
+        return a + d1 / (d1 - d3) * ab;
+    }
+    const Eigen::Vector3d cp = p - c;
+    const double d5 = ab.dot(cp);
+    const double d6 = ac.dot(cp);
+    if (d6 >= 0 && d5 <= d6) {
+        return c;
+    }
+    const double vb = d5 * d2 - d1 * d6;
+    if (vb <= 0 && d2 >= 0 && d6 <= 0) {
+        return a + d2 / (d2 - d6) * ac;
+    }
+    const double va = d3 * d6 - d5 * d4;
+    if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0) {
+        return b + (d4 - d3) / ((d4 - d3) + (d5 - d6)) * (c - b);
+    }
+    const double denom = 1.0 / (va + vb + vc);
+    return a + ab * (vb * denom) + ac * (vc * denom);
+}
+
+struct StackEntry {
+    int node_;
+    /// Lower bound of the ray parameter or distance inside the node.
+    double bound_;
+};
+
+}  // unnamed namespace
+
+TriangleMeshBVH::TriangleMeshBVH() {}
+
+TriangleMeshBVH::TriangleMeshBVH(const TriangleMesh &mesh) {
+    SetTriangleMesh(mesh);
+}
+
+bool TriangleMeshBVH::SetTriangleMesh(const TriangleMesh &mesh) {
+    nodes_.clear();
+    triangle_indices_.clear();
+    vertices_.clear();
+    const int num_triangles = int(mesh.triangles_.size());
+    if (num_triangles == 0) {
+        return true;
+    }
+
+    std::vector<Eigen::Vector3d> triangle_min(num_triangles);
+    std::vector<Eigen::Vector3d> triangle_max(num_triangles);
+    std::vector<Eigen::Vector3d> centroids(num_triangles);
+#pragma omp parallel for schedule(static)
+    for (int tidx = 0; tidx < num_triangles; ++tidx) {
+        const Eigen::Vector3i &triangle = mesh.triangles_[tidx];
+        const Eigen::Vector3d &v0 = mesh.vertices_[triangle(0)];
+        const Eigen::Vector3d &v1 = mesh.vertices_[triangle(1)];
+        const Eigen::Vector3d &v2 = mesh.vertices_[triangle(2)];
+        triangle_min[tidx] = v0.cwiseMin(v1).cwiseMin(v2);
+        triangle_max[tidx] = v0.cwiseMax(v1).cwiseMax(v2);
+        centroids[tidx] = 0.5 * (triangle_min[tidx] + triangle_max[tidx]);
+    }
+    std::vector<int> order(num_triangles);
+    std::iota(order.begin(), order.end(), 0);
+
+    // Nodes are split level by level. The triangles of a node are a range of
+    // order, which the split partitions in place, so all nodes of a level
+    // can be processed in parallel.
+    struct BuildTask {
+        int node_;
+        int begin_;
+        int end_;
+    };
+    std::vector<BuildTask> tasks = {{0, 0, num_triangles}};
+    nodes_.emplace_back();
+    for (int depth = 0; !tasks.empty(); ++depth) {
+        std::vector<int> splits(tasks.size(), -1);
+#pragma omp parallel for schedule(dynamic)
+        for (int i = 0; i < int(tasks.size()); ++i) {
+            const BuildTask &task = tasks[i];
+            Bounds bounds;
+            Bounds centroid_bounds;
+            for (int k = task.begin_; k < task.end_; ++k) {
+                bounds.Grow(triangle_min[order[k]], triangle_max[order[k]]);
+                centroid_bounds.Grow(centroids[order[k]], centroids[order[k]]);
+            }
+            Node &node = nodes_[task.node_];
+            for (int d = 0; d < 3; ++d) {
+                node.min_bound_[d] = RoundDown(bounds.min_bound_(d));
+                node.max_bound_[d] = RoundUp(bounds.max_bound_(d));
+            }
+            const int count = task.end_ - task.begin_;
+            if (count == 1 || depth >= kMaxDepth) {
+                continue;
+            }
+
+            // Binned surface area heuristic over all three axes.
+            const double area =
+                    std::max(bounds.HalfArea(),
+                             std::numeric_limits<double>::min());
+            double best_cost = std::numeric_limits<double>::infinity();
+            int best_axis = -1;
+            int best_bin = -1;
+            for (int axis = 0; axis < 3; ++axis) {
+                const double offset = centroid_bounds.min_bound_(axis);
+                const double extent =
+                        centroid_bounds.max_bound_(axis) - offset;
+                if (!(extent > 0)) {
+                    continue;
+                }
+                const double scale = kNumBins / extent;
+                Bounds bins[kNumBins];
+                int bin_counts[kNumBins] = {0};
+                for (int k = task.begin_; k < task.end_; ++k) {
+                    int b = std::min(
+                            int((centroids[order[k]](axis) - offset) * scale),
+                            kNumBins - 1);
+                    bins[b].Grow(triangle_min[order[k]],
+                                 triangle_max[order[k]]);
+                    bin_counts[b]++;
+                }
+                double right_area[kNumBins];
+                int right_count[kNumBins];
+                Bounds right;
+                int count_right = 0;
+                for (int b = kNumBins - 1; b > 0; --b) {
+                    right.Grow(bins[b]);
+                    count_right += bin_counts[b];
+                    right_area[b] = right.HalfArea();
+                    right_count[b] = count_right;
+                }
+                Bounds left;
+                int count_left = 0;
+                for (int b = 1; b < kNumBins; ++b) {
+                    left.Grow(bins[b - 1]);
+                    count_left += bin_counts[b - 1];
+                    if (count_left == 0 || right_count[b] == 0) {
+                        continue;
+                    }
+                    const double cost =
+                            kTraversalCost + (count_left * left.HalfArea() +
+                                              right_count[b] * right_area[b]) /
+                                                     area;
+                    if (cost < best_cost) {
+                        best_cost = cost;
+                        best_axis = axis;
+                        best_bin = b;
+                    }
+                }
+            }
+            if (best_axis < 0 ||
+                (count <= kMaxLeafSize && best_cost >= count)) {
+                continue;
+            }
+
+            const double offset = centroid_bounds.min_bound_(best_axis);
+            const double scale =
+                    kNumBins / (centroid_bounds.max_bound_(best_axis) - offset);
+            auto mid = std::partition(
+                    order.begin() + task.begin_, order.begin() + task.end_,
+                    [&](int tidx) {
+                        return std::min(int((centroids[tidx](best_axis) -
+                                             offset) *
+                                            scale),
+                                        kNumBins - 1) < best_bin;
+                    });
+            splits[i] = int(mid - order.begin());
+        }
+
+        std::vector<BuildTask> next_tasks;
+        for (size_t i = 0; i < tasks.size(); ++i) {
+            const BuildTask &task = tasks[i];
+            if (splits[i] < 0) {
+                nodes_[task.node_].index_ = task.begin_;
+                nodes_[task.node_].count_ = task.end_ - task.begin_;
+            } else {
+                const int left = int(nodes_.size());
+                nodes_[task.node_].index_ = left;
+                nodes_[task.node_].count_ = 0;
+                nodes_.emplace_back();
+                nodes_.emplace_back();
+                next_tasks.push_back({left, task.begin_, splits[i]});
+                next_tasks.push_back({left + 1, splits[i], task.end_});
+            }
+        }
+        tasks.swap(next_tasks);
+    }
+
+    triangle_indices_ = order;
+    vertices_.resize(3 * num_triangles);
+#pragma omp parallel for schedule(static)
+    for (int k = 0; k < num_triangles; ++k) {
+        const Eigen::Vector3i &triangle = mesh.triangles_[order[k]];
+        for (int j = 0; j < 3; ++j) {
+            vertices_[3 * k + j] = mesh.vertices_[triangle(j)];
+        }
+    }
+    return true;
+}
+
+int TriangleMeshBVH::SearchAABB(const Eigen::Vector3d &min_bound,
+                                const Eigen::Vector3d &max_bound,
+                                std::vector<int> &indices) const {
+    indices.clear();
+    if (nodes_.empty()) {
+        return 0;
+    }
+    int stack[kStackSize];
+    int size = 0;
+    stack[size++] = 0;
+    while (size > 0) {
+        const Node &node = nodes_[stack[--size]];
+        if (!BoxesOverlap(node, min_bound, max_bound)) {
+            continue;
+        }
+        if (!node.IsLeaf()) {
+            stack[size++] = node.index_ + 1;
+            stack[size++] = node.index_;
+            continue;
+        }
+        for (int k = node.index_; k < node.index_ + node.count_; ++k) {
+            const Eigen::Vector3d &v0 = vertices_[3 * k];
+            const Eigen::Vector3d &v1 = vertices_[3 * k + 1];
+            const Eigen::Vector3d &v2 = vertices_[3 * k + 2];
+            if ((v0.cwiseMin(v1).cwiseMin(v2).array() <= max_bound.array())
+                        .all() &&
+                (v0.cwiseMax(v1).cwiseMax(v2).array() >= min_bound.array())
+                        .all()) {
+                indices.push_back(triangle_indices_[k]);
+            }
+        }
+    }
+    return int(indices.size());
+}
+
+TriangleMeshBVH::RayHit TriangleMeshBVH::CastRay(
+        const Eigen::Vector3d &origin,
+        const Eigen::Vector3d &direction,
+        double max_t) const {
+    RayHit hit;
+    const Eigen::Vector3d inv_direction = direction.cwiseInverse();
+    double t_enter;
+    if (nodes_.empty() ||
+        !RayBox(nodes_[0], origin, inv_direction, max_t, t_enter)) {
+        return hit;
+    }
+    double t_max = max_t;
+    StackEntry stack[kStackSize];
+    int size = 0;
+    stack[size++] = {0, t_enter};
+    while (size > 0) {
+        const StackEntry entry = stack[--size];
+        if (entry.bound_ > t_max) {
+            continue;
+        }
+        const Node &node = nodes_[entry.node_];
+        if (node.IsLeaf()) {
+            for (int k = node.index_; k < node.index_ + node.count_; ++k) {
+                double t, u, v;
+                if (RayTriangle(origin, direction, vertices_[3 * k],
+                                vertices_[3 * k + 1], vertices_[3 * k + 2],
+                                t_max, t, u, v)) {
+                    t_max = t;
+                    hit.triangle_index_ = triangle_indices_[k];
+                    hit.t_ = t;
+                    hit.uv_ = Eigen::Vector2d(u, v);
+                }
+            }
+            continue;
+        }
+        // Visit the nearer child first.
+        double t_left, t_right;
+        const bool left = RayBox(nodes_[node.index_], origin, inv_direction,
+                                 t_max, t_left);
+        const bool right = RayBox(nodes_[node.index_ + 1], origin,
+                                  inv_direction, t_max, t_right);
+        if (left && right && t_left > t_right) {
+            stack[size++] = {node.index_, t_left};
+            stack[size++] = {node.index_ + 1, t_right};
+        } else {
+            if (right) {
+                stack[size++] = {node.index_ + 1, t_right};
+            }
+            if (left) {
+                stack[size++] = {node.index_, t_left};
+            }
+        }
+    }
+    return hit;
+}
+
+std::vector<TriangleMeshBVH::RayHit> TriangleMeshBVH::CastRays(
+        const std::vector<Eigen::Vector3d> &origins,
+        const std::vector<Eigen::Vector3d> &directions,
+        double max_t) const {
+    if (origins.size() != directions.size()) {
+        utility::LogError(
+                "[CastRays] Number of origins ({}) and directions ({}) "
+                "differ.",
+                origins.size(), directions.size());
+    }
+    std::vector<RayHit> hits(origins.size());
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < int(origins.size()); ++i) {
+        hits[i] = CastRay(origins[i], directions[i], max_t);
+    }
+    return hits;
+}
+
+TriangleMeshBVH::ClosestPoint TriangleMeshBVH::ComputeClosestPoint(
+        const Eigen::Vector3d &query) const {
+    ClosestPoint result;
+    if (nodes_.empty()) {
+        return result;
+    }
+    double best_distance2 = std::numeric_limits<double>::infinity();
+    StackEntry stack[kStackSize];
+    int size = 0;
+    stack[size++] = {0, PointBoxDistance2(nodes_[0], query)};
+    while (size > 0) {
+        const StackEntry entry = stack[--size];
+        if (entry.bound_ >= best_distance2) {
+            continue;
+        }
+        const Node &node = nodes_[entry.node_];
+        if (node.IsLeaf()) {
+            for (int k = node.index_; k < node.index_ + node.count_; ++k) {
+                const Eigen::Vector3d point = ClosestPointOnTriangle(
+                        query, vertices_[3 * k], vertices_[3 * k + 1],
+                        vertices_[3 * k + 2]);
+                const double distance2 = (point - query).squaredNorm();
+                if (distance2 < best_distance2) {
+                    best_distance2 = distance2;
+                    result.triangle_index_ = triangle_indices_[k];
+                    result.point_ = point;
+                }
+            }
+            continue;
+        }
+        // Visit the nearer child first.
+        const double d_left = PointBoxDistance2(nodes_[node.index_], query);
+        const double d_right =
+                PointBoxDistance2(nodes_[node.index_ + 1], query);
+        if (d_left > d_right) {
+            stack[size++] = {node.index_, d_left};
+            stack[size++] = {node.index_ + 1, d_right};
+        } else {
+            stack[size++] = {node.index_ + 1, d_right};
+            stack[size++] = {node.index_, d_left};
+        }
+    }
+    result.distance_ = std::sqrt(best_distance2);
+    return result;
+}
+
+std::vector<TriangleMeshBVH::ClosestPoint>
+TriangleMeshBVH::ComputeClosestPoints(
+        const std::vector<Eigen::Vector3d> &queries) const {
+    std::vector<ClosestPoint> results(queries.size());
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < int(queries.size()); ++i) {
+        results[i] = ComputeClosestPoint(queries[i]);
+    }
+    return results;
+}
+
+std::vector<double> TriangleMeshBVH::ComputeDistance(
+        const std::vector<Eigen::Vector3d> &points) const {
+    std::vector<double> distances(points.size());
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < int(points.size()); ++i) {
+        distances[i] = ComputeClosestPoint(points[i]).distance_;
+    }
+    return distances;
+}
+
+}  // namespace geometry
+}  // namespace open3d
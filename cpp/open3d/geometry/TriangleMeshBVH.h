@@ -0,0 +1,150 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+class TriangleMesh;
+
+/// \class TriangleMeshBVH
+///
+/// \brief Bounding volume hierarchy over the triangles of a TriangleMesh.
+///
+/// The hierarchy is built top-down with the binned surface area heuristic,
+/// processing all nodes of a level in parallel. Nodes are stored in a flat
+/// array in breadth-first order, siblings are adjacent. The BVH keeps its own
+/// copy of the triangle vertices, so it stays valid when the mesh changes.
+class TriangleMeshBVH {
+public:
+    /// \brief Flattened BVH node of 32 bytes.
+    ///
+    /// The single precision bounds are rounded outwards, so they always
+    /// contain the double precision triangles.
+    struct Node {
+        float min_bound_[3];
+        float max_bound_[3];
+        /// Index of the first triangle for leaves, index of the left child
+        /// for inner nodes. The right child follows the left child.
+        int32_t index_;
+        /// Number of triangles for leaves, 0 for inner nodes.
+        int32_t count_;
+
+        bool IsLeaf() const { return count_ > 0; }
+    };
+
+    /// \brief Result of a ray cast.
+    struct RayHit {
+        /// Index of the hit triangle in the mesh, -1 if nothing was hit.
+        int triangle_index_ = -1;
+        /// Ray parameter of the hit, infinity if nothing was hit.
+        double t_ = std::numeric_limits<double>::infinity();
+        /// Barycentric coordinates of the hit with respect to the second
+        /// and third triangle vertex.
+        Eigen::Vector2d uv_ = Eigen::Vector2d::Zero();
+    };
+
+    /// \brief Result of a closest point query.
+    struct ClosestPoint {
+        /// Index of the closest triangle in the mesh, -1 for an empty mesh.
+        int triangle_index_ = -1;
+        /// Closest point on the mesh.
+        Eigen::Vector3d point_ = Eigen::Vector3d::Zero();
+        /// Distance between the query point and the closest point.
+        double distance_ = std::numeric_limits<double>::infinity();
+    };
+
+    /// \brief Default Constructor.
+    TriangleMeshBVH();
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param mesh Triangle mesh from which the BVH is built.
+    explicit TriangleMeshBVH(const TriangleMesh &mesh);
+
+public:
+    /// Builds the BVH over the triangles of \p mesh.
+    bool SetTriangleMesh(const TriangleMesh &mesh);
+
+    /// Returns the indices of all triangles whose bounding boxes overlap the
+    /// box given by \p min_bound and \p max_bound, touching boxes included.
+    int SearchAABB(const Eigen::Vector3d &min_bound,
+                   const Eigen::Vector3d &max_bound,
+                   std::vector<int> &indices) const;
+
+    /// \brief Returns the first triangle hit by the ray origin + t *
+    /// direction with 0 <= t <= \p max_t.
+    ///
+    /// The direction does not need to be normalized.
+    RayHit CastRay(const Eigen::Vector3d &origin,
+                   const Eigen::Vector3d &direction,
+                   double max_t = std::numeric_limits<double>::infinity())
+            const;
+
+    /// Casts a batch of rays in parallel, see CastRay.
+    std::vector<RayHit> CastRays(
+            const std::vector<Eigen::Vector3d> &origins,
+            const std::vector<Eigen::Vector3d> &directions,
+            double max_t = std::numeric_limits<double>::infinity()) const;
+
+    /// Returns the point on the mesh closest to \p query.
+    ClosestPoint ComputeClosestPoint(const Eigen::Vector3d &query) const;
+
+    /// Computes the closest points of a batch of queries in parallel.
+    std::vector<ClosestPoint> ComputeClosestPoints(
+            const std::vector<Eigen::Vector3d> &queries) const;
+
+    /// Computes the unsigned distance of each point to the mesh in parallel.
+    std::vector<double> ComputeDistance(
+            const std::vector<Eigen::Vector3d> &points) const;
+
+    /// Returns the flattened nodes, the root is the first node.
+    const std::vector<Node> &GetNodes() const { return nodes_; }
+
+    /// Returns the mesh triangle index of each triangle in BVH order. A leaf
+    /// covers the entries [index_, index_ + count_).
+    const std::vector<int> &GetTriangleIndices() const {
+        return triangle_indices_;
+    }
+
+    /// Returns the number of triangles in the BVH.
+    size_t NumTriangles() const { return triangle_indices_.size(); }
+
+private:
+    std::vector<Node> nodes_;
+    /// Mesh triangle index of each triangle in BVH order.
+    std::vector<int> triangle_indices_;
+    /// Three vertices per triangle in BVH order.
+    std::vector<Eigen::Vector3d> vertices_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
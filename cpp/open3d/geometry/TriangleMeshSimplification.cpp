@@ -25,6 +25,8 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <numeric>
 #include <queue>
 #include <tuple>
 
@@ -262,15 +264,662 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyVertexClustering(
     return mesh;
 }
 
+/// Parallel edge collapse with quadric error metrics. Every round computes
+/// the cheapest valid collapse of each vertex, takes the cheapest of these
+/// candidates and applies as many of them as possible that do not modify
+/// the same triangles, concurrently. The adjacency is kept in flat arrays
+/// that are rebuilt from the remaining triangles at the start of every
+/// round.
+class ParallelQuadricDecimation {
+public:
+    ParallelQuadricDecimation(TriangleMesh& mesh)
+        : mesh_(mesh),
+          vertices_deleted_(mesh.vertices_.size(), 0),
+          triangles_deleted_(mesh.triangles_.size(), 0),
+          quadrics_(mesh.vertices_.size()),
+          costs_(mesh.vertices_.size()),
+          partners_(mesh.vertices_.size(), -1),
+          vbars_(mesh.vertices_.size()),
+          shared_triangles_(mesh.vertices_.size(), 0),
+          modified_(mesh.vertices_.size(), 1),
+          active_(mesh.vertices_.size(), 0),
+          frozen_(mesh.vertices_.size(), 0),
+          endpoint_locks_(mesh.vertices_.size(), -1),
+          locks_(mesh.vertices_.size(), -1) {}
+
+    void Run(int target_number_of_triangles,
+             double maximum_error,
+             double boundary_weight) {
+        remaining_vertices_.resize(mesh_.vertices_.size());
+        std::iota(remaining_vertices_.begin(), remaining_vertices_.end(), 0);
+        remaining_triangles_.resize(mesh_.triangles_.size());
+        std::iota(remaining_triangles_.begin(), remaining_triangles_.end(), 0);
+        BuildAdjacency();
+        ComputeQuadrics(boundary_weight);
+
+        int round = 0;
+        while (int(remaining_triangles_.size()) > target_number_of_triangles) {
+            if (round > 0) {
+                BuildAdjacency();
+            }
+            ComputeCandidates(maximum_error);
+            std::vector<int> collapses = SelectCollapses();
+            if (collapses.empty()) {
+                break;
+            }
+            ApplyCollapses(collapses, target_number_of_triangles);
+            utility::LogDebug(
+                    "[SimplifyQuadricDecimation] round {:d}: {:d} collapses, "
+                    "{:d} triangles",
+                    round, collapses.size(), remaining_triangles_.size());
+            ++round;
+        }
+        Compact();
+    }
+
+private:
+    /// Maps every vertex to its remaining triangles and to its neighboring
+    /// vertices. A vertex has at most twice as many neighbors as triangles,
+    /// so both use the same offsets.
+    void BuildAdjacency() {
+        const int n_vertices = int(mesh_.vertices_.size());
+        const int n_triangles = int(remaining_triangles_.size());
+        offsets_.assign(n_vertices + 1, 0);
+#pragma omp parallel for schedule(static)
+        for (int k = 0; k < n_triangles; ++k) {
+            const Eigen::Vector3i& tria =
+                    mesh_.triangles_[remaining_triangles_[k]];
+            for (int i = 0; i < 3; ++i) {
+#pragma omp atomic
+                ++offsets_[tria(i) + 1];
+            }
+        }
+        for (int vidx = 0; vidx < n_vertices; ++vidx) {
+            offsets_[vidx + 1] += offsets_[vidx];
+        }
+        vertex_triangles_.resize(offsets_[n_vertices]);
+        std::vector<int> fill(offsets_.begin(), offsets_.end() - 1);
+#pragma omp parallel for schedule(static)
+        for (int k = 0; k < n_triangles; ++k) {
+            const int tidx = remaining_triangles_[k];
+            const Eigen::Vector3i& tria = mesh_.triangles_[tidx];
+            for (int i = 0; i < 3; ++i) {
+                int pos;
+#pragma omp atomic capture
+                pos = fill[tria(i)]++;
+                vertex_triangles_[pos] = tidx;
+            }
+        }
+
+        n_neighbors_.assign(n_vertices, 0);
+        vertex_neighbors_.resize(2 * offsets_[n_vertices]);
+        const int n_remaining = int(remaining_vertices_.size());
+#pragma omp parallel for schedule(static)
+        for (int k = 0; k < n_remaining; ++k) {
+            const int vidx = remaining_vertices_[k];
+            int* neighbors = vertex_neighbors_.data() + 2 * offsets_[vidx];
+            int n = 0;
+            for (int l = offsets_[vidx]; l < offsets_[vidx + 1]; ++l) {
+                const Eigen::Vector3i& tria =
+                        mesh_.triangles_[vertex_triangles_[l]];
+                for (int i = 0; i < 3; ++i) {
+                    if (tria(i) != vidx) {
+                        neighbors[n++] = tria(i);
+                    }
+                }
+            }
+            std::sort(neighbors, neighbors + n);
+            n_neighbors_[vidx] =
+                    int(std::unique(neighbors, neighbors + n) - neighbors);
+        }
+    }
+
+    const int* NeighborsBegin(int vidx) const {
+        return vertex_neighbors_.data() + 2 * offsets_[vidx];
+    }
+
+    const int* NeighborsEnd(int vidx) const {
+        return NeighborsBegin(vidx) + n_neighbors_[vidx];
+    }
+
+    /// The triangles around an interior vertex of a manifold mesh form a
+    /// closed fan with as many neighbors as triangles.
+    bool IsBoundaryVertex(int vidx) const {
+        return n_neighbors_[vidx] != offsets_[vidx + 1] - offsets_[vidx];
+    }
+
+    /// Same quadrics as the sequential decimation, gathered per vertex.
+    void ComputeQuadrics(double boundary_weight) {
+        const int n_triangles = int(mesh_.triangles_.size());
+        std::vector<Eigen::Vector4d> triangle_planes(n_triangles);
+        std::vector<double> triangle_areas(n_triangles);
+#pragma omp parallel for schedule(static)
+        for (int tidx = 0; tidx < n_triangles; ++tidx) {
+            triangle_planes[tidx] = mesh_.GetTrianglePlane(tidx);
+            triangle_areas[tidx] = mesh_.GetTriangleArea(tidx);
+        }
+
+        const int n_remaining = int(remaining_vertices_.size());
+#pragma omp parallel
+        {
+            std::vector<int> triangles;
+#pragma omp for schedule(static)
+            for (int k = 0; k < n_remaining; ++k) {
+                const int vidx = remaining_vertices_[k];
+                // Summed in a fixed order so that the result does not
+                // depend on the number of threads.
+                triangles.assign(vertex_triangles_.begin() + offsets_[vidx],
+                                 vertex_triangles_.begin() +
+                                         offsets_[vidx + 1]);
+                std::sort(triangles.begin(), triangles.end());
+                Quadric& quadric = quadrics_[vidx];
+                for (int tidx : triangles) {
+                    quadric += Quadric(triangle_planes[tidx],
+                                       triangle_areas[tidx]);
+                    // For boundary edges add perpendicular plane quadric
+                    const Eigen::Vector3i& tria = mesh_.triangles_[tidx];
+                    for (int i = 0; i < 3; ++i) {
+                        const int vidx0 = tria(i);
+                        const int vidx1 = tria((i + 1) % 3);
+                        if ((vidx0 != vidx && vidx1 != vidx) ||
+                            CountSharedTriangles(vidx0, vidx1) != 1) {
+                            continue;
+                        }
+                        const auto& vert0 = mesh_.vertices_[vidx0];
+                        const auto& vert1 = mesh_.vertices_[vidx1];
+                        const auto& vert2 = mesh_.vertices_[tria((i + 2) % 3)];
+                        Eigen::Vector3d vert2p =
+                                (vert2 - vert0).cross(vert2 - vert1);
+                        Eigen::Vector4d plane =
+                                TriangleMesh::ComputeTrianglePlane(vert0, vert1,
+                                                                   vert2p);
+                        quadric += Quadric(plane, triangle_areas[tidx] *
+                                                          boundary_weight);
+                    }
+                }
+            }
+        }
+    }
+
+    /// Number of remaining triangles that contain both vertices.
+    int CountSharedTriangles(int vidx0, int vidx1) const {
+        int count = 0;
+        for (int k = offsets_[vidx0]; k < offsets_[vidx0 + 1]; ++k) {
+            const Eigen::Vector3i& tria =
+                    mesh_.triangles_[vertex_triangles_[k]];
+            count += tria(0) == vidx1 || tria(1) == vidx1 || tria(2) == vidx1;
+        }
+        return count;
+    }
+
+    /// Same cost and target position as the sequential decimation.
+    double ComputeCost(int vidx0, int vidx1, Eigen::Vector3d& vbar) const {
+        const int min = std::min(vidx0, vidx1);
+        const int max = std::max(vidx0, vidx1);
+        Quadric Qbar = quadrics_[min] + quadrics_[max];
+        if (Qbar.IsInvertible()) {
+            vbar = Qbar.Minimum();
+            return Qbar.Eval(vbar);
+        }
+        const Eigen::Vector3d& v0 = mesh_.vertices_[min];
+        const Eigen::Vector3d& v1 = mesh_.vertices_[max];
+        Eigen::Vector3d vmid = (v0 + v1) / 2;
+        double cost0 = Qbar.Eval(v0);
+        double cost1 = Qbar.Eval(v1);
+        double costmid = Qbar.Eval(vmid);
+        double cost = std::min(cost0, std::min(cost1, costmid));
+        if (cost == costmid) {
+            vbar = vmid;
+        } else if (cost == cost0) {
+            vbar = v0;
+        } else {
+            vbar = v1;
+        }
+        return cost;
+    }
+
+    /// Tests if moving \p vidx to \p vbar flips the normal of one of its
+    /// triangles that does not contain \p other.
+    bool FlipsTriangle(int vidx, int other, const Eigen::Vector3d& vbar) const {
+        for (int k = offsets_[vidx]; k < offsets_[vidx + 1]; ++k) {
+            const Eigen::Vector3i& tria =
+                    mesh_.triangles_[vertex_triangles_[k]];
+            if (tria(0) == other || tria(1) == other || tria(2) == other) {
+                continue;
+            }
+            Eigen::Vector3d vert0 = mesh_.vertices_[tria(0)];
+            Eigen::Vector3d vert1 = mesh_.vertices_[tria(1)];
+            Eigen::Vector3d vert2 = mesh_.vertices_[tria(2)];
+            Eigen::Vector3d norm_before = (vert1 - vert0).cross(vert2 - vert0);
+            norm_before /= norm_before.norm();
+            if (vidx == tria(0)) {
+                vert0 = vbar;
+            } else if (vidx == tria(1)) {
+                vert1 = vbar;
+            } else {
+                vert2 = vbar;
+            }
+            Eigen::Vector3d norm_after = (vert1 - vert0).cross(vert2 - vert0);
+            norm_after /= norm_after.norm();
+            if (norm_before.dot(norm_after) < 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Finds the cheapest collapse of every vertex that keeps the mesh
+    /// manifold and does not flip triangles. The two vertices of the edge
+    /// may only share the neighbors opposite to the edge (link condition).
+    /// The boundary counts as a virtual neighbor of all boundary vertices
+    /// that is opposite to boundary edges, so that an interior edge between
+    /// two boundary vertices is not collapsed.
+    void ComputeCandidates(double maximum_error) {
+        typedef std::tuple<double, int, Eigen::Vector3d> CostEdge;
+        const int n_remaining = int(remaining_vertices_.size());
+#pragma omp parallel
+        {
+            std::vector<CostEdge> edges;
+#pragma omp for schedule(dynamic, 256)
+            for (int k = 0; k < n_remaining; ++k) {
+                const int vidx = remaining_vertices_[k];
+                // The candidate is kept if no collapse modified the
+                // triangles of the vertex or of its neighbors.
+                bool changed = modified_[vidx];
+                for (const int* nb = NeighborsBegin(vidx);
+                     !changed && nb != NeighborsEnd(vidx); ++nb) {
+                    changed = modified_[*nb];
+                }
+                if (!changed) {
+                    continue;
+                }
+                partners_[vidx] = -1;
+                edges.clear();
+                for (const int* nb = NeighborsBegin(vidx);
+                     nb != NeighborsEnd(vidx); ++nb) {
+                    Eigen::Vector3d vbar;
+                    double cost = ComputeCost(vidx, *nb, vbar);
+                    if (cost <= maximum_error) {
+                        edges.emplace_back(cost, *nb, vbar);
+                    }
+                }
+                std::sort(edges.begin(), edges.end(),
+                          [](const CostEdge& a, const CostEdge& b) {
+                              return std::get<0>(a) < std::get<0>(b) ||
+                                     (std::get<0>(a) == std::get<0>(b) &&
+                                      std::get<1>(a) < std::get<1>(b));
+                          });
+                for (const CostEdge& edge : edges) {
+                    const int other = std::get<1>(edge);
+                    const Eigen::Vector3d& vbar = std::get<2>(edge);
+                    int n_common = 0;
+                    const int* nb0 = NeighborsBegin(vidx);
+                    const int* nb1 = NeighborsBegin(other);
+                    while (nb0 != NeighborsEnd(vidx) &&
+                           nb1 != NeighborsEnd(other)) {
+                        if (*nb0 < *nb1) {
+                            ++nb0;
+                        } else if (*nb1 < *nb0) {
+                            ++nb1;
+                        } else {
+                            ++n_common;
+                            ++nb0;
+                            ++nb1;
+                        }
+                    }
+                    const int n_shared = CountSharedTriangles(vidx, other);
+                    const bool boundary_vertices =
+                            IsBoundaryVertex(vidx) && IsBoundaryVertex(other);
+                    const bool boundary_edge = n_shared == 1;
+                    if (n_common + boundary_vertices !=
+                                n_shared + boundary_edge ||
+                        FlipsTriangle(vidx, other, vbar) ||
+                        FlipsTriangle(other, vidx, vbar)) {
+                        continue;
+                    }
+                    costs_[vidx] = std::get<0>(edge);
+                    partners_[vidx] = other;
+                    vbars_[vidx] = vbar;
+                    shared_triangles_[vidx] = n_shared;
+                    break;
+                }
+            }
+        }
+        std::fill(modified_.begin(), modified_.end(), 0);
+    }
+
+    /// Pseudo-random order of the candidate collapses of two vertices, which
+    /// decides between overlapping candidates of similar cost. -1 is no
+    /// candidate.
+    bool HasPriority(int vidx0, int vidx1) const {
+        if (vidx0 < 0) {
+            return false;
+        }
+        if (vidx1 < 0) {
+            return true;
+        }
+        auto hash = [&](int vidx) {
+            uint32_t h =
+                    uint32_t(std::min(vidx, partners_[vidx])) * 73856093u ^
+                    uint32_t(std::max(vidx, partners_[vidx])) * 19349663u;
+            h ^= h >> 16;
+            h *= 0x85ebca6bu;
+            h ^= h >> 13;
+            return h;
+        };
+        const uint32_t h0 = hash(vidx0);
+        const uint32_t h1 = hash(vidx1);
+        return h0 < h1 || (h0 == h1 && vidx0 < vidx1);
+    }
+
+    /// Tests the closed neighborhoods of the two vertices of the candidate
+    /// collapse of \p vidx. These are the vertices of all triangles that the
+    /// collapse modifies.
+    template <typename Predicate>
+    bool AllTouched(int vidx, Predicate predicate) const {
+        const int other = partners_[vidx];
+        if (!predicate(vidx) || !predicate(other)) {
+            return false;
+        }
+        for (const int* nb = NeighborsBegin(vidx); nb != NeighborsEnd(vidx);
+             ++nb) {
+            if (!predicate(*nb)) {
+                return false;
+            }
+        }
+        for (const int* nb = NeighborsBegin(other); nb != NeighborsEnd(other);
+             ++nb) {
+            if (!predicate(*nb)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Selects collapses among the cheapest candidates such that no two of
+    /// them touch the same vertex. A candidate is selected if it has the
+    /// highest priority among all candidates that touch one of its
+    /// vertices. The vertices touched by selected collapses are frozen, the
+    /// candidates that touch them are dropped, and the selection repeats
+    /// until no candidate is left. Returns the vertices whose candidates are
+    /// selected.
+    std::vector<int> SelectCollapses() {
+        const int n_remaining = int(remaining_vertices_.size());
+        std::vector<double> candidate_costs;
+        for (int vidx : remaining_vertices_) {
+            if (partners_[vidx] >= 0) {
+                candidate_costs.push_back(costs_[vidx]);
+            }
+        }
+        if (candidate_costs.empty()) {
+            return std::vector<int>();
+        }
+        auto nth = candidate_costs.begin() +
+                   size_t(candidate_costs.size() * kCandidateFraction);
+        std::nth_element(candidate_costs.begin(), nth, candidate_costs.end());
+        const double threshold = *nth;
+
+        // Both vertices of an edge may have it as candidate, keep one.
+        int n_active = 0;
+#pragma omp parallel for schedule(static) reduction(+ : n_active)
+        for (int k = 0; k < n_remaining; ++k) {
+            const int vidx = remaining_vertices_[k];
+            const int other = partners_[vidx];
+            active_[vidx] = other >= 0 && costs_[vidx] <= threshold &&
+                            !(partners_[other] == vidx && other < vidx);
+            frozen_[vidx] = 0;
+            n_active += active_[vidx];
+        }
+
+        std::vector<int> collapses;
+        while (n_active > 0) {
+            // Highest priority candidate with each vertex as an endpoint.
+#pragma omp parallel for schedule(static)
+            for (int k = 0; k < n_remaining; ++k) {
+                const int vidx = remaining_vertices_[k];
+                int best = active_[vidx] ? vidx : -1;
+                for (const int* nb = NeighborsBegin(vidx);
+                     nb != NeighborsEnd(vidx); ++nb) {
+                    if (active_[*nb] && partners_[*nb] == vidx &&
+                        HasPriority(*nb, best)) {
+                        best = *nb;
+                    }
+                }
+                endpoint_locks_[vidx] = best;
+            }
+            // Highest priority candidate that touches each vertex.
+#pragma omp parallel for schedule(static)
+            for (int k = 0; k < n_remaining; ++k) {
+                const int vidx = remaining_vertices_[k];
+                int best = endpoint_locks_[vidx];
+                for (const int* nb = NeighborsBegin(vidx);
+                     nb != NeighborsEnd(vidx); ++nb) {
+                    if (HasPriority(endpoint_locks_[*nb], best)) {
+                        best = endpoint_locks_[*nb];
+                    }
+                }
+                locks_[vidx] = best;
+            }
+
+            std::vector<int> selected;
+#pragma omp parallel
+            {
+                std::vector<int> selected_local;
+#pragma omp for schedule(static) nowait
+                for (int k = 0; k < n_remaining; ++k) {
+                    const int vidx = remaining_vertices_[k];
+                    if (active_[vidx] &&
+                        AllTouched(vidx, [&](int touched) {
+                            return locks_[touched] == vidx;
+                        })) {
+                        selected_local.push_back(vidx);
+                    }
+                }
+#pragma omp critical
+                {
+                    selected.insert(selected.end(), selected_local.begin(),
+                                    selected_local.end());
+                }
+            }
+            // The selected collapses touch disjoint sets of vertices.
+            const int n_selected = int(selected.size());
+#pragma omp parallel for schedule(static)
+            for (int k = 0; k < n_selected; ++k) {
+                AllTouched(selected[k], [&](int touched) {
+                    frozen_[touched] = 1;
+                    return true;
+                });
+            }
+            n_active = 0;
+#pragma omp parallel for schedule(static) reduction(+ : n_active)
+            for (int k = 0; k < n_remaining; ++k) {
+                const int vidx = remaining_vertices_[k];
+                if (active_[vidx]) {
+                    active_[vidx] = AllTouched(vidx, [&](int touched) {
+                        return !frozen_[touched];
+                    });
+                    n_active += active_[vidx];
+                }
+            }
+            collapses.insert(collapses.end(), selected.begin(),
+                             selected.end());
+        }
+        std::sort(collapses.begin(), collapses.end());
+        return collapses;
+    }
+
+    /// Applies the selected collapses, the cheapest first if the target
+    /// would otherwise be overshot. The vertex with the larger index is
+    /// merged into the other one.
+    void ApplyCollapses(std::vector<int>& collapses,
+                        int target_number_of_triangles) {
+        const int n_triangles = int(remaining_triangles_.size());
+        int n_removed = 0;
+        for (int vidx : collapses) {
+            n_removed += shared_triangles_[vidx];
+        }
+        if (n_triangles - n_removed < target_number_of_triangles) {
+            std::sort(collapses.begin(), collapses.end(), [&](int a, int b) {
+                return costs_[a] < costs_[b] ||
+                       (costs_[a] == costs_[b] && a < b);
+            });
+            size_t n_kept = 0;
+            n_removed = 0;
+            while (n_triangles - n_removed > target_number_of_triangles) {
+                n_removed += shared_triangles_[collapses[n_kept++]];
+            }
+            collapses.resize(n_kept);
+        }
+
+        const bool has_vert_normal = mesh_.HasVertexNormals();
+        const bool has_vert_color = mesh_.HasVertexColors();
+        const int n_collapses = int(collapses.size());
+#pragma omp parallel for schedule(static)
+        for (int k = 0; k < n_collapses; ++k) {
+            AllTouched(collapses[k], [&](int touched) {
+                modified_[touched] = 1;
+                return true;
+            });
+            const int vidx0 = std::min(collapses[k], partners_[collapses[k]]);
+            const int vidx1 = std::max(collapses[k], partners_[collapses[k]]);
+            // Connect triangles from vidx1 to vidx0, or mark deleted
+            for (int l = offsets_[vidx1]; l < offsets_[vidx1 + 1]; ++l) {
+                const int tidx = vertex_triangles_[l];
+                Eigen::Vector3i& tria = mesh_.triangles_[tidx];
+                if (tria(0) == vidx0 || tria(1) == vidx0 || tria(2) == vidx0) {
+                    triangles_deleted_[tidx] = 1;
+                } else if (vidx1 == tria(0)) {
+                    tria(0) = vidx0;
+                } else if (vidx1 == tria(1)) {
+                    tria(1) = vidx0;
+                } else {
+                    tria(2) = vidx0;
+                }
+            }
+            mesh_.vertices_[vidx0] = vbars_[collapses[k]];
+            quadrics_[vidx0] += quadrics_[vidx1];
+            if (has_vert_normal) {
+                mesh_.vertex_normals_[vidx0] =
+                        0.5 * (mesh_.vertex_normals_[vidx0] +
+                               mesh_.vertex_normals_[vidx1]);
+            }
+            if (has_vert_color) {
+                mesh_.vertex_colors_[vidx0] =
+                        0.5 * (mesh_.vertex_colors_[vidx0] +
+                               mesh_.vertex_colors_[vidx1]);
+            }
+            vertices_deleted_[vidx1] = 1;
+        }
+
+        remaining_vertices_.erase(
+                std::remove_if(
+                        remaining_vertices_.begin(), remaining_vertices_.end(),
+                        [&](int vidx) { return vertices_deleted_[vidx]; }),
+                remaining_vertices_.end());
+        remaining_triangles_.erase(
+                std::remove_if(
+                        remaining_triangles_.begin(),
+                        remaining_triangles_.end(),
+                        [&](int tidx) { return triangles_deleted_[tidx]; }),
+                remaining_triangles_.end());
+    }
+
+    /// Removes the deleted vertices and triangles from the mesh.
+    void Compact() {
+        const bool has_vert_normal = mesh_.HasVertexNormals();
+        const bool has_vert_color = mesh_.HasVertexColors();
+        std::vector<int> vert_remapping(mesh_.vertices_.size(), -1);
+        int next_free = 0;
+        for (size_t idx = 0; idx < mesh_.vertices_.size(); ++idx) {
+            if (!vertices_deleted_[idx]) {
+                vert_remapping[idx] = next_free;
+                mesh_.vertices_[next_free] = mesh_.vertices_[idx];
+                if (has_vert_normal) {
+                    mesh_.vertex_normals_[next_free] =
+                            mesh_.vertex_normals_[idx];
+                }
+                if (has_vert_color) {
+                    mesh_.vertex_colors_[next_free] = mesh_.vertex_colors_[idx];
+                }
+                next_free++;
+            }
+        }
+        mesh_.vertices_.resize(next_free);
+        if (has_vert_normal) {
+            mesh_.vertex_normals_.resize(next_free);
+        }
+        if (has_vert_color) {
+            mesh_.vertex_colors_.resize(next_free);
+        }
+
+        next_free = 0;
+        for (int tidx : remaining_triangles_) {
+            const Eigen::Vector3i& tria = mesh_.triangles_[tidx];
+            mesh_.triangles_[next_free] = Eigen::Vector3i(
+                    vert_remapping[tria(0)], vert_remapping[tria(1)],
+                    vert_remapping[tria(2)]);
+            next_free++;
+        }
+        mesh_.triangles_.resize(next_free);
+    }
+
+private:
+    /// Fraction of the cheapest candidates considered in each round.
+    static constexpr double kCandidateFraction = 0.25;
+
+    TriangleMesh& mesh_;
+    std::vector<uint8_t> vertices_deleted_;
+    std::vector<uint8_t> triangles_deleted_;
+    /// Vertices and triangles that are not deleted, in ascending order.
+    std::vector<int> remaining_vertices_;
+    std::vector<int> remaining_triangles_;
+    /// Remaining triangles of vertex i are
+    /// vertex_triangles_[offsets_[i] .. offsets_[i + 1]).
+    std::vector<int> offsets_;
+    std::vector<int> vertex_triangles_;
+    /// Neighbors of vertex i start at vertex_neighbors_[2 * offsets_[i]].
+    std::vector<int> vertex_neighbors_;
+    std::vector<int> n_neighbors_;
+    std::vector<Quadric> quadrics_;
+    /// Cheapest valid collapse of every vertex, partners_ is -1 if there is
+    /// none.
+    std::vector<double> costs_;
+    std::vector<int> partners_;
+    std::vector<Eigen::Vector3d> vbars_;
+    std::vector<int> shared_triangles_;
+    /// Vertices of the triangles modified since the candidates were
+    /// computed.
+    std::vector<uint8_t> modified_;
+    std::vector<uint8_t> active_;
+    std::vector<uint8_t> frozen_;
+    std::vector<int> endpoint_locks_;
+    std::vector<int> locks_;
+};
+
 std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
         int target_number_of_triangles,
-        double maximum_error = std::numeric_limits<double>::infinity(),
-        double boundary_weight = 1.0) const {
+        double maximum_error /* = std::numeric_limits<double>::infinity() */,
+        double boundary_weight /* = 1.0 */,
+        bool parallel /* = false */) const {
     if (HasTriangleUvs()) {
         utility::LogWarning(
                 "[SimplifyQuadricDecimation] This mesh contains triangle uvs "
                 "that are not handled in this function");
     }
+    if (parallel) {
+        auto mesh = std::make_shared<TriangleMesh>();
+        mesh->vertices_ = vertices_;
+        mesh->vertex_normals_ = vertex_normals_;
+        mesh->vertex_colors_ = vertex_colors_;
+        mesh->triangles_ = triangles_;
+        ParallelQuadricDecimation(*mesh).Run(target_number_of_triangles,
+                                             maximum_error, boundary_weight);
+        if (HasTriangleNormals()) {
+            mesh->ComputeTriangleNormals();
+        }
+        return mesh;
+    }
+
     typedef std::tuple<double, int, int> CostEdge;
 
     auto mesh = std::make_shared<TriangleMesh>();
@@ -223,22 +223,29 @@ public:
     ///
     /// \param input The input TriangleMesh.
     /// \param voxel_size Voxel size of of the VoxelGrid construction.
+    /// \param solid If true, the voxels inside the mesh are filled as well.
+    /// This requires a closed mesh.
     static std::shared_ptr<VoxelGrid> CreateFromTriangleMesh(
-            const TriangleMesh &input, double voxel_size);
+            const TriangleMesh &input, double voxel_size, bool solid = false);
 
     /// Creates a VoxelGrid from a given TriangleMesh. No color information is
     /// converted. The bounds of the created VoxelGrid are defined by the given
-    /// parameters..
+    /// parameters. Only the voxels overlapping the bounding box of a triangle
+    /// are tested against it.
     ///
     /// \param input The input TriangleMesh.
     /// \param voxel_size Voxel size of of the VoxelGrid construction.
     /// \param min_bound Minimum boundary point for the VoxelGrid to create.
     /// \param max_bound Maximum boundary point for the VoxelGrid to create.
+    /// \param solid If true, the voxels inside the mesh are filled as well.
+    /// Inside is determined by the parity of ray intersections, which
+    /// requires a closed mesh.
     static std::shared_ptr<VoxelGrid> CreateFromTriangleMeshWithinBounds(
             const TriangleMesh &input,
             double voxel_size,
             const Eigen::Vector3d &min_bound,
-            const Eigen::Vector3d &max_bound);
+            const Eigen::Vector3d &max_bound,
+            bool solid = false);
 
     /// Returns List of ``Voxel``: Voxels contained in voxel grid.
     /// Changes to the voxels returned from this method are not reflected in
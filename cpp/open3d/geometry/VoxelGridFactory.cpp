@@ -24,8 +24,10 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <numeric>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "open3d/geometry/IntersectionTest.h"
 #include "open3d/geometry/PointCloud.h"
@@ -115,11 +117,152 @@ std::shared_ptr<VoxelGrid> VoxelGrid::CreateFromPointCloud(
                                             max_bound);
 }
 
+namespace {
+
+using VoxelIndexSet =
+        std::unordered_set<Eigen::Vector3i,
+                           utility::hash_eigen<Eigen::Vector3i>>;
+
+/// Returns the signed double area of the triangle (o, a, p) in 2D. Edges are
+/// evaluated from their lexicographically smaller end point such that both
+/// triangles sharing an edge compute exactly the same value up to the sign.
+double EdgeFunction(const Eigen::Vector2d &a,
+                    const Eigen::Vector2d &b,
+                    const Eigen::Vector2d &p) {
+    const bool flip = b(0) < a(0) || (b(0) == a(0) && b(1) < a(1));
+    const Eigen::Vector2d &o = flip ? b : a;
+    const Eigen::Vector2d &e = flip ? a : b;
+    const double w =
+            (e(0) - o(0)) * (p(1) - o(1)) - (e(1) - o(1)) * (p(0) - o(0));
+    return flip ? -w : w;
+}
+
+/// Tie breaking rule for points on an edge. Exactly one of the two
+/// directions of an edge is accepted, so a point on an edge shared by two
+/// triangles is counted once.
+bool IsTopLeftEdge(const Eigen::Vector2d &a, const Eigen::Vector2d &b) {
+    const Eigen::Vector2d e = b - a;
+    return e(1) > 0 || (e(1) == 0 && e(0) < 0);
+}
+
+bool EdgeContains(const Eigen::Vector2d &a,
+                  const Eigen::Vector2d &b,
+                  double w) {
+    return w > 0 || (w == 0 && IsTopLeftEdge(a, b));
+}
+
+/// Adds the voxels inside the closed \p input to \p output. Rays parallel to
+/// the x axis are cast through the voxel centers of each (y, z) column and
+/// the voxels between entering and leaving intersections are filled.
+void FillInterior(const TriangleMesh &input,
+                  const Eigen::Vector3i &num_voxels,
+                  VoxelGrid &output) {
+    const double voxel_size = output.voxel_size_;
+    const Eigen::Vector3d &min_bound = output.origin_;
+    // The intersections of the triangles with the columns in the form
+    // (column index, x coordinate).
+    std::vector<std::pair<int64_t, double>> hits;
+#pragma omp parallel
+    {
+        std::vector<std::pair<int64_t, double>> hits_local;
+#pragma omp for schedule(static) nowait
+        for (int64_t t = 0; t < int64_t(input.triangles_.size()); ++t) {
+            const Eigen::Vector3i &tria = input.triangles_[t];
+            Eigen::Vector3d v[3];
+            Eigen::Vector2d q[3];
+            for (int i = 0; i < 3; ++i) {
+                v[i] = (input.vertices_[tria(i)] - min_bound) / voxel_size;
+                q[i] = v[i].tail<2>();
+            }
+            double area = EdgeFunction(q[0], q[1], q[2]);
+            if (area == 0) {
+                // Parallel to the rays.
+                continue;
+            }
+            if (area < 0) {
+                std::swap(v[1], v[2]);
+                std::swap(q[1], q[2]);
+                area = -area;
+            }
+            const Eigen::Vector2d q_min = q[0].cwiseMin(q[1]).cwiseMin(q[2]);
+            const Eigen::Vector2d q_max = q[0].cwiseMax(q[1]).cwiseMax(q[2]);
+            const int y0 = std::max(0, int(std::ceil(q_min(0) - 0.5)));
+            const int z0 = std::max(0, int(std::ceil(q_min(1) - 0.5)));
+            const int y1 = std::min(num_voxels(1) - 1,
+                                    int(std::floor(q_max(0) - 0.5)));
+            const int z1 = std::min(num_voxels(2) - 1,
+                                    int(std::floor(q_max(1) - 0.5)));
+            for (int z = z0; z <= z1; ++z) {
+                for (int y = y0; y <= y1; ++y) {
+                    const Eigen::Vector2d p(y + 0.5, z + 0.5);
+                    const double w0 = EdgeFunction(q[1], q[2], p);
+                    const double w1 = EdgeFunction(q[2], q[0], p);
+                    const double w2 = EdgeFunction(q[0], q[1], p);
+                    if (EdgeContains(q[1], q[2], w0) &&
+                        EdgeContains(q[2], q[0], w1) &&
+                        EdgeContains(q[0], q[1], w2)) {
+                        const double x =
+                                (w0 * v[0](0) + w1 * v[1](0) + w2 * v[2](0)) /
+                                area;
+                        hits_local.emplace_back(
+                                int64_t(z) * num_voxels(1) + y, x);
+                    }
+                }
+            }
+        }
+#pragma omp critical
+        {
+            hits.insert(hits.end(), hits_local.begin(), hits_local.end());
+        }
+    }
+    std::sort(hits.begin(), hits.end());
+
+    std::vector<size_t> column_begin;
+    for (size_t i = 0; i < hits.size(); ++i) {
+        if (i == 0 || hits[i].first != hits[i - 1].first) {
+            column_begin.push_back(i);
+        }
+    }
+    column_begin.push_back(hits.size());
+
+#pragma omp parallel
+    {
+        std::vector<Eigen::Vector3i> voxels_local;
+#pragma omp for schedule(dynamic, 64) nowait
+        for (int64_t c = 0; c < int64_t(column_begin.size()) - 1; ++c) {
+            const int y = int(hits[column_begin[c]].first % num_voxels(1));
+            const int z = int(hits[column_begin[c]].first / num_voxels(1));
+            // An odd number of intersections means the mesh is not closed
+            // along this column, the last intersection is ignored.
+            for (size_t i = column_begin[c]; i + 1 < column_begin[c + 1];
+                 i += 2) {
+                const int x0 =
+                        std::max(0, int(std::ceil(hits[i].second - 0.5)));
+                const int x1 =
+                        std::min(num_voxels(0) - 1,
+                                 int(std::floor(hits[i + 1].second - 0.5)));
+                for (int x = x0; x <= x1; ++x) {
+                    voxels_local.emplace_back(x, y, z);
+                }
+            }
+        }
+#pragma omp critical
+        {
+            for (const Eigen::Vector3i &grid_index : voxels_local) {
+                output.AddVoxel(geometry::Voxel(grid_index));
+            }
+        }
+    }
+}
+
+}  // namespace
+
 std::shared_ptr<VoxelGrid> VoxelGrid::CreateFromTriangleMeshWithinBounds(
         const TriangleMesh &input,
         double voxel_size,
         const Eigen::Vector3d &min_bound,
-        const Eigen::Vector3d &max_bound) {
+        const Eigen::Vector3d &max_bound,
+        bool solid) {
     auto output = std::make_shared<VoxelGrid>();
     if (voxel_size <= 0.0) {
         utility::LogError("[CreateFromTriangleMesh] voxel_size <= 0.");
@@ -133,42 +276,76 @@ std::shared_ptr<VoxelGrid> VoxelGrid::CreateFromTriangleMeshWithinBounds(
     output->origin_ = min_bound;
 
     Eigen::Vector3d grid_size = max_bound - min_bound;
-    int num_w = int(std::round(grid_size(0) / voxel_size));
-    int num_h = int(std::round(grid_size(1) / voxel_size));
-    int num_d = int(std::round(grid_size(2) / voxel_size));
+    Eigen::Vector3i num_voxels;
+    for (int i = 0; i < 3; ++i) {
+        num_voxels(i) = int(std::round(grid_size(i) / voxel_size));
+    }
     const Eigen::Vector3d box_half_size(voxel_size / 2, voxel_size / 2,
                                         voxel_size / 2);
-    for (int widx = 0; widx < num_w; widx++) {
-        for (int hidx = 0; hidx < num_h; hidx++) {
-            for (int didx = 0; didx < num_d; didx++) {
-                const Eigen::Vector3d box_center =
-                        min_bound +
-                        Eigen::Vector3d(widx, hidx, didx) * voxel_size;
-                for (const Eigen::Vector3i &tria : input.triangles_) {
-                    const Eigen::Vector3d &v0 = input.vertices_[tria(0)];
-                    const Eigen::Vector3d &v1 = input.vertices_[tria(1)];
-                    const Eigen::Vector3d &v2 = input.vertices_[tria(2)];
-                    if (IntersectionTest::TriangleAABB(
-                                box_center, box_half_size, v0, v1, v2)) {
-                        Eigen::Vector3i grid_index(widx, hidx, didx);
-                        output->AddVoxel(geometry::Voxel(grid_index));
-                        break;
+
+    // Each triangle only tests the voxels overlapping its bounding box.
+#pragma omp parallel
+    {
+        VoxelIndexSet voxels_local;
+#pragma omp for schedule(dynamic, 256) nowait
+        for (int64_t t = 0; t < int64_t(input.triangles_.size()); ++t) {
+            const Eigen::Vector3i &tria = input.triangles_[t];
+            const Eigen::Vector3d &v0 = input.vertices_[tria(0)];
+            const Eigen::Vector3d &v1 = input.vertices_[tria(1)];
+            const Eigen::Vector3d &v2 = input.vertices_[tria(2)];
+            // Voxels touching the bounding box are included because the
+            // intersection test includes the boundary.
+            const Eigen::Vector3d tria_min =
+                    (v0.cwiseMin(v1).cwiseMin(v2) - min_bound) / voxel_size;
+            const Eigen::Vector3d tria_max =
+                    (v0.cwiseMax(v1).cwiseMax(v2) - min_bound) / voxel_size;
+            Eigen::Vector3i idx_min, idx_max;
+            for (int i = 0; i < 3; ++i) {
+                idx_min(i) = std::max(0, int(std::ceil(tria_min(i))) - 1);
+                idx_max(i) = std::min(num_voxels(i) - 1,
+                                      int(std::floor(tria_max(i))));
+            }
+            for (int z = idx_min(2); z <= idx_max(2); ++z) {
+                for (int y = idx_min(1); y <= idx_max(1); ++y) {
+                    for (int x = idx_min(0); x <= idx_max(0); ++x) {
+                        const Eigen::Vector3i grid_index(x, y, z);
+                        const Eigen::Vector3d box_center =
+                                min_bound + box_half_size +
+                                grid_index.cast<double>() * voxel_size;
+                        if (IntersectionTest::TriangleAABB(
+                                    box_center, box_half_size, v0, v1, v2)) {
+                            voxels_local.insert(grid_index);
+                        }
                     }
                 }
             }
         }
+#pragma omp critical
+        {
+            for (const Eigen::Vector3i &grid_index : voxels_local) {
+                output->AddVoxel(geometry::Voxel(grid_index));
+            }
+        }
+    }
+
+    if (solid) {
+        FillInterior(input, num_voxels, *output);
     }
 
+    utility::LogDebug("TriangleMesh is voxelized from {:d} triangles to {:d} "
+                      "voxels.",
+                      (int)input.triangles_.size(),
+                      (int)output->voxels_.size());
     return output;
 }
 
 std::shared_ptr<VoxelGrid> VoxelGrid::CreateFromTriangleMesh(
-        const TriangleMesh &input, double voxel_size) {
+        const TriangleMesh &input, double voxel_size, bool solid) {
     Eigen::Vector3d voxel_size3(voxel_size, voxel_size, voxel_size);
     Eigen::Vector3d min_bound = input.GetMinBound() - voxel_size3 * 0.5;
     Eigen::Vector3d max_bound = input.GetMaxBound() + voxel_size3 * 0.5;
     return CreateFromTriangleMeshWithinBounds(input, voxel_size, min_bound,
-                                              max_bound);
+                                              max_bound, solid);
 }
 
 }  // namespace geometry
@@ -42,6 +42,7 @@ static std::map<std::string, FileGeometry (*)(const std::string&)> gExt2Func = {
         {"pcd", ReadFileGeometryTypePCD},
         {"ply", ReadFileGeometryTypePLY},
         {"pts", ReadFileGeometryTypePTS},
+        {"qpc", ReadFileGeometryTypeQPC},
         {"stl", ReadFileGeometryTypeSTL},
         {"xyz", ReadFileGeometryTypeXYZ},
         {"xyzn", ReadFileGeometryTypeXYZN},
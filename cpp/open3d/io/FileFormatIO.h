@@ -50,6 +50,7 @@ FileGeometry ReadFileGeometryTypeOFF(const std::string& path);
 FileGeometry ReadFileGeometryTypePCD(const std::string& path);
 FileGeometry ReadFileGeometryTypePLY(const std::string& path);
 FileGeometry ReadFileGeometryTypePTS(const std::string& path);
+FileGeometry ReadFileGeometryTypeQPC(const std::string& path);
 FileGeometry ReadFileGeometryTypeSTL(const std::string& path);
 FileGeometry ReadFileGeometryTypeXYZ(const std::string& path);
 FileGeometry ReadFileGeometryTypeXYZN(const std::string& path);
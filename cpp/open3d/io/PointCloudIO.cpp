@@ -49,6 +49,7 @@ static const std::unordered_map<
                 {"ply", ReadPointCloudFromPLY},
                 {"pcd", ReadPointCloudFromPCD},
                 {"pts", ReadPointCloudFromPTS},
+                {"qpc", ReadPointCloudFromQPC},
         };
 
 static const std::unordered_map<
@@ -63,6 +64,7 @@ static const std::unordered_map<
                 {"ply", WritePointCloudToPLY},
                 {"pcd", WritePointCloudToPCD},
                 {"pts", WritePointCloudToPTS},
+                {"qpc", WritePointCloudToQPC},
         };
 
 std::shared_ptr<geometry::PointCloud> CreatePointCloudFromFile(
@@ -129,6 +129,10 @@ struct WritePointCloudOption {
     /// completion (0.-100.) return true indicates to continue loading, false
     /// means to try to stop loading and cleanup
     std::function<bool(double)> update_progress;
+    /// Quantization step of the point positions in formats that quantize
+    /// them. Currently only QPC quantizes. If not positive, the writer picks
+    /// a step from the bounding box.
+    double quantization_precision = 0.0;
 };
 
 /// The general entrance for writing a PointCloud to a file
@@ -187,5 +191,13 @@ bool WritePointCloudToPTS(const std::string &filename,
                           const geometry::PointCloud &pointcloud,
                           const WritePointCloudOption &params);
 
+bool ReadPointCloudFromQPC(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const ReadPointCloudOption &params);
+
+bool WritePointCloudToQPC(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          const WritePointCloudOption &params);
+
 }  // namespace io
 }  // namespace open3d
@@ -0,0 +1,321 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/PointCloudTileIO.h"
+
+#include <json/json.h>
+
+#include <array>
+#include <numeric>
+#include <unordered_set>
+
+#include "open3d/io/IJsonConvertibleIO.h"
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/ProgressReporters.h"
+
+namespace open3d {
+namespace io {
+
+namespace {
+
+constexpr const char *kHierarchyFileName = "hierarchy.json";
+
+/// Points of a tile whose children are not built yet.
+struct PendingTile {
+    int tile;
+    std::vector<size_t> indices;
+};
+
+/// Returns the octant of \p point in a cube with center \p center, in the
+/// numbering of PointCloudTileHierarchy::Tile::name.
+int GetOctant(const Eigen::Vector3d &point, const Eigen::Vector3d &center) {
+    return (point(0) >= center(0) ? 1 : 0) | (point(1) >= center(1) ? 2 : 0) |
+           (point(2) >= center(2) ? 4 : 0);
+}
+
+}  // unnamed namespace
+
+bool PointCloudTileHierarchy::ConvertToJsonValue(Json::Value &value) const {
+    value["class_name"] = "PointCloudTileHierarchy";
+    value["version_major"] = 1;
+    value["version_minor"] = 0;
+    value["num_points"] = Json::Int64(num_points_);
+    value["has_normals"] = has_normals_;
+    value["has_colors"] = has_colors_;
+    Json::Value tile_array(Json::arrayValue);
+    for (const Tile &tile : tiles_) {
+        Json::Value tile_value;
+        tile_value["name"] = tile.name;
+        tile_value["parent"] = tile.parent;
+        tile_value["level"] = tile.level;
+        if (!EigenVector3dToJsonArray(tile.bounds.min_bound_,
+                                      tile_value["min_bound"]) ||
+            !EigenVector3dToJsonArray(tile.bounds.max_bound_,
+                                      tile_value["max_bound"])) {
+            return false;
+        }
+        tile_value["spacing"] = tile.spacing;
+        tile_value["num_points"] = Json::Int64(tile.num_points);
+        tile_array.append(tile_value);
+    }
+    value["tiles"] = tile_array;
+    return true;
+}
+
+bool PointCloudTileHierarchy::ConvertFromJsonValue(const Json::Value &value) {
+    if (!value.isObject() ||
+        value.get("class_name", "").asString() != "PointCloudTileHierarchy" ||
+        value.get("version_major", 1).asInt() != 1 ||
+        value.get("version_minor", 0).asInt() != 0) {
+        utility::LogWarning(
+                "PointCloudTileHierarchy read JSON failed: unsupported json "
+                "format.");
+        return false;
+    }
+    num_points_ = value.get("num_points", 0).asInt64();
+    has_normals_ = value.get("has_normals", false).asBool();
+    has_colors_ = value.get("has_colors", false).asBool();
+    const Json::Value &tile_array = value["tiles"];
+    if (tile_array.size() == 0) {
+        utility::LogWarning(
+                "PointCloudTileHierarchy read JSON failed: no tiles.");
+        return false;
+    }
+    tiles_.clear();
+    tiles_.resize(tile_array.size());
+    for (int i = 0; i < int(tile_array.size()); ++i) {
+        const Json::Value &tile_value = tile_array[i];
+        Tile &tile = tiles_[i];
+        tile.name = tile_value.get("name", "").asString();
+        tile.parent = tile_value.get("parent", -1).asInt();
+        tile.level = tile_value.get("level", 0).asInt();
+        tile.spacing = tile_value.get("spacing", 0.0).asDouble();
+        tile.num_points = tile_value.get("num_points", 0).asInt64();
+        if (!EigenVector3dFromJsonArray(tile.bounds.min_bound_,
+                                        tile_value["min_bound"]) ||
+            !EigenVector3dFromJsonArray(tile.bounds.max_bound_,
+                                        tile_value["max_bound"])) {
+            return false;
+        }
+        // Parents come first, which also rules out cycles.
+        if ((i == 0) != (tile.parent < 0) || tile.parent >= i) {
+            utility::LogWarning(
+                    "PointCloudTileHierarchy read JSON failed: invalid parent "
+                    "of tile {}.",
+                    tile.name);
+            return false;
+        }
+        if (tile.parent >= 0) {
+            tiles_[tile.parent].children.push_back(i);
+        }
+    }
+    return true;
+}
+
+std::string PointCloudTileHierarchy::GetTilePath(const std::string &directory,
+                                                 const Tile &tile) const {
+    return directory + "/" + tile.name + ".qpc";
+}
+
+bool WritePointCloudTiles(const std::string &directory,
+                          const geometry::PointCloud &pointcloud,
+                          const PointCloudTilingOption &option) {
+    if (!pointcloud.HasPoints()) {
+        utility::LogWarning("Write tiles failed: point cloud has 0 points.");
+        return false;
+    }
+    if (option.max_points_per_tile <= 0 || option.grid_size <= 0) {
+        utility::LogWarning(
+                "Write tiles failed: max_points_per_tile and grid_size must "
+                "be positive.");
+        return false;
+    }
+    if (!utility::filesystem::DirectoryExists(directory) &&
+        !utility::filesystem::MakeDirectoryHierarchy(directory)) {
+        utility::LogWarning("Write tiles failed: unable to create {}.",
+                            directory);
+        return false;
+    }
+
+    PointCloudTileHierarchy hierarchy;
+    hierarchy.num_points_ = int64_t(pointcloud.points_.size());
+    hierarchy.has_normals_ = pointcloud.HasNormals();
+    hierarchy.has_colors_ = pointcloud.HasColors();
+
+    // The root covers the bounding cube of the points.
+    const Eigen::Vector3d min_bound = pointcloud.GetMinBound();
+    double size = (pointcloud.GetMaxBound() - min_bound).maxCoeff();
+    if (size <= 0.0) {
+        size = 1.0;
+    }
+    PointCloudTileHierarchy::Tile root;
+    root.name = "r";
+    root.bounds = geometry::AxisAlignedBoundingBox(
+            min_bound, min_bound + Eigen::Vector3d::Constant(size));
+    root.spacing = size / option.grid_size;
+    hierarchy.tiles_.push_back(root);
+
+    WritePointCloudOption write_option;
+    write_option.quantization_precision = option.quantization_precision;
+    utility::CountingProgressReporter reporter(option.update_progress);
+    reporter.SetTotal(hierarchy.num_points_);
+    int64_t num_written = 0;
+
+    std::vector<PendingTile> level_tiles(1);
+    level_tiles[0].tile = 0;
+    level_tiles[0].indices.resize(pointcloud.points_.size());
+    std::iota(level_tiles[0].indices.begin(), level_tiles[0].indices.end(),
+              0);
+    const int64_t grid_size = option.grid_size;
+    while (!level_tiles.empty()) {
+        // Tiles of the same level are independent.
+        const int64_t num_tiles = int64_t(level_tiles.size());
+        std::vector<std::array<std::vector<size_t>, 8>> child_indices(
+                num_tiles);
+        std::vector<int64_t> num_kept(num_tiles, 0);
+        std::vector<char> written(num_tiles, 0);
+#pragma omp parallel for schedule(dynamic)
+        for (int64_t i = 0; i < num_tiles; ++i) {
+            PendingTile &pending = level_tiles[i];
+            const PointCloudTileHierarchy::Tile &tile =
+                    hierarchy.tiles_[pending.tile];
+            std::vector<size_t> kept;
+            if (int64_t(pending.indices.size()) <= option.max_points_per_tile ||
+                tile.level >= option.max_level) {
+                kept.swap(pending.indices);
+            } else {
+                // Keep the first point of each cell and pass the others on.
+                const Eigen::Vector3d &origin = tile.bounds.min_bound_;
+                const Eigen::Vector3d center = tile.bounds.GetCenter();
+                std::unordered_set<int64_t> occupied;
+                for (size_t index : pending.indices) {
+                    const Eigen::Vector3d &point = pointcloud.points_[index];
+                    const Eigen::Array3d cell =
+                            ((point - origin) / tile.spacing)
+                                    .array()
+                                    .floor()
+                                    .max(0.0)
+                                    .min(double(grid_size - 1));
+                    const int64_t key =
+                            int64_t(cell(0)) +
+                            grid_size * (int64_t(cell(1)) +
+                                         grid_size * int64_t(cell(2)));
+                    if (occupied.insert(key).second) {
+                        kept.push_back(index);
+                    } else {
+                        child_indices[i][GetOctant(point, center)].push_back(
+                                index);
+                    }
+                }
+                std::vector<size_t>().swap(pending.indices);
+            }
+            num_kept[i] = int64_t(kept.size());
+            written[i] = WritePointCloud(
+                    hierarchy.GetTilePath(directory, tile),
+                    *pointcloud.SelectByIndex(kept), write_option);
+        }
+
+        std::vector<PendingTile> next_level_tiles;
+        for (int64_t i = 0; i < num_tiles; ++i) {
+            const int parent = level_tiles[i].tile;
+            if (!written[i]) {
+                utility::LogWarning("Write tiles failed: unable to write {}.",
+                                    hierarchy.GetTilePath(
+                                            directory,
+                                            hierarchy.tiles_[parent]));
+                return false;
+            }
+            hierarchy.tiles_[parent].num_points = num_kept[i];
+            num_written += num_kept[i];
+            for (int k = 0; k < 8; ++k) {
+                if (child_indices[i][k].empty()) {
+                    continue;
+                }
+                const PointCloudTileHierarchy::Tile &parent_tile =
+                        hierarchy.tiles_[parent];
+                const double half_size = parent_tile.bounds.GetExtent()(0) / 2;
+                PointCloudTileHierarchy::Tile child;
+                child.name = parent_tile.name + char('0' + k);
+                child.parent = parent;
+                child.level = parent_tile.level + 1;
+                const Eigen::Vector3d child_min =
+                        parent_tile.bounds.min_bound_ +
+                        half_size * Eigen::Vector3d(k & 1, (k >> 1) & 1,
+                                                    (k >> 2) & 1);
+                child.bounds = geometry::AxisAlignedBoundingBox(
+                        child_min,
+                        child_min + Eigen::Vector3d::Constant(half_size));
+                child.spacing = parent_tile.spacing / 2;
+                const int child_index = int(hierarchy.tiles_.size());
+                hierarchy.tiles_[parent].children.push_back(child_index);
+                hierarchy.tiles_.push_back(child);
+                next_level_tiles.push_back(
+                        {child_index, std::move(child_indices[i][k])});
+            }
+        }
+        if (!reporter.Update(num_written)) {
+            utility::LogWarning("Write tiles aborted.");
+            return false;
+        }
+        level_tiles = std::move(next_level_tiles);
+    }
+
+    if (!WriteIJsonConvertibleToJSON(directory + "/" + kHierarchyFileName,
+                                     hierarchy)) {
+        return false;
+    }
+    utility::LogDebug("Write {:d} points to {:d} tiles.",
+                      hierarchy.num_points_, hierarchy.tiles_.size());
+    reporter.Finish();
+    return true;
+}
+
+bool ReadPointCloudTileHierarchy(const std::string &directory,
+                                 PointCloudTileHierarchy &hierarchy) {
+    return ReadIJsonConvertibleFromJSON(directory + "/" + kHierarchyFileName,
+                                        hierarchy);
+}
+
+std::shared_ptr<geometry::PointCloud> ReadPointCloudTile(
+        const std::string &directory,
+        const PointCloudTileHierarchy &hierarchy,
+        const PointCloudTileHierarchy::Tile &tile) {
+    auto pointcloud = std::make_shared<geometry::PointCloud>();
+    ReadPointCloudOption option;
+    option.format = "qpc";
+    option.remove_nan_points = false;
+    option.remove_infinite_points = false;
+    if (!ReadPointCloud(hierarchy.GetTilePath(directory, tile), *pointcloud,
+                        option)) {
+        return nullptr;
+    }
+    return pointcloud;
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,138 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "open3d/geometry/BoundingVolume.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/utility/IJsonConvertible.h"
+
+namespace open3d {
+namespace io {
+
+/// \class PointCloudTileHierarchy
+///
+/// \brief Metadata of a point cloud split into an octree of level of detail
+/// tiles, for viewing clouds that do not fit into memory.
+///
+/// Each tile covers a cube of the octree and keeps a subsample of the points
+/// in the cube with about one point per cell of size spacing_. The points
+/// that are not kept are passed on to the children, whose spacing is half
+/// of the parent's. Tiles are additive: a tile together with all its
+/// ancestors shows the points of its cube at the tile's resolution.
+///
+/// The hierarchy is stored as hierarchy.json next to one QPC file per tile.
+class PointCloudTileHierarchy : public utility::IJsonConvertible {
+public:
+    struct Tile {
+        /// "r" for the root. The name of child k (0-7) of tile "rX" is
+        /// "rXk", where bit 0, 1 and 2 of k select the upper half along x,
+        /// y and z.
+        std::string name;
+        /// Index of the parent tile, -1 for the root.
+        int parent = -1;
+        /// Indices of the child tiles.
+        std::vector<int> children;
+        /// Depth in the octree, 0 for the root.
+        int level = 0;
+        /// Cube of the octree covered by the tile.
+        geometry::AxisAlignedBoundingBox bounds;
+        /// Size of the subsampling cells, about the distance between
+        /// neighboring points of the tile and its ancestors. This is the
+        /// geometric error of rendering up to this tile.
+        double spacing = 0.0;
+        /// Number of points stored in the tile.
+        int64_t num_points = 0;
+    };
+
+public:
+    bool ConvertToJsonValue(Json::Value &value) const override;
+    bool ConvertFromJsonValue(const Json::Value &value) override;
+
+    /// Returns the path of the file with the points of \p tile.
+    std::string GetTilePath(const std::string &directory,
+                            const Tile &tile) const;
+
+public:
+    /// Tiles in breadth first order. The root is the first tile and parents
+    /// come before their children.
+    std::vector<Tile> tiles_;
+    /// Total number of points in all tiles.
+    int64_t num_points_ = 0;
+    bool has_normals_ = false;
+    bool has_colors_ = false;
+};
+
+/// \struct PointCloudTilingOption
+///
+/// Options for WritePointCloudTiles.
+struct PointCloudTilingOption {
+    /// Tiles with at most this many points are not subdivided.
+    int64_t max_points_per_tile = 200000;
+    /// Number of subsampling cells along each axis of a tile. The spacing of
+    /// the root is the size of the bounding cube divided by this number.
+    int grid_size = 128;
+    /// Maximum depth of the octree. Tiles at this depth keep all their
+    /// points.
+    int max_level = 20;
+    /// Quantization step of the positions in the tile files. If not
+    /// positive, each tile uses the default QPC precision of its points.
+    double quantization_precision = 0.0;
+    /// Callback with the percentage of points written. Return false to
+    /// abort.
+    std::function<bool(double)> update_progress;
+};
+
+/// \brief Splits \p pointcloud into a level of detail tile hierarchy and
+/// writes it to \p directory, which is created if needed.
+///
+/// The tiles of each octree level are built and written in parallel. The
+/// point cloud must fit into memory.
+/// \return False if the point cloud is empty or a file cannot be written.
+bool WritePointCloudTiles(const std::string &directory,
+                          const geometry::PointCloud &pointcloud,
+                          const PointCloudTilingOption &option = {});
+
+/// Reads the tile hierarchy written by WritePointCloudTiles to \p directory.
+bool ReadPointCloudTileHierarchy(const std::string &directory,
+                                 PointCloudTileHierarchy &hierarchy);
+
+/// \brief Reads the points of a single tile.
+///
+/// Thread safe, so tiles can be read on background threads.
+/// \return nullptr if the tile cannot be read.
+std::shared_ptr<geometry::PointCloud> ReadPointCloudTile(
+        const std::string &directory,
+        const PointCloudTileHierarchy &hierarchy,
+        const PointCloudTileHierarchy::Tile &tile);
+
+}  // namespace io
+}  // namespace open3d
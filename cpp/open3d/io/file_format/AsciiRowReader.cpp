@@ -0,0 +1,271 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/file_format/AsciiRowReader.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#include "open3d/core/kernel/ParallelUtil.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace io {
+
+namespace {
+
+// Bytes parsed by one thread at a time.
+constexpr int64_t kChunkSize = 1 << 22;
+// Smaller files use smaller chunks, down to kMinChunkSize, so that the
+// progress is still reported about kMinNumWaves times.
+constexpr int64_t kMinChunkSize = 1 << 14;
+constexpr int64_t kMinNumWaves = 100;
+
+// Powers of ten that are exact in double precision.
+const double kExactPowersOfTen[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                    1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                    1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                    1e18, 1e19, 1e20, 1e21, 1e22};
+
+// Whitespace within a line, the characters skipped by sscanf except '\n'.
+inline bool IsBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+inline bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+const char *ParseDoubleWithStrtod(const char *begin,
+                                  const char *end,
+                                  double &value) {
+    // strtod needs a terminated string, numbers longer than the buffer are
+    // not valid anyway.
+    char buffer[128];
+    const size_t length = std::min(size_t(end - begin), sizeof(buffer) - 1);
+    std::memcpy(buffer, begin, length);
+    buffer[length] = '\0';
+    char *number_end;
+    value = std::strtod(buffer, &number_end);
+    if (number_end == buffer) {
+        return nullptr;
+    }
+    return begin + (number_end - buffer);
+}
+
+}  // unnamed namespace
+
+const char *ParseDouble(const char *begin, const char *end, double &value) {
+    const char *ptr = begin;
+    bool negative = false;
+    if (ptr < end && (*ptr == '-' || *ptr == '+')) {
+        negative = *ptr == '-';
+        ++ptr;
+    }
+    uint64_t mantissa = 0;
+    int num_significant_digits = 0;
+    int num_digits = 0;
+    int exponent = 0;
+    for (; ptr < end && IsDigit(*ptr); ++ptr, ++num_digits) {
+        if (mantissa != 0 || *ptr != '0') {
+            mantissa = mantissa * 10 + (*ptr - '0');
+            ++num_significant_digits;
+        }
+    }
+    if (ptr < end && *ptr == '.') {
+        for (++ptr; ptr < end && IsDigit(*ptr); ++ptr, ++num_digits) {
+            if (mantissa != 0 || *ptr != '0') {
+                mantissa = mantissa * 10 + (*ptr - '0');
+                ++num_significant_digits;
+            }
+            --exponent;
+        }
+    }
+    if (num_digits == 0) {
+        // No digits, possibly inf or nan.
+        return ParseDoubleWithStrtod(begin, end, value);
+    }
+    if (ptr < end && (*ptr == 'e' || *ptr == 'E')) {
+        const char *exponent_ptr = ptr + 1;
+        bool negative_exponent = false;
+        if (exponent_ptr < end &&
+            (*exponent_ptr == '-' || *exponent_ptr == '+')) {
+            negative_exponent = *exponent_ptr == '-';
+            ++exponent_ptr;
+        }
+        if (exponent_ptr < end && IsDigit(*exponent_ptr)) {
+            int exponent_value = 0;
+            for (; exponent_ptr < end && IsDigit(*exponent_ptr);
+                 ++exponent_ptr) {
+                if (exponent_value < 100000) {
+                    exponent_value =
+                            exponent_value * 10 + (*exponent_ptr - '0');
+                }
+            }
+            exponent += negative_exponent ? -exponent_value : exponent_value;
+            ptr = exponent_ptr;
+        }
+    }
+    // Hexadecimal numbers go to strtod, as do mantissas above 2^53 and
+    // exponents beyond 10^22, whose products would not be correctly rounded.
+    // The digit count guards the mantissa against overflow.
+    if ((ptr < end && (*ptr == 'x' || *ptr == 'X')) ||
+        num_significant_digits > 19 || mantissa > (uint64_t(1) << 53) ||
+        exponent < -22 || exponent > 22) {
+        if (mantissa == 0 && num_significant_digits == 0 &&
+            !(ptr < end && (*ptr == 'x' || *ptr == 'X'))) {
+            value = negative ? -0.0 : 0.0;
+            return ptr;
+        }
+        return ParseDoubleWithStrtod(begin, end, value);
+    }
+    value = double(mantissa);
+    if (exponent < 0) {
+        value /= kExactPowersOfTen[-exponent];
+    } else {
+        value *= kExactPowersOfTen[exponent];
+    }
+    if (negative) {
+        value = -value;
+    }
+    return ptr;
+}
+
+int64_t ParseAsciiRows(const char *begin,
+                       const char *end,
+                       int num_columns,
+                       bool skip_invalid_lines,
+                       std::vector<double> &values) {
+    int64_t num_rows = 0;
+    std::vector<double> row(num_columns);
+    const char *line_begin = begin;
+    while (line_begin < end) {
+        const char *line_end = static_cast<const char *>(
+                std::memchr(line_begin, '\n', end - line_begin));
+        if (line_end == nullptr) {
+            line_end = end;
+        }
+        const char *ptr = line_begin;
+        int num_values = 0;
+        for (; num_values < num_columns; ++num_values) {
+            while (ptr < line_end && IsBlank(*ptr)) {
+                ++ptr;
+            }
+            ptr = ParseDouble(ptr, line_end, row[num_values]);
+            if (ptr == nullptr) {
+                break;
+            }
+        }
+        if (num_values == num_columns) {
+            values.insert(values.end(), row.begin(), row.end());
+            ++num_rows;
+        } else if (!skip_invalid_lines) {
+            values.resize(values.size() + num_columns, 0.0);
+            ++num_rows;
+        }
+        line_begin = line_end + 1;
+    }
+    return num_rows;
+}
+
+int64_t ParseAsciiRowsParallel(const char *begin,
+                               const char *end,
+                               int num_columns,
+                               bool skip_invalid_lines,
+                               std::vector<double> &values,
+                               utility::CountingProgressReporter *reporter,
+                               int64_t reporter_offset) {
+    const int num_threads = core::kernel::GetMaxThreads();
+    int64_t num_rows = 0;
+    std::vector<const char *> bounds;
+    std::vector<std::vector<double>> chunk_values(num_threads);
+    std::vector<int64_t> chunk_offsets(num_threads + 1);
+    const int64_t chunk_size = std::max(
+            kMinChunkSize,
+            std::min(kChunkSize, int64_t(end - begin) /
+                                         (kMinNumWaves * num_threads)));
+    // Parse one chunk per thread at a time, so that the progress can be
+    // reported from this thread and the buffers stay small.
+    for (const char *wave_begin = begin; wave_begin < end;) {
+        bounds.assign(1, wave_begin);
+        for (int i = 0; i < num_threads && bounds.back() < end; ++i) {
+            const char *chunk_end = bounds.back() + chunk_size;
+            if (chunk_end >= end) {
+                chunk_end = end;
+            } else {
+                chunk_end = static_cast<const char *>(
+                        std::memchr(chunk_end, '\n', end - chunk_end));
+                chunk_end = chunk_end == nullptr ? end : chunk_end + 1;
+            }
+            bounds.push_back(chunk_end);
+        }
+        const int num_chunks = int(bounds.size()) - 1;
+#pragma omp parallel for schedule(static, 1)
+        for (int i = 0; i < num_chunks; ++i) {
+            chunk_values[i].clear();
+            ParseAsciiRows(bounds[i], bounds[i + 1], num_columns,
+                           skip_invalid_lines, chunk_values[i]);
+        }
+        chunk_offsets[0] = int64_t(values.size());
+        for (int i = 0; i < num_chunks; ++i) {
+            chunk_offsets[i + 1] =
+                    chunk_offsets[i] + int64_t(chunk_values[i].size());
+        }
+        values.resize(chunk_offsets[num_chunks]);
+#pragma omp parallel for schedule(static, 1)
+        for (int i = 0; i < num_chunks; ++i) {
+            std::copy(chunk_values[i].begin(), chunk_values[i].end(),
+                      values.begin() + chunk_offsets[i]);
+        }
+        num_rows += (chunk_offsets[num_chunks] - chunk_offsets[0]) /
+                    num_columns;
+        wave_begin = bounds.back();
+        if (reporter != nullptr) {
+            reporter->Update(reporter_offset + (wave_begin - begin));
+        }
+    }
+    return num_rows;
+}
+
+bool ReadAsciiRows(const std::string &filename,
+                   int num_columns,
+                   std::vector<double> &values,
+                   utility::CountingProgressReporter &reporter) {
+    values.clear();
+    utility::filesystem::MappedFile file;
+    if (!file.Open(filename)) {
+        // Empty files cannot be mapped but have no rows.
+        utility::filesystem::CFile empty_file;
+        return empty_file.Open(filename, "r") &&
+               empty_file.GetFileSize() == 0;
+    }
+    reporter.SetTotal(int64_t(file.GetSize()));
+    ParseAsciiRowsParallel(file.GetData(), file.GetData() + file.GetSize(),
+                           num_columns, true, values, &reporter);
+    return true;
+}
+
+}  // namespace io
+}  // namespace open3d
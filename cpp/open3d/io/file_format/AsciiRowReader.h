@@ -0,0 +1,96 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "open3d/utility/ProgressReporters.h"
+
+namespace open3d {
+namespace io {
+
+/// \brief Parses a floating point number at the start of [begin, end).
+///
+/// Accepts what strtod accepts in the C locale. A decimal number whose
+/// significant digits form an integer of at most 2^53 (15 to 16 digits) and
+/// whose decimal exponent, after moving the point behind the last digit, is
+/// within [-22, 22] is converted exactly without strtod. Other numbers are
+/// passed to strtod.
+///
+/// \return The end of the number, nullptr if there is no number.
+const char *ParseDouble(const char *begin, const char *end, double &value);
+
+/// \brief Parses the lines of [begin, end) as rows of numbers.
+///
+/// A line is a valid row if it starts with \p num_columns numbers separated
+/// by optional whitespace, which is what sscanf with "%lf %lf ..." accepts.
+/// Values beyond \p num_columns are ignored.
+///
+/// \param skip_invalid_lines If true, invalid lines are skipped. Otherwise
+/// each line gives a row, with zeros for invalid lines.
+/// \param values The values of the rows are appended to it.
+/// \return The number of rows appended.
+int64_t ParseAsciiRows(const char *begin,
+                       const char *end,
+                       int num_columns,
+                       bool skip_invalid_lines,
+                       std::vector<double> &values);
+
+/// \brief Parses the lines of [begin, end) as rows of numbers in parallel.
+///
+/// The range is split into chunks at line boundaries, the chunks are parsed
+/// by all threads and their rows are concatenated in order, with a prefix
+/// sum over the row counts of the chunks. See ParseAsciiRows().
+///
+/// \param reporter If not nullptr, updated with the number of bytes parsed
+/// from the calling thread.
+/// \param reporter_offset Added to the byte counts passed to \p reporter.
+/// \return The number of rows appended to \p values.
+int64_t ParseAsciiRowsParallel(
+        const char *begin,
+        const char *end,
+        int num_columns,
+        bool skip_invalid_lines,
+        std::vector<double> &values,
+        utility::CountingProgressReporter *reporter = nullptr,
+        int64_t reporter_offset = 0);
+
+/// \brief Maps \p filename and parses all its lines in parallel, skipping
+/// invalid lines. See ParseAsciiRowsParallel().
+///
+/// \param reporter Its total is set to the file size.
+/// \return False if the file cannot be opened.
+bool ReadAsciiRows(const std::string &filename,
+                   int num_columns,
+                   std::vector<double> &values,
+                   utility::CountingProgressReporter &reporter);
+
+}  // namespace io
+}  // namespace open3d
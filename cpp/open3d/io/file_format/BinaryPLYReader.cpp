@@ -0,0 +1,219 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/file_format/BinaryPLYReader.h"
+
+#include <sstream>
+
+namespace open3d {
+namespace io {
+
+namespace {
+
+bool ParseType(const std::string &name, BinaryPLYReader::Type &type) {
+    using Type = BinaryPLYReader::Type;
+    if (name == "char" || name == "int8") {
+        type = Type::Int8;
+    } else if (name == "uchar" || name == "uint8") {
+        type = Type::UInt8;
+    } else if (name == "short" || name == "int16") {
+        type = Type::Int16;
+    } else if (name == "ushort" || name == "uint16") {
+        type = Type::UInt16;
+    } else if (name == "int" || name == "int32") {
+        type = Type::Int32;
+    } else if (name == "uint" || name == "uint32") {
+        type = Type::UInt32;
+    } else if (name == "float" || name == "float32") {
+        type = Type::Float32;
+    } else if (name == "double" || name == "float64") {
+        type = Type::Float64;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool IsHostLittleEndian() {
+    const uint16_t value = 1;
+    char byte;
+    std::memcpy(&byte, &value, 1);
+    return byte == 1;
+}
+
+}  // unnamed namespace
+
+int BinaryPLYReader::Element::FindProperty(const std::string &name) const {
+    for (size_t i = 0; i < properties_.size(); ++i) {
+        if (properties_[i].name_ == name) {
+            return int(i);
+        }
+    }
+    return -1;
+}
+
+size_t BinaryPLYReader::GetTypeSize(Type type) {
+    switch (type) {
+        case Type::Int8:
+        case Type::UInt8:
+            return 1;
+        case Type::Int16:
+        case Type::UInt16:
+            return 2;
+        case Type::Int32:
+        case Type::UInt32:
+        case Type::Float32:
+            return 4;
+        default:
+            return 8;
+    }
+}
+
+bool BinaryPLYReader::Open(const std::string &filename) {
+    elements_.clear();
+    if (!mapped_file_.Open(filename)) {
+        return false;
+    }
+    const char *data = mapped_file_.GetData();
+    const size_t size = mapped_file_.GetSize();
+
+    // Parse the header line by line, up to "end_header".
+    size_t pos = 0;
+    bool has_format = false;
+    bool is_first_line = true;
+    while (true) {
+        const char *line_end = static_cast<const char *>(
+                std::memchr(data + pos, '\n', size - pos));
+        if (line_end == nullptr) {
+            return false;
+        }
+        std::string line(data + pos, line_end);
+        pos = line_end - data + 1;
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        std::istringstream tokens(line);
+        std::string keyword;
+        tokens >> keyword;
+        if (is_first_line) {
+            if (keyword != "ply") {
+                return false;
+            }
+            is_first_line = false;
+        } else if (keyword == "format") {
+            std::string format;
+            tokens >> format;
+            if (format == "binary_little_endian") {
+                swap_bytes_ = !IsHostLittleEndian();
+            } else if (format == "binary_big_endian") {
+                swap_bytes_ = IsHostLittleEndian();
+            } else {
+                return false;
+            }
+            has_format = true;
+        } else if (keyword == "element") {
+            Element element;
+            if (!(tokens >> element.name_ >> element.count_) ||
+                element.count_ < 0) {
+                return false;
+            }
+            element.record_size_ = 0;
+            element.data_offset_ = 0;
+            elements_.push_back(element);
+        } else if (keyword == "property") {
+            if (elements_.empty()) {
+                return false;
+            }
+            Element &element = elements_.back();
+            Property property;
+            std::string type_name;
+            tokens >> type_name;
+            property.is_list_ = type_name == "list";
+            property.length_type_ = Type::UInt8;
+            if (property.is_list_) {
+                std::string length_type_name;
+                tokens >> length_type_name >> type_name;
+                if (!ParseType(length_type_name, property.length_type_)) {
+                    return false;
+                }
+            }
+            if (!ParseType(type_name, property.type_) ||
+                !(tokens >> property.name_)) {
+                return false;
+            }
+            property.offset_ = element.record_size_;
+            element.properties_.push_back(property);
+            element.record_size_ += GetTypeSize(property.type_);
+        } else if (keyword == "end_header") {
+            break;
+        } else if (keyword != "comment" && keyword != "obj_info" &&
+                   !keyword.empty()) {
+            return false;
+        }
+    }
+    if (!has_format) {
+        return false;
+    }
+
+    // Locate the records of each element. Elements with lists have to be
+    // scanned to find the next one.
+    for (size_t e = 0; e < elements_.size(); ++e) {
+        Element &element = elements_[e];
+        element.data_offset_ = pos;
+        bool has_list = false;
+        for (const Property &property : element.properties_) {
+            has_list = has_list || property.is_list_;
+        }
+        if (has_list) {
+            element.record_size_ = 0;
+            if (e + 1 < elements_.size() &&
+                !ScanRecords<uint8_t>(element, -1, nullptr, nullptr, pos)) {
+                return false;
+            }
+        } else {
+            if (element.record_size_ > 0 &&
+                uint64_t(element.count_) >
+                        (size - pos) / element.record_size_) {
+                return false;
+            }
+            pos += element.count_ * element.record_size_;
+        }
+    }
+    return true;
+}
+
+const BinaryPLYReader::Element *BinaryPLYReader::FindElement(
+        const std::string &name) const {
+    for (const Element &element : elements_) {
+        if (element.name_ == name) {
+            return &element;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,281 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace io {
+
+/// \class BinaryPLYReader
+///
+/// \brief Reads the elements of a binary PLY file from a memory mapping.
+///
+/// rply calls back once per scalar value. For elements with fixed-size
+/// records, this reader instead decodes whole property columns at once, in
+/// parallel, with strided copies into the destination arrays. Elements with
+/// list properties are read sequentially. Open() returns false for ASCII
+/// files so that callers can fall back to rply.
+class BinaryPLYReader {
+public:
+    /// Scalar types of the PLY format.
+    enum class Type {
+        Int8,
+        UInt8,
+        Int16,
+        UInt16,
+        Int32,
+        UInt32,
+        Float32,
+        Float64
+    };
+
+    struct Property {
+        std::string name_;
+        /// Type of the value, or of the list items.
+        Type type_;
+        /// True for list properties.
+        bool is_list_;
+        /// Type of the list length.
+        Type length_type_;
+        /// Byte offset of the property in the records of fixed-size elements.
+        size_t offset_;
+    };
+
+    struct Element {
+        std::string name_;
+        int64_t count_;
+        std::vector<Property> properties_;
+        /// Byte size of a record, 0 if the element has list properties.
+        size_t record_size_;
+        /// Byte offset of the first record in the file.
+        size_t data_offset_;
+
+        bool IsFixedSize() const { return record_size_ > 0; }
+        /// Returns the index of property \p name, -1 if there is none.
+        int FindProperty(const std::string &name) const;
+    };
+
+public:
+    /// \brief Maps \p filename and parses its header.
+    ///
+    /// Returns false if the file cannot be mapped, is not a binary PLY file
+    /// or is truncated.
+    bool Open(const std::string &filename);
+
+    /// Returns the element \p name, nullptr if there is none.
+    const Element *FindElement(const std::string &name) const;
+
+    /// \brief Decodes a scalar property of a fixed-size element into
+    /// dst[i * stride], converting the values to T.
+    template <typename T>
+    void ReadProperty(const Element &element,
+                      int property_index,
+                      T *dst,
+                      size_t stride) const {
+        ReadProperty(element, property_index, 0, element.count_, dst, stride);
+    }
+
+    /// \brief Decodes records [begin, begin + count) of a scalar property of
+    /// a fixed-size element into dst[(i - begin) * stride].
+    template <typename T>
+    void ReadProperty(const Element &element,
+                      int property_index,
+                      int64_t begin,
+                      int64_t count,
+                      T *dst,
+                      size_t stride) const {
+        const Property &property = element.properties_[property_index];
+        switch (property.type_) {
+            case Type::Int8:
+                ReadColumn<int8_t>(element, property, begin, count, dst,
+                                   stride);
+                break;
+            case Type::UInt8:
+                ReadColumn<uint8_t>(element, property, begin, count, dst,
+                                    stride);
+                break;
+            case Type::Int16:
+                ReadColumn<int16_t>(element, property, begin, count, dst,
+                                    stride);
+                break;
+            case Type::UInt16:
+                ReadColumn<uint16_t>(element, property, begin, count, dst,
+                                     stride);
+                break;
+            case Type::Int32:
+                ReadColumn<int32_t>(element, property, begin, count, dst,
+                                    stride);
+                break;
+            case Type::UInt32:
+                ReadColumn<uint32_t>(element, property, begin, count, dst,
+                                     stride);
+                break;
+            case Type::Float32:
+                ReadColumn<float>(element, property, begin, count, dst, stride);
+                break;
+            case Type::Float64:
+                ReadColumn<double>(element, property, begin, count, dst,
+                                   stride);
+                break;
+        }
+    }
+
+    /// \brief Reads a list property sequentially.
+    ///
+    /// The items of record i are values[offsets[i]] to
+    /// values[offsets[i + 1] - 1]. Returns false if the data is truncated.
+    template <typename T>
+    bool ReadListProperty(const Element &element,
+                          int property_index,
+                          std::vector<int64_t> &offsets,
+                          std::vector<T> &values) const {
+        size_t end;
+        return ScanRecords(element, property_index, &offsets, &values, end);
+    }
+
+    /// Returns the byte size of a scalar type.
+    static size_t GetTypeSize(Type type);
+
+private:
+    /// Loads a value of type S, swapping bytes if the file endianness
+    /// differs from the host.
+    template <typename S>
+    S LoadRaw(const char *ptr) const {
+        char bytes[sizeof(S)];
+        std::memcpy(bytes, ptr, sizeof(S));
+        if (swap_bytes_) {
+            for (size_t i = 0; i < sizeof(S) / 2; ++i) {
+                std::swap(bytes[i], bytes[sizeof(S) - 1 - i]);
+            }
+        }
+        S value;
+        std::memcpy(&value, bytes, sizeof(S));
+        return value;
+    }
+
+    template <typename T>
+    T Load(const char *ptr, Type type) const {
+        switch (type) {
+            case Type::Int8:
+                return static_cast<T>(LoadRaw<int8_t>(ptr));
+            case Type::UInt8:
+                return static_cast<T>(LoadRaw<uint8_t>(ptr));
+            case Type::Int16:
+                return static_cast<T>(LoadRaw<int16_t>(ptr));
+            case Type::UInt16:
+                return static_cast<T>(LoadRaw<uint16_t>(ptr));
+            case Type::Int32:
+                return static_cast<T>(LoadRaw<int32_t>(ptr));
+            case Type::UInt32:
+                return static_cast<T>(LoadRaw<uint32_t>(ptr));
+            case Type::Float32:
+                return static_cast<T>(LoadRaw<float>(ptr));
+            default:
+                return static_cast<T>(LoadRaw<double>(ptr));
+        }
+    }
+
+    /// Walks the records of \p element, collecting the items of property
+    /// \p property_index if \p offsets and \p values are given. \p end is
+    /// set to the byte offset after the last record.
+    template <typename T>
+    bool ScanRecords(const Element &element,
+                     int property_index,
+                     std::vector<int64_t> *offsets,
+                     std::vector<T> *values,
+                     size_t &end) const {
+        if (offsets != nullptr) {
+            offsets->assign(1, 0);
+            offsets->reserve(element.count_ + 1);
+            values->clear();
+        }
+        const char *data = mapped_file_.GetData();
+        const char *data_end = data + mapped_file_.GetSize();
+        const char *ptr = data + element.data_offset_;
+        for (int64_t i = 0; i < element.count_; ++i) {
+            for (size_t p = 0; p < element.properties_.size(); ++p) {
+                const Property &property = element.properties_[p];
+                int64_t length = 1;
+                if (property.is_list_) {
+                    const size_t length_size =
+                            GetTypeSize(property.length_type_);
+                    if (int64_t(length_size) > data_end - ptr) {
+                        return false;
+                    }
+                    length = Load<int64_t>(ptr, property.length_type_);
+                    ptr += length_size;
+                }
+                const size_t size = GetTypeSize(property.type_);
+                if (length < 0 || length > (data_end - ptr) / int64_t(size)) {
+                    return false;
+                }
+                if (offsets != nullptr && int(p) == property_index) {
+                    for (int64_t k = 0; k < length; ++k) {
+                        values->push_back(
+                                Load<T>(ptr + k * size, property.type_));
+                    }
+                }
+                ptr += length * size;
+            }
+            if (offsets != nullptr) {
+                offsets->push_back(int64_t(values->size()));
+            }
+        }
+        end = size_t(ptr - data);
+        return true;
+    }
+
+    template <typename S, typename T>
+    void ReadColumn(const Element &element,
+                    const Property &property,
+                    int64_t begin,
+                    int64_t count,
+                    T *dst,
+                    size_t stride) const {
+        const size_t record_size = element.record_size_;
+        const char *src = mapped_file_.GetData() + element.data_offset_ +
+                          begin * record_size + property.offset_;
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < count; ++i) {
+            dst[i * stride] = static_cast<T>(LoadRaw<S>(src + i * record_size));
+        }
+    }
+
+    utility::filesystem::MappedFile mapped_file_;
+    std::vector<Element> elements_;
+    bool swap_bytes_ = false;
+};
+
+}  // namespace io
+}  // namespace open3d
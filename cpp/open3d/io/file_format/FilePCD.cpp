@@ -26,12 +26,14 @@
 
 #include <liblzf/lzf.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
 #include <sstream>
 
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/io/file_format/FilePCD.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
@@ -43,43 +45,17 @@
 // https://www.mathworks.com/matlabcentral/fileexchange/40382-matlab-to-point-cloud-library
 
 namespace open3d {
+namespace io {
 
 namespace {
-using namespace io;
-
-enum PCDDataType {
-    PCD_DATA_ASCII = 0,
-    PCD_DATA_BINARY = 1,
-    PCD_DATA_BINARY_COMPRESSED = 2
-};
-
-struct PCLPointField {
-public:
-    std::string name;
-    int size;
-    char type;
-    int count;
-    // helper variable
-    int count_offset;
-    int offset;
-};
-
-struct PCDHeader {
-public:
-    std::string version;
-    std::vector<PCLPointField> fields;
-    int width;
-    int height;
-    int points;
-    PCDDataType datatype;
-    std::string viewpoint;
-    // helper variables
-    int elementnum;
-    int pointsize;
-    bool has_points;
-    bool has_normals;
-    bool has_colors;
-};
+
+/// Bytes of binary_compressed data that are compressed by one thread.
+constexpr int64_t kCompressionChunkSize = 1 << 20;
+
+/// Number of points converted in parallel between two progress updates.
+int64_t ProgressBlockSize(int64_t num_points) {
+    return std::max<int64_t>(1000, num_points / 100);
+}
 
 bool CheckHeader(PCDHeader &header) {
     if (header.points <= 0 || header.pointsize <= 0) {
@@ -131,6 +107,8 @@ bool CheckHeader(PCDHeader &header) {
     return true;
 }
 
+}  // unnamed namespace
+
 bool ReadPCDHeader(FILE *file, PCDHeader &header) {
     char line_buffer[DEFAULT_IO_BUFFER_SIZE];
     size_t specified_channel_count = 0;
@@ -237,63 +215,113 @@ bool ReadPCDHeader(FILE *file, PCDHeader &header) {
     return true;
 }
 
-double UnpackBinaryPCDElement(const char *data_ptr,
-                              const char type,
-                              const int size) {
-    if (type == 'I') {
-        if (size == 1) {
-            std::int8_t data;
-            memcpy(&data, data_ptr, sizeof(data));
-            return (double)data;
-        } else if (size == 2) {
-            std::int16_t data;
-            memcpy(&data, data_ptr, sizeof(data));
-            return (double)data;
-        } else if (size == 4) {
-            std::int32_t data;
-            memcpy(&data, data_ptr, sizeof(data));
-            return (double)data;
-        } else {
-            return 0.0;
-        }
-    } else if (type == 'U') {
-        if (size == 1) {
-            std::uint8_t data;
-            memcpy(&data, data_ptr, sizeof(data));
-            return (double)data;
-        } else if (size == 2) {
-            std::uint16_t data;
-            memcpy(&data, data_ptr, sizeof(data));
-            return (double)data;
-        } else if (size == 4) {
-            std::uint32_t data;
-            memcpy(&data, data_ptr, sizeof(data));
-            return (double)data;
-        } else {
-            return 0.0;
+namespace {
+
+/// Converts the values of a field at src + i * stride to double and stores
+/// them in dst[i * dst_stride].
+template <typename T>
+void UnpackBinaryPCDColumn(const char *src,
+                           size_t stride,
+                           int64_t num_points,
+                           double *dst,
+                           int dst_stride) {
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_points; i++) {
+        T data;
+        memcpy(&data, src + i * stride, sizeof(data));
+        dst[i * dst_stride] = (double)data;
+    }
+}
+
+void UnpackBinaryPCDField(const PCLPointField &field,
+                          const char *src,
+                          size_t stride,
+                          int64_t num_points,
+                          double *dst,
+                          int dst_stride) {
+    if (field.type == 'I' && field.size == 1) {
+        UnpackBinaryPCDColumn<std::int8_t>(src, stride, num_points, dst,
+                                           dst_stride);
+    } else if (field.type == 'I' && field.size == 2) {
+        UnpackBinaryPCDColumn<std::int16_t>(src, stride, num_points, dst,
+                                            dst_stride);
+    } else if (field.type == 'I' && field.size == 4) {
+        UnpackBinaryPCDColumn<std::int32_t>(src, stride, num_points, dst,
+                                            dst_stride);
+    } else if (field.type == 'U' && field.size == 1) {
+        UnpackBinaryPCDColumn<std::uint8_t>(src, stride, num_points, dst,
+                                            dst_stride);
+    } else if (field.type == 'U' && field.size == 2) {
+        UnpackBinaryPCDColumn<std::uint16_t>(src, stride, num_points, dst,
+                                             dst_stride);
+    } else if (field.type == 'U' && field.size == 4) {
+        UnpackBinaryPCDColumn<std::uint32_t>(src, stride, num_points, dst,
+                                             dst_stride);
+    } else if (field.type == 'F' && field.size == 4) {
+        UnpackBinaryPCDColumn<float>(src, stride, num_points, dst,
+                                     dst_stride);
+    } else if (field.type == 'F' && field.size == 8) {
+        UnpackBinaryPCDColumn<double>(src, stride, num_points, dst,
+                                      dst_stride);
+    } else {
+        for (int64_t i = 0; i < num_points; i++) {
+            dst[i * dst_stride] = 0.0;
         }
-    } else if (type == 'F') {
-        if (size == 4) {
-            float data;
-            memcpy(&data, data_ptr, sizeof(data));
-            return (double)data;
+    }
+}
+
+void UnpackBinaryPCDColors(const PCLPointField &field,
+                           const char *src,
+                           size_t stride,
+                           int64_t num_points,
+                           Eigen::Vector3d *colors) {
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_points; i++) {
+        if (field.size == 4) {
+            std::uint8_t data[4];
+            memcpy(data, src + i * stride, 4);
+            // color data is packed in BGR order.
+            colors[i] = utility::ColorToDouble(data[2], data[1], data[0]);
         } else {
-            return 0.0;
+            colors[i] = Eigen::Vector3d::Zero();
         }
     }
-    return 0.0;
 }
 
-Eigen::Vector3d UnpackBinaryPCDColor(const char *data_ptr,
-                                     const char type,
-                                     const int size) {
-    if (size == 4) {
-        std::uint8_t data[4];
-        memcpy(data, data_ptr, 4);
-        // color data is packed in BGR order.
-        return utility::ColorToDouble(data[2], data[1], data[0]);
-    } else {
-        return Eigen::Vector3d::Zero();
+/// \brief Unpacks the fields of the points [begin, begin + count) of binary
+/// data field by field.
+///
+/// Binary data stores the points one after another. Decompressed
+/// binary_compressed data stores all values of a field one after another.
+void UnpackBinaryPCDData(const char *data,
+                         const PCDHeader &header,
+                         bool is_column_major,
+                         int64_t begin,
+                         int64_t count,
+                         geometry::PointCloud &pointcloud) {
+    for (const auto &field : header.fields) {
+        const char *src = data + field.offset;
+        size_t stride = header.pointsize;
+        if (is_column_major) {
+            src = data + size_t(field.offset) * header.points;
+            stride = size_t(field.size) * field.count;
+        }
+        src += begin * stride;
+        if (field.name == "x" || field.name == "y" || field.name == "z") {
+            UnpackBinaryPCDField(field, src, stride, count,
+                                 pointcloud.points_[begin].data() +
+                                         (field.name[0] - 'x'),
+                                 3);
+        } else if (field.name == "normal_x" || field.name == "normal_y" ||
+                   field.name == "normal_z") {
+            UnpackBinaryPCDField(field, src, stride, count,
+                                 pointcloud.normals_[begin].data() +
+                                         (field.name[7] - 'x'),
+                                 3);
+        } else if (field.name == "rgb" || field.name == "rgba") {
+            UnpackBinaryPCDColors(field, src, stride, count,
+                                  pointcloud.colors_.data() + begin);
+        }
     }
 }
 
@@ -333,10 +361,47 @@ Eigen::Vector3d UnpackASCIIPCDColor(const char *data_ptr,
     }
 }
 
+float ConvertRGBToFloat(const Eigen::Vector3d &color) {
+    auto rgb = utility::ColorToUint8(color);
+    std::uint8_t rgba[4] = {rgb(2), rgb(1), rgb(0), 0};
+    float value;
+    memcpy(&value, rgba, 4);
+    return value;
+}
+
+}  // unnamed namespace
+
 bool ReadPCDData(FILE *file,
                  const PCDHeader &header,
                  geometry::PointCloud &pointcloud,
                  const ReadPointCloudOption &params) {
+    if (header.datatype != PCD_DATA_ASCII) {
+        // Binary data is read into memory and decoded like mapped data.
+        std::vector<char> buffer;
+        size_t offset = 0;
+        if (header.datatype == PCD_DATA_BINARY) {
+            buffer.resize(size_t(header.points) * header.pointsize);
+        } else {
+            // The compressed and the uncompressed size precede the data.
+            std::uint32_t sizes[2];
+            if (fread(sizes, sizeof(sizes), 1, file) != 1) {
+                utility::LogWarning(
+                        "[ReadPCDData] Failed to read data record.");
+                return false;
+            }
+            offset = sizeof(sizes);
+            buffer.resize(offset + sizes[0]);
+            memcpy(buffer.data(), sizes, offset);
+        }
+        if (fread(buffer.data() + offset, 1, buffer.size() - offset, file) !=
+            buffer.size() - offset) {
+            utility::LogWarning("[ReadPCDData] Failed to read data record.");
+            return false;
+        }
+        return ReadPCDData(buffer.data(), buffer.size(), header, pointcloud,
+                           params);
+    }
+
     // The header should have been checked
     if (header.has_points) {
         pointcloud.points_.resize(header.points);
@@ -354,195 +419,136 @@ bool ReadPCDData(FILE *file,
     utility::CountingProgressReporter reporter(params.update_progress);
     reporter.SetTotal(header.points);
 
-    if (header.datatype == PCD_DATA_ASCII) {
-        char line_buffer[DEFAULT_IO_BUFFER_SIZE];
-        int idx = 0;
-        while (fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file) &&
-               idx < header.points) {
-            std::string line(line_buffer);
-            std::vector<std::string> strs;
-            utility::SplitString(strs, line, "\t\r\n ");
-            if ((int)strs.size() < header.elementnum) {
-                continue;
-            }
-            for (size_t i = 0; i < header.fields.size(); i++) {
-                const auto &field = header.fields[i];
-                if (field.name == "x") {
-                    pointcloud.points_[idx](0) = UnpackASCIIPCDElement(
-                            strs[field.count_offset].c_str(), field.type,
-                            field.size);
-                } else if (field.name == "y") {
-                    pointcloud.points_[idx](1) = UnpackASCIIPCDElement(
-                            strs[field.count_offset].c_str(), field.type,
-                            field.size);
-                } else if (field.name == "z") {
-                    pointcloud.points_[idx](2) = UnpackASCIIPCDElement(
-                            strs[field.count_offset].c_str(), field.type,
-                            field.size);
-                } else if (field.name == "normal_x") {
-                    pointcloud.normals_[idx](0) = UnpackASCIIPCDElement(
-                            strs[field.count_offset].c_str(), field.type,
-                            field.size);
-                } else if (field.name == "normal_y") {
-                    pointcloud.normals_[idx](1) = UnpackASCIIPCDElement(
-                            strs[field.count_offset].c_str(), field.type,
-                            field.size);
-                } else if (field.name == "normal_z") {
-                    pointcloud.normals_[idx](2) = UnpackASCIIPCDElement(
-                            strs[field.count_offset].c_str(), field.type,
-                            field.size);
-                } else if (field.name == "rgb" || field.name == "rgba") {
-                    pointcloud.colors_[idx] = UnpackASCIIPCDColor(
-                            strs[field.count_offset].c_str(), field.type,
-                            field.size);
-                }
-            }
-            idx++;
-            if (idx % 1000 == 0) {
-                reporter.Update(idx);
-            }
+    char line_buffer[DEFAULT_IO_BUFFER_SIZE];
+    int idx = 0;
+    // Check the count first so that no line past the last point is
+    // consumed when the data is read in batches.
+    while (idx < header.points &&
+           fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file)) {
+        std::string line(line_buffer);
+        std::vector<std::string> strs;
+        utility::SplitString(strs, line, "\t\r\n ");
+        if ((int)strs.size() < header.elementnum) {
+            continue;
         }
-    } else if (header.datatype == PCD_DATA_BINARY) {
-        std::unique_ptr<char[]> buffer(new char[header.pointsize]);
-        for (int i = 0; i < header.points; i++) {
-            if (fread(buffer.get(), header.pointsize, 1, file) != 1) {
-                utility::LogWarning(
-                        "[ReadPCDData] Failed to read data record.");
-                pointcloud.Clear();
-                return false;
-            }
-            for (const auto &field : header.fields) {
-                if (field.name == "x") {
-                    pointcloud.points_[i](0) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "y") {
-                    pointcloud.points_[i](1) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "z") {
-                    pointcloud.points_[i](2) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "normal_x") {
-                    pointcloud.normals_[i](0) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "normal_y") {
-                    pointcloud.normals_[i](1) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "normal_z") {
-                    pointcloud.normals_[i](2) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "rgb" || field.name == "rgba") {
-                    pointcloud.colors_[i] =
-                            UnpackBinaryPCDColor(buffer.get() + field.offset,
-                                                 field.type, field.size);
-                }
-            }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
+        for (size_t i = 0; i < header.fields.size(); i++) {
+            const auto &field = header.fields[i];
+            if (field.name == "x") {
+                pointcloud.points_[idx](0) = UnpackASCIIPCDElement(
+                        strs[field.count_offset].c_str(), field.type,
+                        field.size);
+            } else if (field.name == "y") {
+                pointcloud.points_[idx](1) = UnpackASCIIPCDElement(
+                        strs[field.count_offset].c_str(), field.type,
+                        field.size);
+            } else if (field.name == "z") {
+                pointcloud.points_[idx](2) = UnpackASCIIPCDElement(
+                        strs[field.count_offset].c_str(), field.type,
+                        field.size);
+            } else if (field.name == "normal_x") {
+                pointcloud.normals_[idx](0) = UnpackASCIIPCDElement(
+                        strs[field.count_offset].c_str(), field.type,
+                        field.size);
+            } else if (field.name == "normal_y") {
+                pointcloud.normals_[idx](1) = UnpackASCIIPCDElement(
+                        strs[field.count_offset].c_str(), field.type,
+                        field.size);
+            } else if (field.name == "normal_z") {
+                pointcloud.normals_[idx](2) = UnpackASCIIPCDElement(
+                        strs[field.count_offset].c_str(), field.type,
+                        field.size);
+            } else if (field.name == "rgb" || field.name == "rgba") {
+                pointcloud.colors_[idx] = UnpackASCIIPCDColor(
+                        strs[field.count_offset].c_str(), field.type,
+                        field.size);
             }
         }
-    } else if (header.datatype == PCD_DATA_BINARY_COMPRESSED) {
-        double reporter_total = 100.0;
-        reporter.SetTotal(int(reporter_total));
-        reporter.Update(int(reporter_total * 0.01));
+        idx++;
+        if (idx % 1000 == 0) {
+            reporter.Update(idx);
+        }
+    }
+    reporter.Finish();
+    return true;
+}
+
+bool ReadPCDData(const char *data,
+                 size_t size,
+                 const PCDHeader &header,
+                 geometry::PointCloud &pointcloud,
+                 const ReadPointCloudOption &params) {
+    if (!header.has_points) {
+        utility::LogWarning(
+                "[ReadPCDData] Fields for point data are not complete.");
+        return false;
+    }
+    if (header.datatype == PCD_DATA_ASCII) {
+        utility::LogWarning(
+                "[ReadPCDData] ASCII data has to be read from a file.");
+        return false;
+    }
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(header.points);
+
+    const size_t data_size = size_t(header.points) * header.pointsize;
+    std::unique_ptr<char[]> buffer;
+    if (header.datatype == PCD_DATA_BINARY_COMPRESSED) {
         std::uint32_t compressed_size;
         std::uint32_t uncompressed_size;
-        if (fread(&compressed_size, sizeof(compressed_size), 1, file) != 1) {
-            utility::LogWarning("[ReadPCDData] Failed to read data record.");
-            pointcloud.Clear();
-            return false;
-        }
-        if (fread(&uncompressed_size, sizeof(uncompressed_size), 1, file) !=
-            1) {
+        if (size < sizeof(compressed_size) + sizeof(uncompressed_size)) {
             utility::LogWarning("[ReadPCDData] Failed to read data record.");
-            pointcloud.Clear();
             return false;
         }
+        memcpy(&compressed_size, data, sizeof(compressed_size));
+        memcpy(&uncompressed_size, data + sizeof(compressed_size),
+               sizeof(uncompressed_size));
+        data += sizeof(compressed_size) + sizeof(uncompressed_size);
+        size -= sizeof(compressed_size) + sizeof(uncompressed_size);
         utility::LogDebug(
                 "PCD data with {:d} compressed size, and {:d} uncompressed "
                 "size.",
                 compressed_size, uncompressed_size);
-        std::unique_ptr<char[]> buffer_compressed(new char[compressed_size]);
-        reporter.Update(int(reporter_total * .1));
-        if (fread(buffer_compressed.get(), 1, compressed_size, file) !=
-            compressed_size) {
+        if (size < compressed_size || uncompressed_size < data_size) {
             utility::LogWarning("[ReadPCDData] Failed to read data record.");
-            pointcloud.Clear();
             return false;
         }
-        std::unique_ptr<char[]> buffer(new char[uncompressed_size]);
-        reporter.Update(int(reporter_total * .2));
-        if (lzf_decompress(buffer_compressed.get(),
-                           (unsigned int)compressed_size, buffer.get(),
+        buffer.reset(new char[uncompressed_size]);
+        if (lzf_decompress(data, (unsigned int)compressed_size, buffer.get(),
                            (unsigned int)uncompressed_size) !=
             uncompressed_size) {
             utility::LogWarning("[ReadPCDData] Uncompression failed.");
-            pointcloud.Clear();
             return false;
         }
-        for (const auto &field : header.fields) {
-            const char *base_ptr = buffer.get() + field.offset * header.points;
-            double progress =
-                    double(base_ptr - buffer.get()) / uncompressed_size;
-            reporter.Update(int(reporter_total * (progress + .2)));
-            if (field.name == "x") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.points_[i](0) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "y") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.points_[i](1) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "z") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.points_[i](2) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "normal_x") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.normals_[i](0) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "normal_y") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.normals_[i](1) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "normal_z") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.normals_[i](2) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "rgb" || field.name == "rgba") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.colors_[i] = UnpackBinaryPCDColor(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            }
-        }
+        data = buffer.get();
+    } else if (size < data_size) {
+        utility::LogWarning("[ReadPCDData] Failed to read data record.");
+        return false;
+    }
+
+    pointcloud.points_.resize(header.points);
+    if (header.has_normals) {
+        pointcloud.normals_.resize(header.points);
+    }
+    if (header.has_colors) {
+        pointcloud.colors_.resize(header.points);
+    }
+    const int64_t block_size = ProgressBlockSize(header.points);
+    for (int64_t begin = 0; begin < header.points; begin += block_size) {
+        const int64_t count = std::min<int64_t>(block_size,
+                                                header.points - begin);
+        UnpackBinaryPCDData(data, header,
+                            header.datatype == PCD_DATA_BINARY_COMPRESSED,
+                            begin, count, pointcloud);
+        reporter.Update(begin + count);
     }
     reporter.Finish();
     return true;
 }
 
-bool GenerateHeader(const geometry::PointCloud &pointcloud,
-                    const bool write_ascii,
-                    const bool compressed,
-                    PCDHeader &header) {
+bool GeneratePCDHeader(const geometry::PointCloud &pointcloud,
+                       const bool write_ascii,
+                       const bool compressed,
+                       PCDHeader &header) {
     if (!pointcloud.HasPoints()) {
         return false;
     }
@@ -591,7 +597,7 @@ bool GenerateHeader(const geometry::PointCloud &pointcloud,
     return true;
 }
 
-bool WritePCDHeader(FILE *file, const PCDHeader &header) {
+bool WritePCDHeader(FILE *file, const PCDHeader &header, int count_width) {
     fprintf(file, "# .PCD v%s - Point Cloud Data file format\n",
             header.version.c_str());
     fprintf(file, "VERSION %s\n", header.version.c_str());
@@ -615,10 +621,10 @@ bool WritePCDHeader(FILE *file, const PCDHeader &header) {
         fprintf(file, " %d", field.count);
     }
     fprintf(file, "\n");
-    fprintf(file, "WIDTH %d\n", header.width);
+    fprintf(file, "WIDTH %-*d\n", count_width, header.width);
     fprintf(file, "HEIGHT %d\n", header.height);
     fprintf(file, "VIEWPOINT 0 0 0 1 0 0 0\n");
-    fprintf(file, "POINTS %d\n", header.points);
+    fprintf(file, "POINTS %-*d\n", count_width, header.points);
 
     switch (header.datatype) {
         case PCD_DATA_BINARY:
@@ -635,14 +641,6 @@ bool WritePCDHeader(FILE *file, const PCDHeader &header) {
     return true;
 }
 
-float ConvertRGBToFloat(const Eigen::Vector3d &color) {
-    auto rgb = utility::ColorToUint8(color);
-    std::uint8_t rgba[4] = {rgb(2), rgb(1), rgb(0), 0};
-    float value;
-    memcpy(&value, rgba, 4);
-    return value;
-}
-
 bool WritePCDData(FILE *file,
                   const PCDHeader &header,
                   const geometry::PointCloud &pointcloud,
@@ -670,28 +668,38 @@ bool WritePCDData(FILE *file,
             }
         }
     } else if (header.datatype == PCD_DATA_BINARY) {
-        std::unique_ptr<float[]> data(new float[header.elementnum]);
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-            const auto &point = pointcloud.points_[i];
-            data[0] = (float)point(0);
-            data[1] = (float)point(1);
-            data[2] = (float)point(2);
-            int idx = 3;
-            if (has_normal) {
-                const auto &normal = pointcloud.normals_[i];
-                data[idx + 0] = (float)normal(0);
-                data[idx + 1] = (float)normal(1);
-                data[idx + 2] = (float)normal(2);
-                idx += 3;
-            }
-            if (has_color) {
-                const auto &color = pointcloud.colors_[i];
-                data[idx] = ConvertRGBToFloat(color);
-            }
-            fwrite(data.get(), sizeof(float), header.elementnum, file);
-            if (i % 1000 == 0) {
-                reporter.Update(i);
+        // Pack the points in parallel and write them at once.
+        const int64_t num_points = int64_t(pointcloud.points_.size());
+        const int64_t block_size = ProgressBlockSize(num_points);
+        std::vector<float> data(num_points * header.elementnum);
+        for (int64_t begin = 0; begin < num_points; begin += block_size) {
+            const int64_t end = std::min(begin + block_size, num_points);
+#pragma omp parallel for schedule(static)
+            for (int64_t i = begin; i < end; i++) {
+                float *record = data.data() + i * header.elementnum;
+                const auto &point = pointcloud.points_[i];
+                record[0] = (float)point(0);
+                record[1] = (float)point(1);
+                record[2] = (float)point(2);
+                int idx = 3;
+                if (has_normal) {
+                    const auto &normal = pointcloud.normals_[i];
+                    record[idx + 0] = (float)normal(0);
+                    record[idx + 1] = (float)normal(1);
+                    record[idx + 2] = (float)normal(2);
+                    idx += 3;
+                }
+                if (has_color) {
+                    const auto &color = pointcloud.colors_[i];
+                    record[idx] = ConvertRGBToFloat(color);
+                }
             }
+            reporter.Update(end);
+        }
+        if (fwrite(data.data(), sizeof(float), data.size(), file) !=
+            data.size()) {
+            utility::LogWarning("[WritePCDData] Failed to write data.");
+            return false;
         }
     } else if (header.datatype == PCD_DATA_BINARY_COMPRESSED) {
         double report_total = double(pointcloud.points_.size() * 2);
@@ -699,39 +707,62 @@ bool WritePCDData(FILE *file,
         // 50%-75% compressing buffer
         // 75%-100% writing compressed buffer
         reporter.SetTotal(int(report_total));
-        int strip_size = header.points;
-        std::uint32_t buffer_size =
-                (std::uint32_t)(header.elementnum * header.points);
-        std::unique_ptr<float[]> buffer(new float[buffer_size]);
-        std::unique_ptr<float[]> buffer_compressed(new float[buffer_size * 2]);
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-            const auto &point = pointcloud.points_[i];
-            buffer[0 * strip_size + i] = (float)point(0);
-            buffer[1 * strip_size + i] = (float)point(1);
-            buffer[2 * strip_size + i] = (float)point(2);
-            int idx = 3;
-            if (has_normal) {
-                const auto &normal = pointcloud.normals_[i];
-                buffer[(idx + 0) * strip_size + i] = (float)normal(0);
-                buffer[(idx + 1) * strip_size + i] = (float)normal(1);
-                buffer[(idx + 2) * strip_size + i] = (float)normal(2);
-                idx += 3;
-            }
-            if (has_color) {
-                const auto &color = pointcloud.colors_[i];
-                buffer[idx * strip_size + i] = ConvertRGBToFloat(color);
-            }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
+        const int64_t strip_size = header.points;
+        const int64_t block_size = ProgressBlockSize(strip_size);
+        std::vector<float> buffer(header.elementnum * strip_size);
+        for (int64_t begin = 0; begin < strip_size; begin += block_size) {
+            const int64_t end = std::min(begin + block_size, strip_size);
+#pragma omp parallel for schedule(static)
+            for (int64_t i = begin; i < end; i++) {
+                const auto &point = pointcloud.points_[i];
+                buffer[0 * strip_size + i] = (float)point(0);
+                buffer[1 * strip_size + i] = (float)point(1);
+                buffer[2 * strip_size + i] = (float)point(2);
+                int idx = 3;
+                if (has_normal) {
+                    const auto &normal = pointcloud.normals_[i];
+                    buffer[(idx + 0) * strip_size + i] = (float)normal(0);
+                    buffer[(idx + 1) * strip_size + i] = (float)normal(1);
+                    buffer[(idx + 2) * strip_size + i] = (float)normal(2);
+                    idx += 3;
+                }
+                if (has_color) {
+                    const auto &color = pointcloud.colors_[i];
+                    buffer[idx * strip_size + i] = ConvertRGBToFloat(color);
+                }
             }
+            reporter.Update(end);
         }
-        std::uint32_t buffer_size_in_bytes = buffer_size * sizeof(float);
-        std::uint32_t size_compressed =
-                lzf_compress(buffer.get(), buffer_size_in_bytes,
-                             buffer_compressed.get(), buffer_size_in_bytes * 2);
-        if (size_compressed == 0) {
-            utility::LogWarning("[WritePCDData] Failed to compress data.");
-            return false;
+
+        // Compress chunks of the buffer in parallel. An LZF stream may only
+        // refer back to its own output, so the concatenated chunks form a
+        // single stream that PCL decompresses with one lzf_decompress call.
+        const char *bytes = reinterpret_cast<const char *>(buffer.data());
+        const std::uint32_t buffer_size_in_bytes =
+                std::uint32_t(buffer.size() * sizeof(float));
+        const int64_t num_chunks =
+                (int64_t(buffer_size_in_bytes) + kCompressionChunkSize - 1) /
+                kCompressionChunkSize;
+        std::vector<std::vector<char>> chunks(num_chunks);
+#pragma omp parallel for schedule(dynamic)
+        for (int64_t c = 0; c < num_chunks; c++) {
+            const std::uint32_t begin =
+                    std::uint32_t(c * kCompressionChunkSize);
+            const std::uint32_t size = std::min<std::uint32_t>(
+                    kCompressionChunkSize, buffer_size_in_bytes - begin);
+            // LZF output is less than 104% of the input.
+            chunks[c].resize(size + size / 16 + 64);
+            chunks[c].resize(lzf_compress(bytes + begin, size,
+                                          chunks[c].data(),
+                                          (unsigned int)chunks[c].size()));
+        }
+        std::uint32_t size_compressed = 0;
+        for (const std::vector<char> &chunk : chunks) {
+            if (chunk.empty()) {
+                utility::LogWarning("[WritePCDData] Failed to compress data.");
+                return false;
+            }
+            size_compressed += std::uint32_t(chunk.size());
         }
         utility::LogDebug(
                 "[WritePCDData] {:d} bytes data compressed into {:d} bytes.",
@@ -739,15 +770,17 @@ bool WritePCDData(FILE *file,
         reporter.Update(int(report_total * 0.75));
         fwrite(&size_compressed, sizeof(size_compressed), 1, file);
         fwrite(&buffer_size_in_bytes, sizeof(buffer_size_in_bytes), 1, file);
-        fwrite(buffer_compressed.get(), 1, size_compressed, file);
+        for (const std::vector<char> &chunk : chunks) {
+            if (fwrite(chunk.data(), 1, chunk.size(), file) != chunk.size()) {
+                utility::LogWarning("[WritePCDData] Failed to write data.");
+                return false;
+            }
+        }
     }
     reporter.Finish();
     return true;
 }
 
-}  // unnamed namespace
-
-namespace io {
 FileGeometry ReadFileGeometryTypePCD(const std::string &path) {
     return CONTAINS_POINTS;
 }
@@ -780,12 +813,28 @@ bool ReadPointCloudFromPCD(const std::string &filename,
                       header.has_points ? "yes" : "no",
                       header.has_normals ? "yes" : "no",
                       header.has_colors ? "yes" : "no");
-    if (!ReadPCDData(file, header, pointcloud, params)) {
-        utility::LogWarning("Read PCD failed: unable to read data.");
+    if (header.datatype == PCD_DATA_ASCII) {
+        if (!ReadPCDData(file, header, pointcloud, params)) {
+            utility::LogWarning("Read PCD failed: unable to read data.");
+            fclose(file);
+            return false;
+        }
         fclose(file);
-        return false;
+        return true;
     }
+
+    // Binary data is decoded directly from a mapping of the file.
+    const long data_offset = ftell(file);
     fclose(file);
+    utility::filesystem::MappedFile mapped_file;
+    if (data_offset < 0 || !mapped_file.Open(filename) ||
+        size_t(data_offset) > mapped_file.GetSize() ||
+        !ReadPCDData(mapped_file.GetData() + data_offset,
+                     mapped_file.GetSize() - data_offset, header, pointcloud,
+                     params)) {
+        utility::LogWarning("Read PCD failed: unable to read data.");
+        return false;
+    }
     return true;
 }
 
@@ -793,8 +842,8 @@ bool WritePointCloudToPCD(const std::string &filename,
                           const geometry::PointCloud &pointcloud,
                           const WritePointCloudOption &params) {
     PCDHeader header;
-    if (!GenerateHeader(pointcloud, bool(params.write_ascii),
-                        bool(params.compressed), header)) {
+    if (!GeneratePCDHeader(pointcloud, bool(params.write_ascii),
+                           bool(params.compressed), header)) {
         utility::LogWarning("Write PCD failed: unable to generate header.");
         return false;
     }
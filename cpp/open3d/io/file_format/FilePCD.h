@@ -0,0 +1,116 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/io/PointCloudIO.h"
+
+namespace open3d {
+namespace io {
+
+enum PCDDataType {
+    PCD_DATA_ASCII = 0,
+    PCD_DATA_BINARY = 1,
+    PCD_DATA_BINARY_COMPRESSED = 2
+};
+
+struct PCLPointField {
+public:
+    std::string name;
+    int size;
+    char type;
+    int count;
+    // helper variable
+    int count_offset;
+    int offset;
+};
+
+struct PCDHeader {
+public:
+    std::string version;
+    std::vector<PCLPointField> fields;
+    int width;
+    int height;
+    int points;
+    PCDDataType datatype;
+    std::string viewpoint;
+    // helper variables
+    int elementnum;
+    int pointsize;
+    bool has_points;
+    bool has_normals;
+    bool has_colors;
+};
+
+/// Reads the header of a PCD file. On success, \p file is positioned at the
+/// first byte of the data.
+bool ReadPCDHeader(FILE *file, PCDHeader &header);
+
+/// Reads header.points points from the current position of \p file.
+bool ReadPCDData(FILE *file,
+                 const PCDHeader &header,
+                 geometry::PointCloud &pointcloud,
+                 const ReadPointCloudOption &params);
+
+/// \brief Decodes header.points points of binary or binary_compressed data
+/// from memory, e.g. from a mapping of the file.
+///
+/// The fields are unpacked one at a time, in parallel over the points.
+bool ReadPCDData(const char *data,
+                 size_t size,
+                 const PCDHeader &header,
+                 geometry::PointCloud &pointcloud,
+                 const ReadPointCloudOption &params);
+
+/// Fills the header for writing the points, normals and colors of
+/// \p pointcloud.
+bool GeneratePCDHeader(const geometry::PointCloud &pointcloud,
+                       const bool write_ascii,
+                       const bool compressed,
+                       PCDHeader &header);
+
+/// Writes \p header. WIDTH and POINTS are padded with spaces to
+/// \p count_width characters, so that the header can be rewritten in place
+/// once the number of points is known.
+bool WritePCDHeader(FILE *file, const PCDHeader &header, int count_width = 0);
+
+/// \brief Writes the points of \p pointcloud at the current position of
+/// \p file.
+///
+/// binary_compressed data is compressed in chunks by all threads. The
+/// concatenated chunks are a single LZF stream, as PCL expects.
+bool WritePCDData(FILE *file,
+                  const PCDHeader &header,
+                  const geometry::PointCloud &pointcloud,
+                  const WritePointCloudOption &params);
+
+}  // namespace io
+}  // namespace open3d
@@ -26,11 +26,14 @@
 
 #include <rply.h>
 
+#include <algorithm>
+
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/LineSetIO.h"
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/io/TriangleMeshIO.h"
 #include "open3d/io/VoxelGridIO.h"
+#include "open3d/io/file_format/BinaryPLYReader.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/ProgressReporters.h"
 
@@ -357,6 +360,155 @@ int ReadColorCallback(p_ply_argument argument) {
 
 }  // namespace ply_voxelgrid_reader
 
+namespace ply_binary_reader {
+
+const char *const kPointNames[3] = {"x", "y", "z"};
+const char *const kNormalNames[3] = {"nx", "ny", "nz"};
+const char *const kColorNames[3] = {"red", "green", "blue"};
+
+// Finds the properties \p names, returns false if only some of them exist.
+bool FindVector3Properties(const BinaryPLYReader::Element &vertex,
+                           const char *const names[3],
+                           int indices[3]) {
+    int num_found = 0;
+    for (int k = 0; k < 3; ++k) {
+        indices[k] = vertex.FindProperty(names[k]);
+        num_found += indices[k] >= 0 ? 1 : 0;
+    }
+    return num_found == 0 || num_found == 3;
+}
+
+void ReadVector3Properties(const BinaryPLYReader &reader,
+                           const BinaryPLYReader::Element &vertex,
+                           const int indices[3],
+                           int64_t begin,
+                           int64_t count,
+                           std::vector<Eigen::Vector3d> &values) {
+    if (indices[0] < 0) {
+        return;
+    }
+    for (int k = 0; k < 3; ++k) {
+        reader.ReadProperty(vertex, indices[k], begin, count,
+                            values[begin].data() + k, 3);
+    }
+}
+
+// Returns the vertex element if it can be decoded column by column, that is
+// if its records have a fixed size and each of the point, normal and color
+// properties is either complete or absent. Otherwise the file is left to
+// rply, which also handles the error cases.
+const BinaryPLYReader::Element *FindVertexElement(
+        const BinaryPLYReader &reader) {
+    const BinaryPLYReader::Element *vertex = reader.FindElement("vertex");
+    int indices[3];
+    if (vertex == nullptr || !vertex->IsFixedSize() || vertex->count_ <= 0 ||
+        !FindVector3Properties(*vertex, kPointNames, indices) ||
+        indices[0] < 0 ||
+        !FindVector3Properties(*vertex, kNormalNames, indices) ||
+        !FindVector3Properties(*vertex, kColorNames, indices)) {
+        return nullptr;
+    }
+    return vertex;
+}
+
+// Decodes the vertices in blocks, so that \p reporter, if not nullptr, is
+// updated between the blocks.
+void ReadVertexElement(const BinaryPLYReader &reader,
+                       const BinaryPLYReader::Element &vertex,
+                       std::vector<Eigen::Vector3d> &points,
+                       std::vector<Eigen::Vector3d> &normals,
+                       std::vector<Eigen::Vector3d> &colors,
+                       utility::CountingProgressReporter *reporter = nullptr) {
+    int point_indices[3], normal_indices[3], color_indices[3];
+    FindVector3Properties(vertex, kPointNames, point_indices);
+    FindVector3Properties(vertex, kNormalNames, normal_indices);
+    FindVector3Properties(vertex, kColorNames, color_indices);
+    points.assign(vertex.count_, Eigen::Vector3d::Zero());
+    normals.assign(normal_indices[0] < 0 ? 0 : vertex.count_,
+                   Eigen::Vector3d::Zero());
+    colors.assign(color_indices[0] < 0 ? 0 : vertex.count_,
+                  Eigen::Vector3d::Zero());
+    const int64_t block_size = std::max<int64_t>(1000, vertex.count_ / 100);
+    for (int64_t begin = 0; begin < vertex.count_; begin += block_size) {
+        const int64_t count = std::min(block_size, vertex.count_ - begin);
+        ReadVector3Properties(reader, vertex, point_indices, begin, count,
+                              points);
+        ReadVector3Properties(reader, vertex, normal_indices, begin, count,
+                              normals);
+        ReadVector3Properties(reader, vertex, color_indices, begin, count,
+                              colors);
+        if (reporter != nullptr) {
+            reporter->Update(begin + count);
+        }
+    }
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < int(colors.size()); ++i) {
+        colors[i] /= 255.0;
+    }
+}
+
+bool ReadTriangleMeshFromBinaryPLY(const BinaryPLYReader &reader,
+                                   const BinaryPLYReader::Element &vertex,
+                                   geometry::TriangleMesh &mesh,
+                                   bool print_progress) {
+    mesh.Clear();
+    ReadVertexElement(reader, vertex, mesh.vertices_, mesh.vertex_normals_,
+                      mesh.vertex_colors_);
+
+    const BinaryPLYReader::Element *face = reader.FindElement("face");
+    int property_index = -1;
+    if (face != nullptr) {
+        property_index = face->FindProperty("vertex_indices");
+        if (property_index < 0) {
+            property_index = face->FindProperty("vertex_index");
+        }
+    }
+    if (property_index < 0 || !face->properties_[property_index].is_list_) {
+        return true;
+    }
+
+    // Faces have variable size and are read sequentially.
+    std::vector<int64_t> offsets;
+    std::vector<unsigned int> indices;
+    if (!reader.ReadListProperty(*face, property_index, offsets, indices)) {
+        utility::LogWarning("Read PLY failed: face data is truncated.");
+        return false;
+    }
+    const int num_faces = int(face->count_);
+    bool all_triangles = true;
+    for (int i = 0; i < num_faces && all_triangles; ++i) {
+        all_triangles = offsets[i + 1] - offsets[i] == 3;
+    }
+    if (all_triangles) {
+        mesh.triangles_.resize(num_faces);
+#pragma omp parallel for schedule(static)
+        for (int i = 0; i < num_faces; ++i) {
+            mesh.triangles_[i] = Eigen::Vector3i(indices[3 * i],
+                                                 indices[3 * i + 1],
+                                                 indices[3 * i + 2]);
+        }
+        return true;
+    }
+
+    utility::ConsoleProgressBar progress_bar(num_faces, "Reading PLY: ",
+                                             print_progress);
+    std::vector<unsigned int> polygon;
+    for (int i = 0; i < num_faces; ++i) {
+        polygon.assign(indices.begin() + offsets[i],
+                       indices.begin() + offsets[i + 1]);
+        if (polygon.size() < 3 || !AddTrianglesByEarClipping(mesh, polygon)) {
+            utility::LogWarning(
+                    "Read PLY failed: A polygon in the mesh could not be "
+                    "decomposed into triangles.");
+            return false;
+        }
+        ++progress_bar;
+    }
+    return true;
+}
+
+}  // namespace ply_binary_reader
+
 }  // unnamed namespace
 /// @endcond
 
@@ -398,6 +550,22 @@ bool ReadPointCloudFromPLY(const std::string &filename,
                            const ReadPointCloudOption &params) {
     using namespace ply_pointcloud_reader;
 
+    // Binary files with fixed-size vertex records are decoded directly from
+    // a memory mapping, without a callback per value.
+    BinaryPLYReader binary_reader;
+    if (binary_reader.Open(filename)) {
+        if (auto vertex = ply_binary_reader::FindVertexElement(binary_reader)) {
+            utility::CountingProgressReporter reporter(params.update_progress);
+            reporter.SetTotal(vertex->count_);
+            pointcloud.Clear();
+            ply_binary_reader::ReadVertexElement(
+                    binary_reader, *vertex, pointcloud.points_,
+                    pointcloud.normals_, pointcloud.colors_, &reporter);
+            reporter.Finish();
+            return true;
+        }
+    }
+
     p_ply ply_file = ply_open(filename.c_str(), NULL, 0, NULL);
     if (!ply_file) {
         utility::LogWarning("Read PLY failed: unable to open file: {}",
@@ -542,6 +710,14 @@ bool ReadTriangleMeshFromPLY(const std::string &filename,
                              bool print_progress) {
     using namespace ply_trianglemesh_reader;
 
+    BinaryPLYReader binary_reader;
+    if (binary_reader.Open(filename)) {
+        if (auto vertex = ply_binary_reader::FindVertexElement(binary_reader)) {
+            return ply_binary_reader::ReadTriangleMeshFromBinaryPLY(
+                    binary_reader, *vertex, mesh, print_progress);
+        }
+    }
+
     p_ply ply_file = ply_open(filename.c_str(), NULL, 0, NULL);
     if (!ply_file) {
         utility::LogWarning("Read PLY failed: unable to open file: {}",
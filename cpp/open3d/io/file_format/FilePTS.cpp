@@ -24,10 +24,13 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cstdio>
+#include <cstring>
 
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/io/file_format/AsciiRowReader.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
@@ -44,59 +47,63 @@ bool ReadPointCloudFromPTS(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        utility::filesystem::MappedFile file;
+        if (!file.Open(filename)) {
             utility::LogWarning("Read PTS failed: unable to open file: {}",
                                 filename);
             return false;
         }
+        const char *begin = file.GetData();
+        const char *end = begin + file.GetSize();
+        auto next_line = [end](const char *line_begin) {
+            const char *line_end = static_cast<const char *>(
+                    std::memchr(line_begin, '\n', end - line_begin));
+            return line_end == nullptr ? end : line_end + 1;
+        };
+        const char *data_begin = next_line(begin);
         size_t num_of_pts = 0;
-        int num_of_fields = 0;
-        const char *line_buffer;
-        if ((line_buffer = file.ReadLine())) {
-            sscanf(line_buffer, "%zu", &num_of_pts);
-        }
+        sscanf(std::string(begin, data_begin).c_str(), "%zu", &num_of_pts);
         if (num_of_pts <= 0) {
             utility::LogWarning("Read PTS failed: unable to read header.");
             return false;
         }
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(num_of_pts);
+        reporter.SetTotal(int64_t(file.GetSize()));
 
         pointcloud.Clear();
-        size_t idx = 0;
-        while (idx < num_of_pts && (line_buffer = file.ReadLine())) {
-            if (num_of_fields == 0) {
-                std::vector<std::string> st;
-                utility::SplitString(st, line_buffer, " ");
-                num_of_fields = (int)st.size();
-                if (num_of_fields < 3) {
-                    utility::LogWarning(
-                            "Read PTS failed: insufficient data fields.");
-                    return false;
-                }
-                pointcloud.points_.resize(num_of_pts);
-                if (num_of_fields >= 7) {
-                    // X Y Z I R G B
-                    pointcloud.colors_.resize(num_of_pts);
-                }
-            }
-            double x, y, z;
-            int i, r, g, b;
-            if (num_of_fields < 7) {
-                if (sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                    pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                }
-            } else {
-                if (sscanf(line_buffer, "%lf %lf %lf %d %d %d %d", &x, &y, &z,
-                           &i, &r, &g, &b) == 7) {
-                    pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                    pointcloud.colors_[idx] = utility::ColorToDouble(r, g, b);
-                }
-            }
-            idx++;
-            if (idx % 1000 == 0) {
-                reporter.Update(idx);
+        if (data_begin == end) {
+            reporter.Finish();
+            return true;
+        }
+        // The first point gives the number of fields of all points.
+        std::vector<std::string> st;
+        utility::SplitString(st, std::string(data_begin, next_line(data_begin)),
+                             " ");
+        int num_of_fields = (int)st.size();
+        if (num_of_fields < 3) {
+            utility::LogWarning("Read PTS failed: insufficient data fields.");
+            return false;
+        }
+
+        // X Y Z or X Y Z I R G B, one point per line even if it is invalid.
+        const int num_columns = num_of_fields >= 7 ? 7 : 3;
+        std::vector<double> values;
+        ParseAsciiRowsParallel(data_begin, end, num_columns, false, values,
+                               &reporter, data_begin - begin);
+        const int num_rows =
+                int(std::min(values.size() / num_columns, num_of_pts));
+        pointcloud.points_.resize(num_of_pts, Eigen::Vector3d::Zero());
+        if (num_of_fields >= 7) {
+            pointcloud.colors_.resize(num_of_pts, Eigen::Vector3d::Zero());
+        }
+#pragma omp parallel for schedule(static)
+        for (int idx = 0; idx < num_rows; ++idx) {
+            const double *row = &values[num_columns * idx];
+            pointcloud.points_[idx] = Eigen::Vector3d(row[0], row[1], row[2]);
+            if (num_of_fields >= 7) {
+                pointcloud.colors_[idx] = utility::ColorToDouble(
+                        uint8_t(int(row[4])), uint8_t(int(row[5])),
+                        uint8_t(int(row[6])));
             }
         }
         reporter.Finish();
@@ -0,0 +1,578 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/file_format/FileQPC.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#include "open3d/core/kernel/ParallelUtil.h"
+#include "open3d/io/FileFormatIO.h"
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace io {
+
+namespace {
+
+const char kQPCMagic[6] = {'O', '3', 'D', 'Q', 'P', 'C'};
+constexpr std::uint8_t kQPCVersion = 1;
+constexpr std::uint8_t kQPCHasNormals = 1;
+constexpr std::uint8_t kQPCHasColors = 2;
+/// Magic, version, flags, number of points, origin, precision, points per
+/// chunk and number of chunks.
+constexpr size_t kQPCHeaderSize = 6 + 1 + 1 + 8 + 3 * 8 + 8 + 4 + 4;
+constexpr int64_t kQPCPointsPerChunk = 1 << 14;
+
+/// Values per Rice parameter.
+constexpr int64_t kRiceBlockSize = 32;
+/// Values with a unary prefix of this length are stored with 64 bits.
+constexpr std::uint32_t kRiceEscape = 24;
+/// Bits of the Rice parameter of a block.
+constexpr int kRiceParameterBits = 6;
+
+constexpr int kMortonBitsPerAxis = 21;
+constexpr double kNormalScale = 32767.0;
+constexpr double kColorScale = 255.0;
+
+/// Writes values of up to 32 bits, least significant bit first.
+class BitWriter {
+public:
+    explicit BitWriter(std::vector<std::uint8_t> &bytes) : bytes_(bytes) {}
+
+    void Write(std::uint64_t value, int num_bits) {
+        buffer_ |= value << num_bits_;
+        num_bits_ += num_bits;
+        while (num_bits_ >= 8) {
+            bytes_.push_back(std::uint8_t(buffer_));
+            buffer_ >>= 8;
+            num_bits_ -= 8;
+        }
+    }
+
+    void WriteLong(std::uint64_t value, int num_bits) {
+        if (num_bits > 32) {
+            Write(value & 0xffffffffu, 32);
+            Write(value >> 32, num_bits - 32);
+        } else {
+            Write(value, num_bits);
+        }
+    }
+
+    void Flush() {
+        if (num_bits_ > 0) {
+            bytes_.push_back(std::uint8_t(buffer_));
+        }
+        buffer_ = 0;
+        num_bits_ = 0;
+    }
+
+private:
+    std::vector<std::uint8_t> &bytes_;
+    std::uint64_t buffer_ = 0;
+    int num_bits_ = 0;
+};
+
+/// Reads values of up to 32 bits written by BitWriter.
+class BitReader {
+public:
+    BitReader(const std::uint8_t *begin, const std::uint8_t *end)
+        : next_(begin), end_(end) {}
+
+    std::uint64_t Read(int num_bits) {
+        Refill();
+        if (num_bits > num_bits_) {
+            overrun_ = true;
+            return 0;
+        }
+        const std::uint64_t value =
+                buffer_ & ((std::uint64_t(1) << num_bits) - 1);
+        buffer_ >>= num_bits;
+        num_bits_ -= num_bits;
+        return value;
+    }
+
+    std::uint64_t ReadLong(int num_bits) {
+        if (num_bits > 32) {
+            const std::uint64_t low = Read(32);
+            return low | (Read(num_bits - 32) << 32);
+        }
+        return Read(num_bits);
+    }
+
+    /// Reads a unary prefix of at most kRiceEscape ones, including its
+    /// terminating zero unless it has kRiceEscape ones.
+    std::uint32_t ReadUnary() {
+        Refill();
+        std::uint32_t count = 0;
+        while (count < kRiceEscape && ((buffer_ >> count) & 1) != 0) {
+            ++count;
+        }
+        Read(count < kRiceEscape ? int(count) + 1 : int(count));
+        return count;
+    }
+
+    bool IsOverrun() const { return overrun_; }
+
+private:
+    void Refill() {
+        while (num_bits_ <= 56 && next_ < end_) {
+            buffer_ |= std::uint64_t(*next_++) << num_bits_;
+            num_bits_ += 8;
+        }
+    }
+
+    const std::uint8_t *next_;
+    const std::uint8_t *end_;
+    std::uint64_t buffer_ = 0;
+    int num_bits_ = 0;
+    bool overrun_ = false;
+};
+
+std::uint64_t ZigZagEncode(int64_t value) {
+    return (std::uint64_t(value) << 1) ^ std::uint64_t(value >> 63);
+}
+
+int64_t ZigZagDecode(std::uint64_t value) {
+    return int64_t(value >> 1) ^ -int64_t(value & 1);
+}
+
+/// Delta codes \p values, a channel of \p count points, and writes the
+/// deltas with Rice codes. The parameter of each block is the logarithm of
+/// the mean of its deltas.
+void EncodeChannel(const int64_t *values,
+                   int64_t count,
+                   BitWriter &writer,
+                   std::vector<std::uint64_t> &deltas) {
+    deltas.resize(count);
+    int64_t previous = 0;
+    for (int64_t i = 0; i < count; ++i) {
+        deltas[i] = ZigZagEncode(values[i] - previous);
+        previous = values[i];
+    }
+    for (int64_t begin = 0; begin < count; begin += kRiceBlockSize) {
+        const int64_t end = std::min(begin + kRiceBlockSize, count);
+        std::uint64_t sum = 0;
+        for (int64_t i = begin; i < end; ++i) {
+            sum += deltas[i];
+        }
+        const std::uint64_t mean = sum / std::uint64_t(end - begin);
+        int k = 0;
+        while (k < 63 && (mean >> (k + 1)) != 0) {
+            ++k;
+        }
+        writer.Write(std::uint64_t(k), kRiceParameterBits);
+        for (int64_t i = begin; i < end; ++i) {
+            const std::uint64_t quotient = deltas[i] >> k;
+            if (quotient < kRiceEscape) {
+                // quotient ones followed by a zero.
+                writer.Write((std::uint64_t(1) << quotient) - 1,
+                             int(quotient) + 1);
+                writer.WriteLong(deltas[i] & ((std::uint64_t(1) << k) - 1),
+                                 k);
+            } else {
+                writer.Write((std::uint64_t(1) << kRiceEscape) - 1,
+                             int(kRiceEscape));
+                writer.WriteLong(deltas[i], 64);
+            }
+        }
+    }
+}
+
+void DecodeChannel(BitReader &reader, int64_t count, int64_t *values) {
+    int64_t previous = 0;
+    for (int64_t begin = 0; begin < count; begin += kRiceBlockSize) {
+        const int64_t end = std::min(begin + kRiceBlockSize, count);
+        const int k = int(reader.Read(kRiceParameterBits));
+        for (int64_t i = begin; i < end; ++i) {
+            const std::uint32_t quotient = reader.ReadUnary();
+            std::uint64_t delta;
+            if (quotient < kRiceEscape) {
+                delta = (std::uint64_t(quotient) << k) | reader.ReadLong(k);
+            } else {
+                delta = reader.ReadLong(64);
+            }
+            previous += ZigZagDecode(delta);
+            values[i] = previous;
+        }
+    }
+}
+
+/// Spreads the lower 21 bits of \p value to every third bit.
+std::uint64_t SpreadBits(std::uint64_t value) {
+    value &= 0x1fffff;
+    value = (value | value << 32) & 0x1f00000000ffffULL;
+    value = (value | value << 16) & 0x1f0000ff0000ffULL;
+    value = (value | value << 8) & 0x100f00f00f00f00fULL;
+    value = (value | value << 4) & 0x10c30c30c30c30c3ULL;
+    value = (value | value << 2) & 0x1249249249249249ULL;
+    return value;
+}
+
+template <typename T>
+void AppendValue(std::vector<char> &bytes, T value) {
+    const char *begin = reinterpret_cast<const char *>(&value);
+    bytes.insert(bytes.end(), begin, begin + sizeof(T));
+}
+
+template <typename T>
+T ReadValue(const char *&data) {
+    T value;
+    memcpy(&value, data, sizeof(T));
+    data += sizeof(T);
+    return value;
+}
+
+}  // namespace
+
+bool WriteQPC(const std::string &filename,
+              int64_t num_points,
+              const double *points,
+              const double *normals,
+              const double *colors,
+              double precision,
+              utility::CountingProgressReporter &reporter) {
+    // 0%-50% quantization and sorting, 50%-100% encoding.
+    reporter.SetTotal(2 * num_points);
+    double min_bound[3], max_bound[3];
+    for (int a = 0; a < 3; ++a) {
+        min_bound[a] = std::numeric_limits<double>::infinity();
+        max_bound[a] = -std::numeric_limits<double>::infinity();
+    }
+    for (int64_t i = 0; i < num_points; ++i) {
+        for (int a = 0; a < 3; ++a) {
+            if (!std::isfinite(points[3 * i + a])) {
+                utility::LogWarning(
+                        "Write QPC failed: points that are not finite cannot "
+                        "be quantized.");
+                return false;
+            }
+            min_bound[a] = std::min(min_bound[a], points[3 * i + a]);
+            max_bound[a] = std::max(max_bound[a], points[3 * i + a]);
+        }
+    }
+    double max_extent = 0.0;
+    for (int a = 0; a < 3 && num_points > 0; ++a) {
+        max_extent = std::max(max_extent, max_bound[a] - min_bound[a]);
+    }
+    if (!(precision > 0.0)) {
+        precision = max_extent > 0.0 ? max_extent / kQPCDefaultNumCells : 1.0;
+    }
+    if (max_extent / precision >=
+        double(std::numeric_limits<std::uint32_t>::max())) {
+        utility::LogWarning(
+                "Write QPC failed: precision {} is too small for an extent "
+                "of {}.",
+                precision, max_extent);
+        return false;
+    }
+
+    // Quantize and sort the points along a Morton curve. Coarser cells are
+    // used for the order if the grid has more than 2^21 cells per axis.
+    std::vector<int64_t> quantized(3 * num_points);
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < 3 * num_points; ++i) {
+        quantized[i] = std::llround((points[i] - min_bound[i % 3]) / precision);
+    }
+    int shift = 0;
+    while ((std::llround(max_extent / precision) >>
+            (kMortonBitsPerAxis + shift)) != 0) {
+        ++shift;
+    }
+    std::vector<std::pair<std::uint64_t, int64_t>> order(num_points);
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_points; ++i) {
+        const std::uint64_t x = std::uint64_t(quantized[3 * i]) >> shift;
+        const std::uint64_t y = std::uint64_t(quantized[3 * i + 1]) >> shift;
+        const std::uint64_t z = std::uint64_t(quantized[3 * i + 2]) >> shift;
+        order[i].first =
+                SpreadBits(x) | (SpreadBits(y) << 1) | (SpreadBits(z) << 2);
+        order[i].second = i;
+    }
+    std::sort(order.begin(), order.end());
+    reporter.Update(num_points);
+
+    // Encode the chunks, a few at a time to report the progress.
+    const int num_channels =
+            3 + (normals != nullptr ? 3 : 0) + (colors != nullptr ? 3 : 0);
+    const int64_t num_chunks =
+            (num_points + kQPCPointsPerChunk - 1) / kQPCPointsPerChunk;
+    const int64_t chunks_per_wave = core::kernel::GetMaxThreads();
+    std::vector<std::vector<std::uint8_t>> chunks(num_chunks);
+    for (int64_t wave = 0; wave < num_chunks; wave += chunks_per_wave) {
+        const int64_t wave_end = std::min(wave + chunks_per_wave, num_chunks);
+#pragma omp parallel for schedule(dynamic)
+        for (int64_t c = wave; c < wave_end; ++c) {
+            const int64_t begin = c * kQPCPointsPerChunk;
+            const int64_t count =
+                    std::min(kQPCPointsPerChunk, num_points - begin);
+            std::vector<int64_t> values(count * num_channels);
+            for (int64_t i = 0; i < count; ++i) {
+                const int64_t idx = order[begin + i].second;
+                int channel = 0;
+                for (int a = 0; a < 3; ++a, ++channel) {
+                    values[channel * count + i] = quantized[3 * idx + a];
+                }
+                for (int a = 0; a < 3 && normals != nullptr; ++a, ++channel) {
+                    const double n =
+                            std::min(std::max(normals[3 * idx + a], -1.0), 1.0);
+                    values[channel * count + i] = std::lround(n * kNormalScale);
+                }
+                for (int a = 0; a < 3 && colors != nullptr; ++a, ++channel) {
+                    const double v =
+                            std::min(std::max(colors[3 * idx + a], 0.0), 1.0);
+                    values[channel * count + i] = std::lround(v * kColorScale);
+                }
+            }
+            BitWriter writer(chunks[c]);
+            std::vector<std::uint64_t> deltas;
+            for (int channel = 0; channel < num_channels; ++channel) {
+                EncodeChannel(values.data() + channel * count, count, writer,
+                              deltas);
+            }
+            writer.Flush();
+        }
+        reporter.Update(num_points +
+                        std::min(wave_end * kQPCPointsPerChunk, num_points));
+    }
+
+    std::vector<char> header;
+    header.insert(header.end(), kQPCMagic, kQPCMagic + sizeof(kQPCMagic));
+    AppendValue<std::uint8_t>(header, kQPCVersion);
+    AppendValue<std::uint8_t>(
+            header, std::uint8_t((normals != nullptr ? kQPCHasNormals : 0) |
+                                 (colors != nullptr ? kQPCHasColors : 0)));
+    AppendValue<std::uint64_t>(header, std::uint64_t(num_points));
+    for (int a = 0; a < 3; ++a) {
+        AppendValue<double>(header, num_points > 0 ? min_bound[a] : 0.0);
+    }
+    AppendValue<double>(header, precision);
+    AppendValue<std::uint32_t>(header, std::uint32_t(kQPCPointsPerChunk));
+    AppendValue<std::uint32_t>(header, std::uint32_t(num_chunks));
+    for (const std::vector<std::uint8_t> &chunk : chunks) {
+        AppendValue<std::uint64_t>(header, std::uint64_t(chunk.size()));
+    }
+
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write QPC failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    bool success = fwrite(header.data(), 1, header.size(), file) ==
+                   header.size();
+    for (const std::vector<std::uint8_t> &chunk : chunks) {
+        success = success &&
+                  fwrite(chunk.data(), 1, chunk.size(), file) == chunk.size();
+    }
+    success = fclose(file) == 0 && success;
+    if (!success) {
+        utility::LogWarning("Write QPC failed: unable to write file: {}",
+                            filename);
+        return false;
+    }
+    reporter.Finish();
+    return true;
+}
+
+bool QPCReader::Open(const std::string &filename) {
+    if (!file_.Open(filename)) {
+        return false;
+    }
+    const char *data = file_.GetData();
+    const size_t size = file_.GetSize();
+    if (size < kQPCHeaderSize ||
+        memcmp(data, kQPCMagic, sizeof(kQPCMagic)) != 0) {
+        utility::LogWarning("Read QPC failed: {} is not a QPC file.",
+                            filename);
+        return false;
+    }
+    data += sizeof(kQPCMagic);
+    const std::uint8_t version = ReadValue<std::uint8_t>(data);
+    if (version != kQPCVersion) {
+        utility::LogWarning("Read QPC failed: unsupported version {:d}.",
+                            int(version));
+        return false;
+    }
+    const std::uint8_t flags = ReadValue<std::uint8_t>(data);
+    has_normals_ = (flags & kQPCHasNormals) != 0;
+    has_colors_ = (flags & kQPCHasColors) != 0;
+    num_points_ = int64_t(ReadValue<std::uint64_t>(data));
+    for (int a = 0; a < 3; ++a) {
+        origin_[a] = ReadValue<double>(data);
+    }
+    precision_ = ReadValue<double>(data);
+    points_per_chunk_ = int64_t(ReadValue<std::uint32_t>(data));
+    const int64_t num_chunks = int64_t(ReadValue<std::uint32_t>(data));
+    // Every coded value takes at least one bit, which bounds the number of
+    // points a file of this size can hold before anything is allocated.
+    const int num_channels =
+            3 + (has_normals_ ? 3 : 0) + (has_colors_ ? 3 : 0);
+    if (num_points_ < 0 || points_per_chunk_ <= 0 ||
+        num_points_ > int64_t(size / num_channels) * 8 ||
+        num_chunks != (num_points_ + points_per_chunk_ - 1) /
+                              points_per_chunk_ ||
+        size < kQPCHeaderSize + num_chunks * sizeof(std::uint64_t)) {
+        utility::LogWarning("Read QPC failed: invalid header in {}.",
+                            filename);
+        return false;
+    }
+    chunk_offsets_.resize(num_chunks + 1);
+    chunk_offsets_[0] = kQPCHeaderSize + num_chunks * sizeof(std::uint64_t);
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        chunk_offsets_[c + 1] =
+                chunk_offsets_[c] + size_t(ReadValue<std::uint64_t>(data));
+        if (chunk_offsets_[c + 1] > size ||
+            chunk_offsets_[c + 1] < chunk_offsets_[c]) {
+            utility::LogWarning("Read QPC failed: {} is truncated.", filename);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool QPCReader::Decode(double *points,
+                       double *normals,
+                       double *colors,
+                       utility::CountingProgressReporter &reporter) const {
+    reporter.SetTotal(num_points_);
+    const int num_channels =
+            3 + (has_normals_ ? 3 : 0) + (has_colors_ ? 3 : 0);
+    const int64_t num_chunks = int64_t(chunk_offsets_.size()) - 1;
+    const int64_t chunks_per_wave = core::kernel::GetMaxThreads();
+    std::vector<char> chunk_valid(num_chunks, 1);
+    for (int64_t wave = 0; wave < num_chunks; wave += chunks_per_wave) {
+        const int64_t wave_end = std::min(wave + chunks_per_wave, num_chunks);
+#pragma omp parallel for schedule(dynamic)
+        for (int64_t c = wave; c < wave_end; ++c) {
+            const int64_t begin = c * points_per_chunk_;
+            const int64_t count =
+                    std::min(points_per_chunk_, num_points_ - begin);
+            const std::uint8_t *data = reinterpret_cast<const std::uint8_t *>(
+                    file_.GetData());
+            BitReader reader(data + chunk_offsets_[c],
+                             data + chunk_offsets_[c + 1]);
+            std::vector<int64_t> values(count * num_channels);
+            for (int channel = 0; channel < num_channels; ++channel) {
+                DecodeChannel(reader, count, values.data() + channel * count);
+            }
+            if (reader.IsOverrun()) {
+                chunk_valid[c] = 0;
+                continue;
+            }
+            for (int64_t i = 0; i < count; ++i) {
+                const int64_t idx = begin + i;
+                int channel = 0;
+                for (int a = 0; a < 3; ++a, ++channel) {
+                    points[3 * idx + a] =
+                            origin_[a] +
+                            double(values[channel * count + i]) * precision_;
+                }
+                for (int a = 0; a < 3 && has_normals_; ++a, ++channel) {
+                    if (normals != nullptr) {
+                        normals[3 * idx + a] =
+                                double(values[channel * count + i]) /
+                                kNormalScale;
+                    }
+                }
+                for (int a = 0; a < 3 && has_colors_; ++a, ++channel) {
+                    if (colors != nullptr) {
+                        colors[3 * idx + a] =
+                                double(values[channel * count + i]) /
+                                kColorScale;
+                    }
+                }
+            }
+        }
+        if (std::find(chunk_valid.begin() + wave,
+                      chunk_valid.begin() + wave_end,
+                      0) != chunk_valid.begin() + wave_end) {
+            utility::LogWarning("Read QPC failed: corrupt chunk data.");
+            return false;
+        }
+        reporter.Update(std::min(wave_end * points_per_chunk_, num_points_));
+    }
+    reporter.Finish();
+    return true;
+}
+
+FileGeometry ReadFileGeometryTypeQPC(const std::string &path) {
+    return CONTAINS_POINTS;
+}
+
+bool ReadPointCloudFromQPC(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const ReadPointCloudOption &params) {
+    QPCReader reader;
+    if (!reader.Open(filename)) {
+        utility::LogWarning("Read QPC failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    utility::CountingProgressReporter reporter(params.update_progress);
+    const int64_t num_points = reader.GetNumPoints();
+    pointcloud.Clear();
+    if (num_points == 0) {
+        reporter.Finish();
+        return true;
+    }
+    pointcloud.points_.resize(num_points);
+    if (reader.HasNormals()) {
+        pointcloud.normals_.resize(num_points);
+    }
+    if (reader.HasColors()) {
+        pointcloud.colors_.resize(num_points);
+    }
+    return reader.Decode(
+            pointcloud.points_[0].data(),
+            reader.HasNormals() ? pointcloud.normals_[0].data() : nullptr,
+            reader.HasColors() ? pointcloud.colors_[0].data() : nullptr,
+            reporter);
+}
+
+bool WritePointCloudToQPC(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          const WritePointCloudOption &params) {
+    if (!pointcloud.HasPoints()) {
+        utility::LogWarning("Write QPC failed: point cloud has 0 points.");
+        return false;
+    }
+    utility::CountingProgressReporter reporter(params.update_progress);
+    return WriteQPC(
+            filename, int64_t(pointcloud.points_.size()),
+            pointcloud.points_[0].data(),
+            pointcloud.HasNormals() ? pointcloud.normals_[0].data() : nullptr,
+            pointcloud.HasColors() ? pointcloud.colors_[0].data() : nullptr,
+            params.quantization_precision, reporter);
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,112 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/ProgressReporters.h"
+
+namespace open3d {
+namespace io {
+
+/// \file FileQPC.h
+///
+/// QPC (quantized point cloud) is Open3D's compact point cloud format.
+///
+/// Positions are quantized to a grid with a given precision, relative to the
+/// minimum of the bounding box. The points are sorted along a Morton curve
+/// and split into chunks of 16384 points. In each chunk, every coordinate
+/// and attribute channel is delta coded from the previous point, and the
+/// deltas are Rice coded in blocks of 32 values with a parameter per block.
+/// The chunks are independent, so they are encoded and decoded in parallel.
+///
+/// Normals are stored with 16 bits and colors with 8 bits per channel.
+/// Reading returns the points in Morton order, not in the written order.
+
+/// Default quantization: the largest extent of the bounding box is split
+/// into this many cells.
+constexpr double kQPCDefaultNumCells = double((1 << 21) - 1);
+
+/// \brief Writes arrays of \p num_points xyz triples to a QPC file.
+///
+/// \param normals nullptr if there are no normals.
+/// \param colors nullptr if there are no colors, otherwise values in [0, 1].
+/// \param precision Quantization step of the positions. If not positive, the
+/// largest extent of the bounding box divided by kQPCDefaultNumCells.
+/// \return False if the file cannot be written or if the points are not
+/// finite or do not fit into 2^32 cells per axis.
+bool WriteQPC(const std::string &filename,
+              int64_t num_points,
+              const double *points,
+              const double *normals,
+              const double *colors,
+              double precision,
+              utility::CountingProgressReporter &reporter);
+
+/// \class QPCReader
+///
+/// Decodes a memory-mapped QPC file.
+class QPCReader {
+public:
+    /// Maps the file and reads its header. Returns false if it is not a
+    /// valid QPC file.
+    bool Open(const std::string &filename);
+
+    int64_t GetNumPoints() const { return num_points_; }
+    bool HasNormals() const { return has_normals_; }
+    bool HasColors() const { return has_colors_; }
+    /// Quantization step of the positions.
+    double GetPrecision() const { return precision_; }
+
+    /// \brief Decodes all points into arrays of GetNumPoints() xyz triples.
+    ///
+    /// \param normals nullptr to skip the normals.
+    /// \param colors nullptr to skip the colors.
+    /// \param reporter Updated with the number of decoded points.
+    /// \return False if the data is corrupt.
+    bool Decode(double *points,
+                double *normals,
+                double *colors,
+                utility::CountingProgressReporter &reporter) const;
+
+private:
+    utility::filesystem::MappedFile file_;
+    int64_t num_points_ = 0;
+    bool has_normals_ = false;
+    bool has_colors_ = false;
+    double origin_[3] = {0.0, 0.0, 0.0};
+    double precision_ = 1.0;
+    int64_t points_per_chunk_ = 0;
+    /// Byte offsets of the chunks in the file, with the end as last entry.
+    std::vector<size_t> chunk_offsets_;
+};
+
+}  // namespace io
+}  // namespace open3d
@@ -28,6 +28,7 @@
 
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/io/file_format/AsciiRowReader.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/ProgressReporters.h"
@@ -43,28 +44,23 @@ bool ReadPointCloudFromXYZN(const std::string &filename,
                             geometry::PointCloud &pointcloud,
                             const ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        utility::CountingProgressReporter reporter(params.update_progress);
+        std::vector<double> values;
+        if (!ReadAsciiRows(filename, 6, values, reporter)) {
             utility::LogWarning("Read XYZN failed: unable to open file: {}",
                                 filename);
             return false;
         }
-        utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(file.GetFileSize());
 
         pointcloud.Clear();
-        int i = 0;
-        double x, y, z, nx, ny, nz;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf %lf %lf %lf", &x, &y, &z, &nx,
-                       &ny, &nz) == 6) {
-                pointcloud.points_.push_back(Eigen::Vector3d(x, y, z));
-                pointcloud.normals_.push_back(Eigen::Vector3d(nx, ny, nz));
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
+        const int num_points = int(values.size() / 6);
+        pointcloud.points_.resize(num_points);
+        pointcloud.normals_.resize(num_points);
+#pragma omp parallel for schedule(static)
+        for (int i = 0; i < num_points; ++i) {
+            const double *row = &values[6 * i];
+            pointcloud.points_[i] = Eigen::Vector3d(row[0], row[1], row[2]);
+            pointcloud.normals_[i] = Eigen::Vector3d(row[3], row[4], row[5]);
         }
         reporter.Finish();
 
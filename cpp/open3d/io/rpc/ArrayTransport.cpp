@@ -0,0 +1,306 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/rpc/ArrayTransport.h"
+
+#include <liblzf/lzf.h>
+
+#include <climits>
+#include <cstdlib>
+#include <limits>
+#include <zmq.hpp>
+
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace io {
+namespace rpc {
+
+namespace {
+
+const std::string kSharedMemoryPrefix = "open3d_rpc_";
+
+void FreeBuffer(void* data, void* hint) { free(data); }
+
+void FreeOwner(void* data, void* hint) {
+    delete static_cast<std::shared_ptr<void>*>(hint);
+}
+
+// Creates a frame referencing the data if owner is set and copying it
+// otherwise.
+std::shared_ptr<zmq::message_t> CreateFrame(const char* ptr,
+                                            size_t size,
+                                            std::shared_ptr<void> owner) {
+    if (!owner) {
+        return std::make_shared<zmq::message_t>(
+                static_cast<const void*>(ptr), size);
+    }
+    return std::make_shared<zmq::message_t>(
+            const_cast<char*>(ptr), size, FreeOwner,
+            new std::shared_ptr<void>(std::move(owner)));
+}
+
+// LZF encodes at most 264 bytes with a 3 byte back reference, so the data
+// cannot expand by more than this factor.
+const uint64_t kMaxLZFRatio = 88;
+
+// Computes the number of bytes of the array from its type and shape without
+// overflowing. The shape comes from the peer and cannot be trusted.
+bool CheckNumBytes(const messages::Array& arr,
+                   int64_t& num_bytes,
+                   std::string& errstr) {
+    const int64_t element_size =
+            arr.type.size() < 3 ? 0 : std::atoi(arr.type.c_str() + 2);
+    if (element_size <= 0) {
+        errstr += " invalid array type " + arr.type;
+        return false;
+    }
+    num_bytes = element_size;
+    for (int64_t d : arr.shape) {
+        if (d < 0 ||
+            (num_bytes > 0 &&
+             d > std::numeric_limits<int64_t>::max() / num_bytes)) {
+            errstr += " invalid array shape [";
+            for (auto dim : arr.shape) {
+                errstr += std::to_string(dim) + ", ";
+            }
+            errstr += "]";
+            return false;
+        }
+        num_bytes *= d;
+    }
+    return true;
+}
+
+}  // namespace
+
+void ForEachArray(messages::MeshData& data,
+                  const std::function<void(messages::Array&)>& func) {
+    func(data.vertices);
+    for (auto& item : data.vertex_attributes) func(item.second);
+    func(data.faces);
+    for (auto& item : data.face_attributes) func(item.second);
+    func(data.lines);
+    for (auto& item : data.line_attributes) func(item.second);
+    for (auto& item : data.textures) func(item.second);
+}
+
+void ForEachArray(messages::CameraData& data,
+                  const std::function<void(messages::Array&)>& func) {
+    for (auto& item : data.images) func(item.second);
+}
+
+ArrayPacker::ArrayPacker(const ConnectionBase& connection)
+    : transport_(connection.GetArrayTransport()),
+      compress_(connection.GetCompressArrays()),
+      rng_(std::random_device{}()) {}
+
+ArrayPacker::~ArrayPacker() {
+    for (const auto& path : shm_files_) {
+        utility::filesystem::RemoveFile(path);
+    }
+}
+
+void ArrayPacker::Pack(messages::Array& arr, std::shared_ptr<void> owner) {
+    const char* ptr = arr.data.ptr;
+    const size_t size = arr.data.size;
+    if (size == 0 || (transport_ == ArrayTransport::Inline && !compress_)) {
+        return;
+    }
+
+    if (transport_ == ArrayTransport::SharedMemory) {
+        const std::string name =
+                kSharedMemoryPrefix + fmt::format("{:016x}", rng_());
+        const std::string path = GetSharedMemoryDirectory() + "/" + name;
+        utility::filesystem::CFile file;
+        if (!file.Open(path, "wb") ||
+            fwrite(ptr, 1, size, file.GetFILE()) != size) {
+            utility::LogWarning(
+                    "ArrayPacker: cannot write {}, sending the data inline",
+                    path);
+            file.Close();
+            utility::filesystem::RemoveFile(path);
+            return;
+        }
+        shm_files_.push_back(path);
+        arr.shm_name = name;
+        arr.data = msgpack::type::raw_ref(nullptr, 0);
+        return;
+    }
+
+    std::vector<char> compressed;
+    if (compress_) {
+        // Keep the data uncompressed unless that saves at least a byte.
+        compressed.resize(size - 1);
+        const unsigned int compressed_size =
+                size > 1 ? lzf_compress(ptr, (unsigned int)size,
+                                        compressed.data(),
+                                        (unsigned int)(size - 1))
+                         : 0;
+        compressed.resize(compressed_size);
+    }
+    if (!compressed.empty()) {
+        arr.compression = "lzf";
+    } else if (transport_ == ArrayTransport::Inline) {
+        return;
+    }
+
+    if (transport_ == ArrayTransport::Inline) {
+        compressed_.push_back(std::move(compressed));
+        arr.data = msgpack::type::raw_ref(compressed_.back().data(),
+                                          uint32_t(compressed_.back().size()));
+        return;
+    }
+
+    if (compressed.empty()) {
+        frames_.push_back(CreateFrame(ptr, size, std::move(owner)));
+    } else {
+        auto buffer =
+                std::make_shared<std::vector<char>>(std::move(compressed));
+        frames_.push_back(
+                CreateFrame(buffer->data(), buffer->size(), buffer));
+    }
+    // Frame 0 holds the messages.
+    arr.frame = int64_t(frames_.size());
+    arr.data = msgpack::type::raw_ref(nullptr, 0);
+}
+
+std::shared_ptr<zmq::message_t> ArrayPacker::Send(msgpack::sbuffer& sbuf,
+                                                  ConnectionBase& connection) {
+    // The sbuffer memory is allocated with malloc and handed to ZMQ.
+    const size_t size = sbuf.size();
+    auto msg = std::make_shared<zmq::message_t>(sbuf.release(), size,
+                                                FreeBuffer);
+    if (frames_.empty()) {
+        return connection.Send(*msg);
+    }
+    std::vector<std::shared_ptr<zmq::message_t>> frames;
+    frames.reserve(frames_.size() + 1);
+    frames.push_back(msg);
+    frames.insert(frames.end(), frames_.begin(), frames_.end());
+    return connection.Send(frames);
+}
+
+ArrayUnpacker::ArrayUnpacker(
+        const std::vector<std::shared_ptr<zmq::message_t>>& frames)
+    : frames_(frames) {}
+
+ArrayUnpacker::~ArrayUnpacker() {}
+
+bool ArrayUnpacker::Unpack(messages::Array& arr, std::string& errstr) {
+    if (arr.frame < 0 && arr.shm_name.empty() && arr.compression.empty()) {
+        return true;
+    }
+
+    const char* payload = arr.data.ptr;
+    size_t payload_size = arr.data.size;
+    if (arr.frame >= 0) {
+        if (arr.frame == 0 || size_t(arr.frame) >= frames_.size()) {
+            errstr += fmt::format(" array frame {} does not exist", arr.frame);
+            return false;
+        }
+        const zmq::message_t& frame = *frames_[arr.frame];
+        payload = static_cast<const char*>(frame.data());
+        payload_size = frame.size();
+    } else if (!arr.shm_name.empty()) {
+        // Only map our own files in the shared memory directory and never a
+        // path chosen by the peer.
+        if (arr.shm_name.find_first_of("/\\") != std::string::npos ||
+            arr.shm_name.compare(0, kSharedMemoryPrefix.size(),
+                                 kSharedMemoryPrefix) != 0) {
+            errstr += " invalid shared memory name " + arr.shm_name;
+            return false;
+        }
+        mapped_.emplace_back(new utility::filesystem::MappedFile());
+        auto& file = *mapped_.back();
+        if (!file.Open(GetSharedMemoryDirectory() + "/" + arr.shm_name)) {
+            errstr += " cannot map shared memory " + arr.shm_name + ": " +
+                      file.GetError();
+            return false;
+        }
+        payload = file.GetData();
+        payload_size = file.GetSize();
+    }
+
+    int64_t num_bytes = 0;
+    if (!CheckNumBytes(arr, num_bytes, errstr)) {
+        return false;
+    }
+    if (arr.compression == "lzf") {
+        // Check the size claimed by the peer before allocating.
+        if (num_bytes <= 0 || uint64_t(num_bytes) > UINT_MAX ||
+            payload_size > UINT_MAX ||
+            uint64_t(num_bytes) > uint64_t(payload_size) * kMaxLZFRatio) {
+            errstr += fmt::format(
+                    " invalid size {} of {} bytes of lzf compressed data",
+                    num_bytes, payload_size);
+            return false;
+        }
+        decompressed_.emplace_back(num_bytes);
+        auto& buffer = decompressed_.back();
+        if (lzf_decompress(payload, (unsigned int)payload_size, buffer.data(),
+                           (unsigned int)num_bytes) != num_bytes) {
+            errstr += " lzf decompression failed";
+            return false;
+        }
+        payload = buffer.data();
+        payload_size = buffer.size();
+    } else if (!arr.compression.empty()) {
+        errstr += " unsupported compression " + arr.compression;
+        return false;
+    }
+    if (int64_t(payload_size) != num_bytes) {
+        errstr += fmt::format(" expected {} bytes of array data but got {}",
+                              num_bytes, payload_size);
+        return false;
+    }
+
+    arr.data = msgpack::type::raw_ref(payload, uint32_t(payload_size));
+    arr.frame = -1;
+    arr.shm_name.clear();
+    arr.compression.clear();
+    return true;
+}
+
+std::string GetSharedMemoryDirectory() {
+#ifdef __linux__
+    if (utility::filesystem::DirectoryExists("/dev/shm")) {
+        return "/dev/shm";
+    }
+#endif
+    for (const char* var : {"TMPDIR", "TEMP", "TMP"}) {
+        const char* dir = std::getenv(var);
+        if (dir && *dir) {
+            return dir;
+        }
+    }
+    return "/tmp";
+}
+
+}  // namespace rpc
+}  // namespace io
+}  // namespace open3d
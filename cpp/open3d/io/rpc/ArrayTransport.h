@@ -0,0 +1,117 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "open3d/io/rpc/ConnectionBase.h"
+#include "open3d/io/rpc/Messages.h"
+
+namespace zmq {
+class message_t;
+}  // namespace zmq
+
+namespace open3d {
+
+namespace utility {
+namespace filesystem {
+class MappedFile;
+}  // namespace filesystem
+}  // namespace utility
+
+namespace io {
+namespace rpc {
+
+/// Calls \p func for each array of the mesh data.
+void ForEachArray(messages::MeshData& data,
+                  const std::function<void(messages::Array&)>& func);
+
+/// Calls \p func for each array of the camera data.
+void ForEachArray(messages::CameraData& data,
+                  const std::function<void(messages::Array&)>& func);
+
+/// Moves the data of arrays out of band according to the ArrayTransport of a
+/// connection and sends the message. Shared memory files are removed when
+/// the packer is destroyed, which must be after the reply has arrived.
+class ArrayPacker {
+public:
+    explicit ArrayPacker(const ConnectionBase& connection);
+    ~ArrayPacker();
+
+    ArrayPacker(const ArrayPacker&) = delete;
+    ArrayPacker& operator=(const ArrayPacker&) = delete;
+
+    /// Packs the data of \p arr. If \p owner is set, it keeps the data alive
+    /// until ZMQ has sent it and frames reference the data without a copy.
+    /// Otherwise the data must stay valid until Send() returns.
+    void Pack(messages::Array& arr, std::shared_ptr<void> owner = nullptr);
+
+    /// Sends the serialized messages in \p sbuf, which is released to ZMQ,
+    /// together with the packed array data.
+    std::shared_ptr<zmq::message_t> Send(msgpack::sbuffer& sbuf,
+                                         ConnectionBase& connection);
+
+private:
+    ArrayTransport transport_;
+    bool compress_;
+    std::vector<std::shared_ptr<zmq::message_t>> frames_;
+    std::vector<std::vector<char>> compressed_;
+    std::vector<std::string> shm_files_;
+    std::mt19937_64 rng_;
+};
+
+/// Restores the inline data of arrays that were packed by ArrayPacker.
+/// Decompressed and mapped data stay valid while the unpacker exists.
+class ArrayUnpacker {
+public:
+    explicit ArrayUnpacker(
+            const std::vector<std::shared_ptr<zmq::message_t>>& frames);
+    ~ArrayUnpacker();
+
+    ArrayUnpacker(const ArrayUnpacker&) = delete;
+    ArrayUnpacker& operator=(const ArrayUnpacker&) = delete;
+
+    /// Points the data of \p arr to the received bytes. Returns false on
+    /// failure and appends an error description to errstr.
+    bool Unpack(messages::Array& arr, std::string& errstr);
+
+private:
+    const std::vector<std::shared_ptr<zmq::message_t>>& frames_;
+    std::vector<std::vector<char>> decompressed_;
+    std::vector<std::unique_ptr<utility::filesystem::MappedFile>> mapped_;
+};
+
+/// Returns the directory for shared memory files.
+std::string GetSharedMemoryDirectory();
+
+}  // namespace rpc
+}  // namespace io
+}  // namespace open3d
@@ -56,6 +56,16 @@ std::shared_ptr<zmq::message_t> BufferConnection::Send(const void* data,
     return Send(send_msg);
 }
 
+std::shared_ptr<zmq::message_t> BufferConnection::Send(
+        std::vector<std::shared_ptr<zmq::message_t>>& frames) {
+    if (frames.size() != 1) {
+        LogError(
+                "BufferConnection::Send: multipart messages are not "
+                "supported, use ArrayTransport::Inline");
+    }
+    return Send(*frames[0]);
+}
+
 }  // namespace rpc
 }  // namespace io
 }  // namespace open3d
@@ -46,6 +46,10 @@ public:
     /// Function for sending raw data. Meant for testing purposes
     std::shared_ptr<zmq::message_t> Send(const void* data, size_t size);
 
+    /// Function for sending a multipart message.
+    std::shared_ptr<zmq::message_t> Send(
+            std::vector<std::shared_ptr<zmq::message_t>>& frames);
+
     std::stringstream& buffer() { return buffer_; }
     const std::stringstream& buffer() const { return buffer_; }
 
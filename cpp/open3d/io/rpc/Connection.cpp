@@ -95,6 +95,26 @@ std::shared_ptr<zmq::message_t> Connection::Send(const void* data,
     return Send(send_msg);
 }
 
+std::shared_ptr<zmq::message_t> Connection::Send(
+        std::vector<std::shared_ptr<zmq::message_t>>& frames) {
+    if (frames.empty()) {
+        return std::make_shared<zmq::message_t>();
+    }
+    for (size_t i = 0; i + 1 < frames.size(); ++i) {
+        if (!socket_->send(*frames[i], zmq::send_flags::sndmore)) {
+            // Do not send the remaining frames, the peer would receive a
+            // truncated message.
+            zmq::error_t err;
+            if (err.num()) {
+                LogInfo("Connection::send() send failed with: {}",
+                        err.what());
+            }
+            return std::make_shared<zmq::message_t>();
+        }
+    }
+    return Send(*frames.back());
+}
+
 std::string Connection::DefaultAddress() { return defaults.address; }
 
 }  // namespace rpc
@@ -60,6 +60,10 @@ public:
     /// Function for sending raw data. Meant for testing purposes
     std::shared_ptr<zmq::message_t> Send(const void* data, size_t size);
 
+    /// Function for sending a multipart message.
+    std::shared_ptr<zmq::message_t> Send(
+            std::vector<std::shared_ptr<zmq::message_t>>& frames);
+
     static std::string DefaultAddress();
 
 private:
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 namespace zmq {
 class message_t;
@@ -37,6 +38,19 @@ namespace open3d {
 namespace io {
 namespace rpc {
 
+/// Defines how the data of arrays in messages is transferred.
+enum class ArrayTransport {
+    /// The data is copied into the message. Without compression the messages
+    /// have the same format as in earlier versions.
+    Inline,
+    /// The data of each array is sent without copying as a separate frame of
+    /// a multipart message.
+    Frames,
+    /// The data of each array is written to a shared memory file, which the
+    /// receiver maps. Only for receivers on the same host.
+    SharedMemory,
+};
+
 /// Base class for all connections
 class ConnectionBase {
 public:
@@ -47,6 +61,24 @@ public:
     virtual std::shared_ptr<zmq::message_t> Send(zmq::message_t& send_msg) = 0;
     virtual std::shared_ptr<zmq::message_t> Send(const void* data,
                                                  size_t size) = 0;
+    /// Function for sending a multipart message. The first frame holds the
+    /// messages and the others the array data of ArrayTransport::Frames.
+    virtual std::shared_ptr<zmq::message_t> Send(
+            std::vector<std::shared_ptr<zmq::message_t>>& frames) = 0;
+
+    /// Sets how the arrays of messages sent with this connection are
+    /// transferred. With \p compress array data is LZF compressed when that
+    /// makes it smaller. Shared memory data is never compressed.
+    void SetArrayTransport(ArrayTransport transport, bool compress = false) {
+        array_transport_ = transport;
+        compress_arrays_ = compress;
+    }
+    ArrayTransport GetArrayTransport() const { return array_transport_; }
+    bool GetCompressArrays() const { return compress_arrays_; }
+
+private:
+    ArrayTransport array_transport_ = ArrayTransport::Inline;
+    bool compress_arrays_ = false;
 };
 }  // namespace rpc
 }  // namespace io
@@ -27,6 +27,7 @@
 #pragma once
 #include <boost/predef/other/endian.h>
 
+#include <cstdlib>
 #include <map>
 #include <msgpack.hpp>
 #include <string>
@@ -98,6 +99,10 @@ inline std::string TypeStr<uint64_t>() {
 /// because they use bin-type for the map keys and we must use string.
 /// This structure does not have ownership of the data.
 ///
+/// By default the data is stored inline. Senders may instead move it out of
+/// band (see ArrayTransport) and set frame or shm_name, and may compress it.
+/// ReceiverBase restores inline data before calling ProcessMessage.
+///
 /// The following code can be used in python to create a compatible dict
 ///
 ///   def numpy_to_Array(arr):
@@ -132,6 +137,14 @@ struct Array {
     std::string type;
     std::vector<int64_t> shape;
     msgpack::type::raw_ref data;
+    /// Index of the multipart message frame holding the data, or -1 if the
+    /// data is not in a separate frame. Frame 0 holds the messages.
+    int64_t frame = -1;
+    /// Name of the shared memory file holding the data, empty if the data is
+    /// not in shared memory.
+    std::string shm_name;
+    /// Compression of the data, either empty or "lzf".
+    std::string compression;
 
     template <class T>
     const T* Ptr() const {
@@ -238,8 +251,46 @@ struct Array {
         return CheckType(expected_types, _);
     }
 
-    // macro for creating the serialization/deserialization code
-    MSGPACK_DEFINE_MAP(type, shape, data);
+    /// Returns the size of the uncompressed data in bytes.
+    int64_t NumBytes() const {
+        if (type.size() < 3) return 0;
+        int64_t n = std::atoi(type.c_str() + 2);
+        for (int64_t d : shape) n *= d;
+        return n;
+    }
+
+    // Serialization code as generated by MSGPACK_DEFINE_MAP. Arrays with
+    // uncompressed inline data are written with the keys type, shape and data
+    // only, which is the format of older versions. Missing keys keep their
+    // defaults, so messages of older senders still unpack.
+    template <typename Packer>
+    void msgpack_pack(Packer& msgpack_pk) const {
+        if (frame < 0 && shm_name.empty() && compression.empty()) {
+            msgpack::type::make_define_map("type", type, "shape", shape,
+                                           "data", data)
+                    .msgpack_pack(msgpack_pk);
+        } else {
+            msgpack::type::make_define_map("type", type, "shape", shape,
+                                           "data", data, "frame", frame,
+                                           "shm_name", shm_name,
+                                           "compression", compression)
+                    .msgpack_pack(msgpack_pk);
+        }
+    }
+    void msgpack_unpack(msgpack::object const& msgpack_o) {
+        msgpack::type::make_define_map("type", type, "shape", shape, "data",
+                                       data, "frame", frame, "shm_name",
+                                       shm_name, "compression", compression)
+                .msgpack_unpack(msgpack_o);
+    }
+    template <typename MSGPACK_OBJECT>
+    void msgpack_object(MSGPACK_OBJECT* msgpack_o,
+                        msgpack::zone& msgpack_z) const {
+        msgpack::type::make_define_map("type", type, "shape", shape, "data",
+                                       data, "frame", frame, "shm_name",
+                                       shm_name, "compression", compression)
+                .msgpack_object(msgpack_o, msgpack_z);
+    }
 };
 
 /// struct for storing MeshData, e.g., PointClouds, TriangleMesh, ..
@@ -28,6 +28,7 @@
 
 #include <zmq.hpp>
 
+#include "open3d/io/rpc/ArrayTransport.h"
 #include "open3d/io/rpc/Messages.h"
 #include "open3d/io/rpc/ZMQContext.h"
 
@@ -45,6 +46,38 @@ std::shared_ptr<zmq::message_t> CreateStatusMessage(
 
     return msg;
 }
+
+// Restores the inline data of all arrays of a message.
+template <class MSGTYPE>
+bool UnpackArrays(MSGTYPE& msg,
+                  open3d::io::rpc::ArrayUnpacker& unpacker,
+                  std::string& errstr) {
+    return true;
+}
+
+template <class MSGTYPE>
+bool UnpackDataArrays(MSGTYPE& msg,
+                      open3d::io::rpc::ArrayUnpacker& unpacker,
+                      std::string& errstr) {
+    bool ok = true;
+    open3d::io::rpc::ForEachArray(
+            msg.data, [&](open3d::io::rpc::messages::Array& arr) {
+                ok = ok && unpacker.Unpack(arr, errstr);
+            });
+    return ok;
+}
+
+bool UnpackArrays(open3d::io::rpc::messages::SetMeshData& msg,
+                  open3d::io::rpc::ArrayUnpacker& unpacker,
+                  std::string& errstr) {
+    return UnpackDataArrays(msg, unpacker, errstr);
+}
+
+bool UnpackArrays(open3d::io::rpc::messages::SetCameraData& msg,
+                  open3d::io::rpc::ArrayUnpacker& unpacker,
+                  std::string& errstr) {
+    return UnpackDataArrays(msg, unpacker, errstr);
+}
 }  // namespace
 
 namespace open3d {
@@ -148,16 +181,29 @@ void ReceiverBase::Mainloop() {
             if (!keep_running_) break;
         }
         try {
-            zmq::message_t message;
-            if (!socket_->recv(message)) {
+            // The first frame holds the messages, further frames hold array
+            // data sent with ArrayTransport::Frames.
+            std::vector<std::shared_ptr<zmq::message_t>> frames;
+            frames.push_back(std::make_shared<zmq::message_t>());
+            if (!socket_->recv(*frames[0])) {
                 continue;
             }
+            while (frames.back()->more()) {
+                frames.push_back(std::make_shared<zmq::message_t>());
+                if (!socket_->recv(*frames.back())) {
+                    break;
+                }
+            }
+            const zmq::message_t& message = *frames[0];
 
             const char* buffer = (char*)message.data();
             size_t buffer_size = message.size();
 
             std::vector<std::shared_ptr<zmq::message_t>> replies;
 
+            // Keeps decompressed and mapped array data alive while the
+            // messages are processed.
+            std::unique_ptr<ArrayUnpacker> unpacker(new ArrayUnpacker(frames));
             size_t offset = 0;
             while (offset < buffer_size) {
                 messages::Request req;
@@ -177,6 +223,13 @@ void ReceiverBase::Mainloop() {
         auto obj = oh.get();                                            \
         MSGTYPE msg;                                                    \
         msg = obj.as<MSGTYPE>();                                        \
+        std::string errstr;                                             \
+        if (!UnpackArrays(msg, *unpacker, errstr)) {                    \
+            auto status = messages::Status::ErrorUnpackingFailed();     \
+            status.str += " with " + errstr;                            \
+            replies.push_back(CreateStatusMessage(status));             \
+            break;                                                      \
+        }                                                               \
         auto reply = ProcessMessage(req, msg, MsgpackObject(obj));      \
         if (reply) {                                                    \
             replies.push_back(reply);                                   \
@@ -207,6 +260,9 @@ void ReceiverBase::Mainloop() {
                     break;
                 }
             }
+            // Unmap shared memory before the reply allows the sender to
+            // remove it.
+            unpacker.reset();
             if (replies.size() == 1) {
                 socket_->send(*replies[0], zmq::send_flags::none);
             } else {
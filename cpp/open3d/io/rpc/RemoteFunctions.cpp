@@ -30,6 +30,7 @@
 #include <zmq.hpp>
 
 #include "open3d/core/Dispatch.h"
+#include "open3d/io/rpc/ArrayTransport.h"
 #include "open3d/io/rpc/Connection.h"
 #include "open3d/io/rpc/MessageUtils.h"
 #include "open3d/io/rpc/Messages.h"
@@ -41,6 +42,24 @@ namespace open3d {
 namespace io {
 namespace rpc {
 
+namespace {
+
+// Serializes the message and sends it together with the array data packed
+// by packer.
+template <class Msg>
+bool SendMessage(const Msg& msg,
+                 ArrayPacker& packer,
+                 ConnectionBase& connection) {
+    msgpack::sbuffer sbuf;
+    messages::Request request{msg.MsgId()};
+    msgpack::pack(sbuf, request);
+    msgpack::pack(sbuf, msg);
+    auto reply = packer.Send(sbuf, connection);
+    return ReplyIsOKStatus(*reply);
+}
+
+}  // namespace
+
 bool SetPointCloud(const geometry::PointCloud& pcd,
                    const std::string& path,
                    int time,
@@ -69,17 +88,13 @@ bool SetPointCloud(const geometry::PointCloud& pcd,
                 (double*)pcd.colors_.data(), {int64_t(pcd.colors_.size()), 3});
     }
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
     if (!connection) {
         connection = std::shared_ptr<Connection>(new Connection());
     }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    ArrayPacker packer(*connection);
+    ForEachArray(msg.data,
+                 [&packer](messages::Array& arr) { packer.Pack(arr); });
+    return SendMessage(msg, packer, *connection);
 }
 
 bool SetTriangleMesh(const geometry::TriangleMesh& mesh,
@@ -147,17 +162,13 @@ bool SetTriangleMesh(const geometry::TriangleMesh& mesh,
         }
     }
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
     if (!connection) {
         connection = std::shared_ptr<Connection>(new Connection());
     }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    ArrayPacker packer(*connection);
+    ForEachArray(msg.data,
+                 [&packer](messages::Array& arr) { packer.Pack(arr); });
+    return SendMessage(msg, packer, *connection);
 }
 
 bool SetMeshData(const core::Tensor& vertices,
@@ -304,17 +315,24 @@ bool SetMeshData(const core::Tensor& vertices,
         }
     }
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
     if (!connection) {
         connection = std::shared_ptr<Connection>(new Connection());
     }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    // Frames reference the tensor memory without a copy and keep the
+    // tensors alive until ZMQ has sent them.
+    std::map<const char*, std::shared_ptr<void>> owners;
+    owners[msg.data.vertices.data.ptr] =
+            std::make_shared<core::Tensor>(vertices_ok);
+    for (const auto& tensor : tensor_cache) {
+        owners[(const char*)tensor.GetDataPtr()] =
+                std::make_shared<core::Tensor>(tensor);
+    }
+    ArrayPacker packer(*connection);
+    ForEachArray(msg.data, [&packer, &owners](messages::Array& arr) {
+        auto owner = owners.find(arr.data.ptr);
+        packer.Pack(arr, owner != owners.end() ? owner->second : nullptr);
+    });
+    return SendMessage(msg, packer, *connection);
 }
 
 bool SetLegacyCamera(const camera::PinholeCameraParameters& camera,
@@ -361,34 +379,24 @@ bool SetLegacyCamera(const camera::PinholeCameraParameters& camera,
         }
     }
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
     if (!connection) {
         connection = std::shared_ptr<Connection>(new Connection());
     }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    ArrayPacker packer(*connection);
+    ForEachArray(msg.data,
+                 [&packer](messages::Array& arr) { packer.Pack(arr); });
+    return SendMessage(msg, packer, *connection);
 }
 
 bool SetTime(int time, std::shared_ptr<ConnectionBase> connection) {
     messages::SetTime msg;
     msg.time = time;
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
     if (!connection) {
         connection = std::shared_ptr<Connection>(new Connection());
     }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    ArrayPacker packer(*connection);
+    return SendMessage(msg, packer, *connection);
 }
 
 bool SetActiveCamera(const std::string& path,
@@ -396,17 +404,11 @@ bool SetActiveCamera(const std::string& path,
     messages::SetActiveCamera msg;
     msg.path = path;
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
     if (!connection) {
         connection = std::shared_ptr<Connection>(new Connection());
     }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    ArrayPacker packer(*connection);
+    return SendMessage(msg, packer, *connection);
 }
 
 }  // namespace rpc
@@ -26,11 +26,15 @@
 
 #include "open3d/pipelines/color_map/ColorMapOptimization.h"
 
+#include <algorithm>
+#include <functional>
+
 #include "open3d/camera/PinholeCameraTrajectory.h"
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/io/ImageIO.h"
 #include "open3d/io/ImageWarpingFieldIO.h"
 #include "open3d/io/PinholeCameraTrajectoryIO.h"
 #include "open3d/pipelines/color_map/ColorMapOptimizationJacobian.h"
@@ -43,6 +47,123 @@ namespace open3d {
 namespace pipelines {
 namespace color_map {
 
+/// Runs one non-rigid Gauss-Newton step for camera c, updating its extrinsic
+/// and warping field. Returns the data and regularization residuals.
+static std::pair<double, double> UpdateCameraNonRigid(
+        const geometry::TriangleMesh& mesh,
+        const std::shared_ptr<geometry::Image>& image_gray,
+        const std::shared_ptr<geometry::Image>& image_dx,
+        const std::shared_ptr<geometry::Image>& image_dy,
+        ImageWarpingField& warping_field,
+        const ImageWarpingField& warping_field_init,
+        camera::PinholeCameraTrajectory& camera,
+        int c,
+        const std::vector<int>& visibility_image_to_vertex,
+        const std::vector<double>& proxy_intensity,
+        const ColorMapOptimizationOption& option) {
+    auto n_vertex = mesh.vertices_.size();
+    int nonrigidval = warping_field.anchor_w_ * warping_field.anchor_h_ * 2;
+    double rr_reg = 0.0;
+
+    Eigen::Matrix4d pose;
+    pose = camera.parameters_[c].extrinsic_;
+
+    auto intrinsic = camera.parameters_[c].intrinsic_.intrinsic_matrix_;
+    auto extrinsic = camera.parameters_[c].extrinsic_;
+    ColorMapOptimizationJacobian jac;
+    Eigen::Matrix4d intr = Eigen::Matrix4d::Zero();
+    intr.block<3, 3>(0, 0) = intrinsic;
+    intr(3, 3) = 1.0;
+
+    auto f_lambda = [&](int i, Eigen::Vector14d& J_r, double& r,
+                        Eigen::Vector14i& pattern) {
+        jac.ComputeJacobianAndResidualNonRigid(
+                i, J_r, r, pattern, mesh, proxy_intensity, image_gray,
+                image_dx, image_dy, warping_field, warping_field_init, intr,
+                extrinsic, visibility_image_to_vertex,
+                option.image_boundary_margin_);
+    };
+    Eigen::MatrixXd JTJ;
+    Eigen::VectorXd JTr;
+    double r2;
+    std::tie(JTJ, JTr, r2) =
+            ComputeJTJandJTrNonRigid<Eigen::Vector14d, Eigen::Vector14i,
+                                     Eigen::MatrixXd, Eigen::VectorXd>(
+                    f_lambda, int(visibility_image_to_vertex.size()),
+                    nonrigidval, false);
+
+    double weight = option.non_rigid_anchor_point_weight_ *
+                    visibility_image_to_vertex.size() / n_vertex;
+    for (int j = 0; j < nonrigidval; j++) {
+        double r = weight *
+                   (warping_field.flow_(j) - warping_field_init.flow_(j));
+        JTJ(6 + j, 6 + j) += weight * weight;
+        JTr(6 + j) += weight * r;
+        rr_reg += r * r;
+    }
+
+    bool success;
+    Eigen::VectorXd result;
+    std::tie(success, result) = utility::SolveLinearSystemPSD(
+            JTJ, -JTr, /*prefer_sparse=*/false,
+            /*check_symmetric=*/false,
+            /*check_det=*/false, /*check_psd=*/false);
+    Eigen::Vector6d result_pose;
+    result_pose << result.block(0, 0, 6, 1);
+    auto delta = utility::TransformVector6dToMatrix4d(result_pose);
+    pose = delta * pose;
+
+    for (int j = 0; j < nonrigidval; j++) {
+        warping_field.flow_(j) += result(6 + j);
+    }
+    camera.parameters_[c].extrinsic_ = pose;
+    return std::make_pair(r2, rr_reg);
+}
+
+/// Runs one rigid Gauss-Newton step for camera c, updating its extrinsic.
+/// Returns the residual.
+static double UpdateCameraRigid(
+        const geometry::TriangleMesh& mesh,
+        const std::shared_ptr<geometry::Image>& image_gray,
+        const std::shared_ptr<geometry::Image>& image_dx,
+        const std::shared_ptr<geometry::Image>& image_dy,
+        camera::PinholeCameraTrajectory& camera,
+        int c,
+        const std::vector<int>& visibility_image_to_vertex,
+        const std::vector<double>& proxy_intensity,
+        const ColorMapOptimizationOption& option) {
+    Eigen::Matrix4d pose;
+    pose = camera.parameters_[c].extrinsic_;
+
+    auto intrinsic = camera.parameters_[c].intrinsic_.intrinsic_matrix_;
+    auto extrinsic = camera.parameters_[c].extrinsic_;
+    ColorMapOptimizationJacobian jac;
+    Eigen::Matrix4d intr = Eigen::Matrix4d::Zero();
+    intr.block<3, 3>(0, 0) = intrinsic;
+    intr(3, 3) = 1.0;
+
+    auto f_lambda = [&](int i, Eigen::Vector6d& J_r, double& r, double& w) {
+        jac.ComputeJacobianAndResidualRigid(
+                i, J_r, r, w, mesh, proxy_intensity, image_gray, image_dx,
+                image_dy, intr, extrinsic, visibility_image_to_vertex,
+                option.image_boundary_margin_);
+    };
+    Eigen::Matrix6d JTJ;
+    Eigen::Vector6d JTr;
+    double r2;
+    std::tie(JTJ, JTr, r2) =
+            utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
+                    f_lambda, int(visibility_image_to_vertex.size()), false);
+
+    bool is_success;
+    Eigen::Matrix4d delta;
+    std::tie(is_success, delta) =
+            utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JTJ, JTr);
+    pose = delta * pose;
+    camera.parameters_[c].extrinsic_ = pose;
+    return r2;
+}
+
 static void OptimizeImageCoorNonrigid(
         const geometry::TriangleMesh& mesh,
         const std::vector<std::shared_ptr<geometry::Image>>& images_gray,
@@ -55,7 +176,6 @@ static void OptimizeImageCoorNonrigid(
         const std::vector<std::vector<int>>& visibility_image_to_vertex,
         std::vector<double>& proxy_intensity,
         const ColorMapOptimizationOption& option) {
-    auto n_vertex = mesh.vertices_.size();
     int n_camera = int(camera.parameters_.size());
     SetProxyIntensityForVertex(mesh, images_gray, warping_fields, camera,
                                visibility_vertex_to_image, proxy_intensity,
@@ -64,71 +184,14 @@ static void OptimizeImageCoorNonrigid(
         utility::LogDebug("[Iteration {:04d}] ", itr + 1);
         double residual = 0.0;
         double residual_reg = 0.0;
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) reduction(+ : residual, residual_reg)
         for (int c = 0; c < n_camera; c++) {
-            int nonrigidval = warping_fields[c].anchor_w_ *
-                              warping_fields[c].anchor_h_ * 2;
-            double rr_reg = 0.0;
-
-            Eigen::Matrix4d pose;
-            pose = camera.parameters_[c].extrinsic_;
-
-            auto intrinsic = camera.parameters_[c].intrinsic_.intrinsic_matrix_;
-            auto extrinsic = camera.parameters_[c].extrinsic_;
-            ColorMapOptimizationJacobian jac;
-            Eigen::Matrix4d intr = Eigen::Matrix4d::Zero();
-            intr.block<3, 3>(0, 0) = intrinsic;
-            intr(3, 3) = 1.0;
-
-            auto f_lambda = [&](int i, Eigen::Vector14d& J_r, double& r,
-                                Eigen::Vector14i& pattern) {
-                jac.ComputeJacobianAndResidualNonRigid(
-                        i, J_r, r, pattern, mesh, proxy_intensity,
-                        images_gray[c], images_dx[c], images_dy[c],
-                        warping_fields[c], warping_fields_init[c], intr,
-                        extrinsic, visibility_image_to_vertex[c],
-                        option.image_boundary_margin_);
-            };
-            Eigen::MatrixXd JTJ;
-            Eigen::VectorXd JTr;
-            double r2;
-            std::tie(JTJ, JTr, r2) =
-                    ComputeJTJandJTrNonRigid<Eigen::Vector14d, Eigen::Vector14i,
-                                             Eigen::MatrixXd, Eigen::VectorXd>(
-                            f_lambda, int(visibility_image_to_vertex[c].size()),
-                            nonrigidval, false);
-
-            double weight = option.non_rigid_anchor_point_weight_ *
-                            visibility_image_to_vertex[c].size() / n_vertex;
-            for (int j = 0; j < nonrigidval; j++) {
-                double r = weight * (warping_fields[c].flow_(j) -
-                                     warping_fields_init[c].flow_(j));
-                JTJ(6 + j, 6 + j) += weight * weight;
-                JTr(6 + j) += weight * r;
-                rr_reg += r * r;
-            }
-
-            bool success;
-            Eigen::VectorXd result;
-            std::tie(success, result) = utility::SolveLinearSystemPSD(
-                    JTJ, -JTr, /*prefer_sparse=*/false,
-                    /*check_symmetric=*/false,
-                    /*check_det=*/false, /*check_psd=*/false);
-            Eigen::Vector6d result_pose;
-            result_pose << result.block(0, 0, 6, 1);
-            auto delta = utility::TransformVector6dToMatrix4d(result_pose);
-            pose = delta * pose;
-
-            for (int j = 0; j < nonrigidval; j++) {
-                warping_fields[c].flow_(j) += result(6 + j);
-            }
-            camera.parameters_[c].extrinsic_ = pose;
-
-#pragma omp critical
-            {
-                residual += r2;
-                residual_reg += rr_reg;
-            }
+            std::pair<double, double> r = UpdateCameraNonRigid(
+                    mesh, images_gray[c], images_dx[c], images_dy[c],
+                    warping_fields[c], warping_fields_init[c], camera, c,
+                    visibility_image_to_vertex[c], proxy_intensity, option);
+            residual += r.first;
+            residual_reg += r.second;
         }
         utility::LogDebug("Residual error : {:.6f}, reg : {:.6f}", residual,
                           residual_reg);
@@ -148,7 +211,6 @@ static void OptimizeImageCoorRigid(
         const std::vector<std::vector<int>>& visibility_image_to_vertex,
         std::vector<double>& proxy_intensity,
         const ColorMapOptimizationOption& option) {
-    int total_num_ = 0;
     int n_camera = int(camera.parameters_.size());
     SetProxyIntensityForVertex(mesh, images_gray, camera,
                                visibility_vertex_to_image, proxy_intensity,
@@ -156,47 +218,14 @@ static void OptimizeImageCoorRigid(
     for (int itr = 0; itr < option.maximum_iteration_; itr++) {
         utility::LogDebug("[Iteration {:04d}] ", itr + 1);
         double residual = 0.0;
-        total_num_ = 0;
-#pragma omp parallel for schedule(static)
+        int total_num_ = 0;
+#pragma omp parallel for schedule(static) reduction(+ : residual, total_num_)
         for (int c = 0; c < n_camera; c++) {
-            Eigen::Matrix4d pose;
-            pose = camera.parameters_[c].extrinsic_;
-
-            auto intrinsic = camera.parameters_[c].intrinsic_.intrinsic_matrix_;
-            auto extrinsic = camera.parameters_[c].extrinsic_;
-            ColorMapOptimizationJacobian jac;
-            Eigen::Matrix4d intr = Eigen::Matrix4d::Zero();
-            intr.block<3, 3>(0, 0) = intrinsic;
-            intr(3, 3) = 1.0;
-
-            auto f_lambda = [&](int i, Eigen::Vector6d& J_r, double& r,
-                                double& w) {
-                jac.ComputeJacobianAndResidualRigid(
-                        i, J_r, r, w, mesh, proxy_intensity, images_gray[c],
-                        images_dx[c], images_dy[c], intr, extrinsic,
-                        visibility_image_to_vertex[c],
-                        option.image_boundary_margin_);
-            };
-            Eigen::Matrix6d JTJ;
-            Eigen::Vector6d JTr;
-            double r2;
-            std::tie(JTJ, JTr, r2) =
-                    utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
-                            f_lambda, int(visibility_image_to_vertex[c].size()),
-                            false);
-
-            bool is_success;
-            Eigen::Matrix4d delta;
-            std::tie(is_success, delta) =
-                    utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JTJ,
-                                                                         JTr);
-            pose = delta * pose;
-            camera.parameters_[c].extrinsic_ = pose;
-#pragma omp critical
-            {
-                residual += r2;
-                total_num_ += int(visibility_image_to_vertex[c].size());
-            }
+            residual += UpdateCameraRigid(
+                    mesh, images_gray[c], images_dx[c], images_dy[c],
+                    camera, c, visibility_image_to_vertex[c], proxy_intensity,
+                    option);
+            total_num_ += int(visibility_image_to_vertex[c].size());
         }
         utility::LogDebug("Residual error : {:.6f} (avg : {:.6f})", residual,
                           residual / total_num_);
@@ -206,6 +235,21 @@ static void OptimizeImageCoorRigid(
     }
 }
 
+/// Creates the filtered gray image and its gradients for one RGB-D frame.
+static std::tuple<std::shared_ptr<geometry::Image>,
+                  std::shared_ptr<geometry::Image>,
+                  std::shared_ptr<geometry::Image>>
+CreateGradientImages(const geometry::RGBDImage& image_rgbd) {
+    auto gray_image = image_rgbd.color_.CreateFloatImage();
+    auto gray_image_filtered =
+            gray_image->Filter(geometry::Image::FilterType::Gaussian3);
+    return std::make_tuple(gray_image_filtered,
+                           gray_image_filtered->Filter(
+                                   geometry::Image::FilterType::Sobel3Dx),
+                           gray_image_filtered->Filter(
+                                   geometry::Image::FilterType::Sobel3Dy));
+}
+
 static std::tuple<std::vector<std::shared_ptr<geometry::Image>>,
                   std::vector<std::shared_ptr<geometry::Image>>,
                   std::vector<std::shared_ptr<geometry::Image>>,
@@ -219,14 +263,11 @@ CreateGradientImages(
     std::vector<std::shared_ptr<geometry::Image>> images_color;
     std::vector<std::shared_ptr<geometry::Image>> images_depth;
     for (size_t i = 0; i < images_rgbd.size(); i++) {
-        auto gray_image = images_rgbd[i]->color_.CreateFloatImage();
-        auto gray_image_filtered =
-                gray_image->Filter(geometry::Image::FilterType::Gaussian3);
-        images_gray.push_back(gray_image_filtered);
-        images_dx.push_back(gray_image_filtered->Filter(
-                geometry::Image::FilterType::Sobel3Dx));
-        images_dy.push_back(gray_image_filtered->Filter(
-                geometry::Image::FilterType::Sobel3Dy));
+        std::shared_ptr<geometry::Image> gray, dx, dy;
+        std::tie(gray, dx, dy) = CreateGradientImages(*images_rgbd[i]);
+        images_gray.push_back(gray);
+        images_dx.push_back(dx);
+        images_dy.push_back(dy);
         auto color = std::make_shared<geometry::Image>(images_rgbd[i]->color_);
         auto depth = std::make_shared<geometry::Image>(images_rgbd[i]->depth_);
         images_color.push_back(color);
@@ -314,6 +355,236 @@ void ColorMapOptimization(
     }
 }
 
+/// \class RGBDImageBatch
+///
+/// Holds the images of a contiguous range of cameras, read from disk on
+/// demand. Loading the range that is already held is a no-op, so when every
+/// camera fits in one batch the images are read only once.
+class RGBDImageBatch {
+public:
+    RGBDImageBatch(const std::vector<std::string>& color_filenames,
+                   const std::vector<std::string>& depth_filenames,
+                   double depth_scale,
+                   double depth_trunc)
+        : color_filenames_(color_filenames),
+          depth_filenames_(depth_filenames),
+          depth_scale_(depth_scale),
+          depth_trunc_(depth_trunc) {}
+
+    /// Loads cameras [begin, end), releasing the previous batch first.
+    void Load(int begin, int end) {
+        if (begin == begin_ && end == end_) {
+            return;
+        }
+        int n = end - begin;
+        images_gray_.clear();
+        images_dx_.clear();
+        images_dy_.clear();
+        images_color_.clear();
+        images_depth_.clear();
+        images_gray_.resize(n);
+        images_dx_.resize(n);
+        images_dy_.resize(n);
+        images_color_.resize(n);
+        images_depth_.resize(n);
+        std::vector<char> success(n, 1);
+#pragma omp parallel for schedule(dynamic)
+        for (int k = 0; k < n; k++) {
+            geometry::Image color, depth;
+            if (!io::ReadImage(color_filenames_[begin + k], color) ||
+                !io::ReadImage(depth_filenames_[begin + k], depth)) {
+                success[k] = 0;
+                continue;
+            }
+            auto rgbd = geometry::RGBDImage::CreateFromColorAndDepth(
+                    color, depth, depth_scale_, depth_trunc_, false);
+            std::tie(images_gray_[k], images_dx_[k], images_dy_[k]) =
+                    CreateGradientImages(*rgbd);
+            images_color_[k] = std::make_shared<geometry::Image>(rgbd->color_);
+            images_depth_[k] = std::make_shared<geometry::Image>(rgbd->depth_);
+        }
+        for (int k = 0; k < n; k++) {
+            if (!success[k]) {
+                utility::LogError("Failed to read the images of camera {:d}.",
+                                  begin + k);
+            }
+        }
+        begin_ = begin;
+        end_ = end;
+    }
+
+    /// Memory held by the images of one camera of the current batch.
+    size_t GetBytesPerCamera() const {
+        if (images_gray_.empty()) return 0;
+        return images_gray_[0]->data_.size() + images_dx_[0]->data_.size() +
+               images_dy_[0]->data_.size() + images_color_[0]->data_.size() +
+               images_depth_[0]->data_.size();
+    }
+
+public:
+    std::vector<std::shared_ptr<geometry::Image>> images_gray_;
+    std::vector<std::shared_ptr<geometry::Image>> images_dx_;
+    std::vector<std::shared_ptr<geometry::Image>> images_dy_;
+    std::vector<std::shared_ptr<geometry::Image>> images_color_;
+    std::vector<std::shared_ptr<geometry::Image>> images_depth_;
+
+private:
+    const std::vector<std::string>& color_filenames_;
+    const std::vector<std::string>& depth_filenames_;
+    double depth_scale_;
+    double depth_trunc_;
+    int begin_ = -1;
+    int end_ = -1;
+};
+
+void ColorMapOptimization(
+        geometry::TriangleMesh& mesh,
+        const std::vector<std::string>& color_filenames,
+        const std::vector<std::string>& depth_filenames,
+        camera::PinholeCameraTrajectory& camera,
+        const ColorMapOptimizationOption& option
+        /* = ColorMapOptimizationOption()*/,
+        size_t max_memory_bytes /* = 2GB */,
+        double depth_scale /* = 1000.0 */,
+        double depth_trunc /* = 3.0 */) {
+    utility::LogDebug("[ColorMapOptimization] Streaming");
+    int n_camera = int(camera.parameters_.size());
+    size_t n_vertex = mesh.vertices_.size();
+    if (color_filenames.size() != camera.parameters_.size() ||
+        depth_filenames.size() != camera.parameters_.size()) {
+        utility::LogError(
+                "Expected one color and one depth image per camera ({}), but "
+                "got {} and {}.",
+                n_camera, color_filenames.size(), depth_filenames.size());
+    }
+    if (n_camera == 0) {
+        return;
+    }
+
+    // The batch size is derived from the memory held by the first camera.
+    RGBDImageBatch batch(color_filenames, depth_filenames, depth_scale,
+                         depth_trunc);
+    batch.Load(0, 1);
+    int batch_size = int(std::max(
+            size_t(1), max_memory_bytes / std::max(size_t(1),
+                                                   batch.GetBytesPerCamera())));
+    batch_size = std::min(batch_size, n_camera);
+    utility::LogDebug("[ColorMapOptimization] {:d} camera(s) per batch",
+                      batch_size);
+    auto for_each_batch = [&](const std::function<void(int, int)>& func) {
+        for (int begin = 0; begin < n_camera; begin += batch_size) {
+            int end = std::min(begin + batch_size, n_camera);
+            batch.Load(begin, end);
+            func(begin, end);
+        }
+    };
+
+    utility::LogDebug("[ColorMapOptimization] :: VisibilityCheck");
+    std::vector<std::vector<int>> visibility_image_to_vertex(n_camera);
+    for_each_batch([&](int begin, int end) {
+#pragma omp parallel for schedule(static)
+        for (int c = begin; c < end; c++) {
+            auto mask = batch.images_depth_[c - begin]->CreateDepthBoundaryMask(
+                    option.depth_threshold_for_discontinuity_check_,
+                    option.half_dilation_kernel_size_for_discontinuity_map_);
+            visibility_image_to_vertex[c] = CreateImageToVertexVisibility(
+                    mesh, *batch.images_depth_[c - begin], *mask, camera, c,
+                    option.maximum_allowable_depth_,
+                    option.depth_threshold_for_visibility_check_);
+        }
+    });
+    std::vector<std::vector<int>> visibility_vertex_to_image =
+            CreateVertexToImageVisibility(visibility_image_to_vertex,
+                                          n_vertex);
+
+    std::vector<ImageWarpingField> warping_fields, warping_fields_init;
+    if (option.non_rigid_camera_coordinate_) {
+        for (int c = 0; c < n_camera; c++) {
+            const camera::PinholeCameraIntrinsic& intrinsic =
+                    camera.parameters_[c].intrinsic_;
+            warping_fields.push_back(
+                    ImageWarpingField(intrinsic.width_, intrinsic.height_,
+                                      option.number_of_vertical_anchors_));
+        }
+        warping_fields_init = warping_fields;
+    }
+
+    // The proxy intensity used by iteration i + 1 is accumulated batch by
+    // batch right after the cameras of the batch are updated in iteration i,
+    // so every iteration reads each image once.
+    std::vector<double> proxy_intensity(n_vertex, 0.0);
+    std::vector<double> proxy_weight(n_vertex, 0.0);
+    auto accumulate_proxy_intensity = [&](int begin) {
+        if (option.non_rigid_camera_coordinate_) {
+            AccumulateProxyIntensityForVertex(
+                    mesh, batch.images_gray_, warping_fields, camera,
+                    visibility_vertex_to_image, begin, proxy_intensity,
+                    proxy_weight, option.image_boundary_margin_);
+        } else {
+            AccumulateProxyIntensityForVertex(
+                    mesh, batch.images_gray_, camera,
+                    visibility_vertex_to_image, begin, proxy_intensity,
+                    proxy_weight, option.image_boundary_margin_);
+        }
+    };
+    for_each_batch([&](int begin, int) { accumulate_proxy_intensity(begin); });
+    AverageProxyIntensityForVertex(proxy_intensity, proxy_weight);
+
+    for (int itr = 0; itr < option.maximum_iteration_; itr++) {
+        utility::LogDebug("[Iteration {:04d}] ", itr + 1);
+        std::vector<double> current_proxy_intensity;
+        current_proxy_intensity.swap(proxy_intensity);
+        proxy_intensity.assign(n_vertex, 0.0);
+        proxy_weight.assign(n_vertex, 0.0);
+        double residual = 0.0;
+        double residual_reg = 0.0;
+        for_each_batch([&](int begin, int end) {
+#pragma omp parallel for schedule(static) reduction(+ : residual, residual_reg)
+            for (int c = begin; c < end; c++) {
+                int k = c - begin;
+                if (option.non_rigid_camera_coordinate_) {
+                    std::pair<double, double> r = UpdateCameraNonRigid(
+                            mesh, batch.images_gray_[k], batch.images_dx_[k],
+                            batch.images_dy_[k], warping_fields[c],
+                            warping_fields_init[c], camera, c,
+                            visibility_image_to_vertex[c],
+                            current_proxy_intensity, option);
+                    residual += r.first;
+                    residual_reg += r.second;
+                } else {
+                    residual += UpdateCameraRigid(
+                            mesh, batch.images_gray_[k], batch.images_dx_[k],
+                            batch.images_dy_[k], camera, c,
+                            visibility_image_to_vertex[c],
+                            current_proxy_intensity, option);
+                }
+            }
+            accumulate_proxy_intensity(begin);
+        });
+        AverageProxyIntensityForVertex(proxy_intensity, proxy_weight);
+        utility::LogDebug("Residual error : {:.6f}, reg : {:.6f}", residual,
+                          residual_reg);
+    }
+
+    mesh.vertex_colors_.assign(n_vertex, Eigen::Vector3d::Zero());
+    std::vector<double> color_weight(n_vertex, 0.0);
+    for_each_batch([&](int begin, int) {
+        if (option.non_rigid_camera_coordinate_) {
+            AccumulateGeometryColor(mesh, batch.images_color_, warping_fields,
+                                    camera, visibility_vertex_to_image, begin,
+                                    color_weight,
+                                    option.image_boundary_margin_);
+        } else {
+            AccumulateGeometryColor(mesh, batch.images_color_, camera,
+                                    visibility_vertex_to_image, begin,
+                                    color_weight,
+                                    option.image_boundary_margin_);
+        }
+    });
+    AverageGeometryColor(mesh, color_weight,
+                         option.invisible_vertex_color_knn_);
+}
+
 }  // namespace color_map
 }  // namespace pipelines
 }  // namespace open3d
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "open3d/camera/PinholeCameraTrajectory.h"
@@ -144,6 +145,34 @@ void ColorMapOptimization(
         const ColorMapOptimizationOption& option =
                 ColorMapOptimizationOption());
 
+/// \brief Color map optimization with images streamed from disk.
+///
+/// Same as above, but the RGB-D images are read from disk in batches of
+/// cameras, so that the number of keyframes is not limited by memory. Only the
+/// images of one batch are held at a time, besides per-vertex and per-camera
+/// state. Every iteration reads each image once; when all images fit in \p
+/// max_memory_bytes they are read only once.
+///
+/// \param mesh The input geometry mesh.
+/// \param color_filenames Color image of each camera.
+/// \param depth_filenames Depth image of each camera.
+/// \param camera Cameras' parameters.
+/// \param option Color map optimization options.
+/// \param max_memory_bytes Memory budget for the images held at a time
+/// (color, depth, intensity and its gradients). At least one camera is held.
+/// \param depth_scale Scale passed to RGBDImage::CreateFromColorAndDepth.
+/// \param depth_trunc Truncation passed to RGBDImage::CreateFromColorAndDepth.
+void ColorMapOptimization(
+        geometry::TriangleMesh& mesh,
+        const std::vector<std::string>& color_filenames,
+        const std::vector<std::string>& depth_filenames,
+        camera::PinholeCameraTrajectory& camera,
+        const ColorMapOptimizationOption& option =
+                ColorMapOptimizationOption(),
+        size_t max_memory_bytes = size_t(2) << 30,
+        double depth_scale = 1000.0,
+        double depth_trunc = 3.0);
+
 }  // namespace color_map
 }  // namespace pipelines
 }  // namespace open3d
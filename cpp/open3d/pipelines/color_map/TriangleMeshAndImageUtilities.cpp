@@ -26,7 +26,10 @@
 
 #include "open3d/pipelines/color_map/TriangleMeshAndImageUtilities.h"
 
+#include <algorithm>
+
 #include "open3d/camera/PinholeCameraTrajectory.h"
+#include "open3d/core/kernel/ParallelUtil.h"
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/RGBDImage.h"
@@ -53,6 +56,97 @@ inline std::tuple<float, float, float> Project3DPointAndGetUVDepth(
     return std::make_tuple(u, v, z);
 }
 
+std::vector<int> CreateImageToVertexVisibility(
+        const geometry::TriangleMesh& mesh,
+        const geometry::Image& image_depth,
+        const geometry::Image& image_mask,
+        const camera::PinholeCameraTrajectory& camera,
+        int camera_id,
+        double maximum_allowable_depth,
+        double depth_threshold_for_visibility_check) {
+    std::vector<int> visible_vertices;
+    for (int vertex_id = 0; vertex_id < int(mesh.vertices_.size());
+         vertex_id++) {
+        Eigen::Vector3d X = mesh.vertices_[vertex_id];
+        float u, v, d;
+        std::tie(u, v, d) = Project3DPointAndGetUVDepth(X, camera, camera_id);
+        int u_d = int(round(u)), v_d = int(round(v));
+        // Skip if vertex in image boundary.
+        if (d < 0.0 || !image_depth.TestImageBoundary(u_d, v_d)) {
+            continue;
+        }
+        // Skip if vertex's depth is too large (e.g. background).
+        float d_sensor = *image_depth.PointerAt<float>(u_d, v_d);
+        if (d_sensor > maximum_allowable_depth) {
+            continue;
+        }
+        // Check depth boundary mask. If a vertex is located at the boundary
+        // of an object, its color will be highly diverse from different
+        // viewing angles.
+        if (*image_mask.PointerAt<unsigned char>(u_d, v_d) == 255) {
+            continue;
+        }
+        // Check depth errors.
+        if (std::fabs(d - d_sensor) >= depth_threshold_for_visibility_check) {
+            continue;
+        }
+        visible_vertices.push_back(vertex_id);
+    }
+    return visible_vertices;
+}
+
+std::vector<std::vector<int>> CreateVertexToImageVisibility(
+        const std::vector<std::vector<int>>& visibility_image_to_vertex,
+        size_t n_vertex) {
+    int n_camera = int(visibility_image_to_vertex.size());
+    std::vector<std::vector<int>> visibility_vertex_to_image(n_vertex);
+
+    // Every thread owns a contiguous range of vertices and reads its slice of
+    // each (sorted) per-camera list, so no two threads write the same vertex.
+    // Cameras are visited in order, hence every vertex lists its cameras in
+    // increasing order. Lists are counted first and allocated only once.
+    int num_threads = core::kernel::GetMaxThreads();
+    int n_vertex_per_thread = int((n_vertex + num_threads - 1) / num_threads);
+#pragma omp parallel for schedule(static)
+    for (int thread_id = 0; thread_id < num_threads; thread_id++) {
+        int vertex_begin =
+                std::min(thread_id * n_vertex_per_thread, int(n_vertex));
+        int vertex_end =
+                std::min(vertex_begin + n_vertex_per_thread, int(n_vertex));
+        if (vertex_begin >= vertex_end) {
+            continue;
+        }
+
+        typedef std::vector<int>::const_iterator Iterator;
+        std::vector<std::pair<Iterator, Iterator>> slices(n_camera);
+        std::vector<int> counts(vertex_end - vertex_begin, 0);
+        for (int camera_id = 0; camera_id < n_camera; camera_id++) {
+            const std::vector<int>& vertices =
+                    visibility_image_to_vertex[camera_id];
+            slices[camera_id].first = std::lower_bound(
+                    vertices.begin(), vertices.end(), vertex_begin);
+            slices[camera_id].second = std::lower_bound(
+                    slices[camera_id].first, vertices.end(), vertex_end);
+            for (Iterator it = slices[camera_id].first;
+                 it != slices[camera_id].second; ++it) {
+                counts[*it - vertex_begin]++;
+            }
+        }
+        for (int vertex_id = vertex_begin; vertex_id < vertex_end;
+             vertex_id++) {
+            visibility_vertex_to_image[vertex_id].reserve(
+                    counts[vertex_id - vertex_begin]);
+        }
+        for (int camera_id = 0; camera_id < n_camera; camera_id++) {
+            for (Iterator it = slices[camera_id].first;
+                 it != slices[camera_id].second; ++it) {
+                visibility_vertex_to_image[*it].push_back(camera_id);
+            }
+        }
+    }
+    return visibility_vertex_to_image;
+}
+
 std::tuple<std::vector<std::vector<int>>, std::vector<std::vector<int>>>
 CreateVertexAndImageVisibility(
         const geometry::TriangleMesh& mesh,
@@ -66,45 +160,13 @@ CreateVertexAndImageVisibility(
     // visibility_image_to_vertex[c]: vertices visible by camera c.
     std::vector<std::vector<int>> visibility_image_to_vertex;
     visibility_image_to_vertex.resize(n_camera);
-    // visibility_vertex_to_image[v]: cameras that can see vertex v.
-    std::vector<std::vector<int>> visibility_vertex_to_image;
-    visibility_vertex_to_image.resize(n_vertex);
 
 #pragma omp parallel for schedule(static)
     for (int camera_id = 0; camera_id < int(n_camera); camera_id++) {
-        for (int vertex_id = 0; vertex_id < int(n_vertex); vertex_id++) {
-            Eigen::Vector3d X = mesh.vertices_[vertex_id];
-            float u, v, d;
-            std::tie(u, v, d) =
-                    Project3DPointAndGetUVDepth(X, camera, camera_id);
-            int u_d = int(round(u)), v_d = int(round(v));
-            // Skip if vertex in image boundary.
-            if (d < 0.0 ||
-                !images_depth[camera_id]->TestImageBoundary(u_d, v_d)) {
-                continue;
-            }
-            // Skip if vertex's depth is too large (e.g. background).
-            float d_sensor =
-                    *images_depth[camera_id]->PointerAt<float>(u_d, v_d);
-            if (d_sensor > maximum_allowable_depth) {
-                continue;
-            }
-            // Check depth boundary mask. If a vertex is located at the boundary
-            // of an object, its color will be highly diverse from different
-            // viewing angles.
-            if (*images_mask[camera_id]->PointerAt<unsigned char>(u_d, v_d) ==
-                255) {
-                continue;
-            }
-            // Check depth errors.
-            if (std::fabs(d - d_sensor) >=
-                depth_threshold_for_visibility_check) {
-                continue;
-            }
-            visibility_image_to_vertex[camera_id].push_back(vertex_id);
-#pragma omp critical
-            { visibility_vertex_to_image[vertex_id].push_back(camera_id); }
-        }
+        visibility_image_to_vertex[camera_id] = CreateImageToVertexVisibility(
+                mesh, *images_depth[camera_id], *images_mask[camera_id],
+                camera, camera_id, maximum_allowable_depth,
+                depth_threshold_for_visibility_check);
     }
 
     for (int camera_id = 0; camera_id < int(n_camera); camera_id++) {
@@ -115,6 +177,10 @@ CreateVertexAndImageVisibility(
                 double(n_visible_vertex) / n_vertex * 100);
     }
 
+    // visibility_vertex_to_image[v]: cameras that can see vertex v.
+    std::vector<std::vector<int>> visibility_vertex_to_image =
+            CreateVertexToImageVisibility(visibility_image_to_vertex,
+                                          n_vertex);
     return std::make_tuple(visibility_vertex_to_image,
                            visibility_image_to_vertex);
 }
@@ -172,40 +238,105 @@ std::tuple<bool, T> QueryImageIntensity(
     return std::make_tuple(false, 0);
 }
 
-void SetProxyIntensityForVertex(
+/// Adds the intensity of every vertex seen by cameras [camera_begin,
+/// camera_begin + n_images) to proxy_intensity and proxy_weight. query(j, i)
+/// returns the intensity of vertex i in camera j. Threads own disjoint
+/// vertices.
+template <typename QueryFunc>
+static void AccumulateProxyIntensityForVertexImpl(
         const geometry::TriangleMesh& mesh,
-        const std::vector<std::shared_ptr<geometry::Image>>& images_gray,
-        const std::vector<ImageWarpingField>& warping_field,
-        const camera::PinholeCameraTrajectory& camera,
         const std::vector<std::vector<int>>& visibility_vertex_to_image,
+        int camera_begin,
+        int n_images,
         std::vector<double>& proxy_intensity,
-        int image_boundary_margin) {
-    auto n_vertex = mesh.vertices_.size();
-    proxy_intensity.resize(n_vertex);
-
+        std::vector<double>& proxy_weight,
+        QueryFunc query) {
+    int camera_end = camera_begin + n_images;
 #pragma omp parallel for schedule(static)
-    for (int i = 0; i < int(n_vertex); i++) {
-        proxy_intensity[i] = 0.0;
-        float sum = 0.0;
-        for (size_t iter = 0; iter < visibility_vertex_to_image[i].size();
-             iter++) {
-            int j = visibility_vertex_to_image[i][iter];
+    for (int i = 0; i < int(mesh.vertices_.size()); i++) {
+        const std::vector<int>& cameras = visibility_vertex_to_image[i];
+        auto it = std::lower_bound(cameras.begin(), cameras.end(),
+                                   camera_begin);
+        for (; it != cameras.end() && *it < camera_end; ++it) {
             float gray;
             bool valid = false;
-            std::tie(valid, gray) = QueryImageIntensity<float>(
-                    *images_gray[j], warping_field[j], mesh.vertices_[i],
-                    camera, j, -1, image_boundary_margin);
+            std::tie(valid, gray) = query(*it, i);
             if (valid) {
-                sum += 1.0;
+                proxy_weight[i] += 1.0;
                 proxy_intensity[i] += gray;
             }
         }
-        if (sum > 0) {
-            proxy_intensity[i] /= sum;
+    }
+}
+
+void AccumulateProxyIntensityForVertex(
+        const geometry::TriangleMesh& mesh,
+        const std::vector<std::shared_ptr<geometry::Image>>& images_gray,
+        const std::vector<ImageWarpingField>& warping_fields,
+        const camera::PinholeCameraTrajectory& camera,
+        const std::vector<std::vector<int>>& visibility_vertex_to_image,
+        int camera_begin,
+        std::vector<double>& proxy_intensity,
+        std::vector<double>& proxy_weight,
+        int image_boundary_margin) {
+    AccumulateProxyIntensityForVertexImpl(
+            mesh, visibility_vertex_to_image, camera_begin,
+            int(images_gray.size()), proxy_intensity, proxy_weight,
+            [&](int j, int i) {
+                return QueryImageIntensity<float>(
+                        *images_gray[j - camera_begin], warping_fields[j],
+                        mesh.vertices_[i], camera, j, -1,
+                        image_boundary_margin);
+            });
+}
+
+void AccumulateProxyIntensityForVertex(
+        const geometry::TriangleMesh& mesh,
+        const std::vector<std::shared_ptr<geometry::Image>>& images_gray,
+        const camera::PinholeCameraTrajectory& camera,
+        const std::vector<std::vector<int>>& visibility_vertex_to_image,
+        int camera_begin,
+        std::vector<double>& proxy_intensity,
+        std::vector<double>& proxy_weight,
+        int image_boundary_margin) {
+    AccumulateProxyIntensityForVertexImpl(
+            mesh, visibility_vertex_to_image, camera_begin,
+            int(images_gray.size()), proxy_intensity, proxy_weight,
+            [&](int j, int i) {
+                return QueryImageIntensity<float>(
+                        *images_gray[j - camera_begin], mesh.vertices_[i],
+                        camera, j, -1, image_boundary_margin);
+            });
+}
+
+void AverageProxyIntensityForVertex(std::vector<double>& proxy_intensity,
+                                    const std::vector<double>& proxy_weight) {
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < int(proxy_intensity.size()); i++) {
+        if (proxy_weight[i] > 0) {
+            proxy_intensity[i] /= proxy_weight[i];
         }
     }
 }
 
+void SetProxyIntensityForVertex(
+        const geometry::TriangleMesh& mesh,
+        const std::vector<std::shared_ptr<geometry::Image>>& images_gray,
+        const std::vector<ImageWarpingField>& warping_field,
+        const camera::PinholeCameraTrajectory& camera,
+        const std::vector<std::vector<int>>& visibility_vertex_to_image,
+        std::vector<double>& proxy_intensity,
+        int image_boundary_margin) {
+    auto n_vertex = mesh.vertices_.size();
+    proxy_intensity.assign(n_vertex, 0.0);
+    std::vector<double> proxy_weight(n_vertex, 0.0);
+    AccumulateProxyIntensityForVertex(mesh, images_gray, warping_field, camera,
+                                      visibility_vertex_to_image, 0,
+                                      proxy_intensity, proxy_weight,
+                                      image_boundary_margin);
+    AverageProxyIntensityForVertex(proxy_intensity, proxy_weight);
+}
+
 void SetProxyIntensityForVertex(
         const geometry::TriangleMesh& mesh,
         const std::vector<std::shared_ptr<geometry::Image>>& images_gray,
@@ -214,77 +345,103 @@ void SetProxyIntensityForVertex(
         std::vector<double>& proxy_intensity,
         int image_boundary_margin) {
     auto n_vertex = mesh.vertices_.size();
-    proxy_intensity.resize(n_vertex);
+    proxy_intensity.assign(n_vertex, 0.0);
+    std::vector<double> proxy_weight(n_vertex, 0.0);
+    AccumulateProxyIntensityForVertex(mesh, images_gray, camera,
+                                      visibility_vertex_to_image, 0,
+                                      proxy_intensity, proxy_weight,
+                                      image_boundary_margin);
+    AverageProxyIntensityForVertex(proxy_intensity, proxy_weight);
+}
 
+/// Adds the color of every vertex seen by cameras [camera_begin, camera_begin
+/// + n_images) to mesh.vertex_colors_ and color_weight. query(j, i, ch)
+/// returns channel ch of vertex i in camera j. Threads own disjoint vertices.
+template <typename QueryFunc>
+static void AccumulateGeometryColorImpl(
+        geometry::TriangleMesh& mesh,
+        const std::vector<std::vector<int>>& visibility_vertex_to_image,
+        int camera_begin,
+        int n_images,
+        std::vector<double>& color_weight,
+        QueryFunc query) {
+    int camera_end = camera_begin + n_images;
 #pragma omp parallel for schedule(static)
-    for (int i = 0; i < int(n_vertex); i++) {
-        proxy_intensity[i] = 0.0;
-        float sum = 0.0;
-        for (size_t iter = 0; iter < visibility_vertex_to_image[i].size();
-             iter++) {
-            int j = visibility_vertex_to_image[i][iter];
-            float gray;
-            bool valid = false;
-            std::tie(valid, gray) = QueryImageIntensity<float>(
-                    *images_gray[j], mesh.vertices_[i], camera, j, -1,
-                    image_boundary_margin);
+    for (int i = 0; i < int(mesh.vertices_.size()); i++) {
+        const std::vector<int>& cameras = visibility_vertex_to_image[i];
+        auto it = std::lower_bound(cameras.begin(), cameras.end(),
+                                   camera_begin);
+        for (; it != cameras.end() && *it < camera_end; ++it) {
+            Eigen::Vector3d color;
+            bool valid = true;
+            for (int ch = 0; ch < 3; ch++) {
+                bool valid_ch;
+                unsigned char value;
+                std::tie(valid_ch, value) = query(*it, i, ch);
+                valid = valid && valid_ch;
+                color(ch) = (float)value / 255.0f;
+            }
             if (valid) {
-                sum += 1.0;
-                proxy_intensity[i] += gray;
+                mesh.vertex_colors_[i] += color;
+                color_weight[i] += 1.0;
             }
         }
-        if (sum > 0) {
-            proxy_intensity[i] /= sum;
-        }
     }
 }
 
-void SetGeometryColorAverage(
+void AccumulateGeometryColor(
         geometry::TriangleMesh& mesh,
         const std::vector<std::shared_ptr<geometry::Image>>& images_color,
         const camera::PinholeCameraTrajectory& camera,
         const std::vector<std::vector<int>>& visibility_vertex_to_image,
-        int image_boundary_margin /*= 10*/,
-        int invisible_vertex_color_knn /*= 3*/) {
+        int camera_begin,
+        std::vector<double>& color_weight,
+        int image_boundary_margin /*= 10*/) {
+    AccumulateGeometryColorImpl(
+            mesh, visibility_vertex_to_image, camera_begin,
+            int(images_color.size()), color_weight, [&](int j, int i, int ch) {
+                return QueryImageIntensity<unsigned char>(
+                        *images_color[j - camera_begin], mesh.vertices_[i],
+                        camera, j, ch, image_boundary_margin);
+            });
+}
+
+void AccumulateGeometryColor(
+        geometry::TriangleMesh& mesh,
+        const std::vector<std::shared_ptr<geometry::Image>>& images_color,
+        const std::vector<ImageWarpingField>& warping_fields,
+        const camera::PinholeCameraTrajectory& camera,
+        const std::vector<std::vector<int>>& visibility_vertex_to_image,
+        int camera_begin,
+        std::vector<double>& color_weight,
+        int image_boundary_margin /*= 10*/) {
+    AccumulateGeometryColorImpl(
+            mesh, visibility_vertex_to_image, camera_begin,
+            int(images_color.size()), color_weight, [&](int j, int i, int ch) {
+                return QueryImageIntensity<unsigned char>(
+                        *images_color[j - camera_begin], warping_fields[j],
+                        mesh.vertices_[i], camera, j, ch,
+                        image_boundary_margin);
+            });
+}
+
+void AverageGeometryColor(geometry::TriangleMesh& mesh,
+                          const std::vector<double>& color_weight,
+                          int invisible_vertex_color_knn /*= 3*/) {
     size_t n_vertex = mesh.vertices_.size();
-    mesh.vertex_colors_.clear();
-    mesh.vertex_colors_.resize(n_vertex);
-    std::vector<size_t> valid_vertices;
-    std::vector<size_t> invalid_vertices;
 #pragma omp parallel for schedule(static)
     for (int i = 0; i < (int)n_vertex; i++) {
-        mesh.vertex_colors_[i] = Eigen::Vector3d::Zero();
-        double sum = 0.0;
-        for (size_t iter = 0; iter < visibility_vertex_to_image[i].size();
-             iter++) {
-            int j = visibility_vertex_to_image[i][iter];
-            unsigned char r_temp, g_temp, b_temp;
-            bool valid = false;
-            std::tie(valid, r_temp) = QueryImageIntensity<unsigned char>(
-                    *images_color[j], mesh.vertices_[i], camera, j, 0,
-                    image_boundary_margin);
-            std::tie(valid, g_temp) = QueryImageIntensity<unsigned char>(
-                    *images_color[j], mesh.vertices_[i], camera, j, 1,
-                    image_boundary_margin);
-            std::tie(valid, b_temp) = QueryImageIntensity<unsigned char>(
-                    *images_color[j], mesh.vertices_[i], camera, j, 2,
-                    image_boundary_margin);
-            float r = (float)r_temp / 255.0f;
-            float g = (float)g_temp / 255.0f;
-            float b = (float)b_temp / 255.0f;
-            if (valid) {
-                mesh.vertex_colors_[i] += Eigen::Vector3d(r, g, b);
-                sum += 1.0;
-            }
+        if (color_weight[i] > 0.0) {
+            mesh.vertex_colors_[i] /= color_weight[i];
         }
-#pragma omp critical
-        {
-            if (sum > 0.0) {
-                mesh.vertex_colors_[i] /= sum;
-                valid_vertices.push_back(i);
-            } else {
-                invalid_vertices.push_back(i);
-            }
+    }
+    std::vector<size_t> valid_vertices;
+    std::vector<size_t> invalid_vertices;
+    for (size_t i = 0; i < n_vertex; i++) {
+        if (color_weight[i] > 0.0) {
+            valid_vertices.push_back(i);
+        } else {
+            invalid_vertices.push_back(i);
         }
     }
     if (invisible_vertex_color_knn > 0) {
@@ -310,6 +467,22 @@ void SetGeometryColorAverage(
     }
 }
 
+void SetGeometryColorAverage(
+        geometry::TriangleMesh& mesh,
+        const std::vector<std::shared_ptr<geometry::Image>>& images_color,
+        const camera::PinholeCameraTrajectory& camera,
+        const std::vector<std::vector<int>>& visibility_vertex_to_image,
+        int image_boundary_margin /*= 10*/,
+        int invisible_vertex_color_knn /*= 3*/) {
+    size_t n_vertex = mesh.vertices_.size();
+    mesh.vertex_colors_.assign(n_vertex, Eigen::Vector3d::Zero());
+    std::vector<double> color_weight(n_vertex, 0.0);
+    AccumulateGeometryColor(mesh, images_color, camera,
+                            visibility_vertex_to_image, 0, color_weight,
+                            image_boundary_margin);
+    AverageGeometryColor(mesh, color_weight, invisible_vertex_color_knn);
+}
+
 void SetGeometryColorAverage(
         geometry::TriangleMesh& mesh,
         const std::vector<std::shared_ptr<geometry::Image>>& images_color,
@@ -319,67 +492,12 @@ void SetGeometryColorAverage(
         int image_boundary_margin /*= 10*/,
         int invisible_vertex_color_knn /*= 3*/) {
     size_t n_vertex = mesh.vertices_.size();
-    mesh.vertex_colors_.clear();
-    mesh.vertex_colors_.resize(n_vertex);
-    std::vector<size_t> valid_vertices;
-    std::vector<size_t> invalid_vertices;
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)n_vertex; i++) {
-        mesh.vertex_colors_[i] = Eigen::Vector3d::Zero();
-        double sum = 0.0;
-        for (size_t iter = 0; iter < visibility_vertex_to_image[i].size();
-             iter++) {
-            int j = visibility_vertex_to_image[i][iter];
-            unsigned char r_temp, g_temp, b_temp;
-            bool valid = false;
-            std::tie(valid, r_temp) = QueryImageIntensity<unsigned char>(
-                    *images_color[j], warping_fields[j], mesh.vertices_[i],
-                    camera, j, 0, image_boundary_margin);
-            std::tie(valid, g_temp) = QueryImageIntensity<unsigned char>(
-                    *images_color[j], warping_fields[j], mesh.vertices_[i],
-                    camera, j, 1, image_boundary_margin);
-            std::tie(valid, b_temp) = QueryImageIntensity<unsigned char>(
-                    *images_color[j], warping_fields[j], mesh.vertices_[i],
-                    camera, j, 2, image_boundary_margin);
-            float r = (float)r_temp / 255.0f;
-            float g = (float)g_temp / 255.0f;
-            float b = (float)b_temp / 255.0f;
-            if (valid) {
-                mesh.vertex_colors_[i] += Eigen::Vector3d(r, g, b);
-                sum += 1.0;
-            }
-        }
-#pragma omp critical
-        {
-            if (sum > 0.0) {
-                mesh.vertex_colors_[i] /= sum;
-                valid_vertices.push_back(i);
-            } else {
-                invalid_vertices.push_back(i);
-            }
-        }
-    }
-    if (invisible_vertex_color_knn > 0) {
-        std::shared_ptr<geometry::TriangleMesh> valid_mesh =
-                mesh.SelectByIndex(valid_vertices);
-        geometry::KDTreeFlann kd_tree(*valid_mesh);
-#pragma omp parallel for schedule(static)
-        for (int i = 0; i < (int)invalid_vertices.size(); ++i) {
-            size_t invalid_vertex = invalid_vertices[i];
-            std::vector<int> indices;  // indices to valid_mesh
-            std::vector<double> dists;
-            kd_tree.SearchKNN(mesh.vertices_[invalid_vertex],
-                              invisible_vertex_color_knn, indices, dists);
-            Eigen::Vector3d new_color(0, 0, 0);
-            for (const int& index : indices) {
-                new_color += valid_mesh->vertex_colors_[index];
-            }
-            if (indices.size() > 0) {
-                new_color /= static_cast<double>(indices.size());
-            }
-            mesh.vertex_colors_[invalid_vertex] = new_color;
-        }
-    }
+    mesh.vertex_colors_.assign(n_vertex, Eigen::Vector3d::Zero());
+    std::vector<double> color_weight(n_vertex, 0.0);
+    AccumulateGeometryColor(mesh, images_color, warping_fields, camera,
+                            visibility_vertex_to_image, 0, color_weight,
+                            image_boundary_margin);
+    AverageGeometryColor(mesh, color_weight, invisible_vertex_color_knn);
 }
 
 }  // namespace color_map
@@ -47,6 +47,23 @@ inline std::tuple<float, float, float> Project3DPointAndGetUVDepth(
         const camera::PinholeCameraTrajectory& camera,
         int camid);
 
+/// Returns the vertices of \p mesh visible by camera \p camera_id, in
+/// increasing order.
+std::vector<int> CreateImageToVertexVisibility(
+        const geometry::TriangleMesh& mesh,
+        const geometry::Image& image_depth,
+        const geometry::Image& image_mask,
+        const camera::PinholeCameraTrajectory& camera,
+        int camera_id,
+        double maximum_allowable_depth,
+        double depth_threshold_for_visibility_check);
+
+/// Inverts per-camera visibility lists (sorted by vertex): returns, for every
+/// vertex, the cameras that see it in increasing order.
+std::vector<std::vector<int>> CreateVertexToImageVisibility(
+        const std::vector<std::vector<int>>& visibility_image_to_vertex,
+        size_t n_vertex);
+
 std::tuple<std::vector<std::vector<int>>, std::vector<std::vector<int>>>
 CreateVertexAndImageVisibility(
         const geometry::TriangleMesh& mesh,
@@ -75,6 +92,35 @@ std::tuple<bool, T> QueryImageIntensity(
         int ch = -1,
         int image_boundary_margin = 10);
 
+/// Adds the intensity of the vertices seen by cameras [camera_begin,
+/// camera_begin + images_gray.size()) to \p proxy_intensity and the number of
+/// valid observations to \p proxy_weight. images_gray[k] is the image of
+/// camera camera_begin + k. Used to process images in batches.
+void AccumulateProxyIntensityForVertex(
+        const geometry::TriangleMesh& mesh,
+        const std::vector<std::shared_ptr<geometry::Image>>& images_gray,
+        const std::vector<ImageWarpingField>& warping_fields,
+        const camera::PinholeCameraTrajectory& camera,
+        const std::vector<std::vector<int>>& visibility_vertex_to_image,
+        int camera_begin,
+        std::vector<double>& proxy_intensity,
+        std::vector<double>& proxy_weight,
+        int image_boundary_margin);
+
+void AccumulateProxyIntensityForVertex(
+        const geometry::TriangleMesh& mesh,
+        const std::vector<std::shared_ptr<geometry::Image>>& images_gray,
+        const camera::PinholeCameraTrajectory& camera,
+        const std::vector<std::vector<int>>& visibility_vertex_to_image,
+        int camera_begin,
+        std::vector<double>& proxy_intensity,
+        std::vector<double>& proxy_weight,
+        int image_boundary_margin);
+
+/// Divides the accumulated intensities by their weights.
+void AverageProxyIntensityForVertex(std::vector<double>& proxy_intensity,
+                                    const std::vector<double>& proxy_weight);
+
 void SetProxyIntensityForVertex(
         const geometry::TriangleMesh& mesh,
         const std::vector<std::shared_ptr<geometry::Image>>& images_gray,
@@ -92,6 +138,35 @@ void SetProxyIntensityForVertex(
         std::vector<double>& proxy_intensity,
         int image_boundary_margin);
 
+/// Adds the colors of the vertices seen by cameras [camera_begin,
+/// camera_begin + images_color.size()) to mesh.vertex_colors_ and the number
+/// of valid observations to \p color_weight. images_color[k] is the image of
+/// camera camera_begin + k. Used to process images in batches.
+void AccumulateGeometryColor(
+        geometry::TriangleMesh& mesh,
+        const std::vector<std::shared_ptr<geometry::Image>>& images_color,
+        const camera::PinholeCameraTrajectory& camera,
+        const std::vector<std::vector<int>>& visibility_vertex_to_image,
+        int camera_begin,
+        std::vector<double>& color_weight,
+        int image_boundary_margin = 10);
+
+void AccumulateGeometryColor(
+        geometry::TriangleMesh& mesh,
+        const std::vector<std::shared_ptr<geometry::Image>>& images_color,
+        const std::vector<ImageWarpingField>& warping_fields,
+        const camera::PinholeCameraTrajectory& camera,
+        const std::vector<std::vector<int>>& visibility_vertex_to_image,
+        int camera_begin,
+        std::vector<double>& color_weight,
+        int image_boundary_margin = 10);
+
+/// Divides the accumulated colors by their weights and fills vertices seen by
+/// no camera with the average color of their nearest visible neighbors.
+void AverageGeometryColor(geometry::TriangleMesh& mesh,
+                          const std::vector<double>& color_weight,
+                          int invisible_vertex_color_knn = 3);
+
 void SetGeometryColorAverage(
         geometry::TriangleMesh& mesh,
         const std::vector<std::shared_ptr<geometry::Image>>& images_rgbd,
@@ -26,7 +26,11 @@
 
 #include "open3d/pipelines/registration/FastGlobalRegistration.h"
 
-#include "open3d/geometry/KDTreeFlann.h"
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <random>
+
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/pipelines/registration/Feature.h"
 #include "open3d/pipelines/registration/Registration.h"
@@ -53,118 +57,93 @@ static std::vector<std::pair<int, int>> AdvancedMatching(
         swapped = true;
     }
 
-    // STEP 1) Initial matching
-    int nPti = int(point_cloud_vec[fi].points_.size());
-    int nPtj = int(point_cloud_vec[fj].points_.size());
-    geometry::KDTreeFlann feature_tree_i(features_vec[fi]);
-    geometry::KDTreeFlann feature_tree_j(features_vec[fj]);
-    std::vector<int> corresK;
-    std::vector<double> dis;
-    std::vector<std::pair<int, int>> corres;
-    std::vector<std::pair<int, int>> corres_ij;
-    std::vector<std::pair<int, int>> corres_ji;
-    std::vector<int> i_to_j(nPti, -1);
-    for (int j = 0; j < nPtj; j++) {
-        feature_tree_i.SearchKNN(Eigen::VectorXd(features_vec[fj].data_.col(j)),
-                                 1, corresK, dis);
-        int i = corresK[0];
-        if (i_to_j[i] == -1) {
-            feature_tree_j.SearchKNN(
-                    Eigen::VectorXd(features_vec[fi].data_.col(i)), 1, corresK,
-                    dis);
-            int ij = corresK[0];
-            i_to_j[i] = ij;
-        }
-        corres_ji.push_back(std::pair<int, int>(i, j));
-    }
-    for (int i = 0; i < nPti; i++) {
-        if (i_to_j[i] != -1)
-            corres_ij.push_back(std::pair<int, int>(i, i_to_j[i]));
-    }
-    int ncorres_ij = int(corres_ij.size());
-    int ncorres_ji = int(corres_ji.size());
-    for (int i = 0; i < ncorres_ij; ++i)
-        corres.push_back(
-                std::pair<int, int>(corres_ij[i].first, corres_ij[i].second));
-    for (int j = 0; j < ncorres_ji; ++j)
-        corres.push_back(
-                std::pair<int, int>(corres_ji[j].first, corres_ji[j].second));
-    utility::LogDebug("points are remained : {:d}", (int)corres.size());
-
-    // STEP 2) CROSS CHECK
+    // STEP 1) Initial matching and 2) CROSS CHECK
+    // Keeps the pairs which are mutual nearest neighbors, ordered by i.
     utility::LogDebug("\t[cross check] ");
+    const CorrespondenceSet corres_ji = CorrespondencesFromFeatures(
+            features_vec[fj], features_vec[fi], true, option.feature_matching_);
     std::vector<std::pair<int, int>> corres_cross;
-    std::vector<std::vector<int>> Mi(nPti), Mj(nPtj);
-    int ci, cj;
-    for (int i = 0; i < ncorres_ij; ++i) {
-        ci = corres_ij[i].first;
-        cj = corres_ij[i].second;
-        Mi[ci].push_back(cj);
-    }
-    for (int j = 0; j < ncorres_ji; ++j) {
-        ci = corres_ji[j].first;
-        cj = corres_ji[j].second;
-        Mj[cj].push_back(ci);
-    }
-    for (int i = 0; i < nPti; ++i) {
-        for (size_t ii = 0; ii < Mi[i].size(); ++ii) {
-            int j = Mi[i][ii];
-            for (size_t jj = 0; jj < Mj[j].size(); ++jj) {
-                if (Mj[j][jj] == i)
-                    corres_cross.push_back(std::pair<int, int>(i, j));
-            }
-        }
+    corres_cross.reserve(corres_ji.size());
+    for (const Eigen::Vector2i& c : corres_ji) {
+        corres_cross.push_back(std::pair<int, int>(c(1), c(0)));
     }
-    utility::LogDebug("points are remained : %d", (int)corres_cross.size());
+    std::sort(corres_cross.begin(), corres_cross.end());
+    utility::LogDebug("points are remained : {:d}", (int)corres_cross.size());
 
     // STEP 3) TUPLE CONSTRAINT
+    // Trials are split into chunks with their own random generator, which
+    // are tested in parallel. The chunks are merged in order, so the result
+    // does not depend on the number of threads.
     utility::LogDebug("\t[tuple constraint] ");
-    int rand0, rand1, rand2, i, cnt = 0;
-    int idi0, idi1, idi2, idj0, idj1, idj2;
     double scale = option.tuple_scale_;
     int ncorr = static_cast<int>(corres_cross.size());
     int number_of_trial = ncorr * 100;
-
-    std::vector<std::pair<int, int>> corres_tuple;
-    for (i = 0; i < number_of_trial; i++) {
-        rand0 = utility::UniformRandInt(0, ncorr - 1);
-        rand1 = utility::UniformRandInt(0, ncorr - 1);
-        rand2 = utility::UniformRandInt(0, ncorr - 1);
-        idi0 = corres_cross[rand0].first;
-        idj0 = corres_cross[rand0].second;
-        idi1 = corres_cross[rand1].first;
-        idj1 = corres_cross[rand1].second;
-        idi2 = corres_cross[rand2].first;
-        idj2 = corres_cross[rand2].second;
-
-        // collect 3 points from i-th fragment
-        Eigen::Vector3d pti0 = point_cloud_vec[fi].points_[idi0];
-        Eigen::Vector3d pti1 = point_cloud_vec[fi].points_[idi1];
-        Eigen::Vector3d pti2 = point_cloud_vec[fi].points_[idi2];
-        double li0 = (pti0 - pti1).norm();
-        double li1 = (pti1 - pti2).norm();
-        double li2 = (pti2 - pti0).norm();
-
-        // collect 3 points from j-th fragment
-        Eigen::Vector3d ptj0 = point_cloud_vec[fj].points_[idj0];
-        Eigen::Vector3d ptj1 = point_cloud_vec[fj].points_[idj1];
-        Eigen::Vector3d ptj2 = point_cloud_vec[fj].points_[idj2];
-        double lj0 = (ptj0 - ptj1).norm();
-        double lj1 = (ptj1 - ptj2).norm();
-        double lj2 = (ptj2 - ptj0).norm();
-
-        // check tuple constraint
-        if ((li0 * scale < lj0) && (lj0 < li0 / scale) && (li1 * scale < lj1) &&
-            (lj1 < li1 / scale) && (li2 * scale < lj2) && (lj2 < li2 / scale)) {
-            corres_tuple.push_back(std::pair<int, int>(idi0, idj0));
-            corres_tuple.push_back(std::pair<int, int>(idi1, idj1));
-            corres_tuple.push_back(std::pair<int, int>(idi2, idj2));
-            cnt++;
+    const int chunk_size = 1024;
+    const int num_chunks = (number_of_trial + chunk_size - 1) / chunk_size;
+    const unsigned int seed = (unsigned int)utility::UniformRandInt(
+            0, std::numeric_limits<int>::max());
+    std::vector<std::vector<std::pair<int, int>>> chunk_tuples(num_chunks);
+    std::atomic<int> cnt(0);
+    std::atomic<int> trials(0);
+#pragma omp parallel for schedule(dynamic)
+    for (int chunk = 0; chunk < num_chunks; chunk++) {
+        // Chunks are started in order, so all chunks before the first
+        // skipped one are complete.
+        if (cnt >= option.maximum_tuple_count_) continue;
+        std::mt19937 rng(seed + chunk);
+        std::uniform_int_distribution<int> dist(0, ncorr - 1);
+        const int end = std::min(number_of_trial, (chunk + 1) * chunk_size);
+        int chunk_cnt = 0;
+        for (int trial = chunk * chunk_size; trial < end; trial++) {
+            int rand0 = dist(rng);
+            int rand1 = dist(rng);
+            int rand2 = dist(rng);
+            int idi0 = corres_cross[rand0].first;
+            int idj0 = corres_cross[rand0].second;
+            int idi1 = corres_cross[rand1].first;
+            int idj1 = corres_cross[rand1].second;
+            int idi2 = corres_cross[rand2].first;
+            int idj2 = corres_cross[rand2].second;
+
+            // collect 3 points from i-th fragment
+            const Eigen::Vector3d& pti0 = point_cloud_vec[fi].points_[idi0];
+            const Eigen::Vector3d& pti1 = point_cloud_vec[fi].points_[idi1];
+            const Eigen::Vector3d& pti2 = point_cloud_vec[fi].points_[idi2];
+            double li0 = (pti0 - pti1).norm();
+            double li1 = (pti1 - pti2).norm();
+            double li2 = (pti2 - pti0).norm();
+
+            // collect 3 points from j-th fragment
+            const Eigen::Vector3d& ptj0 = point_cloud_vec[fj].points_[idj0];
+            const Eigen::Vector3d& ptj1 = point_cloud_vec[fj].points_[idj1];
+            const Eigen::Vector3d& ptj2 = point_cloud_vec[fj].points_[idj2];
+            double lj0 = (ptj0 - ptj1).norm();
+            double lj1 = (ptj1 - ptj2).norm();
+            double lj2 = (ptj2 - ptj0).norm();
+
+            // check tuple constraint
+            if ((li0 * scale < lj0) && (lj0 < li0 / scale) &&
+                (li1 * scale < lj1) && (lj1 < li1 / scale) &&
+                (li2 * scale < lj2) && (lj2 < li2 / scale)) {
+                chunk_tuples[chunk].push_back(std::pair<int, int>(idi0, idj0));
+                chunk_tuples[chunk].push_back(std::pair<int, int>(idi1, idj1));
+                chunk_tuples[chunk].push_back(std::pair<int, int>(idi2, idj2));
+                if (++chunk_cnt >= option.maximum_tuple_count_) break;
+            }
         }
-        if (cnt >= option.maximum_tuple_count_) break;
+        cnt += chunk_cnt;
+        trials += end - chunk * chunk_size;
+    }
+    std::vector<std::pair<int, int>> corres_tuple;
+    for (const auto& tuples : chunk_tuples) {
+        corres_tuple.insert(corres_tuple.end(), tuples.begin(), tuples.end());
+    }
+    if (int(corres_tuple.size()) > 3 * option.maximum_tuple_count_) {
+        corres_tuple.resize(3 * option.maximum_tuple_count_);
     }
-    utility::LogDebug("{:d} tuples ({:d} trial, {:d} actual).", cnt,
-                      number_of_trial, i);
+    utility::LogDebug("{:d} tuples ({:d} trial, {:d} actual).",
+                      int(corres_tuple.size()) / 3, number_of_trial,
+                      int(trials));
 
     if (swapped) {
         std::vector<std::pair<int, int>> temp;
@@ -243,59 +222,54 @@ static Eigen::Matrix4d OptimizePairwiseRegistration(
 
     if (corres.size() < 10) return Eigen::Matrix4d::Identity();
 
-    std::vector<double> s(corres.size(), 1.0);
     Eigen::Matrix4d trans;
     trans.setIdentity();
 
     for (int itr = 0; itr < numIter; itr++) {
-        const int nvariable = 6;
-        Eigen::MatrixXd JTJ(nvariable, nvariable);
-        Eigen::MatrixXd JTr(nvariable, 1);
-        Eigen::MatrixXd J(nvariable, 1);
-        JTJ.setZero();
-        JTr.setZero();
-        double r = 0.0, r2 = 0.0;
-
-        for (size_t c = 0; c < corres.size(); c++) {
-            int ii = corres[c].first;
-            int jj = corres[c].second;
-            Eigen::Vector3d p, q;
-            p = point_cloud_vec[i].points_[ii];
-            q = point_cloud_copy_j.points_[jj];
-            Eigen::Vector3d rpq = p - q;
-
-            size_t c2 = c;
-            double temp = par / (rpq.dot(rpq) + par);
-            s[c2] = temp * temp;
-
-            J.setZero();
-            J(1) = -q(2);
-            J(2) = q(1);
-            J(3) = -1;
-            r = rpq(0);
-            JTJ += J * J.transpose() * s[c2];
-            JTr += J * r * s[c2];
-            r2 += r * r * s[c2];
-
-            J.setZero();
-            J(2) = -q(0);
-            J(0) = q(2);
-            J(4) = -1;
-            r = rpq(1);
-            JTJ += J * J.transpose() * s[c2];
-            JTr += J * r * s[c2];
-            r2 += r * r * s[c2];
-
-            J.setZero();
-            J(0) = -q(1);
-            J(1) = q(0);
-            J(5) = -1;
-            r = rpq(2);
-            JTJ += J * J.transpose() * s[c2];
-            JTr += J * r * s[c2];
-            r2 += r * r * s[c2];
-            r2 += (par * (1.0 - sqrt(s[c2])) * (1.0 - sqrt(s[c2])));
-        }
+        auto compute_jacobian_and_residual =
+                [&](int c,
+                    std::vector<Eigen::Vector6d, utility::Vector6d_allocator>
+                            &J_r,
+                    std::vector<double> &r, std::vector<double> &w) {
+                    int ii = corres[c].first;
+                    int jj = corres[c].second;
+                    const Eigen::Vector3d &p = point_cloud_vec[i].points_[ii];
+                    const Eigen::Vector3d &q = point_cloud_copy_j.points_[jj];
+                    Eigen::Vector3d rpq = p - q;
+
+                    double temp = par / (rpq.dot(rpq) + par);
+                    double s = temp * temp;
+
+                    J_r.resize(3);
+                    r.resize(3);
+                    w.assign(3, s);
+
+                    J_r[0].setZero();
+                    J_r[0](1) = -q(2);
+                    J_r[0](2) = q(1);
+                    J_r[0](3) = -1;
+                    r[0] = rpq(0);
+
+                    J_r[1].setZero();
+                    J_r[1](2) = -q(0);
+                    J_r[1](0) = q(2);
+                    J_r[1](4) = -1;
+                    r[1] = rpq(1);
+
+                    J_r[2].setZero();
+                    J_r[2](0) = -q(1);
+                    J_r[2](1) = q(0);
+                    J_r[2](5) = -1;
+                    r[2] = rpq(2);
+                };
+        Eigen::Matrix6d JTJ;
+        Eigen::Vector6d JTr;
+        double r2;
+        std::tie(JTJ, JTr, r2) =
+                utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
+                        compute_jacobian_and_residual, (int)corres.size(),
+                        false);
+
         bool success;
         Eigen::VectorXd result;
         std::tie(success, result) = utility::SolveLinearSystemPSD(-JTJ, JTr);
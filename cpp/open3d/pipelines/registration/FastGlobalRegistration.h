@@ -31,6 +31,8 @@
 #include <tuple>
 #include <vector>
 
+#include "open3d/pipelines/registration/Feature.h"
+
 namespace open3d {
 
 namespace geometry {
@@ -40,7 +42,6 @@ class PointCloud;
 namespace pipelines {
 namespace registration {
 
-class Feature;
 class RegistrationResult;
 
 /// \class FastGlobalRegistrationOption
@@ -61,20 +62,25 @@ public:
     /// \param iteration_number Maximum number of iterations.
     /// \param tuple_scale Similarity measure used for tuples of feature points.
     /// \param maximum_tuple_count Maximum numer of tuples.
+    /// \param feature_matching Nearest neighbor search used to match the
+    /// features.
     FastGlobalRegistrationOption(double division_factor = 1.4,
                                  bool use_absolute_scale = false,
                                  bool decrease_mu = true,
                                  double maximum_correspondence_distance = 0.025,
                                  int iteration_number = 64,
                                  double tuple_scale = 0.95,
-                                 int maximum_tuple_count = 1000)
+                                 int maximum_tuple_count = 1000,
+                                 const FeatureMatchingOption &feature_matching =
+                                         FeatureMatchingOption())
         : division_factor_(division_factor),
           use_absolute_scale_(use_absolute_scale),
           decrease_mu_(decrease_mu),
           maximum_correspondence_distance_(maximum_correspondence_distance),
           iteration_number_(iteration_number),
           tuple_scale_(tuple_scale),
-          maximum_tuple_count_(maximum_tuple_count) {}
+          maximum_tuple_count_(maximum_tuple_count),
+          feature_matching_(feature_matching) {}
     ~FastGlobalRegistrationOption() {}
 
 public:
@@ -95,6 +101,8 @@ public:
     double tuple_scale_;
     /// Maximum number of tuples..
     int maximum_tuple_count_;
+    /// Nearest neighbor search used to match the features.
+    FeatureMatchingOption feature_matching_;
 };
 
 RegistrationResult FastGlobalRegistration(
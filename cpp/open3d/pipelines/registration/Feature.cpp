@@ -24,9 +24,17 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4267)
+#endif
+
 #include "open3d/pipelines/registration/Feature.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <flann/flann.hpp>
+#include <limits>
 
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
@@ -70,90 +78,370 @@ static Eigen::Vector4d ComputePairFeatures(const Eigen::Vector3d &p1,
     return result;
 }
 
-static std::shared_ptr<Feature> ComputeSPFHFeature(
+/// Neighbors of all points in compressed sparse row layout. The neighbors of
+/// point i are stored from offsets_[i] to offsets_[i + 1]. The first neighbor
+/// is the point itself.
+struct Neighborhoods {
+    std::vector<int64_t> offsets_;
+    std::vector<int> indices_;
+    std::vector<float> distance2_;
+};
+
+/// Searches the neighbors of all points once. Points are processed in blocks
+/// which are copied into the shared arrays after the search.
+static Neighborhoods SearchNeighborhoods(
         const geometry::PointCloud &input,
         const geometry::KDTreeFlann &kdtree,
         const geometry::KDTreeSearchParam &search_param) {
-    auto feature = std::make_shared<Feature>();
-    feature->Resize(33, (int)input.points_.size());
+    const int64_t num_points = (int64_t)input.points_.size();
+    const int64_t block_size = 1024;
+    const int64_t num_blocks = (num_points + block_size - 1) / block_size;
+    std::vector<std::vector<int>> block_indices(num_blocks);
+    std::vector<std::vector<float>> block_distance2(num_blocks);
+
+    Neighborhoods neighborhoods;
+    neighborhoods.offsets_.resize(num_points + 1, 0);
+#pragma omp parallel
+    {
+        std::vector<int> indices;
+        std::vector<double> distance2;
+#pragma omp for schedule(dynamic)
+        for (int64_t b = 0; b < num_blocks; ++b) {
+            const int64_t end = std::min(num_points, (b + 1) * block_size);
+            for (int64_t i = b * block_size; i < end; ++i) {
+                const int count =
+                        std::max(0, kdtree.Search(input.points_[i],
+                                                  search_param, indices,
+                                                  distance2));
+                neighborhoods.offsets_[i + 1] = count;
+                block_indices[b].insert(block_indices[b].end(),
+                                        indices.begin(),
+                                        indices.begin() + count);
+                block_distance2[b].insert(block_distance2[b].end(),
+                                          distance2.begin(),
+                                          distance2.begin() + count);
+            }
+        }
+    }
+    for (int64_t i = 0; i < num_points; ++i) {
+        neighborhoods.offsets_[i + 1] += neighborhoods.offsets_[i];
+    }
+    neighborhoods.indices_.resize(neighborhoods.offsets_[num_points]);
+    neighborhoods.distance2_.resize(neighborhoods.offsets_[num_points]);
+#pragma omp parallel for schedule(static)
+    for (int64_t b = 0; b < num_blocks; ++b) {
+        const int64_t offset = neighborhoods.offsets_[b * block_size];
+        std::copy(block_indices[b].begin(), block_indices[b].end(),
+                  neighborhoods.indices_.begin() + offset);
+        std::copy(block_distance2[b].begin(), block_distance2[b].end(),
+                  neighborhoods.distance2_.begin() + offset);
+    }
+    return neighborhoods;
+}
+
+static Eigen::MatrixXf ComputeSPFHFeature(
+        const geometry::PointCloud &input, const Neighborhoods &neighborhoods) {
+    Eigen::MatrixXf feature = Eigen::MatrixXf::Zero(33, input.points_.size());
 #pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)input.points_.size(); i++) {
+    for (int64_t i = 0; i < (int64_t)input.points_.size(); i++) {
         const auto &point = input.points_[i];
         const auto &normal = input.normals_[i];
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
+        const int64_t begin = neighborhoods.offsets_[i];
+        const int64_t end = neighborhoods.offsets_[i + 1];
+        if (end - begin > 1) {
             // only compute SPFH feature when a point has neighbors
-            double hist_incr = 100.0 / (double)(indices.size() - 1);
-            for (size_t k = 1; k < indices.size(); k++) {
+            float hist_incr = 100.0f / (float)(end - begin - 1);
+            for (int64_t k = begin + 1; k < end; k++) {
                 // skip the point itself, compute histogram
-                auto pf = ComputePairFeatures(point, normal,
-                                              input.points_[indices[k]],
-                                              input.normals_[indices[k]]);
+                const int j = neighborhoods.indices_[k];
+                auto pf = ComputePairFeatures(point, normal, input.points_[j],
+                                              input.normals_[j]);
                 int h_index = (int)(floor(11 * (pf(0) + M_PI) / (2.0 * M_PI)));
                 if (h_index < 0) h_index = 0;
                 if (h_index >= 11) h_index = 10;
-                feature->data_(h_index, i) += hist_incr;
+                feature(h_index, i) += hist_incr;
                 h_index = (int)(floor(11 * (pf(1) + 1.0) * 0.5));
                 if (h_index < 0) h_index = 0;
                 if (h_index >= 11) h_index = 10;
-                feature->data_(h_index + 11, i) += hist_incr;
+                feature(h_index + 11, i) += hist_incr;
                 h_index = (int)(floor(11 * (pf(2) + 1.0) * 0.5));
                 if (h_index < 0) h_index = 0;
                 if (h_index >= 11) h_index = 10;
-                feature->data_(h_index + 22, i) += hist_incr;
+                feature(h_index + 22, i) += hist_incr;
             }
         }
     }
     return feature;
 }
 
-std::shared_ptr<Feature> ComputeFPFHFeature(
+Eigen::MatrixXf ComputeFPFHFeatureFloat(
         const geometry::PointCloud &input,
         const geometry::KDTreeSearchParam
                 &search_param /* = geometry::KDTreeSearchParamKNN()*/) {
-    auto feature = std::make_shared<Feature>();
-    feature->Resize(33, (int)input.points_.size());
     if (!input.HasNormals()) {
         utility::LogError(
                 "[ComputeFPFHFeature] Failed because input point cloud has no "
                 "normal.");
     }
     geometry::KDTreeFlann kdtree(input);
-    auto spfh = ComputeSPFHFeature(input, kdtree, search_param);
+    // The neighborhoods are shared by the SPFH and the weighting pass.
+    const Neighborhoods neighborhoods =
+            SearchNeighborhoods(input, kdtree, search_param);
+    const Eigen::MatrixXf spfh = ComputeSPFHFeature(input, neighborhoods);
+    Eigen::MatrixXf feature = Eigen::MatrixXf::Zero(33, input.points_.size());
 #pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)input.points_.size(); i++) {
-        const auto &point = input.points_[i];
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
-            double sum[3] = {0.0, 0.0, 0.0};
-            for (size_t k = 1; k < indices.size(); k++) {
+    for (int64_t i = 0; i < (int64_t)input.points_.size(); i++) {
+        const int64_t begin = neighborhoods.offsets_[i];
+        const int64_t end = neighborhoods.offsets_[i + 1];
+        if (end - begin > 1) {
+            Eigen::Matrix<float, 33, 1> hist =
+                    Eigen::Matrix<float, 33, 1>::Zero();
+            for (int64_t k = begin + 1; k < end; k++) {
                 // skip the point itself
-                double dist = distance2[k];
-                if (dist == 0.0) continue;
-                for (int j = 0; j < 33; j++) {
-                    double val = spfh->data_(j, indices[k]) / dist;
-                    sum[j / 11] += val;
-                    feature->data_(j, i) += val;
-                }
+                const float dist = neighborhoods.distance2_[k];
+                if (dist == 0.0f) continue;
+                hist += spfh.col(neighborhoods.indices_[k]) / dist;
             }
-            for (int j = 0; j < 3; j++)
-                if (sum[j] != 0.0) sum[j] = 100.0 / sum[j];
-            for (int j = 0; j < 33; j++) {
-                feature->data_(j, i) *= sum[j / 11];
-                // The commented line is the fpfh function in the paper.
-                // But according to PCL implementation, it is skipped.
-                // Our initial test shows that the full fpfh function in the
-                // paper seems to be better than PCL implementation. Further
-                // test required.
-                feature->data_(j, i) += spfh->data_(j, i);
+            for (int j = 0; j < 3; j++) {
+                const float sum = hist.segment<11>(11 * j).sum();
+                if (sum != 0.0f) hist.segment<11>(11 * j) *= 100.0f / sum;
             }
+            // The commented line is the fpfh function in the paper.
+            // But according to PCL implementation, it is skipped.
+            // Our initial test shows that the full fpfh function in the
+            // paper seems to be better than PCL implementation. Further
+            // test required.
+            feature.col(i) = hist + spfh.col(i);
         }
     }
     return feature;
 }
 
+std::shared_ptr<Feature> ComputeFPFHFeature(
+        const geometry::PointCloud &input,
+        const geometry::KDTreeSearchParam
+                &search_param /* = geometry::KDTreeSearchParamKNN()*/) {
+    auto feature = std::make_shared<Feature>();
+    feature->data_ =
+            ComputeFPFHFeatureFloat(input, search_param).cast<double>();
+    return feature;
+}
+
+/// Nearest column of \p data for every column of \p queries, with a flann
+/// index built from \p index_params. Blocks of queries are searched in
+/// parallel.
+static std::vector<int> SearchNearestFlann(
+        const Eigen::MatrixXf &data,
+        const Eigen::MatrixXf &queries,
+        const flann::IndexParams &index_params,
+        const flann::SearchParams &search_params) {
+    flann::Matrix<float> dataset((float *)data.data(), data.cols(),
+                                 data.rows());
+    flann::Index<flann::L2<float>> index(dataset, index_params);
+    index.buildIndex();
+
+    const int64_t num_queries = queries.cols();
+    const int64_t block_size = 1024;
+    const int64_t num_blocks = (num_queries + block_size - 1) / block_size;
+    std::vector<int> nearest(num_queries, -1);
+#pragma omp parallel for schedule(dynamic)
+    for (int64_t block = 0; block < num_blocks; block++) {
+        const int64_t begin = block * block_size;
+        const int64_t count = std::min(block_size, num_queries - begin);
+        std::vector<float> distance2(count);
+        flann::Matrix<float> query_flann((float *)queries.col(begin).data(),
+                                         count, queries.rows());
+        flann::Matrix<int> indices_flann(nearest.data() + begin, count, 1);
+        flann::Matrix<float> dists_flann(distance2.data(), count, 1);
+        index.knnSearch(query_flann, indices_flann, dists_flann, 1,
+                        search_params);
+    }
+    return nearest;
+}
+
+/// Nearest target column of every source column by blocks of the squared
+/// distance matrix, which Eigen computes as a vectorized matrix product. If
+/// \p target_to_source is given, the nearest source column of every target
+/// column is found from the same blocks.
+static void SearchNearestBruteForce(const Eigen::MatrixXf &source,
+                                    const Eigen::MatrixXf &target,
+                                    std::vector<int> &source_to_target,
+                                    std::vector<int> *target_to_source) {
+    const int64_t num_source = source.cols();
+    const int64_t num_target = target.cols();
+    const Eigen::RowVectorXf source_norm2 = source.colwise().squaredNorm();
+    const Eigen::VectorXf target_norm2 =
+            target.colwise().squaredNorm().transpose();
+    const int64_t block_size = 256;
+    const int64_t num_blocks = (num_source + block_size - 1) / block_size;
+    const float inf = std::numeric_limits<float>::infinity();
+    source_to_target.assign(num_source, -1);
+    std::vector<float> target_distance2;
+    if (target_to_source) {
+        target_to_source->assign(num_target, -1);
+        target_distance2.assign(num_target, inf);
+    }
+
+#pragma omp parallel
+    {
+        // Rows are targets and columns are sources.
+        Eigen::MatrixXf distance2;
+        std::vector<int> target_to_source_local;
+        std::vector<float> target_distance2_local;
+        if (target_to_source) {
+            target_to_source_local.assign(num_target, -1);
+            target_distance2_local.assign(num_target, inf);
+        }
+#pragma omp for schedule(dynamic)
+        for (int64_t block = 0; block < num_blocks; block++) {
+            const int64_t begin = block * block_size;
+            const int64_t count = std::min(block_size, num_source - begin);
+            Eigen::VectorXf source_distance2 =
+                    Eigen::VectorXf::Constant(count, inf);
+            for (int64_t t_begin = 0; t_begin < num_target;
+                 t_begin += block_size) {
+                const int64_t t_count =
+                        std::min(block_size, num_target - t_begin);
+                // |s - t|^2 = |s|^2 + |t|^2 - 2 t.s
+                distance2.noalias() =
+                        -2.0f * target.middleCols(t_begin, t_count)
+                                        .transpose() *
+                        source.middleCols(begin, count);
+                distance2.colwise() += target_norm2.segment(t_begin, t_count);
+                distance2.rowwise() += source_norm2.segment(begin, count);
+                for (int64_t c = 0; c < count; c++) {
+                    for (int64_t r = 0; r < t_count; r++) {
+                        const float d = distance2(r, c);
+                        if (d < source_distance2(c)) {
+                            source_distance2(c) = d;
+                            source_to_target[begin + c] = int(t_begin + r);
+                        }
+                        if (target_to_source &&
+                            d < target_distance2_local[t_begin + r]) {
+                            target_distance2_local[t_begin + r] = d;
+                            target_to_source_local[t_begin + r] =
+                                    int(begin + c);
+                        }
+                    }
+                }
+            }
+        }
+        if (target_to_source) {
+#pragma omp critical
+            {
+                // Ties go to the smaller index, as in the serial order.
+                for (int64_t j = 0; j < num_target; j++) {
+                    const int i = target_to_source_local[j];
+                    const float d = target_distance2_local[j];
+                    if (i >= 0 && (d < target_distance2[j] ||
+                                   (d == target_distance2[j] &&
+                                    i < (*target_to_source)[j]))) {
+                        target_distance2[j] = d;
+                        (*target_to_source)[j] = i;
+                    }
+                }
+            }
+        }
+    }
+}
+
+/// Nearest source column of every target column that is the nearest neighbor
+/// of some source column. Other targets are -1. Only the matched targets are
+/// searched.
+template <typename SearchFunction>
+static std::vector<int> SearchNearestOfMatched(
+        const Eigen::MatrixXf &target,
+        const std::vector<int> &source_to_target,
+        SearchFunction search) {
+    std::vector<char> is_matched(target.cols(), 0);
+    for (int j : source_to_target) {
+        if (j >= 0) is_matched[j] = 1;
+    }
+    std::vector<int> matched;
+    for (int j = 0; j < int(target.cols()); j++) {
+        if (is_matched[j]) matched.push_back(j);
+    }
+    Eigen::MatrixXf queries(target.rows(), matched.size());
+#pragma omp parallel for schedule(static)
+    for (int k = 0; k < int(matched.size()); k++) {
+        queries.col(k) = target.col(matched[k]);
+    }
+    const std::vector<int> nearest = search(queries);
+    std::vector<int> target_to_source(target.cols(), -1);
+    for (int k = 0; k < int(matched.size()); k++) {
+        target_to_source[matched[k]] = nearest[k];
+    }
+    return target_to_source;
+}
+
+CorrespondenceSet CorrespondencesFromFeatures(
+        const Feature &source_feature,
+        const Feature &target_feature,
+        bool mutual_filter /* = false*/,
+        const FeatureMatchingOption &option /* = FeatureMatchingOption()*/) {
+    if (source_feature.Dimension() != target_feature.Dimension()) {
+        utility::LogError(
+                "[CorrespondencesFromFeatures] Feature dimensions {:d} and "
+                "{:d} do not match.",
+                source_feature.Dimension(), target_feature.Dimension());
+    }
+    CorrespondenceSet corres;
+    if (source_feature.Num() == 0 || target_feature.Num() == 0) {
+        return corres;
+    }
+
+    const Eigen::MatrixXf source = source_feature.data_.cast<float>();
+    const Eigen::MatrixXf target = target_feature.data_.cast<float>();
+    std::vector<int> source_to_target;
+    std::vector<int> target_to_source;
+    if (option.method_ == FeatureMatchingMethod::BruteForce) {
+        SearchNearestBruteForce(source, target, source_to_target,
+                                mutual_filter ? &target_to_source : nullptr);
+    } else {
+        if (option.epsilon_ < 0.0) {
+            utility::LogError(
+                    "[CorrespondencesFromFeatures] epsilon must not be "
+                    "negative.");
+        }
+        flann::IndexParams index_params;
+        flann::SearchParams search_params(-1, float(option.epsilon_));
+        if (option.method_ == FeatureMatchingMethod::KDForest) {
+            if (option.num_trees_ <= 0 || option.checks_ <= 0) {
+                utility::LogError(
+                        "[CorrespondencesFromFeatures] num_trees and checks "
+                        "must be positive.");
+            }
+            index_params = flann::KDTreeIndexParams(option.num_trees_);
+            search_params.checks = option.checks_;
+        } else {
+            index_params = flann::KDTreeSingleIndexParams(15);
+        }
+        source_to_target = SearchNearestFlann(target, source, index_params,
+                                              search_params);
+        if (mutual_filter) {
+            target_to_source = SearchNearestOfMatched(
+                    target, source_to_target,
+                    [&](const Eigen::MatrixXf &queries) {
+                        return SearchNearestFlann(source, queries,
+                                                  index_params, search_params);
+                    });
+        }
+    }
+
+    for (int i = 0; i < int(source_to_target.size()); i++) {
+        const int j = source_to_target[i];
+        if (j < 0 || (mutual_filter && target_to_source[j] != i)) {
+            continue;
+        }
+        corres.emplace_back(i, j);
+    }
+    return corres;
+}
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
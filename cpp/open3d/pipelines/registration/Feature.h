@@ -31,6 +31,7 @@
 #include <vector>
 
 #include "open3d/geometry/KDTreeSearchParam.h"
+#include "open3d/pipelines/registration/TransformationEstimation.h"
 
 namespace open3d {
 
@@ -73,6 +74,76 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
         const geometry::KDTreeSearchParam &search_param =
                 geometry::KDTreeSearchParamKNN());
 
+/// Function to compute FPFH feature for a point cloud in single precision.
+/// The neighbors of each point are searched once and shared by both passes.
+///
+/// \param input The Input point cloud.
+/// \param search_param KDTree KNN search parameter.
+/// \return 33 x N matrix with the feature of point i in column i.
+Eigen::MatrixXf ComputeFPFHFeatureFloat(
+        const geometry::PointCloud &input,
+        const geometry::KDTreeSearchParam &search_param =
+                geometry::KDTreeSearchParamKNN());
+
+/// \brief Nearest neighbor search used to match features.
+enum class FeatureMatchingMethod {
+    /// Search with a single KDTree.
+    KDTree = 0,
+    /// Approximate search with a forest of randomized KDTrees.
+    KDForest = 1,
+    /// Exact search by blocked single precision distance matrices.
+    BruteForce = 2,
+};
+
+/// \class FeatureMatchingOption
+///
+/// \brief Options for CorrespondencesFromFeatures.
+class FeatureMatchingOption {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param method Nearest neighbor search method.
+    /// \param epsilon Relative distance error allowed by the KDTree and
+    /// KDForest methods. 0 gives the exact nearest neighbor with a KDTree.
+    /// \param num_trees Number of randomized trees of the KDForest method.
+    /// \param checks Number of leaves visited per query by the KDForest
+    /// method. Larger values trade speed for recall.
+    FeatureMatchingOption(
+            FeatureMatchingMethod method = FeatureMatchingMethod::KDTree,
+            double epsilon = 0.0,
+            int num_trees = 4,
+            int checks = 128)
+        : method_(method),
+          epsilon_(epsilon),
+          num_trees_(num_trees),
+          checks_(checks) {}
+    ~FeatureMatchingOption() {}
+
+public:
+    /// Nearest neighbor search method.
+    FeatureMatchingMethod method_;
+    /// Relative distance error allowed by the KDTree and KDForest methods.
+    double epsilon_;
+    /// Number of randomized trees of the KDForest method.
+    int num_trees_;
+    /// Number of leaves visited per query by the KDForest method.
+    int checks_;
+};
+
+/// Function to find the nearest target feature of every source feature.
+///
+/// \param source_feature Source features.
+/// \param target_feature Target features.
+/// \param mutual_filter Only keeps the pairs where the source point is also
+/// the nearest neighbor of its target point.
+/// \param option Nearest neighbor search options.
+/// \return Pairs (source index, target index) ordered by source index.
+CorrespondenceSet CorrespondencesFromFeatures(
+        const Feature &source_feature,
+        const Feature &target_feature,
+        bool mutual_filter = false,
+        const FeatureMatchingOption &option = FeatureMatchingOption());
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
@@ -284,51 +284,16 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
                 &checkers /* = {}*/,
         const RANSACConvergenceCriteria &criteria
-        /* = RANSACConvergenceCriteria()*/) {
+        /* = RANSACConvergenceCriteria()*/,
+        const FeatureMatchingOption &matching_option
+        /* = FeatureMatchingOption()*/) {
     if (ransac_n < 3 || max_correspondence_distance <= 0.0) {
         return RegistrationResult();
     }
 
-    int num_src_pts = int(source.points_.size());
-    int num_tgt_pts = int(target.points_.size());
-
-    geometry::KDTreeFlann kdtree_target(target_feature);
-    pipelines::registration::CorrespondenceSet corres_ij(num_src_pts);
-
-#pragma omp parallel for
-    for (int i = 0; i < num_src_pts; i++) {
-        std::vector<int> corres_tmp(1);
-        std::vector<double> dist_tmp(1);
-
-        kdtree_target.SearchKNN(Eigen::VectorXd(source_feature.data_.col(i)), 1,
-                                corres_tmp, dist_tmp);
-        int j = corres_tmp[0];
-        corres_ij[i] = Eigen::Vector2i(i, j);
-    }
-
-    // Do reverse check if mutual_filter is enabled
     if (mutual_filter) {
-        geometry::KDTreeFlann kdtree_source(source_feature);
-        pipelines::registration::CorrespondenceSet corres_ji(num_tgt_pts);
-
-#pragma omp parallel for
-        for (int j = 0; j < num_tgt_pts; ++j) {
-            std::vector<int> corres_tmp(1);
-            std::vector<double> dist_tmp(1);
-            kdtree_source.SearchKNN(
-                    Eigen::VectorXd(target_feature.data_.col(j)), 1, corres_tmp,
-                    dist_tmp);
-            int i = corres_tmp[0];
-            corres_ji[j] = Eigen::Vector2i(i, j);
-        }
-
-        pipelines::registration::CorrespondenceSet corres_mutual;
-        for (int i = 0; i < num_src_pts; ++i) {
-            int j = corres_ij[i](1);
-            if (corres_ji[j](0) == i) {
-                corres_mutual.emplace_back(i, j);
-            }
-        }
+        CorrespondenceSet corres_mutual = CorrespondencesFromFeatures(
+                source_feature, target_feature, true, matching_option);
 
         // Empirically mutual correspondence set should not be too small
         if (int(corres_mutual.size()) >= ransac_n * 3) {
@@ -343,6 +308,8 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
                 "original correspondences.");
     }
 
+    CorrespondenceSet corres_ij = CorrespondencesFromFeatures(
+            source_feature, target_feature, false, matching_option);
     return RegistrationRANSACBasedOnCorrespondence(
             source, target, corres_ij, max_correspondence_distance, estimation,
             ransac_n, checkers, criteria);
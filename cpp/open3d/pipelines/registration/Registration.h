@@ -31,6 +31,7 @@
 #include <vector>
 
 #include "open3d/pipelines/registration/CorrespondenceChecker.h"
+#include "open3d/pipelines/registration/Feature.h"
 #include "open3d/pipelines/registration/TransformationEstimation.h"
 #include "open3d/utility/Eigen.h"
 
@@ -42,7 +43,6 @@ class PointCloud;
 
 namespace pipelines {
 namespace registration {
-class Feature;
 
 /// \class ICPConvergenceCriteria
 ///
@@ -211,6 +211,8 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
 /// \param ransac_n Fit ransac with `ransac_n` correspondences.
 /// \param checkers Correspondence checker.
 /// \param criteria Convergence criteria.
+/// \param matching_option Nearest neighbor search options of the feature
+/// matching.
 RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -224,7 +226,9 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
                 &checkers = {},
         const RANSACConvergenceCriteria &criteria =
-                RANSACConvergenceCriteria());
+                RANSACConvergenceCriteria(),
+        const FeatureMatchingOption &matching_option =
+                FeatureMatchingOption());
 
 /// \param source The source point cloud.
 /// \param target The target point cloud.
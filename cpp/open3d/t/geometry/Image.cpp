@@ -26,9 +26,12 @@
 
 #include "open3d/t/geometry/Image.h"
 
+#include <cmath>
+
 #include "open3d/core/Dtype.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/kernel/Image.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
@@ -69,6 +72,243 @@ Image::Image(const core::Tensor &tensor)
     }
 }
 
+static void AssertImageDtype(const std::string &func_name,
+                             core::Dtype dtype) {
+    if (dtype != core::Dtype::UInt8 && dtype != core::Dtype::UInt16 &&
+        dtype != core::Dtype::Float32) {
+        utility::LogError(
+                "[{}] Unsupported dtype {}, UInt8, UInt16 or Float32 "
+                "expected.",
+                func_name, dtype.ToString());
+    }
+}
+
+static void AssertOddKernelSize(const std::string &func_name,
+                                int kernel_size) {
+    if (kernel_size < 1 || kernel_size % 2 == 0) {
+        utility::LogError("[{}] Kernel size must be odd and positive, but got "
+                          "{}.",
+                          func_name, kernel_size);
+    }
+}
+
+Image Image::To(core::Dtype dtype, double scale, double offset) const {
+    AssertImageDtype("Image::To", GetDtype());
+    AssertImageDtype("Image::To", dtype);
+
+    core::Tensor src = data_.Contiguous();
+    core::Tensor dst(data_.GetShape(), dtype, GetDevice());
+    kernel::image::To(src, dst, scale, offset);
+    return Image(dst);
+}
+
+Image Image::ClipTransform(float scale,
+                           float min_value,
+                           float max_value,
+                           float clip_fill) const {
+    AssertImageDtype("Image::ClipTransform", GetDtype());
+    if (GetChannels() != 1) {
+        utility::LogError(
+                "[Image::ClipTransform] Expected a 1-channel image, but got "
+                "{} channels.",
+                GetChannels());
+    }
+    if (scale <= 0) {
+        utility::LogError("[Image::ClipTransform] scale must be > 0, but got "
+                          "{}.",
+                          scale);
+    }
+
+    core::Tensor src = data_.Contiguous();
+    core::Tensor dst(data_.GetShape(), core::Dtype::Float32, GetDevice());
+    kernel::image::ClipTransform(src, dst, scale, min_value, max_value,
+                                 clip_fill);
+    return Image(dst);
+}
+
+Image Image::RGBToGray() const {
+    AssertImageDtype("Image::RGBToGray", GetDtype());
+    if (GetChannels() != 3) {
+        utility::LogError(
+                "[Image::RGBToGray] Expected a 3-channel image, but got {} "
+                "channels.",
+                GetChannels());
+    }
+
+    core::Tensor src = data_.Contiguous();
+    core::Tensor dst({GetRows(), GetCols(), 1}, GetDtype(), GetDevice());
+    kernel::image::RGBToGray(src, dst);
+    return Image(dst);
+}
+
+Image Image::Resize(float sampling_rate, InterpType interp_type) const {
+    AssertImageDtype("Image::Resize", GetDtype());
+    int64_t rows = static_cast<int64_t>(GetRows() * sampling_rate);
+    int64_t cols = static_cast<int64_t>(GetCols() * sampling_rate);
+    if (rows <= 0 || cols <= 0) {
+        utility::LogError(
+                "[Image::Resize] Sampling rate {} results in an empty image.",
+                sampling_rate);
+    }
+
+    core::Tensor src = data_.Contiguous();
+    core::Tensor dst({rows, cols, GetChannels()}, GetDtype(), GetDevice());
+    kernel::image::Resize(src, dst, interp_type);
+    return Image(dst);
+}
+
+Image Image::FilterGaussian(int kernel_size, float sigma) const {
+    AssertImageDtype("Image::FilterGaussian", GetDtype());
+    AssertOddKernelSize("Image::FilterGaussian", kernel_size);
+    if (sigma <= 0) {
+        utility::LogError(
+                "[Image::FilterGaussian] sigma must be > 0, but got {}.",
+                sigma);
+    }
+
+    std::vector<float> weights(kernel_size);
+    float sum = 0;
+    for (int i = 0; i < kernel_size; ++i) {
+        float x = static_cast<float>(i - kernel_size / 2);
+        weights[i] = std::exp(-x * x / (2 * sigma * sigma));
+        sum += weights[i];
+    }
+    for (float &w : weights) {
+        w /= sum;
+    }
+    core::Tensor kernel(weights, {kernel_size}, core::Dtype::Float32,
+                        GetDevice());
+
+    core::Tensor src = data_.Contiguous();
+    core::Tensor dst(data_.GetShape(), GetDtype(), GetDevice());
+    kernel::image::FilterSeparable(src, dst, kernel, kernel, 1);
+    return Image(dst);
+}
+
+Image Image::FilterBilateral(int kernel_size,
+                             float value_sigma,
+                             float distance_sigma) const {
+    AssertImageDtype("Image::FilterBilateral", GetDtype());
+    AssertOddKernelSize("Image::FilterBilateral", kernel_size);
+    if (value_sigma <= 0 || distance_sigma <= 0) {
+        utility::LogError(
+                "[Image::FilterBilateral] value_sigma and distance_sigma must "
+                "be > 0, but got {} and {}.",
+                value_sigma, distance_sigma);
+    }
+
+    core::Tensor src = data_.Contiguous();
+    core::Tensor dst(data_.GetShape(), GetDtype(), GetDevice());
+    kernel::image::FilterBilateral(src, dst, kernel_size, value_sigma,
+                                   distance_sigma);
+    return Image(dst);
+}
+
+std::pair<Image, Image> Image::FilterSobel(int kernel_size) const {
+    AssertImageDtype("Image::FilterSobel", GetDtype());
+    if (GetChannels() != 1) {
+        utility::LogError(
+                "[Image::FilterSobel] Expected a 1-channel image, but got {} "
+                "channels.",
+                GetChannels());
+    }
+
+    std::vector<float> smooth, derivative;
+    if (kernel_size == 3) {
+        smooth = {1, 2, 1};
+        derivative = {-1, 0, 1};
+    } else if (kernel_size == 5) {
+        smooth = {1, 4, 6, 4, 1};
+        derivative = {-1, -2, 0, 2, 1};
+    } else {
+        utility::LogError(
+                "[Image::FilterSobel] Kernel size must be 3 or 5, but got {}.",
+                kernel_size);
+    }
+    core::Tensor smooth_kernel(smooth, {kernel_size}, core::Dtype::Float32,
+                               GetDevice());
+    core::Tensor derivative_kernel(derivative, {kernel_size},
+                                   core::Dtype::Float32, GetDevice());
+
+    core::Tensor src = data_.Contiguous();
+    core::Tensor dx(data_.GetShape(), core::Dtype::Float32, GetDevice());
+    core::Tensor dy(data_.GetShape(), core::Dtype::Float32, GetDevice());
+    kernel::image::FilterSeparable(src, dx, smooth_kernel, derivative_kernel,
+                                   1);
+    kernel::image::FilterSeparable(src, dy, derivative_kernel, smooth_kernel,
+                                   1);
+    return std::make_pair(Image(dx), Image(dy));
+}
+
+Image Image::PyrDown() const {
+    AssertImageDtype("Image::PyrDown", GetDtype());
+    if (GetRows() < 2 || GetCols() < 2) {
+        utility::LogError("[Image::PyrDown] Image of size {}x{} is too small.",
+                          GetRows(), GetCols());
+    }
+
+    core::Tensor kernel(std::vector<float>{1 / 16.0f, 4 / 16.0f, 6 / 16.0f,
+                                           4 / 16.0f, 1 / 16.0f},
+                        {5}, core::Dtype::Float32, GetDevice());
+
+    core::Tensor src = data_.Contiguous();
+    core::Tensor dst({GetRows() / 2, GetCols() / 2, GetChannels()},
+                     GetDtype(), GetDevice());
+    kernel::image::FilterSeparable(src, dst, kernel, kernel, 2);
+    return Image(dst);
+}
+
+Image Image::PyrDownDepth(float diff_threshold, float invalid_fill) const {
+    if (GetDtype() != core::Dtype::Float32 || GetChannels() != 1) {
+        utility::LogError(
+                "[Image::PyrDownDepth] Expected a 1-channel Float32 image, "
+                "but got {} channels of {}.",
+                GetChannels(), GetDtype().ToString());
+    }
+    if (GetRows() < 2 || GetCols() < 2) {
+        utility::LogError(
+                "[Image::PyrDownDepth] Image of size {}x{} is too small.",
+                GetRows(), GetCols());
+    }
+
+    core::Tensor src = data_.Contiguous();
+    core::Tensor dst({GetRows() / 2, GetCols() / 2, 1}, core::Dtype::Float32,
+                     GetDevice());
+    kernel::image::PyrDownDepth(src, dst, diff_threshold, invalid_fill);
+    return Image(dst);
+}
+
+Image Image::CreateVertexMap(const core::Tensor &intrinsics,
+                             float invalid_fill) const {
+    if (GetDtype() != core::Dtype::Float32 || GetChannels() != 1) {
+        utility::LogError(
+                "[Image::CreateVertexMap] Expected a 1-channel Float32 depth "
+                "image, but got {} channels of {}.",
+                GetChannels(), GetDtype().ToString());
+    }
+    intrinsics.AssertShape({3, 3});
+
+    core::Tensor src = data_.Contiguous();
+    core::Tensor dst({GetRows(), GetCols(), 3}, core::Dtype::Float32,
+                     GetDevice());
+    kernel::image::CreateVertexMap(src, intrinsics, dst, invalid_fill);
+    return Image(dst);
+}
+
+Image Image::CreateNormalMap(float invalid_fill) const {
+    if (GetDtype() != core::Dtype::Float32 || GetChannels() != 3) {
+        utility::LogError(
+                "[Image::CreateNormalMap] Expected a 3-channel Float32 vertex "
+                "map, but got {} channels of {}.",
+                GetChannels(), GetDtype().ToString());
+    }
+
+    core::Tensor src = data_.Contiguous();
+    core::Tensor dst(data_.GetShape(), core::Dtype::Float32, GetDevice());
+    kernel::image::CreateNormalMap(src, dst, invalid_fill);
+    return Image(dst);
+}
+
 Image Image::FromLegacyImage(const open3d::geometry::Image &image_legacy,
                              const core::Device &device) {
     static const std::unordered_map<int, core::Dtype> kBytesToDtypeMap = {
@@ -28,6 +28,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "open3d/core/Tensor.h"
@@ -44,6 +45,12 @@ namespace geometry {
 /// dtype and device.
 class Image : public Geometry {
 public:
+    /// \brief Interpolation type used by Resize.
+    enum class InterpType {
+        Nearest = 0,  ///< Nearest neighbor.
+        Linear = 1,   ///< Bilinear.
+    };
+
     /// \brief Constructor for image.
     ///
     /// Row-major storage is used, similar to OpenCV. Use (row, col, channel)
@@ -141,6 +148,84 @@ public:
                             core::Dtype::Int64);
     };
 
+public:
+    /// The image processing functions below run in parallel on the device of
+    /// the image and return new images on the same device. Unless stated
+    /// otherwise, they support UInt8, UInt16 and Float32 images with any
+    /// number of channels, and replicate border pixels.
+
+    /// \brief Returns a copy of the image converted to \p dtype.
+    ///
+    /// Each value is transformed to value * \p scale + \p offset, rounded and
+    /// saturated for integer dtypes. E.g. use scale = 1 / 255 to map UInt8
+    /// colors to Float32 values in [0, 1].
+    Image To(core::Dtype dtype, double scale = 1.0, double offset = 0.0) const;
+
+    /// \brief Converts a 1-channel depth image to Float32 depth in meters.
+    ///
+    /// Each value is divided by \p scale. Values outside (\p min_value,
+    /// \p max_value] are replaced by \p clip_fill.
+    Image ClipTransform(float scale,
+                        float min_value,
+                        float max_value,
+                        float clip_fill = 0.0f) const;
+
+    /// \brief Converts a 3-channel RGB image to a 1-channel grayscale image of
+    /// the same dtype.
+    Image RGBToGray() const;
+
+    /// \brief Resizes the image, scaling rows and cols by \p sampling_rate.
+    Image Resize(float sampling_rate = 0.5f,
+                 InterpType interp_type = InterpType::Nearest) const;
+
+    /// \brief Gaussian filter with an odd \p kernel_size, applied as two
+    /// separable 1D passes.
+    Image FilterGaussian(int kernel_size = 3, float sigma = 1.0f) const;
+
+    /// \brief Bilateral filter with an odd \p kernel_size.
+    ///
+    /// \param value_sigma Standard deviation of the value difference, in
+    /// units of the pixel values.
+    /// \param distance_sigma Standard deviation of the spatial distance, in
+    /// pixels.
+    Image FilterBilateral(int kernel_size = 3,
+                          float value_sigma = 20.0f,
+                          float distance_sigma = 10.0f) const;
+
+    /// \brief Sobel gradients of a 1-channel image with \p kernel_size 3 or 5.
+    ///
+    /// Returns the unnormalized Float32 gradients {dx, dy} along cols and
+    /// rows respectively.
+    std::pair<Image, Image> FilterSobel(int kernel_size = 3) const;
+
+    /// \brief Gaussian pyramid downsampling: a 5x5 Gaussian ([1 4 6 4 1] / 16)
+    /// evaluated at every other pixel. The result has {rows / 2, cols / 2}.
+    Image PyrDown() const;
+
+    /// \brief Edge-preserving pyramid downsampling of a Float32 depth image.
+    ///
+    /// Each output pixel averages the valid (positive) depths of its 2x2
+    /// block that are within \p diff_threshold of the first valid one, so
+    /// that depth discontinuities are not blurred. Pixels without valid depth
+    /// are set to \p invalid_fill.
+    Image PyrDownDepth(float diff_threshold, float invalid_fill = 0.0f) const;
+
+    /// \brief Unprojects a Float32 depth image (in meters) to a 3-channel
+    /// Float32 vertex map in the camera frame.
+    ///
+    /// \param intrinsics 3x3 pinhole camera matrix.
+    /// \param invalid_fill Value for pixels without positive depth.
+    Image CreateVertexMap(const core::Tensor &intrinsics,
+                          float invalid_fill = 0.0f) const;
+
+    /// \brief Computes unit normals of a vertex map from forward differences
+    /// with the right and bottom neighbors.
+    ///
+    /// Pixels with an invalid (non-positive depth) vertex in that stencil and
+    /// the last row and column are set to \p invalid_fill.
+    Image CreateNormalMap(float invalid_fill = 0.0f) const;
+
+public:
     /// Create from a legacy Open3D Image.
     static Image FromLegacyImage(
             const open3d::geometry::Image &image_legacy,
@@ -27,8 +27,10 @@
 #include "open3d/t/geometry/PointCloud.h"
 
 #include <Eigen/Core>
+#include <cmath>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/core/EigenConverter.h"
 #include "open3d/core/ShapeUtil.h"
@@ -37,6 +39,7 @@
 #include "open3d/core/kernel/Kernel.h"
 #include "open3d/core/linalg/Matmul.h"
 #include "open3d/t/geometry/TensorMap.h"
+#include "open3d/utility/Helper.h"
 
 namespace open3d {
 namespace t {
@@ -135,6 +138,103 @@ PointCloud &PointCloud::Rotate(const core::Tensor &R,
     return *this;
 }
 
+PointCloud PointCloud::VoxelDownSample(double voxel_size) const {
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size must be positive, but got {}.",
+                          voxel_size);
+    }
+    if (!HasPoints()) {
+        return PointCloud(device_);
+    }
+
+    core::Device host("CPU:0");
+    core::Tensor points =
+            GetPoints().Copy(host).To(core::Dtype::Float64).Contiguous();
+    const double *points_ptr = static_cast<const double *>(points.GetDataPtr());
+    int64_t num_points = points.GetLength();
+
+    Eigen::Vector3d min_bound(points_ptr[0], points_ptr[1], points_ptr[2]);
+    for (int64_t i = 1; i < num_points; ++i) {
+        min_bound = min_bound.cwiseMin(
+                Eigen::Map<const Eigen::Vector3d>(points_ptr + 3 * i));
+    }
+    std::vector<Eigen::Vector3i> voxel_coords(num_points);
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_points; ++i) {
+        for (int k = 0; k < 3; ++k) {
+            voxel_coords[i](k) = static_cast<int>(
+                    std::floor((points_ptr[3 * i + k] - min_bound(k)) /
+                               voxel_size));
+        }
+    }
+
+    // Assign voxel indices in order of first occurrence.
+    std::unordered_map<Eigen::Vector3i, int64_t,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            voxel_to_index;
+    std::vector<int64_t> point_to_voxel(num_points);
+    std::vector<int64_t> voxel_counts;
+    for (int64_t i = 0; i < num_points; ++i) {
+        auto it = voxel_to_index.emplace(
+                voxel_coords[i], static_cast<int64_t>(voxel_counts.size()));
+        if (it.second) {
+            voxel_counts.push_back(0);
+        }
+        point_to_voxel[i] = it.first->second;
+        voxel_counts[it.first->second]++;
+    }
+    int64_t num_voxels = static_cast<int64_t>(voxel_counts.size());
+
+    PointCloud pcd(device_);
+    for (const auto &kv : point_attr_) {
+        const core::Tensor &attr = kv.second;
+        if (attr.GetLength() != num_points) {
+            continue;
+        }
+        core::SizeVector shape = attr.GetShape();
+        int64_t stride = attr.NumElements() / num_points;
+        core::Tensor values = attr.Copy(host)
+                                      .To(core::Dtype::Float64)
+                                      .Contiguous()
+                                      .Reshape({num_points, stride});
+        const double *values_ptr =
+                static_cast<const double *>(values.GetDataPtr());
+
+        core::Tensor sums = core::Tensor::Zeros({num_voxels, stride},
+                                                core::Dtype::Float64, host);
+        double *sums_ptr = static_cast<double *>(sums.GetDataPtr());
+        for (int64_t i = 0; i < num_points; ++i) {
+            double *sum = sums_ptr + point_to_voxel[i] * stride;
+            const double *value = values_ptr + i * stride;
+            for (int64_t k = 0; k < stride; ++k) {
+                sum[k] += value[k];
+            }
+        }
+
+        bool is_normal = kv.first == "normals" && stride == 3;
+#pragma omp parallel for schedule(static)
+        for (int64_t v = 0; v < num_voxels; ++v) {
+            double *sum = sums_ptr + v * stride;
+            if (is_normal) {
+                double norm = Eigen::Map<Eigen::Vector3d>(sum).norm();
+                if (norm > 0) {
+                    for (int k = 0; k < 3; ++k) sum[k] /= norm;
+                }
+            } else {
+                for (int64_t k = 0; k < stride; ++k) {
+                    sum[k] /= voxel_counts[v];
+                }
+            }
+        }
+
+        shape[0] = num_voxels;
+        pcd.SetPointAttr(kv.first, sums.Reshape(shape)
+                                           .To(attr.GetDtype())
+                                           .Copy(device_));
+    }
+    return pcd;
+}
+
 PointCloud PointCloud::CreateFromDepthImage(const Image &depth,
                                             const core::Tensor &intrinsics,
                                             const core::Tensor &extrinsics,
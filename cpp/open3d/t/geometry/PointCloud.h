@@ -269,6 +269,18 @@ public:
     /// \return Rotated pointcloud
     PointCloud &Rotate(const core::Tensor &R, const core::Tensor &center);
 
+    /// \brief Downsamples the point cloud with a regular voxel grid.
+    ///
+    /// All points falling into the same voxel are merged into one point. Every
+    /// attribute (points, colors, normals, ...) is averaged over the voxel;
+    /// normals are re-normalized. Voxels are ordered by the first point that
+    /// falls into them. The computation runs on CPU and the result is placed
+    /// on the device of this point cloud.
+    ///
+    /// \param voxel_size Voxel size. Must be positive.
+    /// \return Downsampled point cloud.
+    PointCloud VoxelDownSample(double voxel_size) const;
+
     /// \brief Returns the device attribute of this PointCloud.
     core::Device GetDevice() const { return device_; }
 
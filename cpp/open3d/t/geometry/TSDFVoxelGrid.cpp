@@ -30,11 +30,18 @@
 #include "open3d/core/kernel/Kernel.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Timer.h"
 
 namespace open3d {
 namespace t {
 namespace geometry {
 
+// Blocks are allocated from every kAllocationStride-th row and column of the
+// depth image. A block spans block_resolution voxels, so the truncation band
+// around each sampled point usually covers the blocks hit by the skipped
+// pixels, while the touch pass reads 1/16 of the depth image.
+static constexpr int64_t kAllocationStride = 4;
+
 TSDFVoxelGrid::TSDFVoxelGrid(
         std::unordered_map<std::string, core::Dtype> attr_dtype_map,
         float voxel_size,
@@ -120,14 +127,29 @@ void TSDFVoxelGrid::Integrate(const Image &depth,
                 "[TSDFVoxelGrid] input depth is empty for integration.");
     }
 
-    // Create a point cloud from a low-resolution depth input to roughly
-    // estimate surfaces.
-    PointCloud pcd = PointCloud::CreateFromDepthImage(
-            depth, intrinsics, extrinsics, depth_scale, depth_max, 4);
+    depth.AsTensor().AssertDtype(core::Dtype::UInt16);
+
+    utility::Timer timer;
+    timer.Start();
 
-    // Determine voxel blocks to allocate.
+    // Determine voxel blocks to allocate directly from a low-resolution
+    // (strided) depth input.
     std::unordered_map<std::string, core::Tensor> srcs = {
-            {"points", pcd.GetPoints().Contiguous()},
+            {"depth", depth.AsTensor().Contiguous()},
+            {"intrinsics", intrinsics.Copy(device_)},
+            {"extrinsics", extrinsics.Copy(device_)},
+            {"depth_scale",
+             core::Tensor(std::vector<float>{static_cast<float>(depth_scale)},
+                          {}, core::Dtype::Float32, device_)},
+            {"depth_max",
+             core::Tensor(std::vector<float>{static_cast<float>(depth_max)}, {},
+                          core::Dtype::Float32, device_)},
+            {"stride", core::Tensor(std::vector<int64_t>{kAllocationStride},
+                                    {}, core::Dtype::Int64, device_)},
+            {"ray_march",
+             core::Tensor(std::vector<int64_t>{allocation_mode_ ==
+                                               AllocationMode::RayMarching},
+                          {}, core::Dtype::Int64, device_)},
             {"resolution", core::Tensor(std::vector<int64_t>{block_resolution_},
                                         {}, core::Dtype::Int64, device_)},
             {"voxel_size", core::Tensor(std::vector<float>{voxel_size_}, {},
@@ -137,13 +159,16 @@ void TSDFVoxelGrid::Integrate(const Image &depth,
     std::unordered_map<std::string, core::Tensor> dsts;
 
     core::kernel::GeneralEW(srcs, dsts,
-                            core::kernel::GeneralEWOpCode::TSDFTouch);
+                            core::kernel::GeneralEWOpCode::DepthTouch);
     if (dsts.count("block_coords") == 0) {
         utility::LogError(
                 "[TSDFVoxelGrid] touch launch failed, expected block_coords");
     }
+    timer.Stop();
+    double touch_time = timer.GetDuration();
 
     // Active voxel blocks in the block hashmap.
+    timer.Start();
     core::Tensor block_coords = dsts.at("block_coords");
     core::Tensor addrs, masks;
     block_hashmap_->Activate(block_coords, addrs, masks);
@@ -152,6 +177,8 @@ void TSDFVoxelGrid::Integrate(const Image &depth,
     // reuse addrs from Activate, since some blocks might have been activated in
     // previous launches and return false.
     block_hashmap_->Find(block_coords, addrs, masks);
+    timer.Stop();
+    double activate_time = timer.GetDuration();
 
     // TSDF Integration.
     srcs = {{"depth", depth.AsTensor().Contiguous()},
@@ -193,9 +220,18 @@ void TSDFVoxelGrid::Integrate(const Image &depth,
                 "shape.");
     }
 
+    timer.Start();
     dsts = {{"block_values", block_hashmap_->GetValueTensor()}};
     core::kernel::GeneralEW(srcs, dsts,
                             core::kernel::GeneralEWOpCode::TSDFIntegrate);
+    timer.Stop();
+    double integrate_time = timer.GetDuration();
+
+    utility::LogDebug(
+            "[TSDFVoxelGrid] {} blocks touched, touch {:.3f} ms, "
+            "activate {:.3f} ms, integrate {:.3f} ms.",
+            block_coords.GetLength(), touch_time, activate_time,
+            integrate_time);
 }
 
 PointCloud TSDFVoxelGrid::ExtractSurfacePoints() {
@@ -56,6 +56,17 @@ namespace geometry {
 /// internal Tensor.
 class TSDFVoxelGrid {
 public:
+    /// Strategy to determine the voxel blocks to allocate in Integrate.
+    enum class AllocationMode {
+        /// Blocks within sdf_trunc of every strided unprojected depth point.
+        PointNeighborhood,
+        /// Blocks crossed by every strided pixel ray inside the truncation
+        /// band [depth - sdf_trunc, depth + sdf_trunc]. Touches fewer blocks
+        /// and is faster, at the cost of a slightly thinner band at grazing
+        /// angles.
+        RayMarching
+    };
+
     /// \brief Default Constructor.
     TSDFVoxelGrid(std::unordered_map<std::string, core::Dtype> attr_dtype_map =
                           {{"tsdf", core::Dtype::Float32},
@@ -101,6 +112,11 @@ public:
 
     core::Device GetDevice() { return device_; }
 
+    /// Set the block allocation strategy used in Integrate.
+    void SetAllocationMode(AllocationMode mode) { allocation_mode_ = mode; }
+
+    AllocationMode GetAllocationMode() const { return allocation_mode_; }
+
 protected:
     /// Return  \addrs and \masks for radius (3) neighbor entries.
     /// We first find all active entries in the hashmap with there coordinates.
@@ -122,6 +138,8 @@ protected:
 
     core::Device device_ = core::Device("CPU:0");
 
+    AllocationMode allocation_mode_ = AllocationMode::PointNeighborhood;
+
     std::shared_ptr<core::Hashmap> block_hashmap_;
 
     std::unordered_map<std::string, core::Dtype> attr_dtype_map_;
@@ -0,0 +1,194 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/kernel/Image.h"
+
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace image {
+
+static core::Device::DeviceType CheckDevices(const core::Tensor &src,
+                                             const core::Tensor &dst) {
+    core::Device device = src.GetDevice();
+    if (dst.GetDevice() != device) {
+        utility::LogError("Source device {} != destination device {}.",
+                          device.ToString(), dst.GetDevice().ToString());
+    }
+    if (!src.IsContiguous() || !dst.IsContiguous()) {
+        utility::LogError("Image kernels require contiguous tensors.");
+    }
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type != core::Device::DeviceType::CPU &&
+        device_type != core::Device::DeviceType::CUDA) {
+        utility::LogError("Image kernel: Unimplemented device");
+    }
+    return device_type;
+}
+
+void To(const core::Tensor &src,
+        core::Tensor &dst,
+        double scale,
+        double offset) {
+    if (CheckDevices(src, dst) == core::Device::DeviceType::CPU) {
+        ToCPU(src, dst, scale, offset);
+    } else {
+#ifdef BUILD_CUDA_MODULE
+        ToCUDA(src, dst, scale, offset);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    }
+}
+
+void ClipTransform(const core::Tensor &src,
+                   core::Tensor &dst,
+                   float scale,
+                   float min_value,
+                   float max_value,
+                   float clip_fill) {
+    if (CheckDevices(src, dst) == core::Device::DeviceType::CPU) {
+        ClipTransformCPU(src, dst, scale, min_value, max_value, clip_fill);
+    } else {
+#ifdef BUILD_CUDA_MODULE
+        ClipTransformCUDA(src, dst, scale, min_value, max_value, clip_fill);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    }
+}
+
+void RGBToGray(const core::Tensor &src, core::Tensor &dst) {
+    if (CheckDevices(src, dst) == core::Device::DeviceType::CPU) {
+        RGBToGrayCPU(src, dst);
+    } else {
+#ifdef BUILD_CUDA_MODULE
+        RGBToGrayCUDA(src, dst);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    }
+}
+
+void Resize(const core::Tensor &src,
+            core::Tensor &dst,
+            Image::InterpType interp_type) {
+    if (CheckDevices(src, dst) == core::Device::DeviceType::CPU) {
+        ResizeCPU(src, dst, interp_type);
+    } else {
+#ifdef BUILD_CUDA_MODULE
+        ResizeCUDA(src, dst, interp_type);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    }
+}
+
+void FilterSeparable(const core::Tensor &src,
+                     core::Tensor &dst,
+                     const core::Tensor &kernel_col,
+                     const core::Tensor &kernel_row,
+                     int stride) {
+    if (CheckDevices(src, dst) == core::Device::DeviceType::CPU) {
+        FilterSeparableCPU(src, dst, kernel_col, kernel_row, stride);
+    } else {
+#ifdef BUILD_CUDA_MODULE
+        FilterSeparableCUDA(src, dst, kernel_col, kernel_row, stride);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    }
+}
+
+void FilterBilateral(const core::Tensor &src,
+                     core::Tensor &dst,
+                     int kernel_size,
+                     float value_sigma,
+                     float distance_sigma) {
+    if (CheckDevices(src, dst) == core::Device::DeviceType::CPU) {
+        FilterBilateralCPU(src, dst, kernel_size, value_sigma, distance_sigma);
+    } else {
+#ifdef BUILD_CUDA_MODULE
+        FilterBilateralCUDA(src, dst, kernel_size, value_sigma, distance_sigma);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    }
+}
+
+void PyrDownDepth(const core::Tensor &src,
+                  core::Tensor &dst,
+                  float diff_threshold,
+                  float invalid_fill) {
+    if (CheckDevices(src, dst) == core::Device::DeviceType::CPU) {
+        PyrDownDepthCPU(src, dst, diff_threshold, invalid_fill);
+    } else {
+#ifdef BUILD_CUDA_MODULE
+        PyrDownDepthCUDA(src, dst, diff_threshold, invalid_fill);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    }
+}
+
+void CreateVertexMap(const core::Tensor &src,
+                     const core::Tensor &intrinsics,
+                     core::Tensor &dst,
+                     float invalid_fill) {
+    if (CheckDevices(src, dst) == core::Device::DeviceType::CPU) {
+        CreateVertexMapCPU(src, intrinsics, dst, invalid_fill);
+    } else {
+#ifdef BUILD_CUDA_MODULE
+        CreateVertexMapCUDA(src, intrinsics, dst, invalid_fill);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    }
+}
+
+void CreateNormalMap(const core::Tensor &src,
+                     core::Tensor &dst,
+                     float invalid_fill) {
+    if (CheckDevices(src, dst) == core::Device::DeviceType::CPU) {
+        CreateNormalMapCPU(src, dst, invalid_fill);
+    } else {
+#ifdef BUILD_CUDA_MODULE
+        CreateNormalMapCUDA(src, dst, invalid_fill);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    }
+}
+
+}  // namespace image
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,196 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace image {
+
+/// Image kernels operate on contiguous {rows, cols, channels} tensors. Output
+/// tensors are allocated by the caller on the same device as the input; the
+/// kernels dispatch on the device and write every output pixel. Border pixels
+/// are handled by replicating the nearest valid pixel.
+
+/// dst = saturate_cast<dst_t>(src * scale + offset).
+void To(const core::Tensor &src,
+        core::Tensor &dst,
+        double scale,
+        double offset);
+
+/// dst = src / scale, replaced by \p clip_fill outside (min_value, max_value].
+/// \p dst must be Float32.
+void ClipTransform(const core::Tensor &src,
+                   core::Tensor &dst,
+                   float scale,
+                   float min_value,
+                   float max_value,
+                   float clip_fill);
+
+/// 3-channel to 1-channel luminance (0.299 R + 0.587 G + 0.114 B).
+void RGBToGray(const core::Tensor &src, core::Tensor &dst);
+
+/// Resample \p src to the shape of \p dst.
+void Resize(const core::Tensor &src,
+            core::Tensor &dst,
+            Image::InterpType interp_type);
+
+/// Separable 2D correlation. \p kernel_col is applied along rows and \p
+/// kernel_row along columns; both are odd-sized Float32 vectors on the image's
+/// device. Only every \p stride -th pixel is computed, i.e. dst has shape
+/// {rows / stride, cols / stride, channels}.
+void FilterSeparable(const core::Tensor &src,
+                     core::Tensor &dst,
+                     const core::Tensor &kernel_col,
+                     const core::Tensor &kernel_row,
+                     int stride);
+
+void FilterBilateral(const core::Tensor &src,
+                     core::Tensor &dst,
+                     int kernel_size,
+                     float value_sigma,
+                     float distance_sigma);
+
+/// Edge-preserving 2x downsampling of a Float32 depth image: each output pixel
+/// averages the valid pixels of its 2x2 block within \p diff_threshold of the
+/// first valid one.
+void PyrDownDepth(const core::Tensor &src,
+                  core::Tensor &dst,
+                  float diff_threshold,
+                  float invalid_fill);
+
+/// Float32 depth (in meters) to Float32 3-channel vertex map.
+void CreateVertexMap(const core::Tensor &src,
+                     const core::Tensor &intrinsics,
+                     core::Tensor &dst,
+                     float invalid_fill);
+
+/// Float32 3-channel vertex map to unit normals by forward differences.
+void CreateNormalMap(const core::Tensor &src,
+                     core::Tensor &dst,
+                     float invalid_fill);
+
+void ToCPU(const core::Tensor &src,
+           core::Tensor &dst,
+           double scale,
+           double offset);
+
+void ClipTransformCPU(const core::Tensor &src,
+                      core::Tensor &dst,
+                      float scale,
+                      float min_value,
+                      float max_value,
+                      float clip_fill);
+
+void RGBToGrayCPU(const core::Tensor &src, core::Tensor &dst);
+
+void ResizeCPU(const core::Tensor &src,
+               core::Tensor &dst,
+               Image::InterpType interp_type);
+
+void FilterSeparableCPU(const core::Tensor &src,
+                        core::Tensor &dst,
+                        const core::Tensor &kernel_col,
+                        const core::Tensor &kernel_row,
+                        int stride);
+
+void FilterBilateralCPU(const core::Tensor &src,
+                        core::Tensor &dst,
+                        int kernel_size,
+                        float value_sigma,
+                        float distance_sigma);
+
+void PyrDownDepthCPU(const core::Tensor &src,
+                     core::Tensor &dst,
+                     float diff_threshold,
+                     float invalid_fill);
+
+void CreateVertexMapCPU(const core::Tensor &src,
+                        const core::Tensor &intrinsics,
+                        core::Tensor &dst,
+                        float invalid_fill);
+
+void CreateNormalMapCPU(const core::Tensor &src,
+                        core::Tensor &dst,
+                        float invalid_fill);
+
+#ifdef BUILD_CUDA_MODULE
+void ToCUDA(const core::Tensor &src,
+            core::Tensor &dst,
+            double scale,
+            double offset);
+
+void ClipTransformCUDA(const core::Tensor &src,
+                       core::Tensor &dst,
+                       float scale,
+                       float min_value,
+                       float max_value,
+                       float clip_fill);
+
+void RGBToGrayCUDA(const core::Tensor &src, core::Tensor &dst);
+
+void ResizeCUDA(const core::Tensor &src,
+                core::Tensor &dst,
+                Image::InterpType interp_type);
+
+void FilterSeparableCUDA(const core::Tensor &src,
+                         core::Tensor &dst,
+                         const core::Tensor &kernel_col,
+                         const core::Tensor &kernel_row,
+                         int stride);
+
+void FilterBilateralCUDA(const core::Tensor &src,
+                         core::Tensor &dst,
+                         int kernel_size,
+                         float value_sigma,
+                         float distance_sigma);
+
+void PyrDownDepthCUDA(const core::Tensor &src,
+                      core::Tensor &dst,
+                      float diff_threshold,
+                      float invalid_fill);
+
+void CreateVertexMapCUDA(const core::Tensor &src,
+                         const core::Tensor &intrinsics,
+                         core::Tensor &dst,
+                         float invalid_fill);
+
+void CreateNormalMapCUDA(const core::Tensor &src,
+                         core::Tensor &dst,
+                         float invalid_fill);
+#endif
+
+}  // namespace image
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,554 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/kernel/Image.h"
+#include "open3d/utility/Console.h"
+
+#define DISPATCH_IMAGE_DTYPE_TO_TEMPLATE(DTYPE, ...)         \
+    [&] {                                                    \
+        if (DTYPE == open3d::core::Dtype::UInt8) {           \
+            using scalar_t = uint8_t;                        \
+            return __VA_ARGS__();                            \
+        } else if (DTYPE == open3d::core::Dtype::UInt16) {   \
+            using scalar_t = uint16_t;                       \
+            return __VA_ARGS__();                            \
+        } else if (DTYPE == open3d::core::Dtype::Float32) {  \
+            using scalar_t = float;                          \
+            return __VA_ARGS__();                            \
+        } else {                                             \
+            utility::LogError("Unsupported image dtype {}.", \
+                              DTYPE.ToString());             \
+        }                                                    \
+    }()
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace image {
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+using core::kernel::CUDALauncher;
+#else
+using core::kernel::CPULauncher;
+#endif
+
+/// Round-to-nearest conversion that clamps to the range of integer types.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline scalar_t SaturateCast(float v);
+
+template <>
+OPEN3D_HOST_DEVICE inline uint8_t SaturateCast<uint8_t>(float v) {
+    return static_cast<uint8_t>(v <= 0.0f ? 0.0f
+                                          : (v >= 255.0f ? 255.0f : v + 0.5f));
+}
+
+template <>
+OPEN3D_HOST_DEVICE inline uint16_t SaturateCast<uint16_t>(float v) {
+    return static_cast<uint16_t>(
+            v <= 0.0f ? 0.0f : (v >= 65535.0f ? 65535.0f : v + 0.5f));
+}
+
+template <>
+OPEN3D_HOST_DEVICE inline float SaturateCast<float>(float v) {
+    return v;
+}
+
+OPEN3D_HOST_DEVICE inline int64_t ClampIndex(int64_t i, int64_t size) {
+    return i < 0 ? 0 : (i >= size ? size - 1 : i);
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void ToCUDA
+#else
+void ToCPU
+#endif
+        (const core::Tensor &src,
+         core::Tensor &dst,
+         double scale,
+         double offset) {
+    const float s = static_cast<float>(scale);
+    const float o = static_cast<float>(offset);
+    int64_t n = src.NumElements();
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    CUDALauncher launcher;
+#else
+    CPULauncher launcher;
+#endif
+
+    DISPATCH_IMAGE_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        using src_t = scalar_t;
+        DISPATCH_IMAGE_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+            using dst_t = scalar_t;
+            const src_t *src_ptr = static_cast<const src_t *>(src.GetDataPtr());
+            dst_t *dst_ptr = static_cast<dst_t *>(dst.GetDataPtr());
+            launcher.LaunchGeneralKernel(
+                    n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                        dst_ptr[workload_idx] = SaturateCast<dst_t>(
+                                static_cast<float>(src_ptr[workload_idx]) * s +
+                                o);
+                    });
+        });
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void ClipTransformCUDA
+#else
+void ClipTransformCPU
+#endif
+        (const core::Tensor &src,
+         core::Tensor &dst,
+         float scale,
+         float min_value,
+         float max_value,
+         float clip_fill) {
+    float *dst_ptr = static_cast<float *>(dst.GetDataPtr());
+    int64_t n = src.NumElements();
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    CUDALauncher launcher;
+#else
+    CPULauncher launcher;
+#endif
+
+    DISPATCH_IMAGE_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t *src_ptr =
+                static_cast<const scalar_t *>(src.GetDataPtr());
+        launcher.LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    float v = static_cast<float>(src_ptr[workload_idx]) / scale;
+                    dst_ptr[workload_idx] =
+                            (v <= min_value || v > max_value) ? clip_fill : v;
+                });
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void RGBToGrayCUDA
+#else
+void RGBToGrayCPU
+#endif
+        (const core::Tensor &src, core::Tensor &dst) {
+    int64_t channels = src.GetShape(2);
+    int64_t n = dst.NumElements();
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    CUDALauncher launcher;
+#else
+    CPULauncher launcher;
+#endif
+
+    DISPATCH_IMAGE_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t *src_ptr =
+                static_cast<const scalar_t *>(src.GetDataPtr());
+        scalar_t *dst_ptr = static_cast<scalar_t *>(dst.GetDataPtr());
+        launcher.LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const scalar_t *rgb = src_ptr + workload_idx * channels;
+                    dst_ptr[workload_idx] = SaturateCast<scalar_t>(
+                            0.299f * static_cast<float>(rgb[0]) +
+                            0.587f * static_cast<float>(rgb[1]) +
+                            0.114f * static_cast<float>(rgb[2]));
+                });
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void ResizeCUDA
+#else
+void ResizeCPU
+#endif
+        (const core::Tensor &src,
+         core::Tensor &dst,
+         Image::InterpType interp_type) {
+    int64_t rows_src = src.GetShape(0);
+    int64_t cols_src = src.GetShape(1);
+    int64_t channels = src.GetShape(2);
+    int64_t rows_dst = dst.GetShape(0);
+    int64_t cols_dst = dst.GetShape(1);
+    const float scale_r = static_cast<float>(rows_src) / rows_dst;
+    const float scale_c = static_cast<float>(cols_src) / cols_dst;
+    const bool linear = interp_type == Image::InterpType::Linear;
+    int64_t n = rows_dst * cols_dst;
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    CUDALauncher launcher;
+#else
+    CPULauncher launcher;
+#endif
+
+    DISPATCH_IMAGE_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t *src_ptr =
+                static_cast<const scalar_t *>(src.GetDataPtr());
+        scalar_t *dst_ptr = static_cast<scalar_t *>(dst.GetDataPtr());
+        launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
+                                                int64_t workload_idx) {
+            int64_t r = workload_idx / cols_dst;
+            int64_t c = workload_idx % cols_dst;
+            scalar_t *out = dst_ptr + workload_idx * channels;
+
+            // Pixel centers are aligned, i.e. (r + 0.5) * scale - 0.5.
+            float r_src = (r + 0.5f) * scale_r - 0.5f;
+            float c_src = (c + 0.5f) * scale_c - 0.5f;
+            if (!linear) {
+                int64_t r0 = ClampIndex(static_cast<int64_t>(r_src + 0.5f),
+                                        rows_src);
+                int64_t c0 = ClampIndex(static_cast<int64_t>(c_src + 0.5f),
+                                        cols_src);
+                const scalar_t *in = src_ptr + (r0 * cols_src + c0) * channels;
+                for (int64_t ch = 0; ch < channels; ++ch) {
+                    out[ch] = in[ch];
+                }
+                return;
+            }
+
+            r_src = r_src < 0 ? 0 : r_src;
+            c_src = c_src < 0 ? 0 : c_src;
+            int64_t r0 = ClampIndex(static_cast<int64_t>(r_src), rows_src);
+            int64_t c0 = ClampIndex(static_cast<int64_t>(c_src), cols_src);
+            int64_t r1 = ClampIndex(r0 + 1, rows_src);
+            int64_t c1 = ClampIndex(c0 + 1, cols_src);
+            float wr = r_src - r0, wc = c_src - c0;
+            wr = wr > 1 ? 1 : wr;
+            wc = wc > 1 ? 1 : wc;
+
+            const scalar_t *in00 = src_ptr + (r0 * cols_src + c0) * channels;
+            const scalar_t *in01 = src_ptr + (r0 * cols_src + c1) * channels;
+            const scalar_t *in10 = src_ptr + (r1 * cols_src + c0) * channels;
+            const scalar_t *in11 = src_ptr + (r1 * cols_src + c1) * channels;
+            for (int64_t ch = 0; ch < channels; ++ch) {
+                float top = (1 - wc) * static_cast<float>(in00[ch]) +
+                            wc * static_cast<float>(in01[ch]);
+                float bottom = (1 - wc) * static_cast<float>(in10[ch]) +
+                               wc * static_cast<float>(in11[ch]);
+                out[ch] = SaturateCast<scalar_t>((1 - wr) * top + wr * bottom);
+            }
+        });
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void FilterSeparableCUDA
+#else
+void FilterSeparableCPU
+#endif
+        (const core::Tensor &src,
+         core::Tensor &dst,
+         const core::Tensor &kernel_col,
+         const core::Tensor &kernel_row,
+         int stride) {
+    int64_t rows_src = src.GetShape(0);
+    int64_t cols_src = src.GetShape(1);
+    int64_t channels = src.GetShape(2);
+    int64_t rows_dst = dst.GetShape(0);
+    int64_t cols_dst = dst.GetShape(1);
+
+    const float *kernel_col_ptr =
+            static_cast<const float *>(kernel_col.GetDataPtr());
+    const float *kernel_row_ptr =
+            static_cast<const float *>(kernel_row.GetDataPtr());
+    const int64_t half_col = kernel_col.GetLength() / 2;
+    const int64_t half_row = kernel_row.GetLength() / 2;
+
+    // Horizontal pass on every row, evaluated at the strided columns only.
+    // Each workload is one output element, so that writes are contiguous.
+    core::Tensor tmp({rows_src, cols_dst, channels}, core::Dtype::Float32,
+                     src.GetDevice());
+    float *tmp_ptr = static_cast<float *>(tmp.GetDataPtr());
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    CUDALauncher launcher;
+#else
+    CPULauncher launcher;
+#endif
+
+    DISPATCH_IMAGE_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t *src_ptr =
+                static_cast<const scalar_t *>(src.GetDataPtr());
+        launcher.LaunchGeneralKernel(
+                rows_src * cols_dst * channels,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int64_t ch = workload_idx % channels;
+                    int64_t pixel_idx = workload_idx / channels;
+                    int64_t r = pixel_idx / cols_dst;
+                    int64_t c = (pixel_idx % cols_dst) * stride;
+                    const scalar_t *row = src_ptr + r * cols_src * channels;
+
+                    float sum = 0;
+                    for (int64_t k = -half_row; k <= half_row; ++k) {
+                        int64_t cc = ClampIndex(c + k, cols_src);
+                        sum += kernel_row_ptr[k + half_row] *
+                               static_cast<float>(row[cc * channels + ch]);
+                    }
+                    tmp_ptr[workload_idx] = sum;
+                });
+    });
+
+    // Vertical pass at the strided rows.
+    DISPATCH_IMAGE_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        scalar_t *dst_ptr = static_cast<scalar_t *>(dst.GetDataPtr());
+        const int64_t row_stride = cols_dst * channels;
+        launcher.LaunchGeneralKernel(
+                rows_dst * row_stride, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int64_t r = (workload_idx / row_stride) * stride;
+                    int64_t offset = workload_idx % row_stride;
+
+                    float sum = 0;
+                    for (int64_t k = -half_col; k <= half_col; ++k) {
+                        int64_t rr = ClampIndex(r + k, rows_src);
+                        sum += kernel_col_ptr[k + half_col] *
+                               tmp_ptr[rr * row_stride + offset];
+                    }
+                    dst_ptr[workload_idx] = SaturateCast<scalar_t>(sum);
+                });
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void FilterBilateralCUDA
+#else
+void FilterBilateralCPU
+#endif
+        (const core::Tensor &src,
+         core::Tensor &dst,
+         int kernel_size,
+         float value_sigma,
+         float distance_sigma) {
+    // Per-pixel accumulators live in registers.
+    static constexpr int64_t kMaxChannels = 4;
+    int64_t rows = src.GetShape(0);
+    int64_t cols = src.GetShape(1);
+    int64_t channels = src.GetShape(2);
+    if (channels > kMaxChannels) {
+        utility::LogError(
+                "[FilterBilateral] At most {} channels are supported, but got "
+                "{}.",
+                kMaxChannels, channels);
+    }
+
+    int64_t n = rows * cols;
+    const int64_t half = kernel_size / 2;
+    const float inv_2_value_var = 1.0f / (2 * value_sigma * value_sigma);
+    const float inv_2_distance_var =
+            1.0f / (2 * distance_sigma * distance_sigma);
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    CUDALauncher launcher;
+#else
+    CPULauncher launcher;
+#endif
+
+    DISPATCH_IMAGE_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t *src_ptr =
+                static_cast<const scalar_t *>(src.GetDataPtr());
+        scalar_t *dst_ptr = static_cast<scalar_t *>(dst.GetDataPtr());
+        launcher.LaunchGeneralKernel(
+                n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int64_t r = workload_idx / cols;
+                    int64_t c = workload_idx % cols;
+                    const scalar_t *center = src_ptr + workload_idx * channels;
+
+                    float sum[kMaxChannels] = {0};
+                    float weight_sum = 0;
+                    for (int64_t i = -half; i <= half; ++i) {
+                        int64_t rr = ClampIndex(r + i, rows);
+                        for (int64_t j = -half; j <= half; ++j) {
+                            int64_t cc = ClampIndex(c + j, cols);
+                            const scalar_t *neighbor =
+                                    src_ptr + (rr * cols + cc) * channels;
+
+                            float value_dist2 = 0;
+                            for (int64_t ch = 0; ch < channels; ++ch) {
+                                float diff = static_cast<float>(neighbor[ch]) -
+                                             static_cast<float>(center[ch]);
+                                value_dist2 += diff * diff;
+                            }
+                            float weight =
+                                    expf(-(i * i + j * j) * inv_2_distance_var -
+                                         value_dist2 * inv_2_value_var);
+                            for (int64_t ch = 0; ch < channels; ++ch) {
+                                sum[ch] += weight *
+                                           static_cast<float>(neighbor[ch]);
+                            }
+                            weight_sum += weight;
+                        }
+                    }
+
+                    scalar_t *out = dst_ptr + workload_idx * channels;
+                    for (int64_t ch = 0; ch < channels; ++ch) {
+                        out[ch] = SaturateCast<scalar_t>(sum[ch] / weight_sum);
+                    }
+                });
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void PyrDownDepthCUDA
+#else
+void PyrDownDepthCPU
+#endif
+        (const core::Tensor &src,
+         core::Tensor &dst,
+         float diff_threshold,
+         float invalid_fill) {
+    int64_t cols_src = src.GetShape(1);
+    int64_t cols_dst = dst.GetShape(1);
+    int64_t n = dst.GetShape(0) * cols_dst;
+    const float *src_ptr = static_cast<const float *>(src.GetDataPtr());
+    float *dst_ptr = static_cast<float *>(dst.GetDataPtr());
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    CUDALauncher launcher;
+#else
+    CPULauncher launcher;
+#endif
+
+    launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        int64_t r = workload_idx / cols_dst;
+        int64_t c = workload_idx % cols_dst;
+        const float *block = src_ptr + 2 * r * cols_src + 2 * c;
+        const float vals[4] = {block[0], block[1], block[cols_src],
+                               block[cols_src + 1]};
+
+        // Only average depths close to the first valid one, so that
+        // discontinuities are not blurred.
+        float ref = 0, sum = 0;
+        int count = 0;
+        for (int k = 0; k < 4; ++k) {
+            if (!(vals[k] > 0)) continue;
+            if (count == 0) ref = vals[k];
+            if (fabsf(vals[k] - ref) < diff_threshold) {
+                sum += vals[k];
+                count++;
+            }
+        }
+        dst_ptr[workload_idx] = count > 0 ? sum / count : invalid_fill;
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void CreateVertexMapCUDA
+#else
+void CreateVertexMapCPU
+#endif
+        (const core::Tensor &src,
+         const core::Tensor &intrinsics,
+         core::Tensor &dst,
+         float invalid_fill) {
+    core::Tensor intrinsics_host = intrinsics.To(core::Dtype::Float64)
+                                           .Copy(core::Device("CPU:0"))
+                                           .Contiguous();
+    const double *K =
+            static_cast<const double *>(intrinsics_host.GetDataPtr());
+    const float inv_fx = static_cast<float>(1.0 / K[0]);
+    const float inv_fy = static_cast<float>(1.0 / K[4]);
+    const float cx = static_cast<float>(K[2]);
+    const float cy = static_cast<float>(K[5]);
+
+    int64_t cols = src.GetShape(1);
+    int64_t n = src.GetShape(0) * cols;
+    const float *depth_ptr = static_cast<const float *>(src.GetDataPtr());
+    float *vertex_ptr = static_cast<float *>(dst.GetDataPtr());
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    CUDALauncher launcher;
+#else
+    CPULauncher launcher;
+#endif
+
+    launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        int64_t r = workload_idx / cols;
+        int64_t c = workload_idx % cols;
+        float d = depth_ptr[workload_idx];
+        float *v = vertex_ptr + 3 * workload_idx;
+        if (!(d > 0)) {
+            v[0] = v[1] = v[2] = invalid_fill;
+            return;
+        }
+        v[0] = (c - cx) * d * inv_fx;
+        v[1] = (r - cy) * d * inv_fy;
+        v[2] = d;
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void CreateNormalMapCUDA
+#else
+void CreateNormalMapCPU
+#endif
+        (const core::Tensor &src, core::Tensor &dst, float invalid_fill) {
+    int64_t rows = src.GetShape(0);
+    int64_t cols = src.GetShape(1);
+    const float *vertex_ptr = static_cast<const float *>(src.GetDataPtr());
+    float *normal_ptr = static_cast<float *>(dst.GetDataPtr());
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    CUDALauncher launcher;
+#else
+    CPULauncher launcher;
+#endif
+
+    launcher.LaunchGeneralKernel(rows * cols, [=] OPEN3D_DEVICE(
+                                                      int64_t workload_idx) {
+        int64_t r = workload_idx / cols;
+        int64_t c = workload_idx % cols;
+        float *normal = normal_ptr + 3 * workload_idx;
+        normal[0] = normal[1] = normal[2] = invalid_fill;
+        if (r == rows - 1 || c == cols - 1) return;
+
+        const float *v00 = vertex_ptr + 3 * workload_idx;
+        const float *v01 = v00 + 3;
+        const float *v10 = v00 + 3 * cols;
+        if (!(v00[2] > 0 && v01[2] > 0 && v10[2] > 0)) return;
+
+        float dx[3] = {v01[0] - v00[0], v01[1] - v00[1], v01[2] - v00[2]};
+        float dy[3] = {v10[0] - v00[0], v10[1] - v00[1], v10[2] - v00[2]};
+        float n[3] = {dx[1] * dy[2] - dx[2] * dy[1],
+                      dx[2] * dy[0] - dx[0] * dy[2],
+                      dx[0] * dy[1] - dx[1] * dy[0]};
+        float norm = sqrtf(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        if (norm == 0) return;
+
+        normal[0] = n[0] / norm;
+        normal[1] = n[1] / norm;
+        normal[2] = n[2] / norm;
+    });
+}
+
+}  // namespace image
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
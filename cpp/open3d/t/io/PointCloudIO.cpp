@@ -47,6 +47,7 @@ static const std::unordered_map<
         file_extension_to_pointcloud_read_function{
                 {"xyzi", ReadPointCloudFromXYZI},
                 {"ply", ReadPointCloudFromPLY},
+                {"qpc", ReadPointCloudFromQPC},
         };
 
 static const std::unordered_map<
@@ -57,6 +58,7 @@ static const std::unordered_map<
         file_extension_to_pointcloud_write_function{
                 {"xyzi", WritePointCloudToXYZI},
                 {"ply", WritePointCloudToPLY},
+                {"qpc", WritePointCloudToQPC},
         };
 
 std::shared_ptr<geometry::PointCloud> CreatetPointCloudFromFile(
@@ -89,6 +91,9 @@ bool ReadPointCloud(const std::string &filename,
                 legacy_pointcloud, core::Dtype::Float64);
     } else {
         success = map_itr->second(filename, pointcloud, params);
+        if (!success) {
+            return false;
+        }
         utility::LogDebug("Read geometry::PointCloud: {:d} vertices.",
                           (int)pointcloud.GetPoints().GetLength());
         if (params.remove_nan_points || params.remove_infinite_points) {
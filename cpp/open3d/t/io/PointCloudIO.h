@@ -77,6 +77,20 @@ bool WritePointCloudToPLY(const std::string &filename,
                           const geometry::PointCloud &pointcloud,
                           const WritePointCloudOption &params);
 
+/// \brief Reads a QPC file into Float64 "points" and "normals" and UInt8
+/// "colors". Colors are stored with 8 bits per channel, so Float32 or Float64
+/// colors in [0, 1] that were written to the file come back as UInt8 values
+/// in [0, 255], as colors read from PLY files.
+bool ReadPointCloudFromQPC(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const ReadPointCloudOption &params);
+
+/// \brief Writes the "points", "normals" and "colors" attributes to a QPC
+/// file. Other attributes are not stored.
+bool WritePointCloudToQPC(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          const WritePointCloudOption &params);
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
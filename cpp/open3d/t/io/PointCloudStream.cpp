@@ -0,0 +1,864 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/PointCloudStream.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/io/file_format/AsciiRowReader.h"
+#include "open3d/io/file_format/BinaryPLYReader.h"
+#include "open3d/io/file_format/FilePCD.h"
+#include "open3d/t/io/file_format/FilePLY.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Helper.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+bool IsTextFormat(const std::string &format) {
+    return format == "xyz" || format == "xyzn" || format == "xyzrgb" ||
+           format == "xyzi";
+}
+
+int GetNumColumns(const std::string &format) {
+    if (format == "xyz") {
+        return 3;
+    } else if (format == "xyzi") {
+        return 4;
+    } else {
+        return 6;
+    }
+}
+
+bool IsHostLittleEndian() {
+    const uint16_t value = 1;
+    char byte;
+    std::memcpy(&byte, &value, 1);
+    return byte == 1;
+}
+
+/// Returns the values of \p tensor as a contiguous CPU tensor of \p dtype.
+core::Tensor ToContiguousCPU(const core::Tensor &tensor, core::Dtype dtype) {
+    core::Tensor cpu_tensor =
+            tensor.GetDevice().GetType() == core::Device::DeviceType::CPU
+                    ? tensor
+                    : tensor.Copy(core::Device("CPU:0"));
+    return cpu_tensor.To(dtype).Contiguous();
+}
+
+/// Reads the whole file with ReadPointCloud() and returns it in slices.
+class InMemoryStreamReader : public PointCloudStreamReader {
+public:
+    explicit InMemoryStreamReader(const std::string &format)
+        : format_(format) {}
+
+    bool IsOpened() const override { return is_opened_; }
+
+    bool IsEOF() const override { return position_ >= GetNumPoints(); }
+
+    bool Open(const std::string &filename) override {
+        Close();
+        if (!ReadPointCloud(filename, pointcloud_,
+                            {format_, false, false, false})) {
+            return false;
+        }
+        filename_ = filename;
+        is_opened_ = true;
+        return true;
+    }
+
+    void Close() override {
+        pointcloud_ = geometry::PointCloud();
+        filename_.clear();
+        position_ = 0;
+        is_opened_ = false;
+    }
+
+    int64_t GetNumPoints() const override {
+        return pointcloud_.HasPoints() ? pointcloud_.GetPoints().GetLength()
+                                       : 0;
+    }
+
+    geometry::PointCloud Next(int64_t max_points) override {
+        const int64_t end =
+                std::min(position_ + std::max<int64_t>(max_points, 0),
+                         GetNumPoints());
+        geometry::PointCloud batch(pointcloud_.GetDevice());
+        if (end <= position_) {
+            return batch;
+        }
+        for (const auto &it : pointcloud_.GetPointAttr()) {
+            batch.SetPointAttr(it.first, it.second.Slice(0, position_, end));
+        }
+        position_ = end;
+        return batch;
+    }
+
+    std::string GetFilename() const override { return filename_; }
+
+private:
+    std::string format_;
+    std::string filename_;
+    geometry::PointCloud pointcloud_;
+    int64_t position_ = 0;
+    bool is_opened_ = false;
+};
+
+/// Decodes ranges of fixed-size vertex records of binary PLY files.
+class PLYStreamReader : public PointCloudStreamReader {
+public:
+    bool IsOpened() const override { return vertex_ != nullptr; }
+
+    bool IsEOF() const override { return position_ >= GetNumPoints(); }
+
+    bool Open(const std::string &filename) override {
+        Close();
+        reader_.reset(new open3d::io::BinaryPLYReader());
+        if (!reader_->Open(filename)) {
+            reader_.reset();
+            return false;
+        }
+        vertex_ = reader_->FindElement("vertex");
+        if (vertex_ == nullptr || !vertex_->IsFixedSize()) {
+            Close();
+            return false;
+        }
+        filename_ = filename;
+        return true;
+    }
+
+    void Close() override {
+        vertex_ = nullptr;
+        reader_.reset();
+        filename_.clear();
+        position_ = 0;
+    }
+
+    int64_t GetNumPoints() const override {
+        return vertex_ != nullptr ? vertex_->count_ : 0;
+    }
+
+    geometry::PointCloud Next(int64_t max_points) override {
+        geometry::PointCloud batch;
+        const int64_t count =
+                std::min(max_points, GetNumPoints() - position_);
+        if (count <= 0) {
+            return batch;
+        }
+        if (!ReadPointCloudFromBinaryPLY(*reader_, *vertex_, position_,
+                                         count, batch)) {
+            position_ = GetNumPoints();
+            return geometry::PointCloud();
+        }
+        position_ += count;
+        return batch;
+    }
+
+    std::string GetFilename() const override { return filename_; }
+
+private:
+    std::unique_ptr<open3d::io::BinaryPLYReader> reader_;
+    const open3d::io::BinaryPLYReader::Element *vertex_ = nullptr;
+    std::string filename_;
+    int64_t position_ = 0;
+};
+
+/// Reads ASCII and binary PCD data batch by batch from the file. The data
+/// of binary_compressed files is a single block, which is not supported.
+class PCDStreamReader : public PointCloudStreamReader {
+public:
+    ~PCDStreamReader() override { Close(); }
+
+    bool IsOpened() const override { return file_ != nullptr; }
+
+    bool IsEOF() const override { return position_ >= GetNumPoints(); }
+
+    bool Open(const std::string &filename) override {
+        Close();
+        file_ = utility::filesystem::FOpen(filename, "rb");
+        if (file_ == nullptr) {
+            return false;
+        }
+        if (!open3d::io::ReadPCDHeader(file_, header_) ||
+            header_.datatype == open3d::io::PCD_DATA_BINARY_COMPRESSED) {
+            Close();
+            return false;
+        }
+        filename_ = filename;
+        return true;
+    }
+
+    void Close() override {
+        if (file_ != nullptr) {
+            fclose(file_);
+            file_ = nullptr;
+        }
+        filename_.clear();
+        position_ = 0;
+    }
+
+    int64_t GetNumPoints() const override {
+        return file_ != nullptr ? header_.points : 0;
+    }
+
+    geometry::PointCloud Next(int64_t max_points) override {
+        const int64_t count =
+                std::min(max_points, GetNumPoints() - position_);
+        if (count <= 0) {
+            return geometry::PointCloud();
+        }
+        open3d::io::PCDHeader batch_header = header_;
+        batch_header.points = int(count);
+        open3d::geometry::PointCloud batch;
+        if (!open3d::io::ReadPCDData(file_, batch_header, batch, {})) {
+            position_ = GetNumPoints();
+            return geometry::PointCloud();
+        }
+        position_ += count;
+        return geometry::PointCloud::FromLegacyPointCloud(
+                batch, core::Dtype::Float64);
+    }
+
+    std::string GetFilename() const override { return filename_; }
+
+private:
+    FILE *file_ = nullptr;
+    open3d::io::PCDHeader header_;
+    std::string filename_;
+    int64_t position_ = 0;
+};
+
+/// Parses the lines of XYZ, XYZN, XYZRGB and XYZI files from a memory
+/// mapping, up to the number of lines that gives a full batch.
+class TextStreamReader : public PointCloudStreamReader {
+public:
+    explicit TextStreamReader(const std::string &format)
+        : format_(format), num_columns_(GetNumColumns(format)) {}
+
+    bool IsOpened() const override { return mapped_file_ != nullptr; }
+
+    bool IsEOF() const override { return cursor_ >= end_; }
+
+    bool Open(const std::string &filename) override {
+        Close();
+        mapped_file_.reset(new utility::filesystem::MappedFile());
+        if (!mapped_file_->Open(filename)) {
+            mapped_file_.reset();
+            return false;
+        }
+        cursor_ = mapped_file_->GetData();
+        end_ = cursor_ + mapped_file_->GetSize();
+        filename_ = filename;
+        return true;
+    }
+
+    void Close() override {
+        mapped_file_.reset();
+        cursor_ = nullptr;
+        end_ = nullptr;
+        filename_.clear();
+    }
+
+    int64_t GetNumPoints() const override { return -1; }
+
+    geometry::PointCloud Next(int64_t max_points) override {
+        std::vector<double> values;
+        int64_t num_rows = 0;
+        while (num_rows < max_points && cursor_ < end_) {
+            // Parse as many lines as there are points missing. Invalid lines
+            // are skipped, in which case the loop parses further lines.
+            const char *stop = cursor_;
+            for (int64_t i = num_rows; i < max_points && stop < end_; ++i) {
+                const char *line_end = static_cast<const char *>(
+                        std::memchr(stop, '\n', end_ - stop));
+                stop = line_end == nullptr ? end_ : line_end + 1;
+            }
+            num_rows += open3d::io::ParseAsciiRowsParallel(
+                    cursor_, stop, num_columns_, true, values);
+            cursor_ = stop;
+        }
+
+        geometry::PointCloud batch;
+        if (num_rows == 0) {
+            return batch;
+        }
+        const core::Tensor rows(values, {num_rows, num_columns_},
+                                core::Dtype::Float64);
+        batch.SetPoints(rows.Slice(1, 0, 3).Contiguous());
+        if (format_ == "xyzn") {
+            batch.SetPointNormals(rows.Slice(1, 3, 6).Contiguous());
+        } else if (format_ == "xyzrgb") {
+            batch.SetPointColors(rows.Slice(1, 3, 6).Contiguous());
+        } else if (format_ == "xyzi") {
+            batch.SetPointAttr("intensities",
+                               rows.Slice(1, 3, 4).Contiguous());
+        }
+        return batch;
+    }
+
+    std::string GetFilename() const override { return filename_; }
+
+private:
+    std::string format_;
+    int num_columns_;
+    std::unique_ptr<utility::filesystem::MappedFile> mapped_file_;
+    const char *cursor_ = nullptr;
+    const char *end_ = nullptr;
+    std::string filename_;
+};
+
+/// Returns the PLY name of the property type for \p dtype, nullptr if PLY
+/// has no such type.
+const char *GetPLYTypeName(core::Dtype dtype) {
+    if (dtype == core::Dtype::UInt8) {
+        return "uchar";
+    } else if (dtype == core::Dtype::UInt16) {
+        return "ushort";
+    } else if (dtype == core::Dtype::Int32) {
+        return "int";
+    } else if (dtype == core::Dtype::Float32) {
+        return "float";
+    } else if (dtype == core::Dtype::Float64) {
+        return "double";
+    } else {
+        return nullptr;
+    }
+}
+
+// Floating point values are printed with enough digits to be read back
+// exactly.
+template <typename T>
+int PrintPLYValue(FILE *file, T value) {
+    return fprintf(file, "%d", int(value));
+}
+
+template <>
+int PrintPLYValue<float>(FILE *file, float value) {
+    return fprintf(file, "%.9g", value);
+}
+
+template <>
+int PrintPLYValue<double>(FILE *file, double value) {
+    return fprintf(file, "%.17g", value);
+}
+
+/// Writes the vertex records of a PLY file, with a vertex count that is
+/// rewritten on Close().
+class PLYStreamWriter : public PointCloudStreamWriter {
+public:
+    explicit PLYStreamWriter(bool write_ascii) : write_ascii_(write_ascii) {}
+
+    ~PLYStreamWriter() override {
+        if (IsOpened()) {
+            Close();
+        }
+    }
+
+    bool IsOpened() const override { return file_ != nullptr; }
+
+    bool Open(const std::string &filename) override {
+        if (IsOpened()) {
+            Close();
+        }
+        file_ = utility::filesystem::FOpen(filename, "wb");
+        if (file_ == nullptr) {
+            utility::LogWarning("Write PLY failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        columns_.clear();
+        num_points_ = 0;
+        return true;
+    }
+
+    bool Write(const geometry::PointCloud &pointcloud) override {
+        if (!IsOpened()) {
+            utility::LogWarning("Write PLY failed: file is not opened.");
+            return false;
+        }
+        if (!pointcloud.HasPoints()) {
+            utility::LogWarning("Write PLY failed: batch has no points.");
+            return false;
+        }
+        if (columns_.empty()) {
+            AddColumns(pointcloud);
+            if (!WriteHeader()) {
+                return false;
+            }
+        }
+
+        const int64_t num_points = pointcloud.GetPoints().GetLength();
+        std::vector<core::Tensor> data;
+        size_t record_size = 0;
+        for (const Column &column : columns_) {
+            if (!pointcloud.HasPointAttr(column.attr_)) {
+                utility::LogWarning(
+                        "Write PLY failed: batch has no attribute {}.",
+                        column.attr_);
+                return false;
+            }
+            const core::Tensor &attr = pointcloud.GetPointAttr(column.attr_);
+            if (attr.GetLength() != num_points ||
+                attr.NumElements() !=
+                        num_points * int64_t(column.names_.size())) {
+                utility::LogWarning(
+                        "Write PLY failed: attribute {} has shape {}.",
+                        column.attr_, attr.GetShape());
+                return false;
+            }
+            data.push_back(ToContiguousCPU(attr, column.dtype_));
+            record_size += column.names_.size() * column.dtype_.ByteSize();
+        }
+
+        if (write_ascii_) {
+            for (int64_t i = 0; i < num_points; ++i) {
+                for (size_t c = 0; c < columns_.size(); ++c) {
+                    const int64_t width = int64_t(columns_[c].names_.size());
+                    DISPATCH_DTYPE_TO_TEMPLATE(columns_[c].dtype_, [&]() {
+                        const scalar_t *values =
+                                static_cast<const scalar_t *>(
+                                        data[c].GetDataPtr()) +
+                                i * width;
+                        for (int64_t k = 0; k < width; ++k) {
+                            if (c + k > 0) {
+                                fputc(' ', file_);
+                            }
+                            PrintPLYValue(file_, values[k]);
+                        }
+                    });
+                }
+                if (fputc('\n', file_) == EOF) {
+                    utility::LogWarning(
+                            "Write PLY failed: unable to write data.");
+                    return false;
+                }
+            }
+        } else {
+            // Interleave the columns into records and write them at once.
+            std::vector<char> buffer(num_points * record_size);
+            size_t offset = 0;
+            for (size_t c = 0; c < columns_.size(); ++c) {
+                const char *src =
+                        static_cast<const char *>(data[c].GetDataPtr());
+                const size_t size = columns_[c].names_.size() *
+                                    columns_[c].dtype_.ByteSize();
+#pragma omp parallel for schedule(static)
+                for (int64_t i = 0; i < num_points; ++i) {
+                    std::memcpy(buffer.data() + i * record_size + offset,
+                                src + i * size, size);
+                }
+                offset += size;
+            }
+            if (fwrite(buffer.data(), 1, buffer.size(), file_) !=
+                buffer.size()) {
+                utility::LogWarning("Write PLY failed: unable to write data.");
+                return false;
+            }
+        }
+        num_points_ += num_points;
+        return true;
+    }
+
+    bool Close() override {
+        if (!IsOpened()) {
+            return false;
+        }
+        if (columns_.empty()) {
+            columns_.push_back(
+                    {"points", {"x", "y", "z"}, core::Dtype::Float32});
+        }
+        bool success = fseek(file_, 0, SEEK_SET) == 0 && WriteHeader();
+        success = fclose(file_) == 0 && success;
+        file_ = nullptr;
+        if (!success) {
+            utility::LogWarning("Write PLY failed: unable to write header.");
+        }
+        return success;
+    }
+
+    int64_t GetNumPointsWritten() const override { return num_points_; }
+
+private:
+    struct Column {
+        std::string attr_;
+        std::vector<std::string> names_;
+        core::Dtype dtype_;
+    };
+
+    void AddColumns(const geometry::PointCloud &pointcloud) {
+        auto add_column = [&](const std::string &attr,
+                              const std::vector<std::string> &names) {
+            core::Dtype dtype = pointcloud.GetPointAttr(attr).GetDtype();
+            if (GetPLYTypeName(dtype) == nullptr) {
+                dtype = core::Dtype::Float64;
+            }
+            columns_.push_back({attr, names, dtype});
+        };
+        add_column("points", {"x", "y", "z"});
+        if (pointcloud.HasPointNormals()) {
+            add_column("normals", {"nx", "ny", "nz"});
+        }
+        if (pointcloud.HasPointColors()) {
+            add_column("colors", {"red", "green", "blue"});
+        }
+
+        // Other attributes become scalar properties, in name order.
+        std::vector<std::string> names;
+        for (const auto &it : pointcloud.GetPointAttr()) {
+            if (it.first != "points" && it.first != "normals" &&
+                it.first != "colors") {
+                names.push_back(it.first);
+            }
+        }
+        std::sort(names.begin(), names.end());
+        for (const std::string &name : names) {
+            const core::Tensor &attr = pointcloud.GetPointAttr(name);
+            if (attr.NumDims() > 2 ||
+                (attr.NumDims() == 2 && attr.GetShape(1) != 1)) {
+                utility::LogWarning(
+                        "Write PLY warning: skipping attribute {} with shape "
+                        "{}.",
+                        name, attr.GetShape());
+                continue;
+            }
+            add_column(name, {name});
+        }
+    }
+
+    bool WriteHeader() {
+        const char *format = write_ascii_ ? "ascii"
+                             : IsHostLittleEndian() ? "binary_little_endian"
+                                                    : "binary_big_endian";
+        fprintf(file_, "ply\nformat %s 1.0\n", format);
+        fprintf(file_, "comment Created by Open3D\n");
+        fprintf(file_, "element vertex %-*lld\n", kCountWidth,
+                static_cast<long long>(num_points_));
+        for (const Column &column : columns_) {
+            for (const std::string &name : column.names_) {
+                fprintf(file_, "property %s %s\n",
+                        GetPLYTypeName(column.dtype_), name.c_str());
+            }
+        }
+        return fprintf(file_, "end_header\n") > 0;
+    }
+
+    /// Width of the vertex count, which fits any int64_t.
+    static const int kCountWidth = 19;
+
+    bool write_ascii_;
+    FILE *file_ = nullptr;
+    std::vector<Column> columns_;
+    int64_t num_points_ = 0;
+};
+
+/// Writes the points, normals and colors of the batches through the PCD
+/// writer, with WIDTH and POINTS rewritten on Close().
+class PCDStreamWriter : public PointCloudStreamWriter {
+public:
+    PCDStreamWriter(bool write_ascii, bool compressed)
+        : write_ascii_(write_ascii), compressed_(compressed) {}
+
+    ~PCDStreamWriter() override {
+        if (IsOpened()) {
+            Close();
+        }
+    }
+
+    bool IsOpened() const override { return file_ != nullptr; }
+
+    bool Open(const std::string &filename) override {
+        if (IsOpened()) {
+            Close();
+        }
+        file_ = utility::filesystem::FOpen(filename, "wb");
+        if (file_ == nullptr) {
+            utility::LogWarning("Write PCD failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        if (compressed_ && !write_ascii_) {
+            utility::LogWarning(
+                    "Write PCD warning: binary_compressed data cannot be "
+                    "appended to, writing binary data instead.");
+        }
+        has_header_ = false;
+        num_points_ = 0;
+        return true;
+    }
+
+    bool Write(const geometry::PointCloud &pointcloud) override {
+        if (!IsOpened()) {
+            utility::LogWarning("Write PCD failed: file is not opened.");
+            return false;
+        }
+        const open3d::geometry::PointCloud batch =
+                pointcloud.ToLegacyPointCloud();
+        if (!has_header_) {
+            if (!open3d::io::GeneratePCDHeader(batch, write_ascii_, false,
+                                               header_)) {
+                utility::LogWarning("Write PCD failed: batch has no points.");
+                return false;
+            }
+            has_normals_ = batch.HasNormals();
+            has_colors_ = batch.HasColors();
+            if (!open3d::io::WritePCDHeader(file_, header_, kCountWidth)) {
+                return false;
+            }
+            has_header_ = true;
+        }
+        if (batch.HasNormals() != has_normals_ ||
+            batch.HasColors() != has_colors_) {
+            utility::LogWarning(
+                    "Write PCD failed: batch attributes differ from the "
+                    "first batch.");
+            return false;
+        }
+        if (!open3d::io::WritePCDData(file_, header_, batch, {})) {
+            return false;
+        }
+        num_points_ += int64_t(batch.points_.size());
+        return true;
+    }
+
+    bool Close() override {
+        if (!IsOpened()) {
+            return false;
+        }
+        if (!has_header_) {
+            open3d::geometry::PointCloud empty;
+            empty.points_.push_back(Eigen::Vector3d::Zero());
+            open3d::io::GeneratePCDHeader(empty, write_ascii_, false,
+                                          header_);
+        }
+        bool success = num_points_ <= std::numeric_limits<int>::max();
+        header_.width = int(num_points_);
+        header_.points = int(num_points_);
+        success = success && fseek(file_, 0, SEEK_SET) == 0 &&
+                  open3d::io::WritePCDHeader(file_, header_, kCountWidth);
+        success = fclose(file_) == 0 && success;
+        file_ = nullptr;
+        if (!success) {
+            utility::LogWarning("Write PCD failed: unable to write header.");
+        }
+        return success;
+    }
+
+    int64_t GetNumPointsWritten() const override { return num_points_; }
+
+private:
+    /// Width of WIDTH and POINTS, which fits any int.
+    static const int kCountWidth = 10;
+
+    bool write_ascii_;
+    bool compressed_;
+    FILE *file_ = nullptr;
+    open3d::io::PCDHeader header_;
+    bool has_header_ = false;
+    bool has_normals_ = false;
+    bool has_colors_ = false;
+    int64_t num_points_ = 0;
+};
+
+/// Appends the lines of XYZ, XYZN, XYZRGB and XYZI files.
+class TextStreamWriter : public PointCloudStreamWriter {
+public:
+    explicit TextStreamWriter(const std::string &format) : format_(format) {}
+
+    ~TextStreamWriter() override {
+        if (IsOpened()) {
+            Close();
+        }
+    }
+
+    bool IsOpened() const override { return file_ != nullptr; }
+
+    bool Open(const std::string &filename) override {
+        if (IsOpened()) {
+            Close();
+        }
+        file_ = utility::filesystem::FOpen(filename, "w");
+        if (file_ == nullptr) {
+            utility::LogWarning("Write {} failed: unable to open file: {}",
+                                utility::ToUpper(format_), filename);
+            return false;
+        }
+        num_points_ = 0;
+        return true;
+    }
+
+    bool Write(const geometry::PointCloud &pointcloud) override {
+        const std::string name = utility::ToUpper(format_);
+        if (!IsOpened()) {
+            utility::LogWarning("Write {} failed: file is not opened.", name);
+            return false;
+        }
+        std::string attr;
+        if (format_ == "xyzn") {
+            attr = "normals";
+        } else if (format_ == "xyzrgb") {
+            attr = "colors";
+        } else if (format_ == "xyzi") {
+            attr = "intensities";
+        }
+        if (!pointcloud.HasPoints() ||
+            (!attr.empty() && !pointcloud.HasPointAttr(attr))) {
+            utility::LogWarning("Write {} failed: batch has no {}.", name,
+                                attr.empty() ? "points" : attr);
+            return false;
+        }
+
+        const int64_t num_points = pointcloud.GetPoints().GetLength();
+        const core::Tensor points = ToContiguousCPU(pointcloud.GetPoints(),
+                                                    core::Dtype::Float64);
+        core::Tensor values;
+        int64_t width = 0;
+        if (!attr.empty()) {
+            values = ToContiguousCPU(pointcloud.GetPointAttr(attr),
+                                     core::Dtype::Float64);
+            width = format_ == "xyzi" ? 1 : 3;
+            if (values.NumElements() != num_points * width) {
+                utility::LogWarning(
+                        "Write {} failed: {} has shape {}, but there are {} "
+                        "points.",
+                        name, attr, values.GetShape(), num_points);
+                return false;
+            }
+        }
+        if (points.NumElements() != num_points * 3) {
+            utility::LogWarning(
+                    "Write {} failed: Shape of points is {}, but it should be "
+                    "Nx3.",
+                    name, points.GetShape());
+            return false;
+        }
+
+        const double *points_ptr =
+                static_cast<const double *>(points.GetDataPtr());
+        const double *values_ptr =
+                width > 0 ? static_cast<const double *>(values.GetDataPtr())
+                          : nullptr;
+        for (int64_t i = 0; i < num_points; ++i) {
+            const double *point = points_ptr + 3 * i;
+            fprintf(file_, "%.10f %.10f %.10f", point[0], point[1], point[2]);
+            for (int64_t k = 0; k < width; ++k) {
+                fprintf(file_, " %.10f", values_ptr[width * i + k]);
+            }
+            if (fputc('\n', file_) == EOF) {
+                utility::LogWarning("Write {} failed: unable to write data.",
+                                    name);
+                return false;
+            }
+        }
+        num_points_ += num_points;
+        return true;
+    }
+
+    bool Close() override {
+        if (!IsOpened()) {
+            return false;
+        }
+        const bool success = fclose(file_) == 0;
+        file_ = nullptr;
+        return success;
+    }
+
+    int64_t GetNumPointsWritten() const override { return num_points_; }
+
+private:
+    std::string format_;
+    FILE *file_ = nullptr;
+    int64_t num_points_ = 0;
+};
+
+}  // unnamed namespace
+
+std::shared_ptr<PointCloudStreamReader> PointCloudStreamReader::Create(
+        const std::string &filename, const std::string &format) {
+    const std::string file_format =
+            format == "auto"
+                    ? utility::filesystem::GetFileExtensionInLowerCase(
+                              filename)
+                    : format;
+
+    std::shared_ptr<PointCloudStreamReader> reader;
+    if (file_format == "ply") {
+        reader = std::make_shared<PLYStreamReader>();
+    } else if (file_format == "pcd") {
+        reader = std::make_shared<PCDStreamReader>();
+    } else if (IsTextFormat(file_format)) {
+        reader = std::make_shared<TextStreamReader>(file_format);
+    }
+    if (reader != nullptr && reader->Open(filename)) {
+        return reader;
+    }
+
+    // Files that cannot be decoded in batches are read completely.
+    utility::LogDebug("Reading {} completely for streaming.", filename);
+    reader = std::make_shared<InMemoryStreamReader>(file_format);
+    if (reader->Open(filename)) {
+        return reader;
+    }
+    utility::LogWarning("Unable to open {} for streaming.", filename);
+    return nullptr;
+}
+
+std::shared_ptr<PointCloudStreamWriter> PointCloudStreamWriter::Create(
+        const std::string &filename, const WritePointCloudOption &params) {
+    const std::string format =
+            utility::filesystem::GetFileExtensionInLowerCase(filename);
+
+    std::shared_ptr<PointCloudStreamWriter> writer;
+    if (format == "ply") {
+        writer = std::make_shared<PLYStreamWriter>(bool(params.write_ascii));
+    } else if (format == "pcd") {
+        writer = std::make_shared<PCDStreamWriter>(bool(params.write_ascii),
+                                                   bool(params.compressed));
+    } else if (IsTextFormat(format)) {
+        writer = std::make_shared<TextStreamWriter>(format);
+    } else {
+        utility::LogWarning("Streaming is not supported for {} files.",
+                            format);
+        return nullptr;
+    }
+    if (!writer->Open(filename)) {
+        return nullptr;
+    }
+    return writer;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
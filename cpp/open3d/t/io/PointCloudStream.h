@@ -0,0 +1,137 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/io/PointCloudIO.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class PointCloudStreamReader
+///
+/// \brief Reads a point cloud file in batches of points.
+///
+/// Binary PLY files with fixed-size vertex records, ASCII and binary PCD
+/// files and XYZ, XYZN, XYZRGB and XYZI files are decoded one batch at a
+/// time, so memory use is bounded by the batch size. Other files, such as
+/// ASCII PLY or binary_compressed PCD files, are read completely by Open()
+/// and returned in slices.
+///
+/// The batches have the attributes and dtypes that ReadPointCloud() reads
+/// from the same file.
+class PointCloudStreamReader {
+public:
+    PointCloudStreamReader() {}
+    virtual ~PointCloudStreamReader() {}
+
+    /// Check if the file is opened.
+    virtual bool IsOpened() const = 0;
+
+    /// Check if all points have been read.
+    virtual bool IsEOF() const = 0;
+
+    /// Open a point cloud file.
+    ///
+    /// \param filename Path to the point cloud file.
+    virtual bool Open(const std::string &filename) = 0;
+
+    /// Close the opened file.
+    virtual void Close() = 0;
+
+    /// Total number of points in the file, -1 if the format does not store
+    /// it.
+    virtual int64_t GetNumPoints() const = 0;
+
+    /// \brief Read the next batch of at most \p max_points points.
+    ///
+    /// Only the last batch holds fewer points. Returns an empty point cloud
+    /// at the end of the file or if reading fails. Since invalid lines of
+    /// text formats are skipped, the last batch of a text file may be empty.
+    virtual geometry::PointCloud Next(int64_t max_points) = 0;
+
+    /// Return filename being read.
+    virtual std::string GetFilename() const = 0;
+
+    /// \brief Factory function to create an opened reader based on the
+    /// file extension or \p format.
+    ///
+    /// Returns nullptr if the file cannot be opened.
+    static std::shared_ptr<PointCloudStreamReader> Create(
+            const std::string &filename, const std::string &format = "auto");
+};
+
+/// \class PointCloudStreamWriter
+///
+/// \brief Writes a point cloud file by appending batches of points.
+///
+/// PLY, PCD, XYZ, XYZN, XYZRGB and XYZI files are supported. The number of
+/// points in PLY and PCD headers is written as a space-padded placeholder and
+/// filled in by Close(). Since binary_compressed PCD data is a single
+/// compressed block, PCD files are written as binary data instead.
+class PointCloudStreamWriter {
+public:
+    PointCloudStreamWriter() {}
+    virtual ~PointCloudStreamWriter() {}
+
+    /// Check if the file is opened.
+    virtual bool IsOpened() const = 0;
+
+    /// Open a point cloud file for writing.
+    ///
+    /// \param filename Path to the point cloud file.
+    virtual bool Open(const std::string &filename) = 0;
+
+    /// \brief Append the points of \p pointcloud to the file.
+    ///
+    /// The first batch determines the attributes and dtypes that are
+    /// written. Later batches must have the same attributes.
+    virtual bool Write(const geometry::PointCloud &pointcloud) = 0;
+
+    /// Finish the header and close the file.
+    virtual bool Close() = 0;
+
+    /// Number of points written so far.
+    virtual int64_t GetNumPointsWritten() const = 0;
+
+    /// \brief Factory function to create an opened writer based on the
+    /// file extension.
+    ///
+    /// Returns nullptr if the file cannot be opened.
+    static std::shared_ptr<PointCloudStreamWriter> Create(
+            const std::string &filename,
+            const WritePointCloudOption &params = {});
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
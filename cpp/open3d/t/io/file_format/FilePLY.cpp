@@ -29,8 +29,10 @@
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/io/file_format/BinaryPLYReader.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/file_format/FilePLY.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/ProgressReporters.h"
@@ -171,9 +173,148 @@ static core::Dtype GetDtype(e_ply_type type) {
     }
 }
 
+static core::Dtype GetDtype(open3d::io::BinaryPLYReader::Type type) {
+    using Type = open3d::io::BinaryPLYReader::Type;
+    if (type == Type::UInt8) {
+        return core::Dtype::UInt8;
+    } else if (type == Type::UInt16) {
+        return core::Dtype::UInt16;
+    } else if (type == Type::Int32) {
+        return core::Dtype::Int32;
+    } else if (type == Type::Float32) {
+        return core::Dtype::Float32;
+    } else if (type == Type::Float64) {
+        return core::Dtype::Float64;
+    } else {
+        return core::Dtype::Undefined;
+    }
+}
+
+static std::string GetDtypeString(open3d::io::BinaryPLYReader::Type type) {
+    using Type = open3d::io::BinaryPLYReader::Type;
+    if (type == Type::Int8) {
+        return "int8";
+    } else if (type == Type::Int16) {
+        return "int16";
+    } else if (type == Type::UInt32) {
+        return "uint32";
+    } else {
+        return GetDtype(type).ToString();
+    }
+}
+
+bool ReadPointCloudFromBinaryPLY(
+        const open3d::io::BinaryPLYReader &reader,
+        const open3d::io::BinaryPLYReader::Element &vertex,
+        int64_t begin,
+        int64_t count,
+        geometry::PointCloud &pointcloud) {
+    if (begin < 0 || count < 0 || begin + count > vertex.count_) {
+        utility::LogWarning(
+                "Read PLY failed: vertices [{}, {}) are out of range.", begin,
+                begin + count);
+        return false;
+    }
+
+    std::unordered_map<std::string, int> name_to_property;
+    for (size_t i = 0; i < vertex.properties_.size(); ++i) {
+        const open3d::io::BinaryPLYReader::Property &property =
+                vertex.properties_[i];
+        if (property.is_list_ ||
+            GetDtype(property.type_) == core::Dtype::Undefined) {
+            // Only warn once when the vertices are read in batches.
+            if (begin == 0) {
+                utility::LogWarning(
+                        "Read PLY warning: skipping property \"{}\", "
+                        "unsupported datatype \"{}\".",
+                        property.name_,
+                        property.is_list_ ? "list"
+                                          : GetDtypeString(property.type_));
+            }
+        } else {
+            name_to_property[property.name_] = int(i);
+        }
+    }
+
+    auto read_property = [&](int property_index, core::Tensor &data,
+                             int64_t column, int64_t stride) {
+        DISPATCH_DTYPE_TO_TEMPLATE(data.GetDtype(), [&]() {
+            reader.ReadProperty(vertex, property_index, begin, count,
+                                static_cast<scalar_t *>(data.GetDataPtr()) +
+                                        column,
+                                stride);
+        });
+    };
+    auto read_vector3 = [&](const std::string &name_0,
+                            const std::string &name_1,
+                            const std::string &name_2, core::Tensor &data) {
+        if (name_to_property.count(name_0) == 0 ||
+            name_to_property.count(name_1) == 0 ||
+            name_to_property.count(name_2) == 0) {
+            return false;
+        }
+        const int indices[3] = {name_to_property.at(name_0),
+                                name_to_property.at(name_1),
+                                name_to_property.at(name_2)};
+        core::Dtype dtype = GetDtype(vertex.properties_[indices[0]].type_);
+        if (GetDtype(vertex.properties_[indices[1]].type_) != dtype ||
+            GetDtype(vertex.properties_[indices[2]].type_) != dtype) {
+            utility::LogError(
+                    "Read PLY failed: datatype mismatch in base attributes.");
+        }
+        data = core::Tensor::Empty({count, 3}, dtype);
+        for (int k = 0; k < 3; ++k) {
+            read_property(indices[k], data, k, 3);
+        }
+        name_to_property.erase(name_0);
+        name_to_property.erase(name_1);
+        name_to_property.erase(name_2);
+        return true;
+    };
+
+    pointcloud.Clear();
+
+    // Add base attributes.
+    core::Tensor data;
+    if (read_vector3("x", "y", "z", data)) {
+        pointcloud.SetPoints(data);
+    }
+    if (read_vector3("nx", "ny", "nz", data)) {
+        pointcloud.SetPointNormals(data);
+    }
+    if (read_vector3("red", "green", "blue", data)) {
+        pointcloud.SetPointColors(data);
+    }
+
+    // Add rest of the attributes.
+    for (auto const &it : name_to_property) {
+        core::Tensor attr = core::Tensor::Empty(
+                {count, 1}, GetDtype(vertex.properties_[it.second].type_));
+        read_property(it.second, attr, 0, 1);
+        pointcloud.SetPointAttr(it.first, attr);
+    }
+    return true;
+}
+
 bool ReadPointCloudFromPLY(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const open3d::io::ReadPointCloudOption &params) {
+    // Binary files with fixed-size vertex records are decoded directly from
+    // a memory mapping, without a callback per value.
+    open3d::io::BinaryPLYReader binary_reader;
+    if (binary_reader.Open(filename)) {
+        const open3d::io::BinaryPLYReader::Element *vertex =
+                binary_reader.FindElement("vertex");
+        if (vertex != nullptr && vertex->IsFixedSize()) {
+            utility::CountingProgressReporter reporter(params.update_progress);
+            reporter.SetTotal(vertex->count_);
+            const bool success = ReadPointCloudFromBinaryPLY(
+                    binary_reader, *vertex, 0, vertex->count_, pointcloud);
+            reporter.Finish();
+            return success;
+        }
+    }
+
     p_ply ply_file = ply_open(filename.c_str(), nullptr, 0, nullptr);
     if (!ply_file) {
         utility::LogWarning("Read PLY failed: unable to open file: {}.",
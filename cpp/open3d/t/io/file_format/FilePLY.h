@@ -0,0 +1,53 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+#include "open3d/io/file_format/BinaryPLYReader.h"
+#include "open3d/t/geometry/PointCloud.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \brief Reads the vertices [begin, begin + count) of a binary PLY file with
+/// fixed-size vertex records.
+///
+/// Properties x/y/z, nx/ny/nz and red/green/blue are combined into the
+/// "points", "normals" and "colors" attributes. Every other supported scalar
+/// property becomes an {N, 1} attribute of the same name.
+bool ReadPointCloudFromBinaryPLY(
+        const open3d::io::BinaryPLYReader &reader,
+        const open3d::io::BinaryPLYReader::Element &vertex,
+        int64_t begin,
+        int64_t count,
+        geometry::PointCloud &pointcloud);
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,132 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/file_format/FileQPC.h"
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/ProgressReporters.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+bool ReadPointCloudFromQPC(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const open3d::io::ReadPointCloudOption &params) {
+    open3d::io::QPCReader reader;
+    if (!reader.Open(filename)) {
+        utility::LogWarning("Read QPC failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    utility::CountingProgressReporter reporter(params.update_progress);
+    const int64_t num_points = reader.GetNumPoints();
+    core::Tensor points({num_points, 3}, core::Dtype::Float64);
+    core::Tensor normals, colors;
+    if (reader.HasNormals()) {
+        normals = core::Tensor({num_points, 3}, core::Dtype::Float64);
+    }
+    if (reader.HasColors()) {
+        colors = core::Tensor({num_points, 3}, core::Dtype::Float64);
+    }
+    if (!reader.Decode(
+                static_cast<double *>(points.GetDataPtr()),
+                reader.HasNormals() ? static_cast<double *>(
+                                              normals.GetDataPtr())
+                                    : nullptr,
+                reader.HasColors() ? static_cast<double *>(colors.GetDataPtr())
+                                   : nullptr,
+                reporter)) {
+        return false;
+    }
+    pointcloud.Clear();
+    pointcloud.SetPoints(points);
+    if (reader.HasNormals()) {
+        pointcloud.SetPointNormals(normals);
+    }
+    if (reader.HasColors()) {
+        // Colors are stored with 8 bits, as in PLY files.
+        pointcloud.SetPointColors(
+                colors.Mul(255.0).Add(0.5).To(core::Dtype::UInt8));
+    }
+    return true;
+}
+
+bool WritePointCloudToQPC(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          const open3d::io::WritePointCloudOption &params) {
+    if (!pointcloud.HasPoints()) {
+        utility::LogWarning("Write QPC failed: point cloud has 0 points.");
+        return false;
+    }
+    // The codec reads contiguous Float64 xyz triples on the CPU.
+    auto to_float64 = [](const core::Tensor &tensor) {
+        return tensor.Copy(core::Device("CPU:0"))
+                .To(core::Dtype::Float64)
+                .Contiguous();
+    };
+    const bool has_normals = pointcloud.HasPointNormals();
+    const bool has_colors = pointcloud.HasPointColors();
+    const core::Tensor points = to_float64(pointcloud.GetPoints());
+    const core::Tensor normals =
+            has_normals ? to_float64(pointcloud.GetPointNormals()) : points;
+    // UInt8 colors, as read from PLY files, are scaled to [0, 1].
+    const double color_scale =
+            has_colors && pointcloud.GetPointColors().GetDtype() ==
+                                  core::Dtype::UInt8
+                    ? 255.0
+                    : 1.0;
+    const core::Tensor colors =
+            has_colors ? to_float64(pointcloud.GetPointColors())
+                                 .Div(color_scale)
+                       : points;
+    const int64_t num_points = points.GetLength();
+    for (const core::Tensor *tensor : {&points, &normals, &colors}) {
+        if (tensor->GetShape() != core::SizeVector({num_points, 3})) {
+            utility::LogWarning(
+                    "Write QPC failed: Shape of attribute is {}, but it should "
+                    "be {}x3.",
+                    tensor->GetShape(), num_points);
+            return false;
+        }
+    }
+    utility::CountingProgressReporter reporter(params.update_progress);
+    return open3d::io::WriteQPC(
+            filename, num_points,
+            static_cast<const double *>(points.GetDataPtr()),
+            has_normals ? static_cast<const double *>(normals.GetDataPtr())
+                        : nullptr,
+            has_colors ? static_cast<const double *>(colors.GetDataPtr())
+                       : nullptr,
+            params.quantization_precision, reporter);
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
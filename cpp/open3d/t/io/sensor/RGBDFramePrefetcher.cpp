@@ -0,0 +1,277 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/sensor/RGBDFramePrefetcher.h"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "open3d/io/ImageIO.h"
+#include "open3d/t/io/sensor/RGBDVideoReader.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Helper.h"
+#ifdef BUILD_AZURE_KINECT
+#include "open3d/io/sensor/azure_kinect/MKVReader.h"
+#endif
+
+namespace open3d {
+namespace t {
+namespace io {
+
+RGBDFramePrefetcher::RGBDFramePrefetcher(const FrameLoader &load,
+                                         int64_t num_frames,
+                                         size_t queue_size,
+                                         size_t num_workers)
+    : load_(load),
+      queue_size_(std::max<size_t>(queue_size, 1)),
+      num_frames_(num_frames) {
+    num_workers = std::max<size_t>(num_workers, 1);
+    for (size_t i = 0; i < num_workers; ++i) {
+        workers_.emplace_back(&RGBDFramePrefetcher::WorkerLoop, this);
+    }
+}
+
+RGBDFramePrefetcher::~RGBDFramePrefetcher() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    space_ready_.notify_all();
+    for (std::thread &worker : workers_) {
+        worker.join();
+    }
+}
+
+void RGBDFramePrefetcher::WorkerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        space_ready_.wait(lock, [this] {
+            return stop_ || (num_frames_ >= 0 && next_index_ >= num_frames_) ||
+                   next_index_ < num_frames_read_ + int64_t(queue_size_);
+        });
+        if (stop_ || (num_frames_ >= 0 && next_index_ >= num_frames_)) {
+            return;
+        }
+        const int64_t index = next_index_++;
+        lock.unlock();
+
+        t::geometry::RGBDImage frame;
+        bool found = false;
+        std::exception_ptr error;
+        try {
+            found = load_(index, frame);
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        lock.lock();
+        if (error && !error_) {
+            error_ = error;
+        }
+        if (found && !error) {
+            frames_.emplace(index, std::move(frame));
+        } else if (num_frames_ < 0 || index < num_frames_) {
+            // The stream ends before the first frame that is missing.
+            num_frames_ = index;
+        }
+        frame_ready_.notify_all();
+        space_ready_.notify_all();
+    }
+}
+
+bool RGBDFramePrefetcher::IsEOF() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    frame_ready_.wait(lock, [this] {
+        return frames_.count(num_frames_read_) > 0 ||
+               (num_frames_ >= 0 && num_frames_read_ >= num_frames_);
+    });
+    if (frames_.count(num_frames_read_) > 0) {
+        return false;
+    }
+    if (error_) {
+        std::exception_ptr error = error_;
+        error_ = nullptr;
+        std::rethrow_exception(error);
+    }
+    return true;
+}
+
+t::geometry::RGBDImage RGBDFramePrefetcher::NextFrame() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    frame_ready_.wait(lock, [this] {
+        return frames_.count(num_frames_read_) > 0 ||
+               (num_frames_ >= 0 && num_frames_read_ >= num_frames_);
+    });
+    auto it = frames_.find(num_frames_read_);
+    if (it == frames_.end()) {
+        if (error_) {
+            std::exception_ptr error = error_;
+            error_ = nullptr;
+            std::rethrow_exception(error);
+        }
+        return t::geometry::RGBDImage();
+    }
+    t::geometry::RGBDImage frame = std::move(it->second);
+    frames_.erase(it);
+    ++num_frames_read_;
+    lock.unlock();
+    space_ready_.notify_all();
+    return frame;
+}
+
+std::shared_ptr<RGBDFramePrefetcher> RGBDFramePrefetcher::CreateFromImagePairs(
+        const std::vector<std::string> &color_filenames,
+        const std::vector<std::string> &depth_filenames,
+        const core::Device &device,
+        size_t queue_size,
+        size_t num_workers) {
+    if (color_filenames.size() != depth_filenames.size()) {
+        utility::LogError(
+                "[RGBDFramePrefetcher] Got {} color and {} depth images.",
+                color_filenames.size(), depth_filenames.size());
+    }
+    auto load = [color_filenames, depth_filenames, device](
+                        int64_t index, t::geometry::RGBDImage &frame) {
+        open3d::geometry::Image color, depth;
+        if (!open3d::io::ReadImage(color_filenames[index], color)) {
+            utility::LogError("[RGBDFramePrefetcher] Failed to read {}",
+                              color_filenames[index]);
+        }
+        if (!open3d::io::ReadImage(depth_filenames[index], depth)) {
+            utility::LogError("[RGBDFramePrefetcher] Failed to read {}",
+                              depth_filenames[index]);
+        }
+        frame = t::geometry::RGBDImage(
+                t::geometry::Image::FromLegacyImage(color, device),
+                t::geometry::Image::FromLegacyImage(depth, device));
+        return true;
+    };
+    return std::make_shared<RGBDFramePrefetcher>(
+            load, int64_t(color_filenames.size()), queue_size, num_workers);
+}
+
+std::shared_ptr<RGBDFramePrefetcher>
+RGBDFramePrefetcher::CreateFromAssociationFile(const std::string &filename,
+                                               const core::Device &device,
+                                               size_t queue_size,
+                                               size_t num_workers) {
+    std::vector<std::string> color_filenames, depth_filenames;
+    if (!ReadRGBDAssociationFile(filename, color_filenames, depth_filenames)) {
+        utility::LogError("[RGBDFramePrefetcher] Failed to read {}",
+                          filename);
+    }
+    return CreateFromImagePairs(color_filenames, depth_filenames, device,
+                                queue_size, num_workers);
+}
+
+std::shared_ptr<RGBDFramePrefetcher>
+RGBDFramePrefetcher::CreateFromVideoReader(
+        std::shared_ptr<RGBDVideoReader> reader, size_t queue_size) {
+    if (!reader || !reader->IsOpened()) {
+        utility::LogError("Null file handler. Please call Open().");
+    }
+    auto load = [reader](int64_t, t::geometry::RGBDImage &frame) {
+        if (reader->IsEOF()) {
+            return false;
+        }
+        frame = reader->NextFrame();
+        return !frame.IsEmpty();
+    };
+    return std::make_shared<RGBDFramePrefetcher>(load, -1, queue_size, 1);
+}
+
+std::shared_ptr<RGBDFramePrefetcher> RGBDFramePrefetcher::CreateFromMKVReader(
+        std::shared_ptr<open3d::io::MKVReader> reader, size_t queue_size) {
+#ifdef BUILD_AZURE_KINECT
+    if (!reader || !reader->IsOpened()) {
+        utility::LogError("Null file handler. Please call Open().");
+    }
+    auto load = [reader](int64_t, t::geometry::RGBDImage &frame) {
+        while (!reader->IsEOF()) {
+            auto rgbd = reader->NextFrame();
+            if (rgbd) {
+                frame = t::geometry::RGBDImage(
+                        t::geometry::Image::FromLegacyImage(rgbd->color_),
+                        t::geometry::Image::FromLegacyImage(rgbd->depth_));
+                return true;
+            }
+        }
+        return false;
+    };
+    return std::make_shared<RGBDFramePrefetcher>(load, -1, queue_size, 1);
+#else
+    utility::LogError(
+            "[RGBDFramePrefetcher] Open3D is built without Azure Kinect "
+            "support.");
+#endif
+}
+
+bool ReadRGBDAssociationFile(const std::string &filename,
+                             std::vector<std::string> &color_filenames,
+                             std::vector<std::string> &depth_filenames) {
+    color_filenames.clear();
+    depth_filenames.clear();
+    FILE *file = utility::filesystem::FOpen(filename, "r");
+    if (file == NULL) {
+        utility::LogWarning("Unable to open file {}", filename);
+        return false;
+    }
+    const std::string dir_name =
+            utility::filesystem::GetFileParentDirectory(filename);
+    auto to_path = [&dir_name](const std::string &path) {
+        const bool is_absolute = path[0] == '/' || path[0] == '\\' ||
+                                 (path.size() > 1 && path[1] == ':');
+        return is_absolute ? path : dir_name + path;
+    };
+    char buffer[DEFAULT_IO_BUFFER_SIZE];
+    bool success = true;
+    for (int line = 1; fgets(buffer, DEFAULT_IO_BUFFER_SIZE, file); ++line) {
+        std::vector<std::string> st;
+        utility::SplitString(st, buffer, "\t\r\n ");
+        if (st.empty() || st[0][0] == '#') {
+            continue;
+        }
+        if (st.size() == 2) {
+            depth_filenames.push_back(to_path(st[0]));
+            color_filenames.push_back(to_path(st[1]));
+        } else if (st.size() == 4) {
+            color_filenames.push_back(to_path(st[1]));
+            depth_filenames.push_back(to_path(st[3]));
+        } else {
+            utility::LogWarning("Invalid line {:d} in association file {}",
+                                line, filename);
+            success = false;
+            break;
+        }
+    }
+    fclose(file);
+    return success;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,180 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/t/geometry/RGBDImage.h"
+
+namespace open3d {
+namespace io {
+class MKVReader;
+}  // namespace io
+
+namespace t {
+namespace io {
+
+class RGBDVideoReader;
+
+/// \class RGBDFramePrefetcher
+///
+/// Decodes RGBD frames ahead of their use on a pool of worker threads, so
+/// that integration and odometry do not wait for image IO.
+///
+/// Frames are returned in order. At most \p queue_size frames are decoded
+/// and not yet returned at any time, which bounds the memory use. Frames of
+/// image pair lists are independent and are decoded by all workers. Video
+/// readers can only be read sequentially and use a single worker.
+class RGBDFramePrefetcher {
+public:
+    static const size_t DEFAULT_QUEUE_SIZE = 8;
+    static const size_t DEFAULT_NUM_WORKERS = 2;
+
+    /// Decodes frame \p index into \p frame. Returns false if there is no
+    /// such frame. Errors are reported with exceptions, which are rethrown
+    /// by IsEOF() or NextFrame().
+    using FrameLoader = std::function<bool(int64_t index,
+                                           t::geometry::RGBDImage &frame)>;
+
+    /// \brief Starts decoding frames with \p load.
+    ///
+    /// \param load Called from the worker threads. With more than one worker
+    /// it has to be thread-safe, with one worker it is called with increasing
+    /// indices.
+    /// \param num_frames Number of frames, -1 if it is only known once \p load
+    /// returns false.
+    /// \param queue_size Max number of decoded frames that are not returned
+    /// yet.
+    /// \param num_workers Number of worker threads.
+    RGBDFramePrefetcher(const FrameLoader &load,
+                        int64_t num_frames = -1,
+                        size_t queue_size = DEFAULT_QUEUE_SIZE,
+                        size_t num_workers = DEFAULT_NUM_WORKERS);
+
+    RGBDFramePrefetcher(const RGBDFramePrefetcher &) = delete;
+    RGBDFramePrefetcher &operator=(const RGBDFramePrefetcher &) = delete;
+    /// Stops the workers, waiting for the frames that are being decoded.
+    ~RGBDFramePrefetcher();
+
+    /// Check if all frames are read. Waits until the next frame is decoded
+    /// or the end of the stream is known. Rethrows the error of the loader
+    /// if the stream ends because of it.
+    bool IsEOF();
+
+    /// Returns the next frame, waiting for it if it is not decoded yet.
+    /// Returns an empty RGBDImage after the last frame.
+    t::geometry::RGBDImage NextFrame();
+
+    /// Number of frames returned by NextFrame() so far.
+    int64_t GetNumFramesRead() const { return num_frames_read_; }
+
+    /// \brief Prefetches the image pairs color_filenames[i] and
+    /// depth_filenames[i] with io::ReadImage.
+    ///
+    /// \param device The images are copied to this device by the workers.
+    static std::shared_ptr<RGBDFramePrefetcher> CreateFromImagePairs(
+            const std::vector<std::string> &color_filenames,
+            const std::vector<std::string> &depth_filenames,
+            const core::Device &device = core::Device("CPU:0"),
+            size_t queue_size = DEFAULT_QUEUE_SIZE,
+            size_t num_workers = DEFAULT_NUM_WORKERS);
+
+    /// \brief Prefetches the image pairs of an association file. See
+    /// ReadRGBDAssociationFile().
+    static std::shared_ptr<RGBDFramePrefetcher> CreateFromAssociationFile(
+            const std::string &filename,
+            const core::Device &device = core::Device("CPU:0"),
+            size_t queue_size = DEFAULT_QUEUE_SIZE,
+            size_t num_workers = DEFAULT_NUM_WORKERS);
+
+    /// \brief Prefetches the frames of an opened RGBD video, e.g. an
+    /// RSBagReader, from its current position.
+    ///
+    /// The reader must not be used by other code until the prefetcher is
+    /// destroyed.
+    static std::shared_ptr<RGBDFramePrefetcher> CreateFromVideoReader(
+            std::shared_ptr<RGBDVideoReader> reader,
+            size_t queue_size = DEFAULT_QUEUE_SIZE);
+
+    /// \brief Prefetches the frames of an opened Azure Kinect mkv file from
+    /// its current position. Frames that fail to decode are skipped.
+    ///
+    /// Requires Open3D to be built with Azure Kinect support. The reader must
+    /// not be used by other code until the prefetcher is destroyed.
+    static std::shared_ptr<RGBDFramePrefetcher> CreateFromMKVReader(
+            std::shared_ptr<open3d::io::MKVReader> reader,
+            size_t queue_size = DEFAULT_QUEUE_SIZE);
+
+private:
+    void WorkerLoop();
+
+    FrameLoader load_;
+    size_t queue_size_;
+    std::vector<std::thread> workers_;
+
+    std::mutex mutex_;
+    /// Signals the consumer that a frame was decoded or the end is known.
+    std::condition_variable frame_ready_;
+    /// Signals the workers that a frame was returned or that they have to
+    /// stop.
+    std::condition_variable space_ready_;
+    /// Decoded frames that are not returned yet, by index.
+    std::map<int64_t, t::geometry::RGBDImage> frames_;
+    /// Index of the next frame to be decoded.
+    int64_t next_index_ = 0;
+    /// Number of frames of the stream, -1 while unknown.
+    int64_t num_frames_;
+    int64_t num_frames_read_ = 0;
+    bool stop_ = false;
+    /// First error of a worker, rethrown by IsEOF() or NextFrame().
+    std::exception_ptr error_;
+};
+
+/// \brief Reads the image pairs of an association file.
+///
+/// Each line is either "depth color", as in Open3D's match files, or
+/// "timestamp color timestamp depth", as written by the TUM RGB-D benchmark
+/// association script. Relative paths are relative to the directory of
+/// \p filename. Empty lines and lines starting with '#' are skipped.
+///
+/// \return False if the file cannot be opened or has an invalid line.
+bool ReadRGBDAssociationFile(const std::string &filename,
+                             std::vector<std::string> &color_filenames,
+                             std::vector<std::string> &depth_filenames);
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
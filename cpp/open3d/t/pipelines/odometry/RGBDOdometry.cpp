@@ -0,0 +1,382 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/odometry/RGBDOdometry.h"
+
+#include <Eigen/Core>
+#include <array>
+#include <cmath>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/kernel/ParallelUtil.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Eigen.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace odometry {
+
+// Same weights as the legacy hybrid Jacobian.
+static const double kLambdaHybridDepth = 0.968;
+static const double kSobelScale = 0.125;
+
+// Upper triangle of JTJ (21), JTr (6), sum of squared residuals, count.
+static const int kReductionSize = 29;
+using LinearSystem = std::array<double, kReductionSize>;
+
+static inline void AccumulateRow(const double J[6],
+                                 double r,
+                                 LinearSystem &system) {
+    int offset = 0;
+    for (int i = 0; i < 6; ++i) {
+        for (int j = 0; j <= i; ++j) {
+            system[offset++] += J[i] * J[j];
+        }
+        system[21 + i] += J[i] * r;
+    }
+    system[27] += r * r;
+}
+
+// One Gauss-Newton step at one level with projective data association. Each
+// thread reduces a contiguous chunk of source pixels into its own linear
+// system; the per-thread systems are summed afterwards.
+static LinearSystem ComputeLinearSystem(const RGBDPyramid &source,
+                                        const RGBDPyramid &target,
+                                        int level,
+                                        const Eigen::Matrix4d &transformation,
+                                        double max_depth_diff,
+                                        Method method) {
+    const core::Tensor &vertex_s = source.vertex_map_[level];
+    const core::Tensor &vertex_t = target.vertex_map_[level];
+    const core::Tensor &normal_t = target.normal_map_[level];
+    int64_t rows_s = vertex_s.GetShape()[0];
+    int64_t cols_s = vertex_s.GetShape()[1];
+    int64_t rows_t = vertex_t.GetShape()[0];
+    int64_t cols_t = vertex_t.GetShape()[1];
+
+    const float *vertex_s_ptr =
+            static_cast<const float *>(vertex_s.GetDataPtr());
+    const float *vertex_t_ptr =
+            static_cast<const float *>(vertex_t.GetDataPtr());
+    const float *normal_t_ptr =
+            static_cast<const float *>(normal_t.GetDataPtr());
+
+    const bool use_geometry = method != Method::Intensity;
+    const bool use_intensity = method != Method::PointToPlane;
+    const float *intensity_s_ptr = nullptr, *intensity_t_ptr = nullptr,
+                *dx_t_ptr = nullptr, *dy_t_ptr = nullptr;
+    if (use_intensity) {
+        intensity_s_ptr = static_cast<const float *>(
+                source.intensity_[level].GetDataPtr());
+        intensity_t_ptr = static_cast<const float *>(
+                target.intensity_[level].GetDataPtr());
+        dx_t_ptr = static_cast<const float *>(
+                target.intensity_dx_[level].GetDataPtr());
+        dy_t_ptr = static_cast<const float *>(
+                target.intensity_dy_[level].GetDataPtr());
+    }
+
+    const double sqrt_lambda_geo =
+            method == Method::Hybrid ? std::sqrt(kLambdaHybridDepth) : 1.0;
+    const double sqrt_lambda_img =
+            method == Method::Hybrid ? std::sqrt(1.0 - kLambdaHybridDepth)
+                                     : 1.0;
+
+    Eigen::Matrix3d intrinsic = core::eigen_converter::TensorToEigenMatrixXd(
+            target.intrinsics_[level]);
+    const double fx = intrinsic(0, 0), fy = intrinsic(1, 1);
+    const double cx = intrinsic(0, 2), cy = intrinsic(1, 2);
+    const Eigen::Matrix3d R = transformation.block<3, 3>(0, 0);
+    const Eigen::Vector3d t = transformation.block<3, 1>(0, 3);
+
+    int64_t n = rows_s * cols_s;
+    int64_t num_threads = core::kernel::GetMaxThreads();
+    int64_t workload_per_thread = (n + num_threads - 1) / num_threads;
+    std::vector<LinearSystem> thread_systems(num_threads);
+
+#pragma omp parallel for schedule(static)
+    for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+        LinearSystem &system = thread_systems[thread_idx];
+        system.fill(0);
+        int64_t start = thread_idx * workload_per_thread;
+        int64_t end = std::min(start + workload_per_thread, n);
+        for (int64_t i = start; i < end; ++i) {
+            const float *vs = vertex_s_ptr + 3 * i;
+            if (vs[2] <= 0) continue;
+
+            Eigen::Vector3d p =
+                    R * Eigen::Vector3d(vs[0], vs[1], vs[2]) + t;
+            if (p(2) <= 0) continue;
+
+            double inv_z = 1.0 / p(2);
+            int64_t u = std::lround(fx * p(0) * inv_z + cx);
+            int64_t v = std::lround(fy * p(1) * inv_z + cy);
+            if (u < 0 || u >= cols_t || v < 0 || v >= rows_t) continue;
+
+            int64_t j = v * cols_t + u;
+            const float *vt = vertex_t_ptr + 3 * j;
+            if (vt[2] <= 0) continue;
+            Eigen::Vector3d diff(p(0) - vt[0], p(1) - vt[1], p(2) - vt[2]);
+            if (diff.norm() > max_depth_diff) continue;
+
+            const float *nt = normal_t_ptr + 3 * j;
+            bool valid_normal = nt[0] != 0 || nt[1] != 0 || nt[2] != 0;
+            if (method == Method::PointToPlane && !valid_normal) continue;
+
+            double J[6];
+            if (use_geometry && valid_normal) {
+                double r = sqrt_lambda_geo * (nt[0] * diff(0) +
+                                              nt[1] * diff(1) +
+                                              nt[2] * diff(2));
+                J[0] = sqrt_lambda_geo * (p(1) * nt[2] - p(2) * nt[1]);
+                J[1] = sqrt_lambda_geo * (p(2) * nt[0] - p(0) * nt[2]);
+                J[2] = sqrt_lambda_geo * (p(0) * nt[1] - p(1) * nt[0]);
+                J[3] = sqrt_lambda_geo * nt[0];
+                J[4] = sqrt_lambda_geo * nt[1];
+                J[5] = sqrt_lambda_geo * nt[2];
+                AccumulateRow(J, r, system);
+            }
+
+            if (use_intensity) {
+                double r = sqrt_lambda_img *
+                           (intensity_t_ptr[j] - intensity_s_ptr[i]);
+                double c0 = dx_t_ptr[j] * fx * inv_z;
+                double c1 = dy_t_ptr[j] * fy * inv_z;
+                double c2 = -(c0 * p(0) + c1 * p(1)) * inv_z;
+                J[0] = sqrt_lambda_img * (p(1) * c2 - p(2) * c1);
+                J[1] = sqrt_lambda_img * (p(2) * c0 - p(0) * c2);
+                J[2] = sqrt_lambda_img * (p(0) * c1 - p(1) * c0);
+                J[3] = sqrt_lambda_img * c0;
+                J[4] = sqrt_lambda_img * c1;
+                J[5] = sqrt_lambda_img * c2;
+                AccumulateRow(J, r, system);
+            }
+            system[28] += 1;
+        }
+    }
+
+    LinearSystem result;
+    result.fill(0);
+    for (const LinearSystem &system : thread_systems) {
+        for (int k = 0; k < kReductionSize; ++k) {
+            result[k] += system[k];
+        }
+    }
+    return result;
+}
+
+RGBDPyramid CreateRGBDPyramid(const t::geometry::RGBDImage &rgbd,
+                              const core::Tensor &intrinsics,
+                              int num_levels,
+                              const OdometryOption &option) {
+    if (rgbd.depth_.IsEmpty()) {
+        utility::LogError("[CreateRGBDPyramid] Depth image is empty.");
+    }
+    if (num_levels < 1) {
+        utility::LogError("[CreateRGBDPyramid] Invalid number of levels {}.",
+                          num_levels);
+    }
+    intrinsics.AssertShape({3, 3});
+
+    // Computations run on CPU.
+    core::Device host("CPU:0");
+    t::geometry::Image depth(rgbd.depth_.AsTensor().Copy(host));
+    if (depth.GetDtype() != core::Dtype::UInt16 &&
+        depth.GetDtype() != core::Dtype::Float32) {
+        utility::LogError(
+                "[CreateRGBDPyramid] Unsupported depth dtype {}, UInt16 or "
+                "Float32 expected.",
+                depth.GetDtype().ToString());
+    }
+    float depth_scale = depth.GetDtype() == core::Dtype::UInt16
+                                ? static_cast<float>(option.depth_scale_)
+                                : 1.0f;
+
+    bool has_color = !rgbd.color_.IsEmpty();
+    t::geometry::Image intensity;
+    if (has_color) {
+        if (rgbd.color_.GetRows() != rgbd.depth_.GetRows() ||
+            rgbd.color_.GetCols() != rgbd.depth_.GetCols()) {
+            utility::LogError(
+                    "[CreateRGBDPyramid] Color and depth images must be "
+                    "aligned.");
+        }
+        t::geometry::Image color(rgbd.color_.AsTensor().Copy(host));
+        double color_scale = 1.0;
+        if (color.GetDtype() == core::Dtype::UInt8) {
+            color_scale = 1.0 / 255.0;
+        } else if (color.GetDtype() == core::Dtype::UInt16) {
+            color_scale = 1.0 / 65535.0;
+        }
+        intensity = color.To(core::Dtype::Float32, color_scale);
+        if (intensity.GetChannels() != 1) {
+            intensity = intensity.RGBToGray();
+        }
+    }
+
+    // Depth and intensity are stored as (rows, cols) views of the images.
+    auto as_2d = [](const t::geometry::Image &image) {
+        return image.AsTensor().Reshape({image.GetRows(), image.GetCols()});
+    };
+
+    core::Tensor intrinsic =
+            intrinsics.To(core::Dtype::Float64).Copy(host).Contiguous();
+    t::geometry::Image depth_level = depth.ClipTransform(
+            depth_scale, 0.0f, static_cast<float>(option.depth_max_), 0.0f);
+    RGBDPyramid pyramid;
+    for (int level = 0; level < num_levels; ++level) {
+        if (level > 0) {
+            depth_level = depth_level.PyrDownDepth(
+                    static_cast<float>(option.max_depth_diff_));
+            if (has_color) {
+                intensity = intensity.PyrDown();
+            }
+            intrinsic = intrinsic.Copy();
+            double *K = static_cast<double *>(intrinsic.GetDataPtr());
+            K[0] *= 0.5;
+            K[2] *= 0.5;
+            K[4] *= 0.5;
+            K[5] *= 0.5;
+        }
+        t::geometry::Image vertex_map = depth_level.CreateVertexMap(intrinsic);
+        pyramid.intrinsics_.push_back(intrinsic);
+        pyramid.depth_.push_back(as_2d(depth_level));
+        pyramid.vertex_map_.push_back(vertex_map.AsTensor());
+        pyramid.normal_map_.push_back(vertex_map.CreateNormalMap().AsTensor());
+        if (has_color) {
+            t::geometry::Image dx, dy;
+            std::tie(dx, dy) = intensity.FilterSobel(3);
+            pyramid.intensity_.push_back(as_2d(intensity));
+            pyramid.intensity_dx_.push_back(as_2d(dx).Mul_(kSobelScale));
+            pyramid.intensity_dy_.push_back(as_2d(dy).Mul_(kSobelScale));
+        }
+    }
+    return pyramid;
+}
+
+OdometryResult RGBDOdometryMultiScale(const RGBDPyramid &source,
+                                      const RGBDPyramid &target,
+                                      const core::Tensor &init_source_to_target,
+                                      const OdometryOption &option,
+                                      const Method &method) {
+    const std::vector<int> &iter_counts =
+            option.iteration_number_per_pyramid_level_;
+    int num_levels = static_cast<int>(iter_counts.size());
+    if (num_levels > source.NumLevels() || num_levels > target.NumLevels()) {
+        utility::LogError(
+                "[RGBDOdometryMultiScale] {} levels requested, but the "
+                "pyramids only have {} and {} levels.",
+                num_levels, source.NumLevels(), target.NumLevels());
+    }
+    if (method != Method::PointToPlane &&
+        (!source.HasIntensity() || !target.HasIntensity())) {
+        utility::LogError(
+                "[RGBDOdometryMultiScale] Color images are required for the "
+                "intensity and hybrid methods.");
+    }
+    init_source_to_target.AssertShape({4, 4});
+
+    Eigen::Matrix4d transformation =
+            core::eigen_converter::TensorToEigenMatrixXd(
+                    init_source_to_target.To(core::Dtype::Float64)
+                            .Copy(core::Device("CPU:0")));
+    const float *depth_ptr =
+            static_cast<const float *>(source.depth_[0].GetDataPtr());
+    int64_t num_valid = 0;
+    for (int64_t i = 0; i < source.depth_[0].NumElements(); ++i) {
+        num_valid += depth_ptr[i] > 0;
+    }
+
+    OdometryResult result;
+    for (int level = num_levels - 1; level >= 0; --level) {
+        for (int iter = 0; iter < iter_counts[num_levels - level - 1];
+             ++iter) {
+            LinearSystem system =
+                    ComputeLinearSystem(source, target, level, transformation,
+                                        option.max_depth_diff_, method);
+            double count = system[28];
+            if (count < 6) {
+                utility::LogWarning(
+                        "[RGBDOdometryMultiScale] Too few correspondences "
+                        "({}) at level {}.",
+                        count, level);
+                return OdometryResult();
+            }
+
+            Eigen::Matrix6d JTJ;
+            Eigen::Vector6d JTr;
+            int offset = 0;
+            for (int i = 0; i < 6; ++i) {
+                for (int j = 0; j <= i; ++j) {
+                    JTJ(i, j) = JTJ(j, i) = system[offset++];
+                }
+                JTr(i) = system[21 + i];
+            }
+
+            bool is_success;
+            Eigen::Matrix4d delta;
+            std::tie(is_success, delta) =
+                    utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JTJ,
+                                                                         JTr);
+            if (!is_success) {
+                utility::LogWarning("[RGBDOdometryMultiScale] No solution.");
+                return OdometryResult();
+            }
+            transformation = delta * transformation;
+
+            if (level == 0) {
+                result.inlier_rmse_ = std::sqrt(system[27] / count);
+                result.fitness_ = num_valid > 0 ? count / num_valid : 0;
+            }
+        }
+    }
+    result.transformation_ =
+            core::eigen_converter::EigenMatrixToTensor(transformation);
+    return result;
+}
+
+OdometryResult RGBDOdometryMultiScale(const t::geometry::RGBDImage &source,
+                                      const t::geometry::RGBDImage &target,
+                                      const core::Tensor &intrinsics,
+                                      const core::Tensor &init_source_to_target,
+                                      const OdometryOption &option,
+                                      const Method &method) {
+    int num_levels =
+            static_cast<int>(option.iteration_number_per_pyramid_level_.size());
+    RGBDPyramid source_pyramid =
+            CreateRGBDPyramid(source, intrinsics, num_levels, option);
+    RGBDPyramid target_pyramid =
+            CreateRGBDPyramid(target, intrinsics, num_levels, option);
+    return RGBDOdometryMultiScale(source_pyramid, target_pyramid,
+                                  init_source_to_target, option, method);
+}
+
+}  // namespace odometry
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
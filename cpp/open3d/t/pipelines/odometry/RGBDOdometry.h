@@ -0,0 +1,195 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/RGBDImage.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace odometry {
+
+/// Residual terms minimized by the RGB-D odometry.
+enum class Method {
+    PointToPlane,  ///< Projective point-to-plane (depth only).
+    Intensity,     ///< Photometric intensity consistency (color only).
+    Hybrid,        ///< Weighted sum of point-to-plane and intensity terms.
+};
+
+/// \class OdometryOption
+///
+/// Class that defines the tensor RGB-D odometry options.
+class OdometryOption {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param iteration_number_per_pyramid_level Number of iterations per
+    /// level of pyramid, from the coarsest to the finest level.
+    /// \param max_depth_diff Maximum distance between associated points to be
+    /// considered as a correspondence.
+    /// \param depth_scale Scale factor converting raw depth values to meters.
+    /// \param depth_max Depth values larger than depth_max are ignored.
+    OdometryOption(const std::vector<int> &iteration_number_per_pyramid_level =
+                           {10, 5, 3},
+                   double max_depth_diff = 0.07,
+                   double depth_scale = 1000.0,
+                   double depth_max = 3.0)
+        : iteration_number_per_pyramid_level_(
+                  iteration_number_per_pyramid_level),
+          max_depth_diff_(max_depth_diff),
+          depth_scale_(depth_scale),
+          depth_max_(depth_max) {}
+    ~OdometryOption() {}
+
+public:
+    /// Iteration number per image pyramid level, from the coarsest (smallest
+    /// image) to the finest (original image) level.
+    std::vector<int> iteration_number_per_pyramid_level_;
+    /// Maximum distance between associated points to be considered as a
+    /// correspondence.
+    double max_depth_diff_;
+    /// Scale factor converting raw depth values to meters.
+    double depth_scale_;
+    /// Depth values larger than depth_max are ignored.
+    double depth_max_;
+};
+
+/// \class OdometryResult
+///
+/// Class that contains the odometry results.
+class OdometryResult {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param transformation The estimated transformation matrix.
+    OdometryResult(const core::Tensor &transformation = core::Tensor::Eye(
+                           4, core::Dtype::Float64, core::Device("CPU:0")))
+        : transformation_(transformation), inlier_rmse_(0.0), fitness_(0.0) {}
+    ~OdometryResult() {}
+
+public:
+    /// The estimated 4x4 transformation matrix (Float64) mapping points in the
+    /// source camera frame to the target camera frame.
+    core::Tensor transformation_;
+    /// RMSE of the residuals of all correspondences at the finest level.
+    double inlier_rmse_;
+    /// Ratio of the number of correspondences to the number of valid source
+    /// pixels at the finest level.
+    double fitness_;
+};
+
+/// \class RGBDPyramid
+///
+/// Multi-scale representation of an RGB-D frame holding everything the
+/// odometry needs from either the source or the target. A pyramid can be
+/// built once per frame and reused: in frame-to-frame tracking, the pyramid of
+/// the current frame is the source of one call and the target of the next.
+/// All tensors are Float32 and stored on CPU:0, where the odometry is computed.
+/// Level 0 is the finest (original resolution).
+class RGBDPyramid {
+public:
+    /// Number of pyramid levels.
+    int NumLevels() const { return static_cast<int>(depth_.size()); }
+
+    /// Whether intensity (and its gradients) are available.
+    bool HasIntensity() const { return !intensity_.empty(); }
+
+public:
+    /// 3x3 Float64 camera intrinsic matrix per level.
+    std::vector<core::Tensor> intrinsics_;
+    /// Depth in meters, (rows, cols). Invalid depth is 0.
+    std::vector<core::Tensor> depth_;
+    /// Vertices in the camera frame, (rows, cols, 3).
+    std::vector<core::Tensor> vertex_map_;
+    /// Unit normals in the camera frame, (rows, cols, 3). Invalid normals are
+    /// 0.
+    std::vector<core::Tensor> normal_map_;
+    /// Intensity in [0, 1], (rows, cols).
+    std::vector<core::Tensor> intensity_;
+    /// Horizontal intensity gradient (Sobel), (rows, cols).
+    std::vector<core::Tensor> intensity_dx_;
+    /// Vertical intensity gradient (Sobel), (rows, cols).
+    std::vector<core::Tensor> intensity_dy_;
+};
+
+/// \brief Create the pyramid used by RGBDOdometryMultiScale for an RGB-D frame.
+///
+/// \param rgbd RGB-D image. Depth must be UInt16 or Float32. Color may be
+/// empty, in which case only Method::PointToPlane can be used.
+/// \param intrinsics 3x3 camera intrinsic matrix.
+/// \param num_levels Number of pyramid levels.
+/// \param option Odometry options providing depth_scale, depth_max and
+/// max_depth_diff.
+RGBDPyramid CreateRGBDPyramid(const t::geometry::RGBDImage &rgbd,
+                              const core::Tensor &intrinsics,
+                              int num_levels,
+                              const OdometryOption &option = OdometryOption());
+
+/// \brief Estimate the rigid motion between two RGB-D pyramids with
+/// coarse-to-fine Gauss-Newton iterations.
+///
+/// \param source Source pyramid.
+/// \param target Target pyramid.
+/// \param init_source_to_target Initial 4x4 transformation estimation.
+/// \param option Odometry options. The number of levels used is the size of
+/// option.iteration_number_per_pyramid_level_.
+/// \param method Residual terms to minimize.
+OdometryResult RGBDOdometryMultiScale(
+        const RGBDPyramid &source,
+        const RGBDPyramid &target,
+        const core::Tensor &init_source_to_target = core::Tensor::Eye(
+                4, core::Dtype::Float64, core::Device("CPU:0")),
+        const OdometryOption &option = OdometryOption(),
+        const Method &method = Method::Hybrid);
+
+/// \brief Estimate the rigid motion between two RGB-D images. Convenience
+/// wrapper that builds both pyramids. Prefer the pyramid overload when
+/// tracking a sequence, so that each frame is preprocessed only once.
+///
+/// \param source Source RGB-D image.
+/// \param target Target RGB-D image.
+/// \param intrinsics 3x3 camera intrinsic matrix.
+/// \param init_source_to_target Initial 4x4 transformation estimation.
+/// \param option Odometry options.
+/// \param method Residual terms to minimize.
+OdometryResult RGBDOdometryMultiScale(
+        const t::geometry::RGBDImage &source,
+        const t::geometry::RGBDImage &target,
+        const core::Tensor &intrinsics,
+        const core::Tensor &init_source_to_target = core::Tensor::Eye(
+                4, core::Dtype::Float64, core::Device("CPU:0")),
+        const OdometryOption &option = OdometryOption(),
+        const Method &method = Method::Hybrid);
+
+}  // namespace odometry
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,58 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/Feature.h"
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/pipelines/registration/Feature.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+core::Tensor ComputeFPFHFeature(
+        const geometry::PointCloud &input,
+        const open3d::geometry::KDTreeSearchParam &search_param) {
+    if (!input.HasPointNormals()) {
+        utility::LogError(
+                "[ComputeFPFHFeature] Failed because input point cloud has no "
+                "normal.");
+    }
+    // The columns of the 33 x N matrix have the layout of the rows of a
+    // row-major N x 33 tensor.
+    const Eigen::MatrixXf feature =
+            open3d::pipelines::registration::ComputeFPFHFeatureFloat(
+                    input.ToLegacyPointCloud(), search_param);
+    return core::Tensor(feature.data(), {feature.cols(), 33},
+                        core::Dtype::Float32, input.GetDevice());
+}
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,54 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/KDTreeSearchParam.h"
+#include "open3d/t/geometry/PointCloud.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+/// \brief Function to compute FPFH feature for a point cloud.
+///
+/// The features are computed on CPU; point clouds on other devices are
+/// copied once per call.
+///
+/// \param input The input point cloud with normals.
+/// \param search_param KDTree search parameter for the neighborhoods.
+/// \return Float32 tensor of shape {N, 33} on the device of the input.
+core::Tensor ComputeFPFHFeature(
+        const geometry::PointCloud &input,
+        const open3d::geometry::KDTreeSearchParam &search_param =
+                open3d::geometry::KDTreeSearchParamKNN());
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
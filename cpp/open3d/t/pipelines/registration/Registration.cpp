@@ -0,0 +1,389 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/Registration.h"
+
+#include <Eigen/Core>
+#include <cmath>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+static core::Tensor CopyToHost(const core::Tensor &tensor,
+                               core::Dtype dtype,
+                               bool force_copy) {
+    core::Device host("CPU:0");
+    core::Tensor result = tensor;
+    if (result.GetDevice() != host) {
+        result = result.Copy(host);
+    } else if (force_copy && result.GetDtype() == dtype) {
+        result = result.Copy();
+    }
+    return result.To(dtype).Contiguous();
+}
+
+static Eigen::Matrix4d TransformationToEigen(
+        const core::Tensor &transformation) {
+    transformation.AssertShape({4, 4});
+    return core::eigen_converter::TensorToEigenMatrixXd(
+            CopyToHost(transformation, core::Dtype::Float64, false));
+}
+
+/// Applies points = R * points + t in place.
+template <typename scalar_t>
+static void TransformPointsInPlace(core::Tensor &points,
+                                   const Eigen::Matrix4d &transformation) {
+    scalar_t *points_ptr = static_cast<scalar_t *>(points.GetDataPtr());
+    int64_t n = points.GetLength();
+    const Eigen::Matrix4d T = transformation;
+
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < n; ++i) {
+        scalar_t *p = points_ptr + 3 * i;
+        double x = p[0], y = p[1], z = p[2];
+        for (int k = 0; k < 3; ++k) {
+            p[k] = static_cast<scalar_t>(T(k, 0) * x + T(k, 1) * y +
+                                         T(k, 2) * z + T(k, 3));
+        }
+    }
+}
+
+static void TransformPointsInPlace(core::Tensor &points,
+                                   const Eigen::Matrix4d &transformation) {
+    if (points.GetDtype() == core::Dtype::Float32) {
+        TransformPointsInPlace<float>(points, transformation);
+    } else {
+        TransformPointsInPlace<double>(points, transformation);
+    }
+}
+
+/// Queries the nearest target point of every source point and keeps the pairs
+/// within max_correspondence_distance.
+template <typename scalar_t>
+static RegistrationResult GetRegistrationResultAndCorrespondences(
+        const core::Tensor &source_points,
+        core::nns::NearestNeighborSearch &target_nns,
+        double max_correspondence_distance,
+        const core::Tensor &transformation) {
+    RegistrationResult result(transformation);
+    int64_t num_source = source_points.GetLength();
+    if (num_source == 0) {
+        result.correspondence_set_ = std::make_pair(
+                core::Tensor({0}, core::Dtype::Int64),
+                core::Tensor({0}, core::Dtype::Int64));
+        return result;
+    }
+
+    core::Tensor indices, distances2;
+    std::tie(indices, distances2) = target_nns.KnnSearch(source_points, 1);
+    indices = indices.To(core::Dtype::Int64).Contiguous();
+    distances2 = distances2.Contiguous();
+    const int64_t *indices_ptr =
+            static_cast<const int64_t *>(indices.GetDataPtr());
+    const scalar_t *distances2_ptr =
+            static_cast<const scalar_t *>(distances2.GetDataPtr());
+
+    // Sequential compaction keeps the correspondences ordered by source index
+    // and is cheap compared to the search itself.
+    const double max_distance2 =
+            max_correspondence_distance * max_correspondence_distance;
+    core::Tensor source_indices({num_source}, core::Dtype::Int64);
+    core::Tensor target_indices({num_source}, core::Dtype::Int64);
+    int64_t *source_indices_ptr =
+            static_cast<int64_t *>(source_indices.GetDataPtr());
+    int64_t *target_indices_ptr =
+            static_cast<int64_t *>(target_indices.GetDataPtr());
+    int64_t count = 0;
+    double error2 = 0.0;
+    for (int64_t i = 0; i < num_source; ++i) {
+        if (indices_ptr[i] >= 0 && distances2_ptr[i] <= max_distance2) {
+            source_indices_ptr[count] = i;
+            target_indices_ptr[count] = indices_ptr[i];
+            error2 += distances2_ptr[i];
+            ++count;
+        }
+    }
+
+    result.correspondence_set_ =
+            std::make_pair(source_indices.Slice(0, 0, count).Contiguous(),
+                           target_indices.Slice(0, 0, count).Contiguous());
+    if (count > 0) {
+        result.fitness_ = static_cast<double>(count) / num_source;
+        result.inlier_rmse_ = std::sqrt(error2 / count);
+    }
+    return result;
+}
+
+static RegistrationResult GetRegistrationResultAndCorrespondences(
+        const core::Tensor &source_points,
+        core::nns::NearestNeighborSearch &target_nns,
+        double max_correspondence_distance,
+        const core::Tensor &transformation) {
+    if (source_points.GetDtype() == core::Dtype::Float32) {
+        return GetRegistrationResultAndCorrespondences<float>(
+                source_points, target_nns, max_correspondence_distance,
+                transformation);
+    } else {
+        return GetRegistrationResultAndCorrespondences<double>(
+                source_points, target_nns, max_correspondence_distance,
+                transformation);
+    }
+}
+
+static void AssertPointsDtype(const core::Tensor &points) {
+    core::Dtype dtype = points.GetDtype();
+    if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Float64) {
+        utility::LogError("Points must be Float32 or Float64, but got {}.",
+                          dtype.ToString());
+    }
+}
+
+RegistrationResult EvaluateRegistration(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        double max_correspondence_distance,
+        const core::Tensor &transformation /* = Eye(4) */) {
+    if (max_correspondence_distance <= 0.0) {
+        utility::LogError(
+                "max_correspondence_distance must be positive, but got {}.",
+                max_correspondence_distance);
+    }
+    AssertPointsDtype(target.GetPoints());
+    core::Tensor target_points = CopyToHost(
+            target.GetPoints(), target.GetPoints().GetDtype(), false);
+    core::nns::NearestNeighborSearch target_nns(target_points);
+    if (!target_nns.KnnIndex()) {
+        utility::LogError("Failed to build the KNN index of the target.");
+    }
+
+    Eigen::Matrix4d T = TransformationToEigen(transformation);
+    core::Tensor source_points =
+            CopyToHost(source.GetPoints(), target_points.GetDtype(), true);
+    TransformPointsInPlace(source_points, T);
+    return GetRegistrationResultAndCorrespondences(
+            source_points, target_nns, max_correspondence_distance,
+            core::eigen_converter::EigenMatrixToTensor(T));
+}
+
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        double max_correspondence_distance,
+        const core::Tensor &init /* = Eye(4) */,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint()*/,
+        const ICPConvergenceCriteria &criteria
+        /* = ICPConvergenceCriteria()*/) {
+    AssertPointsDtype(target.GetPoints());
+    core::Tensor target_points = CopyToHost(
+            target.GetPoints(), target.GetPoints().GetDtype(), false);
+    core::nns::NearestNeighborSearch target_nns(target_points);
+    if (!target_nns.KnnIndex()) {
+        utility::LogError("Failed to build the KNN index of the target.");
+    }
+    return RegistrationICP(source, target, target_nns,
+                           max_correspondence_distance, init, estimation,
+                           criteria);
+}
+
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        core::nns::NearestNeighborSearch &target_nns,
+        double max_correspondence_distance,
+        const core::Tensor &init /* = Eye(4) */,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint()*/,
+        const ICPConvergenceCriteria &criteria
+        /* = ICPConvergenceCriteria()*/) {
+    if (max_correspondence_distance <= 0.0) {
+        utility::LogError(
+                "max_correspondence_distance must be positive, but got {}.",
+                max_correspondence_distance);
+    }
+    AssertPointsDtype(target.GetPoints());
+    if (estimation.GetTransformationEstimationType() ==
+                TransformationEstimationType::PointToPlane &&
+        !target.HasPointNormals()) {
+        utility::LogError(
+                "TransformationEstimationPointToPlane requires target "
+                "normals.");
+    }
+
+    // The estimation only reads points and normals; build a host-side view
+    // of the target so that it is copied at most once per call.
+    core::Dtype dtype = target.GetPoints().GetDtype();
+    geometry::PointCloud target_host(
+            CopyToHost(target.GetPoints(), dtype, false));
+    if (target.HasPointNormals()) {
+        target_host.SetPointNormals(
+                CopyToHost(target.GetPointNormals(), dtype, false));
+    }
+
+    Eigen::Matrix4d transformation = TransformationToEigen(init);
+    geometry::PointCloud source_host(
+            CopyToHost(source.GetPoints(), dtype, true));
+    core::Tensor &source_points = source_host.GetPoints();
+    TransformPointsInPlace(source_points, transformation);
+
+    RegistrationResult result = GetRegistrationResultAndCorrespondences(
+            source_points, target_nns, max_correspondence_distance,
+            core::eigen_converter::EigenMatrixToTensor(transformation));
+    for (int i = 0; i < criteria.max_iteration_; i++) {
+        utility::LogDebug("ICP Iteration #{:d}: Fitness {:.4f}, RMSE {:.4f}", i,
+                          result.fitness_, result.inlier_rmse_);
+        core::Tensor update_tensor = estimation.ComputeTransformation(
+                source_host, target_host, result.correspondence_set_);
+        Eigen::Matrix4d update = TransformationToEigen(update_tensor);
+        transformation = update * transformation;
+        TransformPointsInPlace(source_points, update);
+
+        RegistrationResult backup = result;
+        result = GetRegistrationResultAndCorrespondences(
+                source_points, target_nns, max_correspondence_distance,
+                core::eigen_converter::EigenMatrixToTensor(transformation));
+        if (std::abs(backup.fitness_ - result.fitness_) <
+                    criteria.relative_fitness_ &&
+            std::abs(backup.inlier_rmse_ - result.inlier_rmse_) <
+                    criteria.relative_rmse_) {
+            break;
+        }
+    }
+    return result;
+}
+
+static geometry::PointCloud DownSampleOnHost(const geometry::PointCloud &pcd,
+                                             double voxel_size) {
+    core::Dtype dtype = pcd.GetPoints().GetDtype();
+    geometry::PointCloud pcd_host(CopyToHost(pcd.GetPoints(), dtype, false));
+    if (pcd.HasPointNormals()) {
+        pcd_host.SetPointNormals(
+                CopyToHost(pcd.GetPointNormals(), dtype, false));
+    }
+    if (voxel_size <= 0.0) {
+        return pcd_host;
+    }
+    return pcd_host.VoxelDownSample(voxel_size);
+}
+
+PointCloudPyramid CreatePointCloudPyramid(
+        const geometry::PointCloud &pcd,
+        const std::vector<double> &voxel_sizes,
+        bool build_index /* = true */) {
+    AssertPointsDtype(pcd.GetPoints());
+    PointCloudPyramid pyramid;
+    pyramid.voxel_sizes_ = voxel_sizes;
+    for (size_t i = 0; i < voxel_sizes.size(); ++i) {
+        // Consecutive levels with the same voxel size share their points.
+        if (i > 0 && voxel_sizes[i] == voxel_sizes[i - 1]) {
+            pyramid.point_clouds_.push_back(pyramid.point_clouds_.back());
+        } else {
+            pyramid.point_clouds_.push_back(
+                    DownSampleOnHost(pcd, voxel_sizes[i]));
+        }
+        if (!build_index) continue;
+
+        if (i > 0 && voxel_sizes[i] == voxel_sizes[i - 1]) {
+            pyramid.nns_.push_back(pyramid.nns_.back());
+        } else {
+            auto nns = std::make_shared<core::nns::NearestNeighborSearch>(
+                    pyramid.point_clouds_.back().GetPoints());
+            if (!nns->KnnIndex()) {
+                utility::LogError(
+                        "Failed to build the KNN index of pyramid level {}.",
+                        i);
+            }
+            pyramid.nns_.push_back(nns);
+        }
+    }
+    return pyramid;
+}
+
+RegistrationResult RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<double> &voxel_sizes,
+        const std::vector<ICPConvergenceCriteria> &criterias,
+        const std::vector<double> &max_correspondence_distances,
+        const core::Tensor &init /* = Eye(4) */,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint()*/) {
+    return RegistrationMultiScaleICP(
+            source, CreatePointCloudPyramid(target, voxel_sizes), criterias,
+            max_correspondence_distances, init, estimation);
+}
+
+RegistrationResult RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const PointCloudPyramid &target,
+        const std::vector<ICPConvergenceCriteria> &criterias,
+        const std::vector<double> &max_correspondence_distances,
+        const core::Tensor &init /* = Eye(4) */,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint()*/) {
+    int num_levels = target.NumLevels();
+    if (num_levels == 0) {
+        utility::LogError("The target pyramid has no levels.");
+    }
+    if (!target.HasIndex()) {
+        utility::LogError(
+                "The target pyramid must be created with build_index = "
+                "true.");
+    }
+    if (static_cast<int>(criterias.size()) != num_levels ||
+        static_cast<int>(max_correspondence_distances.size()) != num_levels) {
+        utility::LogError(
+                "Expected {} criterias and max_correspondence_distances, one "
+                "per level, but got {} and {}.",
+                num_levels, criterias.size(),
+                max_correspondence_distances.size());
+    }
+
+    RegistrationResult result(init);
+    core::Tensor transformation = init;
+    geometry::PointCloud source_level;
+    for (int i = 0; i < num_levels; ++i) {
+        if (i == 0 || target.voxel_sizes_[i] != target.voxel_sizes_[i - 1]) {
+            source_level = DownSampleOnHost(source, target.voxel_sizes_[i]);
+        }
+        result = RegistrationICP(source_level, target.point_clouds_[i],
+                                 *target.nns_[i],
+                                 max_correspondence_distances[i],
+                                 transformation, estimation, criterias[i]);
+        transformation = result.transformation_;
+    }
+    return result;
+}
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
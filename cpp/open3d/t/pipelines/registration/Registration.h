@@ -0,0 +1,251 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/registration/TransformationEstimation.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+class ICPConvergenceCriteria {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param relative_fitness If relative change (difference) of fitness score
+    /// is lower than relative_fitness, the iteration stops.
+    /// \param relative_rmse If relative change (difference) of inliner RMSE
+    /// score is lower than relative_rmse, the iteration stops.
+    /// \param max_iteration Maximum iteration before iteration stops.
+    ICPConvergenceCriteria(double relative_fitness = 1e-6,
+                           double relative_rmse = 1e-6,
+                           int max_iteration = 30)
+        : relative_fitness_(relative_fitness),
+          relative_rmse_(relative_rmse),
+          max_iteration_(max_iteration) {}
+    ~ICPConvergenceCriteria() {}
+
+public:
+    /// If relative change (difference) of fitness score is lower than
+    /// `relative_fitness`, the iteration stops.
+    double relative_fitness_;
+    /// If relative change (difference) of inliner RMSE score is lower than
+    /// `relative_rmse`, the iteration stops.
+    double relative_rmse_;
+    /// Maximum iteration before iteration stops.
+    int max_iteration_;
+};
+
+class RegistrationResult {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param transformation The estimated 4x4 transformation matrix.
+    RegistrationResult(const core::Tensor &transformation = core::Tensor::Eye(
+                               4, core::Dtype::Float64, core::Device("CPU:0")))
+        : transformation_(transformation), inlier_rmse_(0.0), fitness_(0.0) {}
+    ~RegistrationResult() {}
+
+public:
+    /// The estimated transformation matrix, 4x4 Float64 on CPU.
+    core::Tensor transformation_;
+    /// Correspondence set between source and target point cloud.
+    CorrespondenceSet correspondence_set_;
+    /// RMSE of all inlier correspondences. Lower is better.
+    double inlier_rmse_;
+    /// The overlapping area (# of inlier correspondences / # of points in
+    /// source). Higher is better.
+    double fitness_;
+};
+
+/// \brief Function for evaluating registration between point clouds.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param transformation The 4x4 transformation matrix to transform source to
+/// target.
+RegistrationResult EvaluateRegistration(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        double max_correspondence_distance,
+        const core::Tensor &transformation =
+                core::Tensor::Eye(4, core::Dtype::Float64,
+                                  core::Device("CPU:0")));
+
+/// \brief Functions for ICP registration.
+///
+/// Builds a KNN index on the target and runs ICP. Computation runs on CPU;
+/// point clouds on other devices are copied once per call.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud. Normals are required for
+/// point-to-plane estimation.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param init Initial 4x4 transformation estimation.
+/// \param estimation Estimation method.
+/// \param criteria Convergence criteria.
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        double max_correspondence_distance,
+        const core::Tensor &init = core::Tensor::Eye(4,
+                                                     core::Dtype::Float64,
+                                                     core::Device("CPU:0")),
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
+
+/// \brief ICP registration against a prebuilt target index.
+///
+/// Use this overload to register many sources against the same target (e.g.
+/// a sequence of scans against a map) without rebuilding the index:
+///
+///     core::nns::NearestNeighborSearch target_nns(target.GetPoints());
+///     target_nns.KnnIndex();
+///     for (const auto &source : sources) {
+///         RegistrationICP(source, target, target_nns, ...);
+///     }
+///
+/// \param target_nns KNN index built on the points of \p target (on CPU).
+/// The source points are converted to the dtype of the indexed points.
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        core::nns::NearestNeighborSearch &target_nns,
+        double max_correspondence_distance,
+        const core::Tensor &init = core::Tensor::Eye(4,
+                                                     core::Dtype::Float64,
+                                                     core::Device("CPU:0")),
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
+
+/// \class PointCloudPyramid
+///
+/// Voxel-downsampled copies of a point cloud, one per scale, together with
+/// their KNN indices. Build the pyramid of a target once and reuse it for every
+/// source registered against it. Levels are ordered as the voxel sizes they
+/// were created with, normally from the coarsest to the finest. All point
+/// clouds are stored on CPU:0, where the registration is computed.
+class PointCloudPyramid {
+public:
+    /// Number of pyramid levels.
+    int NumLevels() const { return static_cast<int>(point_clouds_.size()); }
+
+    /// Whether a KNN index was built for every level.
+    bool HasIndex() const {
+        return !point_clouds_.empty() && nns_.size() == point_clouds_.size();
+    }
+
+public:
+    /// Voxel size of each level. A non-positive size keeps the original
+    /// points.
+    std::vector<double> voxel_sizes_;
+    /// Downsampled point cloud of each level.
+    std::vector<geometry::PointCloud> point_clouds_;
+    /// KNN index on the points of each level.
+    std::vector<std::shared_ptr<core::nns::NearestNeighborSearch>> nns_;
+};
+
+/// \brief Create the pyramid used by RegistrationMultiScaleICP.
+///
+/// \param pcd The point cloud. Normals, if present, are averaged per voxel.
+/// \param voxel_sizes Voxel size of each level. A non-positive size keeps the
+/// original points at that level.
+/// \param build_index Whether to build a KNN index for each level. Only
+/// targets need one.
+PointCloudPyramid CreatePointCloudPyramid(
+        const geometry::PointCloud &pcd,
+        const std::vector<double> &voxel_sizes,
+        bool build_index = true);
+
+/// \brief Coarse-to-fine ICP registration.
+///
+/// Downsamples source and target with each voxel size in turn and runs ICP on
+/// every level, starting each level from the transformation estimated on the
+/// previous one. The three vectors must have the same length.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud. Normals are required for
+/// point-to-plane estimation.
+/// \param voxel_sizes Voxel size of each level, normally decreasing. A
+/// non-positive size uses the original points.
+/// \param criterias Convergence criteria of each level.
+/// \param max_correspondence_distances Maximum correspondence points-pair
+/// distance of each level.
+/// \param init Initial 4x4 transformation estimation.
+/// \param estimation Estimation method.
+/// \return The result of the last level.
+RegistrationResult RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<double> &voxel_sizes,
+        const std::vector<ICPConvergenceCriteria> &criterias,
+        const std::vector<double> &max_correspondence_distances,
+        const core::Tensor &init = core::Tensor::Eye(4,
+                                                     core::Dtype::Float64,
+                                                     core::Device("CPU:0")),
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint());
+
+/// \brief Coarse-to-fine ICP registration against a prebuilt target pyramid.
+///
+/// The source is downsampled with the voxel sizes of \p target. Downsampled
+/// targets and their indices are reused as is:
+///
+///     PointCloudPyramid target_pyramid =
+///             CreatePointCloudPyramid(target, {0.05, 0.025, 0.0125});
+///     for (const auto &source : sources) {
+///         RegistrationMultiScaleICP(source, target_pyramid, ...);
+///     }
+///
+/// \param target Target pyramid built with an index.
+RegistrationResult RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const PointCloudPyramid &target,
+        const std::vector<ICPConvergenceCriteria> &criterias,
+        const std::vector<double> &max_correspondence_distances,
+        const core::Tensor &init = core::Tensor::Eye(4,
+                                                     core::Dtype::Float64,
+                                                     core::Device("CPU:0")),
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint());
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
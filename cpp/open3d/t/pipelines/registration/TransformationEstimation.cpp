@@ -0,0 +1,366 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/TransformationEstimation.h"
+
+#include <Eigen/Core>
+#include <Eigen/SVD>
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/kernel/ParallelUtil.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/Eigen.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+/// Reduces reduce_func(i, partial) over i in [0, n). Each thread accumulates a
+/// contiguous chunk into its own partial sum; the partial sums are added up
+/// afterwards, so no synchronization is needed inside the loop.
+template <int N, typename func_t>
+static std::array<double, N> ParallelReduce(int64_t n, func_t reduce_func) {
+    int64_t num_threads = core::kernel::GetMaxThreads();
+    int64_t workload_per_thread = (n + num_threads - 1) / num_threads;
+    std::vector<std::array<double, N>> partials(num_threads);
+
+#pragma omp parallel for schedule(static)
+    for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+        std::array<double, N> &partial = partials[thread_idx];
+        partial.fill(0);
+        int64_t start = thread_idx * workload_per_thread;
+        int64_t end = std::min(start + workload_per_thread, n);
+        for (int64_t i = start; i < end; ++i) {
+            reduce_func(i, partial);
+        }
+    }
+
+    std::array<double, N> result;
+    result.fill(0);
+    for (const std::array<double, N> &partial : partials) {
+        for (int k = 0; k < N; ++k) {
+            result[k] += partial[k];
+        }
+    }
+    return result;
+}
+
+static void AssertCorrespondences(const geometry::PointCloud &source,
+                                  const geometry::PointCloud &target,
+                                  const CorrespondenceSet &corres) {
+    core::Device host("CPU:0");
+    source.GetPoints().AssertDevice(host);
+    target.GetPoints().AssertDevice(host);
+    if (source.GetPoints().GetDtype() != target.GetPoints().GetDtype()) {
+        utility::LogError(
+                "Source and target points must have the same dtype, but got "
+                "{} and {}.",
+                source.GetPoints().GetDtype().ToString(),
+                target.GetPoints().GetDtype().ToString());
+    }
+    corres.first.AssertDtype(core::Dtype::Int64);
+    corres.second.AssertDtype(core::Dtype::Int64);
+    corres.first.AssertDevice(host);
+    corres.second.AssertDevice(host);
+    if (corres.first.GetLength() != corres.second.GetLength()) {
+        utility::LogError(
+                "Correspondence index tensors have different lengths {} and "
+                "{}.",
+                corres.first.GetLength(), corres.second.GetLength());
+    }
+}
+
+template <typename scalar_t>
+static double ComputeRMSEPointToPoint(const core::Tensor &source_points,
+                                      const core::Tensor &target_points,
+                                      const CorrespondenceSet &corres) {
+    const scalar_t *source_ptr =
+            static_cast<const scalar_t *>(source_points.GetDataPtr());
+    const scalar_t *target_ptr =
+            static_cast<const scalar_t *>(target_points.GetDataPtr());
+    const int64_t *source_idx =
+            static_cast<const int64_t *>(corres.first.GetDataPtr());
+    const int64_t *target_idx =
+            static_cast<const int64_t *>(corres.second.GetDataPtr());
+    int64_t n = corres.first.GetLength();
+
+    std::array<double, 1> err =
+            ParallelReduce<1>(n, [&](int64_t i, std::array<double, 1> &sum) {
+                const scalar_t *p = source_ptr + 3 * source_idx[i];
+                const scalar_t *q = target_ptr + 3 * target_idx[i];
+                for (int k = 0; k < 3; ++k) {
+                    double d = static_cast<double>(p[k]) - q[k];
+                    sum[0] += d * d;
+                }
+            });
+    return std::sqrt(err[0] / n);
+}
+
+template <typename scalar_t>
+static core::Tensor ComputeTransformationPointToPoint(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const CorrespondenceSet &corres) {
+    const scalar_t *source_ptr =
+            static_cast<const scalar_t *>(source_points.GetDataPtr());
+    const scalar_t *target_ptr =
+            static_cast<const scalar_t *>(target_points.GetDataPtr());
+    const int64_t *source_idx =
+            static_cast<const int64_t *>(corres.first.GetDataPtr());
+    const int64_t *target_idx =
+            static_cast<const int64_t *>(corres.second.GetDataPtr());
+    int64_t n = corres.first.GetLength();
+
+    // Two passes (means, then centered cross-covariance) to avoid
+    // cancellation with large coordinates.
+    std::array<double, 6> sums =
+            ParallelReduce<6>(n, [&](int64_t i, std::array<double, 6> &sum) {
+                const scalar_t *p = source_ptr + 3 * source_idx[i];
+                const scalar_t *q = target_ptr + 3 * target_idx[i];
+                for (int k = 0; k < 3; ++k) {
+                    sum[k] += p[k];
+                    sum[3 + k] += q[k];
+                }
+            });
+    const Eigen::Vector3d mean_p =
+            Eigen::Vector3d(sums[0], sums[1], sums[2]) / n;
+    const Eigen::Vector3d mean_q =
+            Eigen::Vector3d(sums[3], sums[4], sums[5]) / n;
+
+    std::array<double, 9> cov =
+            ParallelReduce<9>(n, [&](int64_t i, std::array<double, 9> &sum) {
+                const scalar_t *p = source_ptr + 3 * source_idx[i];
+                const scalar_t *q = target_ptr + 3 * target_idx[i];
+                double dp[3], dq[3];
+                for (int k = 0; k < 3; ++k) {
+                    dp[k] = p[k] - mean_p(k);
+                    dq[k] = q[k] - mean_q(k);
+                }
+                for (int r = 0; r < 3; ++r) {
+                    for (int c = 0; c < 3; ++c) {
+                        sum[3 * r + c] += dq[r] * dp[c];
+                    }
+                }
+            });
+
+    // Umeyama without scaling: R = U S V^T, where S fixes reflections.
+    Eigen::Matrix3d sigma;
+    sigma << cov[0], cov[1], cov[2], cov[3], cov[4], cov[5], cov[6], cov[7],
+            cov[8];
+    Eigen::JacobiSVD<Eigen::Matrix3d> svd(
+            sigma, Eigen::ComputeFullU | Eigen::ComputeFullV);
+    Eigen::Matrix3d S = Eigen::Matrix3d::Identity();
+    if (svd.matrixU().determinant() * svd.matrixV().determinant() < 0) {
+        S(2, 2) = -1;
+    }
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    Eigen::Matrix3d R = svd.matrixU() * S * svd.matrixV().transpose();
+    transformation.block<3, 3>(0, 0) = R;
+    transformation.block<3, 1>(0, 3) = mean_q - R * mean_p;
+    return core::eigen_converter::EigenMatrixToTensor(transformation);
+}
+
+template <typename scalar_t>
+static double ComputeRMSEPointToPlane(const core::Tensor &source_points,
+                                      const core::Tensor &target_points,
+                                      const core::Tensor &target_normals,
+                                      const CorrespondenceSet &corres) {
+    const scalar_t *source_ptr =
+            static_cast<const scalar_t *>(source_points.GetDataPtr());
+    const scalar_t *target_ptr =
+            static_cast<const scalar_t *>(target_points.GetDataPtr());
+    const scalar_t *normal_ptr =
+            static_cast<const scalar_t *>(target_normals.GetDataPtr());
+    const int64_t *source_idx =
+            static_cast<const int64_t *>(corres.first.GetDataPtr());
+    const int64_t *target_idx =
+            static_cast<const int64_t *>(corres.second.GetDataPtr());
+    int64_t n = corres.first.GetLength();
+
+    std::array<double, 1> err =
+            ParallelReduce<1>(n, [&](int64_t i, std::array<double, 1> &sum) {
+                const scalar_t *p = source_ptr + 3 * source_idx[i];
+                const scalar_t *q = target_ptr + 3 * target_idx[i];
+                const scalar_t *nq = normal_ptr + 3 * target_idx[i];
+                double r = 0;
+                for (int k = 0; k < 3; ++k) {
+                    r += (static_cast<double>(p[k]) - q[k]) * nq[k];
+                }
+                sum[0] += r * r;
+            });
+    return std::sqrt(err[0] / n);
+}
+
+template <typename scalar_t>
+static core::Tensor ComputeTransformationPointToPlane(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &target_normals,
+        const CorrespondenceSet &corres) {
+    const scalar_t *source_ptr =
+            static_cast<const scalar_t *>(source_points.GetDataPtr());
+    const scalar_t *target_ptr =
+            static_cast<const scalar_t *>(target_points.GetDataPtr());
+    const scalar_t *normal_ptr =
+            static_cast<const scalar_t *>(target_normals.GetDataPtr());
+    const int64_t *source_idx =
+            static_cast<const int64_t *>(corres.first.GetDataPtr());
+    const int64_t *target_idx =
+            static_cast<const int64_t *>(corres.second.GetDataPtr());
+    int64_t n = corres.first.GetLength();
+
+    // Upper triangle of JTJ (21) and JTr (6).
+    std::array<double, 27> system = ParallelReduce<27>(
+            n, [&](int64_t i, std::array<double, 27> &sum) {
+                const scalar_t *p = source_ptr + 3 * source_idx[i];
+                const scalar_t *q = target_ptr + 3 * target_idx[i];
+                const scalar_t *nq = normal_ptr + 3 * target_idx[i];
+                const double px = p[0], py = p[1], pz = p[2];
+                const double nx = nq[0], ny = nq[1], nz = nq[2];
+
+                double r = (px - q[0]) * nx + (py - q[1]) * ny +
+                           (pz - q[2]) * nz;
+                const double J[6] = {py * nz - pz * ny, pz * nx - px * nz,
+                                     px * ny - py * nx, nx,
+                                     ny,                nz};
+                int offset = 0;
+                for (int a = 0; a < 6; ++a) {
+                    for (int b = 0; b <= a; ++b) {
+                        sum[offset++] += J[a] * J[b];
+                    }
+                    sum[21 + a] += J[a] * r;
+                }
+            });
+
+    Eigen::Matrix6d JTJ;
+    Eigen::Vector6d JTr;
+    int offset = 0;
+    for (int a = 0; a < 6; ++a) {
+        for (int b = 0; b <= a; ++b) {
+            JTJ(a, b) = JTJ(b, a) = system[offset++];
+        }
+        JTr(a) = system[21 + a];
+    }
+
+    bool is_success;
+    Eigen::Matrix4d extrinsic;
+    std::tie(is_success, extrinsic) =
+            utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JTJ, JTr);
+    return core::eigen_converter::EigenMatrixToTensor(
+            is_success ? extrinsic : Eigen::Matrix4d::Identity());
+}
+
+double TransformationEstimationPointToPoint::ComputeRMSE(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres) const {
+    AssertCorrespondences(source, target, corres);
+    if (corres.first.GetLength() == 0) return 0.0;
+
+    core::Tensor source_points = source.GetPoints().Contiguous();
+    core::Tensor target_points = target.GetPoints().Contiguous();
+    if (source_points.GetDtype() == core::Dtype::Float32) {
+        return ComputeRMSEPointToPoint<float>(source_points, target_points,
+                                              corres);
+    } else {
+        return ComputeRMSEPointToPoint<double>(source_points, target_points,
+                                               corres);
+    }
+}
+
+core::Tensor TransformationEstimationPointToPoint::ComputeTransformation(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres) const {
+    AssertCorrespondences(source, target, corres);
+    if (corres.first.GetLength() == 0) {
+        return core::Tensor::Eye(4, core::Dtype::Float64,
+                                 core::Device("CPU:0"));
+    }
+
+    core::Tensor source_points = source.GetPoints().Contiguous();
+    core::Tensor target_points = target.GetPoints().Contiguous();
+    if (source_points.GetDtype() == core::Dtype::Float32) {
+        return ComputeTransformationPointToPoint<float>(
+                source_points, target_points, corres);
+    } else {
+        return ComputeTransformationPointToPoint<double>(
+                source_points, target_points, corres);
+    }
+}
+
+double TransformationEstimationPointToPlane::ComputeRMSE(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres) const {
+    AssertCorrespondences(source, target, corres);
+    if (corres.first.GetLength() == 0) return 0.0;
+    if (!target.HasPointNormals()) return 0.0;
+
+    core::Tensor source_points = source.GetPoints().Contiguous();
+    core::Tensor target_points = target.GetPoints().Contiguous();
+    core::Tensor target_normals = target.GetPointNormals().Contiguous();
+    target_normals.AssertDtype(target_points.GetDtype());
+    if (source_points.GetDtype() == core::Dtype::Float32) {
+        return ComputeRMSEPointToPlane<float>(source_points, target_points,
+                                              target_normals, corres);
+    } else {
+        return ComputeRMSEPointToPlane<double>(source_points, target_points,
+                                               target_normals, corres);
+    }
+}
+
+core::Tensor TransformationEstimationPointToPlane::ComputeTransformation(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres) const {
+    AssertCorrespondences(source, target, corres);
+    if (corres.first.GetLength() == 0 || !target.HasPointNormals()) {
+        return core::Tensor::Eye(4, core::Dtype::Float64,
+                                 core::Device("CPU:0"));
+    }
+
+    core::Tensor source_points = source.GetPoints().Contiguous();
+    core::Tensor target_points = target.GetPoints().Contiguous();
+    core::Tensor target_normals = target.GetPointNormals().Contiguous();
+    target_normals.AssertDtype(target_points.GetDtype());
+    if (source_points.GetDtype() == core::Dtype::Float32) {
+        return ComputeTransformationPointToPlane<float>(
+                source_points, target_points, target_normals, corres);
+    } else {
+        return ComputeTransformationPointToPlane<double>(
+                source_points, target_points, target_normals, corres);
+    }
+}
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,139 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <utility>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/PointCloud.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+/// Correspondences between a source and a target point cloud, as a pair of
+/// Int64 index tensors {source_indices, target_indices} of shape {n,}.
+typedef std::pair<core::Tensor, core::Tensor> CorrespondenceSet;
+
+enum class TransformationEstimationType {
+    Unspecified = 0,
+    PointToPoint = 1,
+    PointToPlane = 2,
+};
+
+/// \class TransformationEstimation
+///
+/// Base class that estimates a transformation between two point clouds. The
+/// virtual function ComputeTransformation() must be implemented in
+/// subclasses.
+///
+/// Points (and normals) may be Float32 or Float64 and must be on CPU. The
+/// normal equations are accumulated in double precision by a parallel
+/// reduction over the correspondences.
+class TransformationEstimation {
+public:
+    TransformationEstimation() {}
+    virtual ~TransformationEstimation() {}
+
+public:
+    virtual TransformationEstimationType GetTransformationEstimationType()
+            const = 0;
+
+    /// Compute RMSE between source and target points cloud given
+    /// correspondences.
+    virtual double ComputeRMSE(const geometry::PointCloud &source,
+                               const geometry::PointCloud &target,
+                               const CorrespondenceSet &corres) const = 0;
+
+    /// Compute the transformation from source to target point cloud given
+    /// correspondences. Returns a 4x4 Float64 tensor on CPU.
+    virtual core::Tensor ComputeTransformation(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const CorrespondenceSet &corres) const = 0;
+};
+
+/// \class TransformationEstimationPointToPoint
+///
+/// Estimate a transformation for point to point distance (rigid, without
+/// scaling), in closed form from the cross-covariance of the
+/// correspondences.
+class TransformationEstimationPointToPoint : public TransformationEstimation {
+public:
+    TransformationEstimationPointToPoint() {}
+    ~TransformationEstimationPointToPoint() override {}
+
+public:
+    TransformationEstimationType GetTransformationEstimationType()
+            const override {
+        return type_;
+    };
+    double ComputeRMSE(const geometry::PointCloud &source,
+                       const geometry::PointCloud &target,
+                       const CorrespondenceSet &corres) const override;
+    core::Tensor ComputeTransformation(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const CorrespondenceSet &corres) const override;
+
+private:
+    const TransformationEstimationType type_ =
+            TransformationEstimationType::PointToPoint;
+};
+
+/// \class TransformationEstimationPointToPlane
+///
+/// Estimate a transformation for point to plane distance by one
+/// Gauss-Newton step on the linearized residuals. Requires target normals.
+class TransformationEstimationPointToPlane : public TransformationEstimation {
+public:
+    TransformationEstimationPointToPlane() {}
+    ~TransformationEstimationPointToPlane() override {}
+
+public:
+    TransformationEstimationType GetTransformationEstimationType()
+            const override {
+        return type_;
+    };
+    double ComputeRMSE(const geometry::PointCloud &source,
+                       const geometry::PointCloud &target,
+                       const CorrespondenceSet &corres) const override;
+    core::Tensor ComputeTransformation(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const CorrespondenceSet &corres) const override;
+
+private:
+    const TransformationEstimationType type_ =
+            TransformationEstimationType::PointToPlane;
+};
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -43,6 +43,7 @@
 #else
 #include <dirent.h>
 #include <limits.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #endif
@@ -556,6 +557,91 @@ size_t CFile::ReadData(void *data, size_t elem_size, size_t num_elems) {
     return elems;
 }
 
+MappedFile::~MappedFile() { Close(); }
+
+bool MappedFile::Open(const std::string &filename) {
+    Close();
+#ifdef WINDOWS
+    std::wstring filename_w;
+    filename_w.resize(filename.size());
+    int newSize = MultiByteToWideChar(CP_UTF8, 0, filename.c_str(),
+                                      static_cast<int>(filename.length()),
+                                      const_cast<wchar_t *>(filename_w.c_str()),
+                                      static_cast<int>(filename.length()));
+    filename_w.resize(newSize);
+    HANDLE file = CreateFileW(filename_w.c_str(), GENERIC_READ,
+                              FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        error_code_ = ENOENT;
+        return false;
+    }
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+        error_code_ = EIO;
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (mapping == NULL) {
+        error_code_ = EIO;
+        return false;
+    }
+    void *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (data == NULL) {
+        error_code_ = EIO;
+        CloseHandle(mapping);
+        return false;
+    }
+    mapping_ = mapping;
+    size_ = size_t(file_size.QuadPart);
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        error_code_ = errno;
+        return false;
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0) {
+        error_code_ = errno;
+        close(fd);
+        return false;
+    }
+    if (file_stat.st_size == 0) {
+        error_code_ = EIO;
+        close(fd);
+        return false;
+    }
+    void *data = mmap(nullptr, size_t(file_stat.st_size), PROT_READ,
+                      MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        error_code_ = errno;
+        return false;
+    }
+    size_ = size_t(file_stat.st_size);
+#endif
+    data_ = static_cast<const char *>(data);
+    return true;
+}
+
+std::string MappedFile::GetError() { return GetIOErrorString(error_code_); }
+
+void MappedFile::Close() {
+    if (data_) {
+#ifdef WINDOWS
+        UnmapViewOfFile(data_);
+        CloseHandle(mapping_);
+        mapping_ = nullptr;
+#else
+        munmap(const_cast<char *>(data_), size_);
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+}
+
 }  // namespace filesystem
 }  // namespace utility
 }  // namespace open3d
@@ -147,6 +147,44 @@ private:
     std::vector<char> line_buffer_;
 };
 
+/// RAII read-only memory mapping of a whole file.
+/// Pages are loaded by the OS on first access, so threads can decode
+/// different parts of a large file in parallel without a read buffer.
+class MappedFile {
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    /// The destructor unmaps the file automatically.
+    ~MappedFile();
+
+    /// Maps a file. Returns false if it cannot be opened or mapped, e.g. if
+    /// it is empty.
+    bool Open(const std::string &filename);
+
+    /// Returns the last encountered error for this file.
+    std::string GetError();
+
+    /// Unmaps the file.
+    void Close();
+
+    bool IsOpen() const { return data_ != nullptr; }
+
+    /// Returns the mapped bytes, nullptr if no file is mapped.
+    const char *GetData() const { return data_; }
+
+    /// Returns the file size in bytes.
+    size_t GetSize() const { return size_; }
+
+private:
+    const char *data_ = nullptr;
+    size_t size_ = 0;
+    int error_code_ = 0;
+#ifdef WINDOWS
+    void *mapping_ = nullptr;
+#endif
+};
+
 }  // namespace filesystem
 }  // namespace utility
 }  // namespace open3d
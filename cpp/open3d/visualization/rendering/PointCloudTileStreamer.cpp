@@ -0,0 +1,278 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/rendering/PointCloudTileStreamer.h"
+
+#include <algorithm>
+#include <array>
+#include <queue>
+#include <utility>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/utility/Console.h"
+#include "open3d/visualization/rendering/Camera.h"
+#include "open3d/visualization/rendering/Open3DScene.h"
+
+namespace open3d {
+namespace visualization {
+namespace rendering {
+
+namespace {
+
+using Plane = Eigen::Vector4d;
+
+/// Returns the planes of the view frustum of \p view_projection, with
+/// normals pointing inwards.
+std::array<Plane, 6> GetFrustumPlanes(const Eigen::Matrix4d& view_projection) {
+    std::array<Plane, 6> planes;
+    for (int i = 0; i < 3; ++i) {
+        planes[2 * i] = view_projection.row(3) + view_projection.row(i);
+        planes[2 * i + 1] = view_projection.row(3) - view_projection.row(i);
+    }
+    for (Plane& plane : planes) {
+        plane /= plane.head<3>().norm();
+    }
+    return planes;
+}
+
+bool IsSphereInFrustum(const std::array<Plane, 6>& planes,
+                       const Eigen::Vector3d& center,
+                       double radius) {
+    for (const Plane& plane : planes) {
+        if (plane.head<3>().dot(center) + plane(3) < -radius) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+PointCloudTileStreamer::PointCloudTileStreamer(
+        Open3DScene& scene,
+        const std::string& name,
+        const std::string& directory,
+        const io::PointCloudTileHierarchy& hierarchy,
+        const Material& material,
+        const Options& options)
+    : scene_(scene),
+      name_(name),
+      directory_(directory),
+      hierarchy_(hierarchy),
+      material_(material),
+      options_(options),
+      last_used_frame_(hierarchy.tiles_.size(), 0) {
+    if (hierarchy_.tiles_.empty()) {
+        utility::LogError("The tile hierarchy has no tiles.");
+    }
+    loader_ = std::thread(&PointCloudTileStreamer::LoadTiles, this);
+}
+
+PointCloudTileStreamer::~PointCloudTileStreamer() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    request_ready_.notify_all();
+    loader_.join();
+}
+
+bool PointCloudTileStreamer::Update(const Camera& camera,
+                                    int viewport_height) {
+    ++frame_;
+    const Eigen::Matrix4d projection =
+            camera.GetProjectionMatrix().matrix().cast<double>();
+    const std::array<Plane, 6> planes = GetFrustumPlanes(
+            projection * camera.GetViewMatrix().matrix().cast<double>());
+    const Eigen::Vector3d eye = camera.GetPosition().cast<double>();
+    // Pixels per unit length at distance 1 from a perspective camera, or at
+    // any distance from an orthographic one.
+    const double pixels_per_unit = projection(1, 1) * viewport_height / 2;
+    const bool is_orthographic = projection(3, 3) == 1.0;
+
+    // Select tiles by decreasing screen space error within the GPU budget.
+    std::vector<int> selected;
+    size_t selected_bytes = 0;
+    std::priority_queue<std::pair<double, int>> candidates;
+    auto push_if_visible = [&](int tile_index) {
+        const io::PointCloudTileHierarchy::Tile& tile =
+                hierarchy_.tiles_[tile_index];
+        const Eigen::Vector3d center = tile.bounds.GetCenter();
+        const double radius = tile.bounds.GetExtent().norm() / 2;
+        if (!IsSphereInFrustum(planes, center, radius)) {
+            return;
+        }
+        // Screen space error of showing the tile without its children.
+        double error = tile.spacing * pixels_per_unit;
+        if (!is_orthographic) {
+            error /= std::max((center - eye).norm() - radius, 1e-6);
+        }
+        candidates.push({error, tile_index});
+    };
+    push_if_visible(0);
+    while (!candidates.empty()) {
+        const double error = candidates.top().first;
+        const int tile_index = candidates.top().second;
+        candidates.pop();
+        const io::PointCloudTileHierarchy::Tile& tile =
+                hierarchy_.tiles_[tile_index];
+        const size_t bytes = size_t(tile.num_points) * kGPUBytesPerPoint;
+        if (selected_bytes + bytes > options_.max_gpu_memory) {
+            continue;
+        }
+        selected_bytes += bytes;
+        selected.push_back(tile_index);
+        last_used_frame_[tile_index] = frame_;
+        if (error > options_.max_screen_space_error) {
+            for (int child : tile.children) {
+                push_if_visible(child);
+            }
+        }
+    }
+
+    bool changed = false;
+    const std::unordered_set<int> selected_set(selected.begin(),
+                                               selected.end());
+    for (auto it = shown_.begin(); it != shown_.end();) {
+        if (selected_set.count(*it) == 0) {
+            scene_.RemoveGeometry(GetGeometryName(*it));
+            num_shown_points_ -= hierarchy_.tiles_[*it].num_points;
+            it = shown_.erase(it);
+            changed = true;
+        } else {
+            ++it;
+        }
+    }
+
+    // Loaded tiles are taken out under the lock and uploaded after it is
+    // released, so the loader thread never waits on the GPU upload. Marking
+    // them as shown keeps EvictTiles from dropping them in between.
+    std::vector<int> requests;
+    std::vector<std::pair<int, std::shared_ptr<geometry::PointCloud>>> ready;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (int tile_index : selected) {
+            if (shown_.count(tile_index) > 0) {
+                continue;
+            }
+            auto loaded = loaded_.find(tile_index);
+            if (loaded == loaded_.end()) {
+                requests.push_back(tile_index);
+            } else if (loaded->second) {
+                ready.emplace_back(tile_index, loaded->second);
+                shown_.insert(tile_index);
+            }
+        }
+        // The loader takes requests from the back.
+        requests_.assign(requests.rbegin(), requests.rend());
+        EvictTiles();
+    }
+    if (!requests.empty()) {
+        request_ready_.notify_one();
+    }
+    for (const auto& tile : ready) {
+        scene_.AddGeometry(GetGeometryName(tile.first), tile.second.get(),
+                           material_, false);
+        num_shown_points_ += hierarchy_.tiles_[tile.first].num_points;
+        changed = true;
+    }
+    return changed;
+}
+
+void PointCloudTileStreamer::Clear() {
+    for (int tile_index : shown_) {
+        scene_.RemoveGeometry(GetGeometryName(tile_index));
+    }
+    shown_.clear();
+    num_shown_points_ = 0;
+}
+
+void PointCloudTileStreamer::LoadTiles() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        request_ready_.wait(lock,
+                            [this]() { return stop_ || !requests_.empty(); });
+        if (stop_) {
+            return;
+        }
+        const int tile_index = requests_.back();
+        requests_.pop_back();
+        if (loaded_.count(tile_index) > 0) {
+            continue;
+        }
+        lock.unlock();
+        const io::PointCloudTileHierarchy::Tile& tile =
+                hierarchy_.tiles_[tile_index];
+        std::shared_ptr<geometry::PointCloud> pointcloud =
+                io::ReadPointCloudTile(directory_, hierarchy_, tile);
+        if (!pointcloud) {
+            utility::LogWarning("Unable to read tile {}.",
+                                hierarchy_.GetTilePath(directory_, tile));
+        }
+        lock.lock();
+        loaded_[tile_index] = pointcloud;
+        if (pointcloud) {
+            cached_bytes_ += GetCPUBytes(tile_index);
+        }
+    }
+}
+
+std::string PointCloudTileStreamer::GetGeometryName(int tile) const {
+    return name_ + "/" + hierarchy_.tiles_[tile].name;
+}
+
+size_t PointCloudTileStreamer::GetCPUBytes(int tile) const {
+    const size_t num_attributes = 1 + (hierarchy_.has_normals_ ? 1 : 0) +
+                                  (hierarchy_.has_colors_ ? 1 : 0);
+    return size_t(hierarchy_.tiles_[tile].num_points) * num_attributes *
+           sizeof(Eigen::Vector3d);
+}
+
+void PointCloudTileStreamer::EvictTiles() {
+    if (cached_bytes_ <= options_.max_cpu_memory) {
+        return;
+    }
+    std::vector<int> candidates;
+    for (const auto& loaded : loaded_) {
+        if (loaded.second && shown_.count(loaded.first) == 0) {
+            candidates.push_back(loaded.first);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(), [this](int a, int b) {
+        return last_used_frame_[a] < last_used_frame_[b];
+    });
+    for (int tile_index : candidates) {
+        if (cached_bytes_ <= options_.max_cpu_memory) {
+            break;
+        }
+        loaded_.erase(tile_index);
+        cached_bytes_ -= GetCPUBytes(tile_index);
+    }
+}
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
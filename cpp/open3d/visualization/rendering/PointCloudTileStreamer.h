@@ -0,0 +1,151 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "open3d/io/PointCloudTileIO.h"
+#include "open3d/visualization/rendering/Material.h"
+
+namespace open3d {
+
+namespace geometry {
+class PointCloud;
+}
+
+namespace visualization {
+namespace rendering {
+
+class Camera;
+class Open3DScene;
+
+/// \class PointCloudTileStreamer
+///
+/// \brief Shows a point cloud tile hierarchy written by
+/// io::WritePointCloudTiles, keeping only the tiles the camera needs on the
+/// GPU.
+///
+/// Update() selects tiles from the root down, largest screen space error
+/// first, and refines a tile while the spacing of its points projects to
+/// more than Options::max_screen_space_error pixels. Tiles that do not fit
+/// into the GPU memory budget are skipped with their subtrees. Selected
+/// tiles are added to the scene as soon as they are loaded and all others
+/// are removed. Tiles are read on a background thread and the recently used
+/// ones stay cached in memory.
+class PointCloudTileStreamer {
+public:
+    struct Options {
+        /// Maximum projected point spacing in pixels.
+        double max_screen_space_error = 2.0;
+        /// Maximum size of the vertex and index buffers of the shown tiles.
+        size_t max_gpu_memory = size_t(512) << 20;
+        /// Maximum size of the loaded tiles in memory, shown ones included.
+        size_t max_cpu_memory = size_t(2048) << 20;
+    };
+
+    /// Size of the vertex and index buffers of a point of a legacy point
+    /// cloud.
+    static constexpr size_t kGPUBytesPerPoint = 56;
+
+    /// Tiles are added to \p scene as \p name + "/" + tile name. The scene
+    /// must outlive the streamer.
+    PointCloudTileStreamer(Open3DScene& scene,
+                           const std::string& name,
+                           const std::string& directory,
+                           const io::PointCloudTileHierarchy& hierarchy,
+                           const Material& material,
+                           const Options& options);
+    /// Stops the loader thread. The shown tiles stay in the scene, call
+    /// Clear() first to remove them.
+    ~PointCloudTileStreamer();
+
+    /// \brief Updates the shown tiles for \p camera. Call once per frame
+    /// from the main thread.
+    ///
+    /// \param viewport_height Height of the view in pixels.
+    /// \return True if tiles were added or removed, so the scene needs to
+    /// be redrawn.
+    bool Update(const Camera& camera, int viewport_height);
+
+    /// Removes all tiles from the scene.
+    void Clear();
+
+    /// Bounds of the root tile.
+    const geometry::AxisAlignedBoundingBox& GetBoundingBox() const {
+        return hierarchy_.tiles_[0].bounds;
+    }
+    size_t GetNumShownTiles() const { return shown_.size(); }
+    int64_t GetNumShownPoints() const { return num_shown_points_; }
+    size_t GetGPUMemoryUsage() const {
+        return size_t(num_shown_points_) * kGPUBytesPerPoint;
+    }
+
+private:
+    /// Body of the loader thread.
+    void LoadTiles();
+    std::string GetGeometryName(int tile) const;
+    size_t GetCPUBytes(int tile) const;
+    /// Drops the least recently used loaded tiles that are not shown until
+    /// the cache fits into Options::max_cpu_memory. Requires mutex_.
+    void EvictTiles();
+
+private:
+    Open3DScene& scene_;
+    const std::string name_;
+    const std::string directory_;
+    const io::PointCloudTileHierarchy hierarchy_;
+    const Material material_;
+    const Options options_;
+
+    // Shared with the loader thread.
+    std::mutex mutex_;
+    std::condition_variable request_ready_;
+    /// Tiles to load, the most important last.
+    std::vector<int> requests_;
+    /// Loaded tiles. nullptr marks tiles that could not be read.
+    std::unordered_map<int, std::shared_ptr<geometry::PointCloud>> loaded_;
+    size_t cached_bytes_ = 0;
+    bool stop_ = false;
+    std::thread loader_;
+
+    // Main thread only.
+    std::unordered_set<int> shown_;
+    int64_t num_shown_points_ = 0;
+    std::vector<uint64_t> last_used_frame_;
+    uint64_t frame_ = 0;
+};
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
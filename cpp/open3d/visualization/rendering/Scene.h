@@ -43,7 +43,8 @@ class Image;
 namespace t {
 namespace geometry {
 class PointCloud;
-}
+class TriangleMesh;
+}  // namespace geometry
 }  // namespace t
 
 namespace visualization {
@@ -97,12 +98,22 @@ public:
                              const Material& material,
                              const std::string& downsampled_name = "",
                              size_t downsample_threshold = SIZE_MAX) = 0;
+    virtual bool AddGeometry(const std::string& object_name,
+                             const t::geometry::TriangleMesh& mesh,
+                             const Material& material) = 0;
     virtual bool AddGeometry(const std::string& object_name,
                              const TriangleMeshModel& model) = 0;
     virtual bool HasGeometry(const std::string& object_name) const = 0;
     virtual void UpdateGeometry(const std::string& object_name,
                                 const t::geometry::PointCloud& point_cloud,
                                 uint32_t update_flags) = 0;
+    // Updates the flagged arrays of vertices [first_vertex, first_vertex +
+    // point_cloud.GetLength()) in place, leaving the other vertices as they
+    // are. The point cloud holds only the new values for that range.
+    virtual void UpdateGeometry(const std::string& object_name,
+                                const t::geometry::PointCloud& point_cloud,
+                                uint32_t update_flags,
+                                size_t first_vertex) = 0;
     virtual void RemoveGeometry(const std::string& object_name) = 0;
     virtual void ShowGeometry(const std::string& object_name, bool show) = 0;
     virtual bool GeometryIsVisible(const std::string& object_name) = 0;
@@ -0,0 +1,100 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/rendering/filament/FilamentBufferRing.h"
+
+#include <cstdlib>
+
+namespace open3d {
+namespace visualization {
+namespace rendering {
+
+namespace {
+
+void DeallocateBuffer(void* buffer, size_t size, void* user_ptr) {
+    free(buffer);
+}
+
+}  // namespace
+
+FilamentBufferRing::FilamentBufferRing(size_t size) {
+    slots_.reserve(size);
+    for (size_t i = 0; i < size; ++i) {
+        slots_.push_back(new Slot());
+    }
+}
+
+FilamentBufferRing::~FilamentBufferRing() {
+    for (Slot* slot : slots_) {
+        // A slot that Filament still references is freed by ReleaseSlot()
+        // once the upload is done.
+        int expected = kInFlight;
+        if (!slot->state.compare_exchange_strong(expected, kOrphaned)) {
+            free(slot->data);
+            delete slot;
+        }
+    }
+}
+
+filament::VertexBuffer::BufferDescriptor FilamentBufferRing::Acquire(
+        size_t byte_count) {
+    for (size_t i = 0; i < slots_.size(); ++i) {
+        const size_t idx = (next_ + i) % slots_.size();
+        Slot* slot = slots_[idx];
+        if (slot->state.load() != kFree) {
+            continue;
+        }
+        if (slot->capacity < byte_count) {
+            free(slot->data);
+            slot->data = malloc(byte_count);
+            slot->capacity = byte_count;
+        }
+        slot->state = kInFlight;
+        next_ = idx + 1;
+        return filament::VertexBuffer::BufferDescriptor(
+                slot->data, byte_count, ReleaseSlot, slot);
+    }
+
+    ++n_overflows_;
+    return filament::VertexBuffer::BufferDescriptor(
+            malloc(byte_count), byte_count, DeallocateBuffer);
+}
+
+void FilamentBufferRing::ReleaseSlot(void* buffer,
+                                     size_t size,
+                                     void* user_ptr) {
+    auto* slot = static_cast<Slot*>(user_ptr);
+    int expected = kInFlight;
+    if (!slot->state.compare_exchange_strong(expected, kFree)) {
+        // The ring was destroyed while the upload was pending.
+        free(slot->data);
+        delete slot;
+    }
+}
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
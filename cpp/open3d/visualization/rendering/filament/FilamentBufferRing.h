@@ -0,0 +1,96 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+// 4068: Filament has some clang-specific vectorizing pragma's that MSVC flags
+// 4146: Filament's utils/algorithm.h utils::details::ctz() tries to negate
+//       an unsigned int.
+// 4293: Filament's utils/algorithm.h utils::details::clz() does strange
+//       things with MSVC. Somehow sizeof(unsigned int) > 4, but its size is
+//       32 so that x >> 32 gives a warning. (Or maybe the compiler can't
+//       determine the if statement does not run.)
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4068 4146 4293)
+#endif  // _MSC_VER
+
+#include <filament/VertexBuffer.h>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif  // _MSC_VER
+
+#include <atomic>
+#include <vector>
+
+namespace open3d {
+namespace visualization {
+namespace rendering {
+
+// A ring of reusable staging buffers for vertex buffer updates. Filament
+// reads a BufferDescriptor some frames after setBufferAt() is called, so the
+// caller's data is copied into a staging buffer that Filament's release
+// callback returns to the ring. If every buffer is still in flight a new one
+// is allocated instead, so the CPU never waits on the GPU.
+class FilamentBufferRing {
+public:
+    // Enough for every attribute of a few objects over the frames Filament
+    // keeps in flight.
+    static constexpr size_t kDefaultSize = 16;
+
+    explicit FilamentBufferRing(size_t size = kDefaultSize);
+    ~FilamentBufferRing();
+
+    FilamentBufferRing(const FilamentBufferRing&) = delete;
+    FilamentBufferRing& operator=(const FilamentBufferRing&) = delete;
+
+    // Returns a descriptor of byte_count bytes for the caller to fill through
+    // descriptor.buffer before passing it to VertexBuffer::setBufferAt().
+    filament::VertexBuffer::BufferDescriptor Acquire(size_t byte_count);
+
+    size_t GetSize() const { return slots_.size(); }
+    // Number of Acquire() calls that found no free buffer in the ring.
+    size_t GetOverflowCount() const { return n_overflows_; }
+
+private:
+    enum SlotState { kFree, kInFlight, kOrphaned };
+    struct Slot {
+        void* data = nullptr;
+        size_t capacity = 0;
+        std::atomic<int> state{kFree};
+    };
+
+    static void ReleaseSlot(void* buffer, size_t size, void* user_ptr);
+
+    std::vector<Slot*> slots_;
+    size_t next_ = 0;
+    size_t n_overflows_ = 0;
+};
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
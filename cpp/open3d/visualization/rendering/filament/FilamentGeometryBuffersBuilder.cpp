@@ -26,6 +26,21 @@
 
 #include "open3d/visualization/rendering/filament/FilamentGeometryBuffersBuilder.h"
 
+// See FilamentGeometryBuffersBuilder.h for the disabled warnings.
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4068 4146 4293)
+#endif  // _MSC_VER
+
+#include <geometry/SurfaceOrientation.h>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif  // _MSC_VER
+
+#include <algorithm>
+#include <vector>
+
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/LineSet.h"
 #include "open3d/geometry/PointCloud.h"
@@ -35,6 +50,59 @@ namespace open3d {
 namespace visualization {
 namespace rendering {
 
+namespace {
+
+const filament::math::float3* GetBlockNormals(
+        const float* normals,
+        size_t begin,
+        size_t count,
+        std::vector<filament::math::float3>& buffer) {
+    return reinterpret_cast<const filament::math::float3*>(normals) + begin;
+}
+
+const filament::math::float3* GetBlockNormals(
+        const double* normals,
+        size_t begin,
+        size_t count,
+        std::vector<filament::math::float3>& buffer) {
+    buffer.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        const double* normal = normals + 3 * (begin + i);
+        buffer[i] = {float(normal[0]), float(normal[1]), float(normal[2])};
+    }
+    return buffer.data();
+}
+
+template <typename Scalar>
+void ComputeTangentsInBlocks(const Scalar* normals,
+                             size_t n_vertices,
+                             filament::math::quatf* tangents,
+                             size_t stride) {
+    // The tangent frame of a vertex only depends on its normal, so blocks of
+    // vertices are independent.
+    constexpr size_t kBlockSize = 4096;
+    const int64_t n_blocks =
+            int64_t((n_vertices + kBlockSize - 1) / kBlockSize);
+#pragma omp parallel for schedule(static)
+    for (int64_t block = 0; block < n_blocks; ++block) {
+        const size_t begin = size_t(block) * kBlockSize;
+        const size_t count = std::min(kBlockSize, n_vertices - begin);
+        std::vector<filament::math::float3> buffer;
+        std::unique_ptr<filament::geometry::SurfaceOrientation> orientation(
+                filament::geometry::SurfaceOrientation::Builder()
+                        .vertexCount(count)
+                        .normals(GetBlockNormals(normals, begin, count,
+                                                 buffer))
+                        .build());
+        orientation->getQuats(
+                reinterpret_cast<filament::math::quatf*>(
+                        reinterpret_cast<char*>(tangents) + begin * stride),
+                count, stride);
+    }
+}
+
+}  // namespace
+
 class TemporaryLineSetBuilder : public LineSetBuffersBuilder {
 public:
     explicit TemporaryLineSetBuilder(std::shared_ptr<geometry::LineSet> lines)
@@ -87,6 +155,25 @@ std::unique_ptr<GeometryBuffersBuilder> GeometryBuffersBuilder::GetBuilder(
     return std::make_unique<TPointCloudBuffersBuilder>(geometry);
 }
 
+std::unique_ptr<GeometryBuffersBuilder> GeometryBuffersBuilder::GetBuilder(
+        const t::geometry::TriangleMesh& geometry) {
+    return std::make_unique<TTriangleMeshBuffersBuilder>(geometry);
+}
+
+void GeometryBuffersBuilder::ComputeTangents(const double* normals,
+                                             size_t n_vertices,
+                                             filament::math::quatf* tangents,
+                                             size_t stride) {
+    ComputeTangentsInBlocks(normals, n_vertices, tangents, stride);
+}
+
+void GeometryBuffersBuilder::ComputeTangents(const float* normals,
+                                             size_t n_vertices,
+                                             filament::math::quatf* tangents,
+                                             size_t stride) {
+    ComputeTangentsInBlocks(normals, n_vertices, tangents, stride);
+}
+
 void GeometryBuffersBuilder::DeallocateBuffer(void* buffer,
                                               size_t size,
                                               void* user_ptr) {
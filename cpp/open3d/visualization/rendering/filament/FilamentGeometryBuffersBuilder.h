@@ -45,6 +45,7 @@
 
 #include <filament/Box.h>
 #include <filament/RenderableManager.h>
+#include <math/quat.h>
 
 #ifdef _MSC_VER
 #pragma warning(pop)
@@ -66,7 +67,8 @@ class TriangleMesh;
 namespace t {
 namespace geometry {
 class PointCloud;
-}
+class TriangleMesh;
+}  // namespace geometry
 }  // namespace t
 
 namespace visualization {
@@ -86,6 +88,22 @@ public:
             const geometry::Geometry3D& geometry);
     static std::unique_ptr<GeometryBuffersBuilder> GetBuilder(
             const t::geometry::PointCloud& geometry);
+    static std::unique_ptr<GeometryBuffersBuilder> GetBuilder(
+            const t::geometry::TriangleMesh& geometry);
+
+    // Converts n_vertices normals (xyz triples) to Filament's tangent frame
+    // quaternions in parallel. Quaternion i is written stride bytes after
+    // quaternion i - 1, so it can go straight into an interleaved vertex.
+    static void ComputeTangents(
+            const double* normals,
+            size_t n_vertices,
+            filament::math::quatf* tangents,
+            size_t stride = sizeof(filament::math::quatf));
+    static void ComputeTangents(
+            const float* normals,
+            size_t n_vertices,
+            filament::math::quatf* tangents,
+            size_t stride = sizeof(filament::math::quatf));
 
     virtual ~GeometryBuffersBuilder() = default;
 
@@ -164,6 +182,21 @@ private:
     const t::geometry::PointCloud& geometry_;
 };
 
+class TTriangleMeshBuffersBuilder : public GeometryBuffersBuilder {
+public:
+    explicit TTriangleMeshBuffersBuilder(
+            const t::geometry::TriangleMesh& geometry);
+
+    filament::RenderableManager::PrimitiveType GetPrimitiveType()
+            const override;
+
+    Buffers ConstructBuffers() override;
+    filament::Box ComputeAABB() override;
+
+private:
+    const t::geometry::TriangleMesh& geometry_;
+};
+
 class LineSetBuffersBuilder : public GeometryBuffersBuilder {
 public:
     explicit LineSetBuffersBuilder(const geometry::LineSet& geometry);
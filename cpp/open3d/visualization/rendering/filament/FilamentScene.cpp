@@ -32,6 +32,7 @@
 //       32 so that x >> 32 gives a warning. (Or maybe the compiler can't
 //       determine the if statement does not run.)
 // 4305: LightManager.h needs to specify some constants as floats
+#include <functional>
 #include <unordered_set>
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -51,7 +52,6 @@
 #include <filament/TransformManager.h>
 #include <filament/VertexBuffer.h>
 #include <filament/View.h>
-#include <geometry/SurfaceOrientation.h>
 #include <utils/EntityManager.h>
 
 #ifdef _MSC_VER
@@ -72,6 +72,7 @@
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
 #include "open3d/visualization/rendering/Light.h"
 #include "open3d/visualization/rendering/Material.h"
@@ -374,6 +375,47 @@ bool FilamentScene::AddGeometry(const std::string& object_name,
     return success;
 }
 
+bool FilamentScene::AddGeometry(const std::string& object_name,
+                                const t::geometry::TriangleMesh& mesh,
+                                const Material& material) {
+    if (geometries_.count(object_name) > 0) {
+        utility::LogWarning(
+                "Geometry {} has already been added to scene graph.",
+                object_name);
+        return false;
+    }
+
+    // Basic sanity checks
+    if (!mesh.HasVertices() || !mesh.HasTriangles()) {
+        utility::LogWarning("Triangle mesh for object {} is empty",
+                            object_name);
+        return false;
+    }
+    const auto& vertices = mesh.GetVertices();
+    if (vertices.GetDevice().GetType() == core::Device::DeviceType::CUDA) {
+        utility::LogWarning(
+                "GPU resident tensor triangle meshes are not supported at "
+                "this time");
+        return false;
+    }
+    if (vertices.GetDtype() != core::Dtype::Float32 ||
+        !vertices.IsContiguous()) {
+        utility::LogWarning(
+                "tensor triangle mesh vertices must be contiguous with Dtype "
+                "of Float32");
+        return false;
+    }
+
+    auto buffer_builder = GeometryBuffersBuilder::GetBuilder(mesh);
+    buffer_builder->SetAdjustColorsForSRGBToneMapping(material.sRGB_color);
+    auto buffers = buffer_builder->ConstructBuffers();
+    auto vb = std::get<0>(buffers);
+    auto ib = std::get<1>(buffers);
+    filament::Box aabb = buffer_builder->ComputeAABB();
+    return CreateAndAddFilamentEntity(object_name, *buffer_builder, aabb, vb,
+                                      ib, material);
+}
+
 #ifndef NDEBUG
 void OutputMaterialProperties(const visualization::rendering::Material& mat) {
     utility::LogInfo("Material {}", mat.name);
@@ -480,96 +522,116 @@ bool FilamentScene::HasGeometry(const std::string& object_name) const {
     return (geom_entry != geometries_.end());
 }
 
-static void deallocate_vertex_buffer(void* buffer,
-                                     size_t size,
-                                     void* user_ptr) {
-    free(buffer);
-}
-
 void FilamentScene::UpdateGeometry(const std::string& object_name,
                                    const t::geometry::PointCloud& point_cloud,
                                    uint32_t update_flags) {
     auto geoms = GetGeometry(object_name, false);
     if (!geoms.empty()) {
         // Note: There should only be a single entry in geoms
-        auto* g = geoms[0];
-        auto vbuf_ptr = resource_mgr_.GetVertexBuffer(g->vb).lock();
-        auto vbuf = vbuf_ptr.get();
-
-        const auto& points = point_cloud.GetPoints();
-        const size_t n_vertices = points.GetLength();
+        auto vbuf_ptr = resource_mgr_.GetVertexBuffer(geoms[0]->vb).lock();
+        const size_t n_vertices = point_cloud.GetPoints().GetLength();
 
         // NOTE: number of points in the updated point cloud must be the
         // same as the number of points when the vertex buffer was first
         // created. If the number of points has changed then it cannot be
         // updated. In that case, you must remove the geometry then add it
         // again.
-        if (n_vertices != vbuf->getVertexCount()) {
+        if (n_vertices != vbuf_ptr->getVertexCount()) {
             utility::LogWarning(
                     "Geometry for point cloud {} cannot be updated because the "
                     "number of points has changed (Old: {}, New: {})",
-                    object_name, vbuf->getVertexCount(), n_vertices);
+                    object_name, vbuf_ptr->getVertexCount(), n_vertices);
             return;
         }
+        UpdateGeometry(object_name, point_cloud, update_flags, 0);
+    }
+}
 
-        if (update_flags & kUpdatePointsFlag) {
-            filament::VertexBuffer::BufferDescriptor pts_descriptor(
-                    points.GetDataPtr(), n_vertices * 3 * sizeof(float));
-            vbuf->setBufferAt(engine_, 0, std::move(pts_descriptor));
-        }
-
-        if (update_flags & kUpdateColorsFlag && point_cloud.HasPointColors()) {
-            const size_t color_array_size = n_vertices * 3 * sizeof(float);
-            filament::VertexBuffer::BufferDescriptor color_descriptor(
-                    point_cloud.GetPointColors().GetDataPtr(),
-                    color_array_size);
-            vbuf->setBufferAt(engine_, 1, std::move(color_descriptor));
-        }
+void FilamentScene::UpdateGeometry(const std::string& object_name,
+                                   const t::geometry::PointCloud& point_cloud,
+                                   uint32_t update_flags,
+                                   size_t first_vertex) {
+    auto geoms = GetGeometry(object_name, false);
+    if (geoms.empty()) {
+        return;
+    }
+    // Note: There should only be a single entry in geoms
+    auto* g = geoms[0];
+    auto vbuf_ptr = resource_mgr_.GetVertexBuffer(g->vb).lock();
+    auto vbuf = vbuf_ptr.get();
 
-        if (update_flags & kUpdateNormalsFlag &&
-            point_cloud.HasPointNormals()) {
-            const size_t normal_array_size = n_vertices * 4 * sizeof(float);
-            const auto& normals = point_cloud.GetPointNormals();
-
-            // Converting normals to Filament type - quaternions
-            auto float4v_tangents = static_cast<filament::math::quatf*>(
-                    malloc(normal_array_size));
-            auto orientation = filament::geometry::SurfaceOrientation::Builder()
-                                       .vertexCount(n_vertices)
-                                       .normals(reinterpret_cast<
-                                                const filament::math::float3*>(
-                                               normals.GetDataPtr()))
-                                       .build();
-            orientation->getQuats(float4v_tangents, n_vertices);
-            filament::VertexBuffer::BufferDescriptor normals_descriptor(
-                    float4v_tangents, normal_array_size,
-                    deallocate_vertex_buffer);
-            vbuf->setBufferAt(engine_, 2, std::move(normals_descriptor));
-        }
+    const size_t n_vertices = point_cloud.GetPoints().GetLength();
+    if (first_vertex + n_vertices > vbuf->getVertexCount()) {
+        utility::LogWarning(
+                "Geometry for point cloud {} cannot be updated because "
+                "vertices [{}, {}) are out of range (vertex count {})",
+                object_name, first_vertex, first_vertex + n_vertices,
+                vbuf->getVertexCount());
+        return;
+    }
+    if (n_vertices == 0) {
+        return;
+    }
+
+    // The arrays are copied into staging buffers from staging_ring_ so the
+    // caller may overwrite the point cloud as soon as this returns. Only the
+    // byte range of the updated vertices is uploaded.
+    auto UpdateArray = [this, vbuf, first_vertex, n_vertices](
+                               uint8_t buffer_index, size_t n_floats,
+                               const std::function<void(float*)>& fill) {
+        const size_t stride = n_floats * sizeof(float);
+        auto descriptor = staging_ring_.Acquire(n_vertices * stride);
+        fill(static_cast<float*>(descriptor.buffer));
+        vbuf->setBufferAt(engine_, buffer_index, std::move(descriptor),
+                          uint32_t(first_vertex * stride));
+    };
+    auto CopyArray = [n_vertices](const core::Tensor& array, size_t n_floats) {
+        const core::Tensor src = array.To(core::Dtype::Float32).Contiguous();
+        return [src, n_vertices, n_floats](float* dst) {
+            memcpy(dst, src.GetDataPtr(),
+                   n_vertices * n_floats * sizeof(float));
+        };
+    };
 
-        if (update_flags & kUpdateUv0Flag) {
-            const size_t uv_array_size = n_vertices * 2 * sizeof(float);
-            if (point_cloud.HasPointAttr("uv")) {
-                filament::VertexBuffer::BufferDescriptor uv_descriptor(
-                        point_cloud.GetPointAttr("uv").GetDataPtr(),
-                        uv_array_size);
-                vbuf->setBufferAt(engine_, 3, std::move(uv_descriptor));
-            } else if (point_cloud.HasPointAttr("__visualization_scalar")) {
-                // Update in PointCloudBuffers.cpp, too:
-                //     TPointCloudBuffersBuilder::ConstructBuffers
-                float* uv_array = static_cast<float*>(malloc(uv_array_size));
-                memset(uv_array, 0, uv_array_size);
-                const float* src = static_cast<const float*>(
-                        point_cloud.GetPointAttr("__visualization_scalar")
-                                .GetDataPtr());
-                const size_t n = 2 * n_vertices;
-                for (size_t i = 0; i < n; i += 2) {
-                    uv_array[i] = *src++;
+    if (update_flags & kUpdatePointsFlag) {
+        UpdateArray(0, 3, CopyArray(point_cloud.GetPoints(), 3));
+    }
+
+    if (update_flags & kUpdateColorsFlag && point_cloud.HasPointColors()) {
+        UpdateArray(1, 3, CopyArray(point_cloud.GetPointColors(), 3));
+    }
+
+    if (update_flags & kUpdateNormalsFlag && point_cloud.HasPointNormals()) {
+        const core::Tensor normals = point_cloud.GetPointNormals()
+                                             .To(core::Dtype::Float32)
+                                             .Contiguous();
+        // Converting normals to Filament type - quaternions
+        UpdateArray(2, 4, [&normals, n_vertices](float* dst) {
+            GeometryBuffersBuilder::ComputeTangents(
+                    static_cast<const float*>(normals.GetDataPtr()),
+                    n_vertices, reinterpret_cast<filament::math::quatf*>(dst));
+        });
+    }
+
+    if (update_flags & kUpdateUv0Flag) {
+        if (point_cloud.HasPointAttr("uv")) {
+            UpdateArray(3, 2, CopyArray(point_cloud.GetPointAttr("uv"), 2));
+        } else if (point_cloud.HasPointAttr("__visualization_scalar")) {
+            // Update in PointCloudBuffers.cpp, too:
+            //     TPointCloudBuffersBuilder::ConstructBuffers
+            const core::Tensor scalars =
+                    point_cloud.GetPointAttr("__visualization_scalar")
+                            .To(core::Dtype::Float32)
+                            .Contiguous();
+            UpdateArray(3, 2, [&scalars, n_vertices](float* dst) {
+                const float* src =
+                        static_cast<const float*>(scalars.GetDataPtr());
+#pragma omp parallel for schedule(static)
+                for (int64_t i = 0; i < int64_t(n_vertices); ++i) {
+                    dst[2 * i] = src[i];
+                    dst[2 * i + 1] = 0.f;
                 }
-                filament::VertexBuffer::BufferDescriptor uv_descriptor(
-                        uv_array, uv_array_size, DeallocateBuffer);
-                vbuf->setBufferAt(engine_, 3, std::move(uv_descriptor));
-            }
+            });
         }
     }
 }
@@ -56,6 +56,7 @@
 #include "open3d/visualization/rendering/Material.h"
 #include "open3d/visualization/rendering/RendererHandle.h"
 #include "open3d/visualization/rendering/Scene.h"
+#include "open3d/visualization/rendering/filament/FilamentBufferRing.h"
 #include "open3d/visualization/rendering/filament/FilamentResourceManager.h"
 
 /// @cond
@@ -119,12 +120,19 @@ public:
                      const Material& material,
                      const std::string& downsampled_name = "",
                      size_t downsample_threshold = SIZE_MAX) override;
+    bool AddGeometry(const std::string& object_name,
+                     const t::geometry::TriangleMesh& mesh,
+                     const Material& material) override;
     bool AddGeometry(const std::string& object_name,
                      const TriangleMeshModel& model) override;
     bool HasGeometry(const std::string& object_name) const override;
     void UpdateGeometry(const std::string& object_name,
                         const t::geometry::PointCloud& point_cloud,
                         uint32_t update_flags) override;
+    void UpdateGeometry(const std::string& object_name,
+                        const t::geometry::PointCloud& point_cloud,
+                        uint32_t update_flags,
+                        size_t first_vertex) override;
     void RemoveGeometry(const std::string& object_name) override;
     void ShowGeometry(const std::string& object_name, bool show) override;
     bool GeometryIsVisible(const std::string& object_name) override;
@@ -235,6 +243,9 @@ private:
     filament::Engine& engine_;
     FilamentResourceManager& resource_mgr_;
     filament::Scene* scene_ = nullptr;
+    // Staging memory for UpdateGeometry(), so that callers can overwrite
+    // their data while Filament is still uploading the previous frame.
+    FilamentBufferRing staging_ring_;
 
     struct TextureMaps {
         rendering::TextureHandle albedo_map =
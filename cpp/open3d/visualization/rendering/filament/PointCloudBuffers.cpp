@@ -38,12 +38,13 @@
 
 #include <filament/IndexBuffer.h>
 #include <filament/VertexBuffer.h>
-#include <geometry/SurfaceOrientation.h>
 
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif  // _MSC_VER
 
+#include <algorithm>
+
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/t/geometry/PointCloud.h"
@@ -216,49 +217,29 @@ GeometryBuffersBuilder::Buffers PointCloudBuffersBuilder::ConstructBuffers() {
         return {};
     }
 
-    math::quatf* float4v_tagents = nullptr;
-    if (geometry_.HasNormals()) {
-        // Converting vertex normals to float base
-        std::vector<Eigen::Vector3f> normals;
-        normals.resize(n_vertices);
-        for (size_t i = 0; i < n_vertices; ++i) {
-            normals[i] = geometry_.normals_[i].cast<float>();
-        }
-
-        // Converting normals to Filament type - quaternions
-        const size_t tangents_byte_count = n_vertices * 4 * sizeof(float);
-        float4v_tagents =
-                static_cast<math::quatf*>(malloc(tangents_byte_count));
-        auto orientation = filament::geometry::SurfaceOrientation::Builder()
-                                   .vertexCount(n_vertices)
-                                   .normals(reinterpret_cast<math::float3*>(
-                                           normals.data()))
-                                   .build();
-        orientation->getQuats(float4v_tagents, n_vertices);
-    }
-
     const size_t vertices_byte_count = n_vertices * sizeof(ColoredVertex);
     auto* vertices = static_cast<ColoredVertex*>(malloc(vertices_byte_count));
+    const bool has_colors = geometry_.HasColors();
     const ColoredVertex kDefault;
-    for (size_t i = 0; i < geometry_.points_.size(); ++i) {
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < int64_t(n_vertices); ++i) {
         ColoredVertex& element = vertices[i];
         element.SetVertexPosition(geometry_.points_[i]);
-        if (geometry_.HasColors()) {
+        if (has_colors) {
             element.SetVertexColor(geometry_.colors_[i],
                                    adjust_colors_for_srgb_tonemapping_);
         } else {
             element.color = kDefault.color;
         }
-
-        if (float4v_tagents) {
-            element.tangent = float4v_tagents[i];
-        } else {
-            element.tangent = kDefault.tangent;
-        }
+        element.tangent = kDefault.tangent;
         element.uv = kDefault.uv;
     }
-
-    free(float4v_tagents);
+    if (geometry_.HasNormals()) {
+        // Converting normals to Filament type - quaternions, straight into
+        // the vertices
+        ComputeTangents(geometry_.normals_[0].data(), n_vertices,
+                        &vertices[0].tangent, sizeof(ColoredVertex));
+    }
 
     // Moving `vertices` to IndexBuffer, which will clean them up later
     // with DeallocateBuffer
@@ -352,9 +333,7 @@ GeometryBuffersBuilder::Buffers TPointCloudBuffersBuilder::ConstructBuffers() {
         vbuf->setBufferAt(engine, 1, std::move(color_descriptor));
     } else {
         float* color_array = static_cast<float*>(malloc(color_array_size));
-        for (size_t i = 0; i < n_vertices * 3; ++i) {
-            color_array[i] = 1.f;
-        }
+        std::fill(color_array, color_array + n_vertices * 3, 1.f);
         VertexBuffer::BufferDescriptor color_descriptor(
                 color_array, color_array_size,
                 GeometryBuffersBuilder::DeallocateBuffer);
@@ -368,26 +347,17 @@ GeometryBuffersBuilder::Buffers TPointCloudBuffersBuilder::ConstructBuffers() {
         // Converting normals to Filament type - quaternions
         auto float4v_tangents =
                 static_cast<math::quatf*>(malloc(normal_array_size));
-        auto orientation =
-                filament::geometry::SurfaceOrientation::Builder()
-                        .vertexCount(n_vertices)
-                        .normals(reinterpret_cast<const math::float3*>(
-                                normals.GetDataPtr()))
-                        .build();
-        orientation->getQuats(float4v_tangents, n_vertices);
+        ComputeTangents(static_cast<const float*>(normals.GetDataPtr()),
+                        n_vertices, float4v_tangents);
         VertexBuffer::BufferDescriptor normals_descriptor(
                 float4v_tangents, normal_array_size,
                 GeometryBuffersBuilder::DeallocateBuffer);
         vbuf->setBufferAt(engine, 2, std::move(normals_descriptor));
     } else {
-        float* normal_array = static_cast<float*>(malloc(normal_array_size));
-        float* normal_ptr = normal_array;
-        for (size_t i = 0; i < n_vertices; ++i) {
-            *normal_ptr++ = 0.f;
-            *normal_ptr++ = 0.f;
-            *normal_ptr++ = 0.f;
-            *normal_ptr++ = 1.f;
-        }
+        auto* normal_array =
+                static_cast<math::quatf*>(malloc(normal_array_size));
+        std::fill(normal_array, normal_array + n_vertices,
+                  math::quatf(0.f, 0.f, 0.f, 1.f));
         VertexBuffer::BufferDescriptor normals_descriptor(
                 normal_array, normal_array_size,
                 GeometryBuffersBuilder::DeallocateBuffer);
@@ -405,9 +375,9 @@ GeometryBuffersBuilder::Buffers TPointCloudBuffersBuilder::ConstructBuffers() {
         memset(uv_array, 0, uv_array_size);
         const float* src = static_cast<const float*>(
                 geometry_.GetPointAttr("__visualization_scalar").GetDataPtr());
-        const size_t n = 2 * n_vertices;
-        for (size_t i = 0; i < n; i += 2) {
-            uv_array[i] = *src++;
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < int64_t(n_vertices); ++i) {
+            uv_array[2 * i] = src[i];
         }
     } else {
         memset(uv_array, 0, uv_array_size);
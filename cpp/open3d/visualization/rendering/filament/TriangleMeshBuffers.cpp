@@ -48,10 +48,13 @@
 #pragma warning(pop)
 #endif  // _MSC_VER
 
+#include <algorithm>
 #include <map>
 
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/utility/Console.h"
 #include "open3d/visualization/rendering/filament/FilamentEngine.h"
 #include "open3d/visualization/rendering/filament/FilamentGeometryBuffersBuilder.h"
 #include "open3d/visualization/rendering/filament/FilamentResourceManager.h"
@@ -183,11 +186,27 @@ struct ibdata {
     size_t stride = 0;
 };
 
+// Transfers ownership on return for ibdata.bytes
+ibdata CreateIndexData(const geometry::TriangleMesh& geometry) {
+    ibdata index_data;
+    index_data.stride = sizeof(GeometryBuffersBuilder::IndexType);
+    index_data.byte_count = geometry.triangles_.size() * 3 * index_data.stride;
+    index_data.bytes = static_cast<GeometryBuffersBuilder::IndexType*>(
+            malloc(index_data.byte_count));
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < int64_t(geometry.triangles_.size()); ++i) {
+        const auto& triangle = geometry.triangles_[i];
+        index_data.bytes[3 * i] = triangle(0);
+        index_data.bytes[3 * i + 1] = triangle(1);
+        index_data.bytes[3 * i + 2] = triangle(2);
+    }
+    return index_data;
+}
+
 // Transfers ownership on return for vbdata.bytes and ibdata.bytes
 std::tuple<vbdata, ibdata> CreatePlainBuffers(
-        const math::quatf* tangents, const geometry::TriangleMesh& geometry) {
+        const geometry::TriangleMesh& geometry) {
     vbdata vertex_data;
-    ibdata index_data;
 
     vertex_data.vertices_count = geometry.vertices_.size();
     vertex_data.byte_count = vertex_data.vertices_count * sizeof(BaseVertex);
@@ -196,36 +215,25 @@ std::tuple<vbdata, ibdata> CreatePlainBuffers(
 
     const BaseVertex kDefault;
     auto plain_vertices = static_cast<BaseVertex*>(vertex_data.bytes);
-    for (size_t i = 0; i < vertex_data.vertices_count; ++i) {
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < int64_t(vertex_data.vertices_count); ++i) {
         BaseVertex& element = plain_vertices[i];
-
         SetVertexPosition(element, geometry.vertices_[i]);
-        if (tangents != nullptr) {
-            element.tangent = tangents[i];
-        } else {
-            element.tangent = kDefault.tangent;
-        }
+        element.tangent = kDefault.tangent;
     }
-
-    index_data.stride = sizeof(GeometryBuffersBuilder::IndexType);
-    index_data.byte_count = geometry.triangles_.size() * 3 * index_data.stride;
-    index_data.bytes = static_cast<GeometryBuffersBuilder::IndexType*>(
-            malloc(index_data.byte_count));
-    for (size_t i = 0; i < geometry.triangles_.size(); ++i) {
-        const auto& triangle = geometry.triangles_[i];
-        index_data.bytes[3 * i] = triangle(0);
-        index_data.bytes[3 * i + 1] = triangle(1);
-        index_data.bytes[3 * i + 2] = triangle(2);
+    if (geometry.HasVertexNormals()) {
+        GeometryBuffersBuilder::ComputeTangents(
+                geometry.vertex_normals_[0].data(), vertex_data.vertices_count,
+                &plain_vertices[0].tangent, sizeof(BaseVertex));
     }
 
-    return std::make_tuple(vertex_data, index_data);
+    return std::make_tuple(vertex_data, CreateIndexData(geometry));
 }
 
 // Transfers ownership on return for vbdata.bytes and ibdata.bytes
 std::tuple<vbdata, ibdata> CreateColoredBuffers(
-        const math::quatf* tangents, const geometry::TriangleMesh& geometry) {
+        const geometry::TriangleMesh& geometry) {
     vbdata vertex_data;
-    ibdata index_data;
 
     vertex_data.vertices_count = geometry.vertices_.size();
     vertex_data.byte_count =
@@ -234,36 +242,28 @@ std::tuple<vbdata, ibdata> CreateColoredBuffers(
     vertex_data.bytes = malloc(vertex_data.byte_count);
 
     const TexturedVertex kDefault;
+    const bool has_colors = geometry.HasVertexColors();
     auto vertices = static_cast<TexturedVertex*>(vertex_data.bytes);
-    for (size_t i = 0; i < vertex_data.vertices_count; ++i) {
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < int64_t(vertex_data.vertices_count); ++i) {
         TexturedVertex& element = vertices[i];
 
         SetVertexPosition(element, geometry.vertices_[i]);
-        if (tangents != nullptr) {
-            element.tangent = tangents[i];
-        } else {
-            element.tangent = kDefault.tangent;
-        }
-
-        if (geometry.HasVertexColors()) {
+        element.tangent = kDefault.tangent;
+        if (has_colors) {
             SetVertexColor(element, geometry.vertex_colors_[i]);
         } else {
             element.color = kDefault.color;
         }
+        element.uv = kDefault.uv;
     }
-
-    index_data.stride = sizeof(GeometryBuffersBuilder::IndexType);
-    index_data.byte_count = geometry.triangles_.size() * 3 * index_data.stride;
-    index_data.bytes = static_cast<GeometryBuffersBuilder::IndexType*>(
-            malloc(index_data.byte_count));
-    for (size_t i = 0; i < geometry.triangles_.size(); ++i) {
-        const auto& triangle = geometry.triangles_[i];
-        index_data.bytes[3 * i] = triangle(0);
-        index_data.bytes[3 * i + 1] = triangle(1);
-        index_data.bytes[3 * i + 2] = triangle(2);
+    if (geometry.HasVertexNormals()) {
+        GeometryBuffersBuilder::ComputeTangents(
+                geometry.vertex_normals_[0].data(), vertex_data.vertices_count,
+                &vertices[0].tangent, sizeof(TexturedVertex));
     }
 
-    return std::make_tuple(vertex_data, index_data);
+    return std::make_tuple(vertex_data, CreateIndexData(geometry));
 }
 
 // Transfers ownership on return for vbdata.bytes and ibdata.bytes
@@ -384,29 +384,6 @@ GeometryBuffersBuilder::Buffers TriangleMeshBuffersBuilder::ConstructBuffers() {
     auto& engine = EngineInstance::GetInstance();
     auto& resource_mgr = EngineInstance::GetResourceManager();
 
-    const size_t n_vertices = geometry_.vertices_.size();
-
-    math::quatf* float4v_tangents = nullptr;
-    if (geometry_.HasVertexNormals()) {
-        // Converting vertex normals to float base
-        std::vector<Eigen::Vector3f> normals;
-        normals.resize(n_vertices);
-        for (size_t i = 0; i < n_vertices; ++i) {
-            normals[i] = geometry_.vertex_normals_[i].cast<float>();
-        }
-
-        // Converting normals to Filament type - quaternions
-        const size_t tangents_byte_count = n_vertices * 4 * sizeof(float);
-        float4v_tangents =
-                static_cast<math::quatf*>(malloc(tangents_byte_count));
-        auto orientation = filament::geometry::SurfaceOrientation::Builder()
-                                   .vertexCount(n_vertices)
-                                   .normals(reinterpret_cast<math::float3*>(
-                                           normals.data()))
-                                   .build();
-        orientation->getQuats(float4v_tangents, n_vertices);
-    }
-
     // NOTE: Both default lit and unlit material shaders require per-vertex
     // colors so we unconditionally assume the triangle mesh has color.
     const bool has_colors = true;
@@ -416,18 +393,27 @@ GeometryBuffersBuilder::Buffers TriangleMeshBuffersBuilder::ConstructBuffers() {
     std::tuple<vbdata, ibdata> buffers_data;
     size_t stride = sizeof(BaseVertex);
     if (has_uvs) {
+        // Vertices are split where their UVs differ, so the tangents are
+        // computed up front and looked up by source vertex.
+        const size_t n_vertices = geometry_.vertices_.size();
+        math::quatf* float4v_tangents = nullptr;
+        if (geometry_.HasVertexNormals()) {
+            float4v_tangents = static_cast<math::quatf*>(
+                    malloc(n_vertices * sizeof(math::quatf)));
+            ComputeTangents(geometry_.vertex_normals_[0].data(), n_vertices,
+                            float4v_tangents);
+        }
         buffers_data = CreateTexturedBuffers(float4v_tangents, geometry_);
+        free(float4v_tangents);
         stride = sizeof(TexturedVertex);
     } else if (has_colors) {
-        buffers_data = CreateColoredBuffers(float4v_tangents, geometry_);
+        buffers_data = CreateColoredBuffers(geometry_);
         stride = sizeof(TexturedVertex);
         has_uvs = true;
     } else {
-        buffers_data = CreatePlainBuffers(float4v_tangents, geometry_);
+        buffers_data = CreatePlainBuffers(geometry_);
     }
 
-    free(float4v_tangents);
-
     const vbdata& vertex_data = std::get<0>(buffers_data);
     const ibdata& index_data = std::get<1>(buffers_data);
 
@@ -483,6 +469,156 @@ filament::Box TriangleMeshBuffersBuilder::ComputeAABB() {
     return aabb;
 }
 
+TTriangleMeshBuffersBuilder::TTriangleMeshBuffersBuilder(
+        const t::geometry::TriangleMesh& geometry)
+    : geometry_(geometry) {}
+
+RenderableManager::PrimitiveType
+TTriangleMeshBuffersBuilder::GetPrimitiveType() const {
+    return RenderableManager::PrimitiveType::TRIANGLES;
+}
+
+GeometryBuffersBuilder::Buffers
+TTriangleMeshBuffersBuilder::ConstructBuffers() {
+    auto& engine = EngineInstance::GetInstance();
+    auto& resource_mgr = EngineInstance::GetResourceManager();
+
+    // NOTE: ConstructBuffers assumes caller has checked that the vertices are
+    // a contiguous float32 tensor on the CPU, as they are passed to Filament
+    // without a copy. Normals are converted to float32. Colors are converted
+    // to float32 in [0, 1], UInt8 and UInt16 colors are scaled to that range.
+
+    const auto& vertices = geometry_.GetVertices();
+    const size_t n_vertices = vertices.GetLength();
+
+    core::Tensor colors;
+    if (geometry_.HasVertexColors()) {
+        const core::Tensor& vertex_colors = geometry_.GetVertexColors();
+        const core::Dtype dtype = vertex_colors.GetDtype();
+        if (dtype == core::Dtype::Float32 || dtype == core::Dtype::Float64) {
+            colors = vertex_colors.To(core::Dtype::Float32);
+        } else if (dtype == core::Dtype::UInt8) {
+            colors = vertex_colors.To(core::Dtype::Float32).Div(255.f);
+        } else if (dtype == core::Dtype::UInt16) {
+            colors = vertex_colors.To(core::Dtype::Float32).Div(65535.f);
+        } else {
+            utility::LogError(
+                    "Vertex colors of dtype {} are not supported, use a "
+                    "float, UInt8 or UInt16 dtype.",
+                    dtype.ToString());
+        }
+        colors = colors.Contiguous();
+    }
+
+    // See TPointCloudBuffersBuilder::ConstructBuffers() for why TANGENTS and
+    // CUSTOM0 share a buffer.
+    VertexBuffer* vbuf = VertexBuffer::Builder()
+                                 .bufferCount(4)
+                                 .vertexCount(uint32_t(n_vertices))
+                                 .attribute(VertexAttribute::POSITION, 0,
+                                            VertexBuffer::AttributeType::FLOAT3)
+                                 .normalized(VertexAttribute::COLOR)
+                                 .attribute(VertexAttribute::COLOR, 1,
+                                            VertexBuffer::AttributeType::FLOAT3)
+                                 .normalized(VertexAttribute::TANGENTS)
+                                 .attribute(VertexAttribute::TANGENTS, 2,
+                                            VertexBuffer::AttributeType::FLOAT4)
+                                 .attribute(VertexAttribute::CUSTOM0, 2,
+                                            VertexBuffer::AttributeType::FLOAT4)
+                                 .attribute(VertexAttribute::UV0, 3,
+                                            VertexBuffer::AttributeType::FLOAT2)
+                                 .build(engine);
+
+    VertexBufferHandle vb_handle;
+    if (vbuf) {
+        vb_handle = resource_mgr.AddVertexBuffer(vbuf);
+    } else {
+        return {};
+    }
+
+    VertexBuffer::BufferDescriptor pts_descriptor(
+            vertices.GetDataPtr(), n_vertices * 3 * sizeof(float));
+    vbuf->setBufferAt(engine, 0, std::move(pts_descriptor));
+
+    const size_t color_array_size = n_vertices * 3 * sizeof(float);
+    float* color_array = static_cast<float*>(malloc(color_array_size));
+    if (geometry_.HasVertexColors()) {
+        memcpy(color_array, colors.GetDataPtr(), color_array_size);
+    } else {
+        std::fill(color_array, color_array + n_vertices * 3, 0.5f);
+    }
+    VertexBuffer::BufferDescriptor color_descriptor(
+            color_array, color_array_size,
+            GeometryBuffersBuilder::DeallocateBuffer);
+    vbuf->setBufferAt(engine, 1, std::move(color_descriptor));
+
+    const size_t normal_array_size = n_vertices * 4 * sizeof(float);
+    auto* float4v_tangents =
+            static_cast<math::quatf*>(malloc(normal_array_size));
+    if (geometry_.HasVertexNormals()) {
+        const auto normals = geometry_.GetVertexNormals()
+                                     .To(core::Dtype::Float32)
+                                     .Contiguous();
+        ComputeTangents(static_cast<const float*>(normals.GetDataPtr()),
+                        n_vertices, float4v_tangents);
+    } else {
+        std::fill(float4v_tangents, float4v_tangents + n_vertices,
+                  math::quatf(0.f, 0.f, 0.f, 1.f));
+    }
+    VertexBuffer::BufferDescriptor normals_descriptor(
+            float4v_tangents, normal_array_size,
+            GeometryBuffersBuilder::DeallocateBuffer);
+    vbuf->setBufferAt(engine, 2, std::move(normals_descriptor));
+
+    const size_t uv_array_size = n_vertices * 2 * sizeof(float);
+    float* uv_array = static_cast<float*>(malloc(uv_array_size));
+    memset(uv_array, 0, uv_array_size);
+    VertexBuffer::BufferDescriptor uv_descriptor(
+            uv_array, uv_array_size, GeometryBuffersBuilder::DeallocateBuffer);
+    vbuf->setBufferAt(engine, 3, std::move(uv_descriptor));
+
+    const auto triangles =
+            geometry_.GetTriangles().To(core::Dtype::Int64).Contiguous();
+    const size_t n_indices = triangles.NumElements();
+    const auto* src = static_cast<const int64_t*>(triangles.GetDataPtr());
+    const size_t index_array_size = n_indices * sizeof(IndexType);
+    auto* index_array = static_cast<IndexType*>(malloc(index_array_size));
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < int64_t(n_indices); ++i) {
+        index_array[i] = IndexType(src[i]);
+    }
+
+    auto ib_handle =
+            resource_mgr.CreateIndexBuffer(n_indices, sizeof(IndexType));
+    auto ibuf = resource_mgr.GetIndexBuffer(ib_handle).lock();
+
+    // Gives ownership of index_array to IndexBuffer, which will be
+    // deallocated later with DeallocateBuffer.
+    IndexBuffer::BufferDescriptor ib_descriptor(index_array, index_array_size);
+    ib_descriptor.setCallback(GeometryBuffersBuilder::DeallocateBuffer);
+    ibuf->setBuffer(engine, std::move(ib_descriptor));
+
+    return std::make_tuple(vb_handle, ib_handle, IndexBufferHandle());
+}
+
+filament::Box TTriangleMeshBuffersBuilder::ComputeAABB() {
+    const auto& vertices = geometry_.GetVertices();
+    auto min_bounds = vertices.Min({0});
+    auto max_bounds = vertices.Max({0});
+    auto* min_bounds_float = static_cast<float*>(min_bounds.GetDataPtr());
+    auto* max_bounds_float = static_cast<float*>(max_bounds.GetDataPtr());
+
+    const filament::math::float3 min(min_bounds_float[0], min_bounds_float[1],
+                                     min_bounds_float[2]);
+    const filament::math::float3 max(max_bounds_float[0], max_bounds_float[1],
+                                     max_bounds_float[2]);
+
+    Box aabb;
+    aabb.set(min, max);
+
+    return aabb;
+}
+
 }  // namespace rendering
 }  // namespace visualization
 }  // namespace open3d
@@ -271,7 +271,7 @@ void pybind_trianglemesh(py::module &m) {
                  "Garland and Heckbert",
                  "target_number_of_triangles"_a,
                  "maximum_error"_a = std::numeric_limits<double>::infinity(),
-                 "boundary_weight"_a = 1.0)
+                 "boundary_weight"_a = 1.0, "parallel"_a = false)
             .def("compute_convex_hull", &TriangleMesh::ComputeConvexHull,
                  "Computes the convex hull of the triangle mesh.")
             .def("cluster_connected_triangles",
@@ -345,7 +345,7 @@ void pybind_trianglemesh(py::module &m) {
                     "reconstruction is done by rolling a ball with a given "
                     "radius over the point cloud, whenever the ball touches "
                     "three points a triangle is created.",
-                    "pcd"_a, "radii"_a)
+                    "pcd"_a, "radii"_a, "parallel"_a = false)
             .def_static("create_from_point_cloud_poisson",
                         &TriangleMesh::CreateFromPointCloudPoisson,
                         "Function that computes a triangle mesh from a "
@@ -609,10 +609,16 @@ void pybind_trianglemesh(py::module &m) {
               "The number of triangles that the simplified mesh should have. "
               "It is not guaranteed that this number will be reached."},
              {"maximum_error",
-              "The maximum error where a vertex is allowed to be merged"},
+              "The maximum error where a vertex is allowed to be merged. "
+              "With a target of zero triangles the simplification only "
+              "stops at this error."},
              {"boundary_weight",
               "A weight applied to edge vertices used to preserve "
-              "boundaries"}});
+              "boundaries"},
+             {"parallel",
+              "If true, every round collapses the edges that are the "
+              "cheapest in their neighborhood in parallel, instead of one "
+              "edge at a time. These collapses keep the mesh manifold."}});
     docstring::ClassMethodDocInject(m, "TriangleMesh", "compute_convex_hull");
     docstring::ClassMethodDocInject(m, "TriangleMesh",
                                     "cluster_connected_triangles");
@@ -671,6 +677,12 @@ void pybind_trianglemesh(py::module &m) {
               "reconstructed. Has to contain normals."},
              {"radii",
               "The radii of the ball that are used for the surface "
+              "reconstruction."},
+             {"parallel",
+              "If true, the point cloud is split into spatially disjoint "
+              "regions that are reconstructed in parallel. The open edges "
+              "between the regions are then pivoted over the whole point "
+              "cloud. The result can differ slightly from the serial "
               "reconstruction."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "create_from_point_cloud_poisson",
@@ -42,8 +42,24 @@ void pybind_rpc(py::module& m_io) {
     atexit.attr("register")(
             py::cpp_function([]() { rpc::DestroyZMQContext(); }));
 
+    py::enum_<rpc::ArrayTransport>(m, "ArrayTransport",
+                                   "Transport of the array data in messages.")
+            .value("Inline", rpc::ArrayTransport::Inline,
+                   "Array data is serialized inside the messages.")
+            .value("Frames", rpc::ArrayTransport::Frames,
+                   "Array data is sent as separate frames without copies.")
+            .value("SharedMemory", rpc::ArrayTransport::SharedMemory,
+                   "Array data is passed in shared memory files. Sender and "
+                   "receiver must be on the same machine.")
+            .export_values();
+
     py::class_<rpc::ConnectionBase, std::shared_ptr<rpc::ConnectionBase>>(
-            m, "_ConnectionBase");
+            m, "_ConnectionBase")
+            .def("set_array_transport",
+                 &rpc::ConnectionBase::SetArrayTransport,
+                 "Sets the transport for array data and whether array data "
+                 "is compressed with LZF.",
+                 "transport"_a, "compress"_a = false);
 
     py::class_<rpc::Connection, std::shared_ptr<rpc::Connection>,
                rpc::ConnectionBase>(m, "Connection")
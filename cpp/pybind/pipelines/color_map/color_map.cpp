@@ -167,7 +167,12 @@ void pybind_color_map_classes(py::module &m) {
 }
 
 void pybind_color_map_methods(py::module &m) {
-    m.def("color_map_optimization", &ColorMapOptimization,
+    m.def("color_map_optimization",
+          py::overload_cast<
+                  geometry::TriangleMesh &,
+                  const std::vector<std::shared_ptr<geometry::RGBDImage>> &,
+                  camera::PinholeCameraTrajectory &,
+                  const ColorMapOptimizationOption &>(&ColorMapOptimization),
           "Function for color mapping of reconstructed scenes via "
           "optimization, "
           "This is implementation of following by paper Q-Y Zhou and V Koltun: "
@@ -182,6 +187,33 @@ void pybind_color_map_methods(py::module &m) {
              {"imgs_rgbd", "A list of RGBD images seen by cameras."},
              {"camera", "Cameras' parameters."},
              {"option", "The ColorMap optimization option."}});
+
+    m.def("color_map_optimization_from_files",
+          py::overload_cast<geometry::TriangleMesh &,
+                            const std::vector<std::string> &,
+                            const std::vector<std::string> &,
+                            camera::PinholeCameraTrajectory &,
+                            const ColorMapOptimizationOption &, size_t, double,
+                            double>(&ColorMapOptimization),
+          "Color map optimization with the RGBD images streamed from disk in "
+          "batches that fit in a memory budget.",
+          "mesh"_a, "color_filenames"_a, "depth_filenames"_a, "camera"_a,
+          "option"_a = ColorMapOptimizationOption(),
+          "max_memory_bytes"_a = size_t(2) << 30, "depth_scale"_a = 1000.0,
+          "depth_trunc"_a = 3.0);
+    docstring::FunctionDocInject(
+            m, "color_map_optimization_from_files",
+            {{"mesh", "The input geometry mesh."},
+             {"color_filenames", "Color image file of each camera."},
+             {"depth_filenames", "Depth image file of each camera."},
+             {"camera", "Cameras' parameters."},
+             {"option", "The ColorMap optimization option."},
+             {"max_memory_bytes",
+              "Memory budget for the images held at the same time. At least "
+              "one camera is held."},
+             {"depth_scale", "Depth scale of the depth images."},
+             {"depth_trunc", "Depth values larger than depth_trunc are "
+                             "ignored."}});
 }
 
 void pybind_color_map(py::module &m) {
@@ -27,6 +27,7 @@
 #include "open3d/pipelines/registration/Feature.h"
 
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/utility/Console.h"
 #include "pybind/docstring.h"
 #include "pybind/pipelines/registration/registration.h"
 
@@ -62,6 +63,58 @@ void pybind_feature(py::module &m) {
     docstring::ClassMethodDocInject(m, "Feature", "resize",
                                     {{"dim", "Feature dimension per point."},
                                      {"n", "Number of points."}});
+
+    // open3d.registration.FeatureMatchingMethod
+    py::enum_<FeatureMatchingMethod> feature_matching_method(
+            m, "FeatureMatchingMethod");
+    feature_matching_method.value("KDTree", FeatureMatchingMethod::KDTree)
+            .value("KDForest", FeatureMatchingMethod::KDForest)
+            .value("BruteForce", FeatureMatchingMethod::BruteForce)
+            .export_values();
+    feature_matching_method.attr("__doc__") = docstring::static_property(
+            py::cpp_function([](py::handle arg) -> std::string {
+                return "Enum class for nearest neighbor search methods used "
+                       "to match features.";
+            }),
+            py::none(), py::none(), "");
+
+    // open3d.registration.FeatureMatchingOption
+    py::class_<FeatureMatchingOption> feature_matching_option(
+            m, "FeatureMatchingOption",
+            "Options for correspondences_from_features.");
+    py::detail::bind_copy_functions<FeatureMatchingOption>(
+            feature_matching_option);
+    feature_matching_option
+            .def(py::init([](FeatureMatchingMethod method, double epsilon,
+                             int num_trees, int checks) {
+                     return new FeatureMatchingOption(method, epsilon,
+                                                      num_trees, checks);
+                 }),
+                 "method"_a = FeatureMatchingMethod::KDTree,
+                 "epsilon"_a = 0.0, "num_trees"_a = 4, "checks"_a = 128)
+            .def_readwrite("method", &FeatureMatchingOption::method_,
+                           "FeatureMatchingMethod: Nearest neighbor search "
+                           "method.")
+            .def_readwrite("epsilon", &FeatureMatchingOption::epsilon_,
+                           "float: Relative distance error allowed by the "
+                           "KDTree and KDForest methods. 0 gives the exact "
+                           "nearest neighbor with a KDTree.")
+            .def_readwrite("num_trees", &FeatureMatchingOption::num_trees_,
+                           "int: Number of randomized trees of the KDForest "
+                           "method.")
+            .def_readwrite("checks", &FeatureMatchingOption::checks_,
+                           "int: Number of leaves visited per query by the "
+                           "KDForest method. Larger values trade speed for "
+                           "recall.")
+            .def("__repr__", [](const FeatureMatchingOption &c) {
+                return fmt::format(
+                        "FeatureMatchingOption class with "
+                        "\nmethod={}"
+                        "\nepsilon={}"
+                        "\nnum_trees={}"
+                        "\nchecks={}",
+                        int(c.method_), c.epsilon_, c.num_trees_, c.checks_);
+            });
 }
 
 void pybind_feature_methods(py::module &m) {
@@ -72,6 +125,20 @@ void pybind_feature_methods(py::module &m) {
             m, "compute_fpfh_feature",
             {{"input", "The Input point cloud."},
              {"search_param", "KDTree KNN search parameter."}});
+
+    m.def("correspondences_from_features", &CorrespondencesFromFeatures,
+          "Function to find the nearest target feature of every source "
+          "feature",
+          "source_feature"_a, "target_feature"_a, "mutual_filter"_a = false,
+          "option"_a = FeatureMatchingOption());
+    docstring::FunctionDocInject(
+            m, "correspondences_from_features",
+            {{"source_feature", "Source features."},
+             {"target_feature", "Target features."},
+             {"mutual_filter",
+              "Only keeps the pairs where the source point is also the "
+              "nearest neighbor of its target point."},
+             {"option", "Nearest neighbor search options."}});
 }
 
 }  // namespace registration
@@ -423,17 +423,20 @@ must hold true for all edges.)");
                              bool decrease_mu,
                              double maximum_correspondence_distance,
                              int iteration_number, double tuple_scale,
-                             int maximum_tuple_count) {
+                             int maximum_tuple_count,
+                             const FeatureMatchingOption &feature_matching) {
                      return new FastGlobalRegistrationOption(
                              division_factor, use_absolute_scale, decrease_mu,
                              maximum_correspondence_distance, iteration_number,
-                             tuple_scale, maximum_tuple_count);
+                             tuple_scale, maximum_tuple_count,
+                             feature_matching);
                  }),
                  "division_factor"_a = 1.4, "use_absolute_scale"_a = false,
                  "decrease_mu"_a = false,
                  "maximum_correspondence_distance"_a = 0.025,
                  "iteration_number"_a = 64, "tuple_scale"_a = 0.95,
-                 "maximum_tuple_count"_a = 1000)
+                 "maximum_tuple_count"_a = 1000,
+                 "feature_matching"_a = FeatureMatchingOption())
             .def_readwrite(
                     "division_factor",
                     &FastGlobalRegistrationOption::division_factor_,
@@ -461,6 +464,10 @@ must hold true for all edges.)");
             .def_readwrite("maximum_tuple_count",
                            &FastGlobalRegistrationOption::maximum_tuple_count_,
                            "float: Maximum tuple numbers.")
+            .def_readwrite("feature_matching",
+                           &FastGlobalRegistrationOption::feature_matching_,
+                           "FeatureMatchingOption: Nearest neighbor search "
+                           "used to match the features.")
             .def("__repr__", [](const FastGlobalRegistrationOption &c) {
                 return fmt::format(
                         ""
@@ -545,6 +552,9 @@ static const std::unordered_map<std::string, std::string>
                 {"init", "Initial transformation estimation"},
                 {"lambda_geometric", "lambda_geometric value"},
                 {"kernel", "Robust Kernel used in the Optimization"},
+                {"matching_option",
+                 "FeatureMatchingOption: Nearest neighbor search options of "
+                 "the feature matching."},
                 {"max_correspondence_distance",
                  "Maximum correspondence points-pair distance."},
                 {"mutual_filter",
@@ -608,7 +618,8 @@ void pybind_registration_methods(py::module &m) {
           "ransac_n"_a = 3,
           "checkers"_a = std::vector<
                   std::reference_wrapper<const CorrespondenceChecker>>(),
-          "criteria"_a = RANSACConvergenceCriteria(100000, 0.999));
+          "criteria"_a = RANSACConvergenceCriteria(100000, 0.999),
+          "matching_option"_a = FeatureMatchingOption());
     docstring::FunctionDocInject(
             m, "registration_ransac_based_on_feature_matching",
             map_shared_argument_docstrings);
@@ -635,11 +646,13 @@ void pybind_registration_methods(py::module &m) {
 void pybind_registration(py::module &m) {
     py::module m_submodule =
             m.def_submodule("registration", "Registration pipeline.");
+    // Features are bound first since FastGlobalRegistrationOption defaults
+    // to a FeatureMatchingOption.
+    pybind_feature(m_submodule);
+    pybind_feature_methods(m_submodule);
     pybind_registration_classes(m_submodule);
     pybind_registration_methods(m_submodule);
 
-    pybind_feature(m_submodule);
-    pybind_feature_methods(m_submodule);
     pybind_global_optimization(m_submodule);
     pybind_global_optimization_methods(m_submodule);
     pybind_robust_kernels(m_submodule);
@@ -68,6 +68,12 @@ void pybind_image(py::module &m) {
             m, "Image", py::buffer_protocol(),
             "The Image class stores image with customizable rols, cols, "
             "channels, dtype and device.");
+    py::enum_<Image::InterpType>(image, "InterpType",
+                                 "Interpolation type used by resize.")
+            .value("Nearest", Image::InterpType::Nearest)
+            .value("Linear", Image::InterpType::Linear)
+            .export_values();
+
     // Constructors
     image.def(py::init<int64_t, int64_t, int64_t, core::Dtype, core::Device>(),
               "Row-major storage is used, similar to OpenCV. Use (row, col, "
@@ -111,6 +117,41 @@ void pybind_image(py::module &m) {
                  "Compute max 2D coordinates for the data ({rows, cols}).")
             .def("__repr__", &Image::ToString);
 
+    // Image processing.
+    image.def("to", &Image::To,
+              "Returns a copy converted to dtype, with values transformed to "
+              "value * scale + offset.",
+              "dtype"_a, "scale"_a = 1.0, "offset"_a = 0.0)
+            .def("clip_transform", &Image::ClipTransform,
+                 "Converts a depth image to Float32 depth / scale, replacing "
+                 "values outside (min_value, max_value] with clip_fill.",
+                 "scale"_a, "min_value"_a, "max_value"_a, "clip_fill"_a = 0.0f)
+            .def("rgb_to_gray", &Image::RGBToGray,
+                 "Converts a 3-channel RGB image to a 1-channel grayscale "
+                 "image.")
+            .def("resize", &Image::Resize, "Resizes the image.",
+                 "sampling_rate"_a = 0.5f,
+                 "interp_type"_a = Image::InterpType::Nearest)
+            .def("filter_gaussian", &Image::FilterGaussian,
+                 "Gaussian filter.", "kernel_size"_a = 3, "sigma"_a = 1.0f)
+            .def("filter_bilateral", &Image::FilterBilateral,
+                 "Bilateral filter.", "kernel_size"_a = 3,
+                 "value_sigma"_a = 20.0f, "distance_sigma"_a = 10.0f)
+            .def("filter_sobel", &Image::FilterSobel,
+                 "Returns the Sobel gradients (dx, dy) of a 1-channel image.",
+                 "kernel_size"_a = 3)
+            .def("pyrdown", &Image::PyrDown,
+                 "Gaussian blur followed by 2x downsampling.")
+            .def("pyrdown_depth", &Image::PyrDownDepth,
+                 "Edge-preserving 2x downsampling of a Float32 depth image.",
+                 "diff_threshold"_a, "invalid_fill"_a = 0.0f)
+            .def("create_vertex_map", &Image::CreateVertexMap,
+                 "Unprojects a Float32 depth image to a vertex map.",
+                 "intrinsics"_a, "invalid_fill"_a = 0.0f)
+            .def("create_normal_map", &Image::CreateNormalMap,
+                 "Computes a normal map from a vertex map.",
+                 "invalid_fill"_a = 0.0f);
+
     // Conversion.
     image.def("to_legacy_image", &Image::ToLegacyImage,
               "Convert to legacy Image type.");
@@ -39,6 +39,14 @@ void pybind_tsdf_voxelgrid(py::module& m) {
             m, "TSDFVoxelGrid",
             "A voxel grid for TSDF and/or color integration.");
 
+    py::enum_<TSDFVoxelGrid::AllocationMode>(
+            tsdf_voxelgrid, "AllocationMode",
+            "Strategy to determine the voxel blocks to allocate in integrate.")
+            .value("PointNeighborhood",
+                   TSDFVoxelGrid::AllocationMode::PointNeighborhood)
+            .value("RayMarching", TSDFVoxelGrid::AllocationMode::RayMarching)
+            .export_values();
+
     // Constructors.
     tsdf_voxelgrid.def(
             py::init<const std::unordered_map<std::string, core::Dtype>&, float,
@@ -73,6 +81,9 @@ void pybind_tsdf_voxelgrid(py::module& m) {
     tsdf_voxelgrid.def("cuda", &TSDFVoxelGrid::CUDA);
 
     tsdf_voxelgrid.def("get_device", &TSDFVoxelGrid::GetDevice);
+    tsdf_voxelgrid.def_property("allocation_mode",
+                                &TSDFVoxelGrid::GetAllocationMode,
+                                &TSDFVoxelGrid::SetAllocationMode);
 }
 }  // namespace geometry
 }  // namespace t
@@ -25,6 +25,7 @@
 // ----------------------------------------------------------------------------
 
 #include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/TriangleMesh.h"
 #include "open3d/visualization/rendering/Gradient.h"
 #include "open3d/visualization/rendering/Material.h"
 #include "open3d/visualization/rendering/Open3DScene.h"
@@ -266,14 +267,34 @@ void pybind_rendering_classes(py::module &m) {
                  "name"_a, "geometry"_a, "material"_a,
                  "downsampled_name"_a = "", "downsample_threshold"_a = SIZE_MAX,
                  "Adds a Geometry with a material to the scene")
+            .def("add_geometry",
+                 (bool (Scene::*)(const std::string &,
+                                  const t::geometry::TriangleMesh &,
+                                  const Material &)) &
+                         Scene::AddGeometry,
+                 "name"_a, "geometry"_a, "material"_a,
+                 "Adds a tensor TriangleMesh with a material to the scene")
             .def("has_geometry", &Scene::HasGeometry,
                  "Returns True if a geometry with the provided name exists in "
                  "the scene.")
-            .def("update_geometry", &Scene::UpdateGeometry,
+            .def("update_geometry",
+                 (void (Scene::*)(const std::string &,
+                                  const t::geometry::PointCloud &, uint32_t)) &
+                         Scene::UpdateGeometry,
                  "Updates the flagged arrays from the tgeometry.PointCloud. "
                  "The flags should be ORed from Scene.UPDATE_POINTS_FLAG, "
                  "Scene.UPDATE_NORMALS_FLAG, Scene.UPDATE_COLORS_FLAG, and "
                  "Scene.UPDATE_UV0_FLAG")
+            .def("update_geometry",
+                 (void (Scene::*)(const std::string &,
+                                  const t::geometry::PointCloud &, uint32_t,
+                                  size_t)) &
+                         Scene::UpdateGeometry,
+                 "name"_a, "point_cloud"_a, "update_flags"_a,
+                 "first_vertex"_a,
+                 "Updates the flagged arrays of the vertices starting at "
+                 "first_vertex from the tgeometry.PointCloud, which holds "
+                 "only the new vertices. Other vertices are left unchanged.")
             .def("enable_indirect_light", &Scene::EnableIndirectLight,
                  "Enables or disables indirect lighting")
             .def("set_indirect_light", &Scene::SetIndirectLight,
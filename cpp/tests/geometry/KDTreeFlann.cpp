@@ -72,6 +72,47 @@ TEST(KDTreeFlann, SearchKNN) {
     ExpectEQ(ref_distance2, distance2);
 }
 
+TEST(KDTreeFlann, SearchKNNBatch) {
+    geometry::PointCloud pc;
+    pc.points_.resize(2000);
+    Rand(pc.points_, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(10, 10, 10),
+         0);
+    geometry::KDTreeFlann kdtree(pc);
+
+    Eigen::MatrixXd queries(3, 1500);
+    for (int i = 0; i < queries.cols(); ++i) {
+        queries.col(i) = pc.points_[i] + Eigen::Vector3d(0.1, -0.05, 0.02);
+    }
+    const int knn = 5;
+    Eigen::MatrixXi indices;
+    Eigen::MatrixXd distance2;
+    EXPECT_EQ(kdtree.SearchKNN(queries, knn, indices, distance2),
+              knn * queries.cols());
+    ASSERT_EQ(indices.rows(), knn);
+    ASSERT_EQ(indices.cols(), queries.cols());
+
+    // Same results as searching the queries one by one.
+    std::vector<int> ref_indices;
+    std::vector<double> ref_distance2;
+    for (int i = 0; i < queries.cols(); ++i) {
+        kdtree.SearchKNN(Eigen::Vector3d(queries.col(i)), knn, ref_indices,
+                         ref_distance2);
+        for (int k = 0; k < knn; ++k) {
+            EXPECT_EQ(indices(k, i), ref_indices[k]);
+            EXPECT_DOUBLE_EQ(distance2(k, i), ref_distance2[k]);
+        }
+    }
+
+    // Missing neighbors are marked with -1.
+    geometry::PointCloud small;
+    small.points_ = {Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 0, 0)};
+    geometry::KDTreeFlann small_kdtree(small);
+    EXPECT_EQ(small_kdtree.SearchKNN(queries.leftCols(2), 3, indices,
+                                     distance2),
+              4);
+    EXPECT_EQ(indices.row(2), Eigen::RowVector2i(-1, -1));
+}
+
 TEST(KDTreeFlann, SearchRadius) {
     std::vector<int> ref_indices = {27, 48, 4,  77, 90, 7, 54, 17, 76, 38, 39,
                                     60, 15, 84, 11, 57, 3, 32, 99, 36, 52};
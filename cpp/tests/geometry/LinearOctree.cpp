@@ -0,0 +1,254 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/LinearOctree.h"
+
+#include <json/json.h>
+
+#include <algorithm>
+#include <limits>
+
+#include "open3d/geometry/PointCloud.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+// Random points on a coarse lattice so that many of them share leaves.
+geometry::PointCloud CreateLatticePointCloud(int num_points, int seed) {
+    std::vector<Eigen::Vector3i> cells(num_points);
+    Rand(cells, Eigen::Vector3i(0, 0, 0), Eigen::Vector3i(40, 20, 30), seed);
+    geometry::PointCloud pcd;
+    for (const Eigen::Vector3i &cell : cells) {
+        pcd.points_.push_back(cell.cast<double>() * 0.25);
+    }
+    pcd.colors_.resize(num_points);
+    Rand(pcd.colors_, Eigen::Vector3d::Zero(), Eigen::Vector3d::Ones(),
+         seed + 1);
+    return pcd;
+}
+
+// Leaf boxes of the octree, in leaf order.
+std::vector<geometry::OctreeNodeInfo> GetLeafNodeInfos(
+        const geometry::LinearOctree &octree) {
+    std::vector<geometry::OctreeNodeInfo> infos;
+    for (size_t i = 0; i < octree.NumLeaves(); ++i) {
+        infos.push_back(octree.GetLeafNodeInfo(int(i)));
+    }
+    return infos;
+}
+
+}  // namespace
+
+TEST(LinearOctree, ConstructorWithSize) {
+    geometry::LinearOctree octree(10, Eigen::Vector3d(-1, -1, -1), 2);
+    ExpectEQ(octree.origin_, Eigen::Vector3d(-1, -1, -1));
+    EXPECT_EQ(octree.size_, 2);
+    EXPECT_EQ(octree.max_depth_, 10u);
+    EXPECT_TRUE(octree.IsEmpty());
+    EXPECT_EQ(octree.LocateLeaf(Eigen::Vector3d(0, 0, 0)), -1);
+    EXPECT_THROW(geometry::LinearOctree(22, Eigen::Vector3d(0, 0, 0), 1),
+                 std::runtime_error);
+}
+
+TEST(LinearOctree, SetPointsMatchesInsertPoint) {
+    geometry::PointCloud pcd = CreateLatticePointCloud(2000, 0);
+    for (size_t max_depth : {0, 1, 4, 7}) {
+        auto octree =
+                geometry::LinearOctree::CreateFromPointCloud(pcd, max_depth);
+
+        geometry::Octree ref_octree(max_depth, octree->origin_,
+                                    octree->size_);
+        for (size_t idx = 0; idx < pcd.points_.size(); idx++) {
+            ref_octree.InsertPoint(
+                    pcd.points_[idx],
+                    geometry::OctreeColorLeafNode::GetInitFunction(),
+                    geometry::OctreeColorLeafNode::GetUpdateFunction(
+                            pcd.colors_[idx]));
+        }
+        EXPECT_TRUE(*octree->ToOctree() == ref_octree);
+
+        geometry::Octree converted_octree(max_depth);
+        converted_octree.ConvertFromPointCloud(pcd, 0.01);
+        EXPECT_TRUE(converted_octree == ref_octree);
+
+        // Levels are sorted and each node lists its children.
+        const auto &nodes = octree->GetNodes();
+        EXPECT_EQ(octree->GetLevelOffset(0), 0u);
+        EXPECT_EQ(octree->GetLevelOffset(max_depth + 1), nodes.size());
+        for (size_t depth = 0; depth < max_depth; ++depth) {
+            for (size_t i = octree->GetLevelOffset(depth);
+                 i < octree->GetLevelOffset(depth + 1); ++i) {
+                int child = nodes[i].first_child_;
+                for (int c = 0; c < 8; ++c) {
+                    if (nodes[i].child_mask_ & (1 << c)) {
+                        EXPECT_EQ(nodes[child++].code_,
+                                  (nodes[i].code_ << 3) | c);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(LinearOctree, SetPointsWithoutColors) {
+    geometry::PointCloud pcd = CreateLatticePointCloud(100, 1);
+    pcd.colors_.clear();
+    auto octree = geometry::LinearOctree::CreateFromPointCloud(pcd, 3);
+    EXPECT_FALSE(octree->IsEmpty());
+    for (const Eigen::Vector3d &color : octree->leaf_colors_) {
+        ExpectEQ(color, Eigen::Vector3d(0, 0, 0));
+    }
+}
+
+TEST(LinearOctree, ConvertOctreeAndJson) {
+    geometry::PointCloud pcd = CreateLatticePointCloud(1000, 2);
+    geometry::Octree src_octree(5);
+    src_octree.ConvertFromPointCloud(pcd, 0.01);
+
+    auto octree = geometry::LinearOctree::CreateFromOctree(src_octree);
+    EXPECT_TRUE(*octree->ToOctree() == src_octree);
+
+    Json::Value json_value;
+    EXPECT_TRUE(octree->ConvertToJsonValue(json_value));
+    geometry::Octree dst_octree;
+    EXPECT_TRUE(dst_octree.ConvertFromJsonValue(json_value));
+    EXPECT_TRUE(dst_octree == src_octree);
+
+    geometry::LinearOctree dst_linear_octree;
+    EXPECT_TRUE(dst_linear_octree.ConvertFromJsonValue(json_value));
+    EXPECT_TRUE(*dst_linear_octree.ToOctree() == src_octree);
+}
+
+TEST(LinearOctree, LocateLeaf) {
+    geometry::PointCloud pcd = CreateLatticePointCloud(1000, 3);
+    size_t max_depth = 6;
+    auto octree = geometry::LinearOctree::CreateFromPointCloud(pcd, max_depth);
+    auto ref_octree = octree->ToOctree();
+    for (const Eigen::Vector3d &point : pcd.points_) {
+        int leaf_index = octree->LocateLeaf(point);
+        ASSERT_GE(leaf_index, 0);
+        geometry::OctreeNodeInfo info = octree->GetLeafNodeInfo(leaf_index);
+        std::shared_ptr<geometry::OctreeLeafNode> ref_node;
+        std::shared_ptr<geometry::OctreeNodeInfo> ref_info;
+        std::tie(ref_node, ref_info) = ref_octree->LocateLeafNode(point);
+        ExpectEQ(info.origin_, ref_info->origin_);
+        EXPECT_EQ(info.size_, ref_info->size_);
+        EXPECT_EQ(info.depth_, max_depth);
+        EXPECT_EQ(info.child_index_, ref_info->child_index_);
+    }
+    EXPECT_EQ(octree->LocateLeaf(octree->origin_ -
+                                 Eigen::Vector3d(1e-3, 0, 0)),
+              -1);
+}
+
+TEST(LinearOctree, SearchNeighborLeaves) {
+    geometry::PointCloud pcd = CreateLatticePointCloud(500, 4);
+    auto octree = geometry::LinearOctree::CreateFromPointCloud(pcd, 5);
+    std::vector<geometry::OctreeNodeInfo> infos = GetLeafNodeInfos(*octree);
+    std::vector<int> neighbors;
+    for (size_t i = 0; i < infos.size(); ++i) {
+        octree->SearchNeighborLeaves(int(i), neighbors);
+        std::sort(neighbors.begin(), neighbors.end());
+        std::vector<int> ref_neighbors;
+        for (size_t j = 0; j < infos.size(); ++j) {
+            double distance = (infos[j].origin_ - infos[i].origin_)
+                                      .lpNorm<Eigen::Infinity>();
+            if (j != i && distance < 1.5 * infos[i].size_) {
+                ref_neighbors.push_back(int(j));
+            }
+        }
+        EXPECT_EQ(neighbors, ref_neighbors);
+    }
+}
+
+TEST(LinearOctree, SearchAABB) {
+    geometry::PointCloud pcd = CreateLatticePointCloud(1000, 5);
+    auto octree = geometry::LinearOctree::CreateFromPointCloud(pcd, 5);
+    std::vector<geometry::OctreeNodeInfo> infos = GetLeafNodeInfos(*octree);
+    std::vector<Eigen::Vector3d> corners(20);
+    Rand(corners, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(11, 6, 8), 6);
+    std::vector<int> leaf_indices;
+    for (size_t k = 0; k + 1 < corners.size(); k += 2) {
+        Eigen::Vector3d min_bound = corners[k].cwiseMin(corners[k + 1]);
+        Eigen::Vector3d max_bound = corners[k].cwiseMax(corners[k + 1]);
+        octree->SearchAABB(min_bound, max_bound, leaf_indices);
+        std::vector<int> ref_leaf_indices;
+        for (size_t j = 0; j < infos.size(); ++j) {
+            Eigen::Vector3d leaf_max =
+                    infos[j].origin_.array() + infos[j].size_;
+            if ((infos[j].origin_.array() <= max_bound.array()).all() &&
+                (leaf_max.array() >= min_bound.array()).all()) {
+                ref_leaf_indices.push_back(int(j));
+            }
+        }
+        EXPECT_EQ(leaf_indices, ref_leaf_indices);
+    }
+}
+
+TEST(LinearOctree, CastRay) {
+    geometry::PointCloud pcd = CreateLatticePointCloud(300, 7);
+    auto octree = geometry::LinearOctree::CreateFromPointCloud(pcd, 5);
+    std::vector<geometry::OctreeNodeInfo> infos = GetLeafNodeInfos(*octree);
+    std::vector<Eigen::Vector3d> origins(100);
+    std::vector<Eigen::Vector3d> targets(100);
+    Rand(origins, Eigen::Vector3d(-5, -5, -5), Eigen::Vector3d(15, 10, 12), 8);
+    Rand(targets, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(10, 5, 7.5), 9);
+    for (size_t k = 0; k < origins.size(); ++k) {
+        const Eigen::Vector3d direction = targets[k] - origins[k];
+        double t;
+        int leaf_index = octree->CastRay(origins[k], direction, t);
+
+        // Brute force slab test against all leaves.
+        double ref_t = std::numeric_limits<double>::infinity();
+        for (const geometry::OctreeNodeInfo &info : infos) {
+            double t0 = 0;
+            double t1 = std::numeric_limits<double>::infinity();
+            for (int i = 0; i < 3; ++i) {
+                double t_near = (info.origin_(i) - origins[k](i)) /
+                                direction(i);
+                double t_far = (info.origin_(i) + info.size_ - origins[k](i)) /
+                               direction(i);
+                t0 = std::max(t0, std::min(t_near, t_far));
+                t1 = std::min(t1, std::max(t_near, t_far));
+            }
+            if (t0 <= t1) {
+                ref_t = std::min(ref_t, t0);
+            }
+        }
+        if (std::isinf(ref_t)) {
+            EXPECT_EQ(leaf_index, -1);
+        } else {
+            ASSERT_GE(leaf_index, 0);
+            EXPECT_NEAR(t, ref_t, 1e-12);
+        }
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -1021,6 +1021,28 @@ TEST(PointCloud, ClusterDBSCAN) {
     EXPECT_EQ(cluster_sum, 398580);
 }
 
+TEST(PointCloud, ClusterDBSCANBorderPoints) {
+    // Two crosses share the border point (1.4, 0). It is closer to the
+    // second cross, but joins the first one as it has the smaller label.
+    geometry::PointCloud pcd({{1.4, 0, 0},
+                              {3, 0, 0},
+                              {3, 1, 0},
+                              {3, -1, 0},
+                              {4.5, 0, 0},
+                              {10, 10, 0},
+                              {0, 0, 0},
+                              {0, 1, 0},
+                              {0, -1, 0},
+                              {-1.5, 0, 0}});
+
+    EXPECT_EQ(pcd.ClusterDBSCAN(1.7, 4),
+              std::vector<int>({0, 0, 0, 0, 0, -1, 1, 1, 1, 1}));
+    EXPECT_EQ(pcd.ClusterDBSCAN(1.7, 6), std::vector<int>(10, -1));
+    EXPECT_EQ(pcd.ClusterDBSCAN(0.5, 1),
+              std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    EXPECT_TRUE(geometry::PointCloud().ClusterDBSCAN(1.7, 4).empty());
+}
+
 TEST(PointCloud, SegmentPlane) {
     geometry::PointCloud pcd;
     io::ReadPointCloud(std::string(TEST_DATA_DIR) + "/fragment.pcd", pcd);
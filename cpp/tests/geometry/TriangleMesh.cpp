@@ -839,6 +839,64 @@ TEST(TriangleMesh, FilterSmoothTaubin) {
     ExpectEQ(mesh->vertices_, ref2, 1e-4);
 }
 
+TEST(TriangleMesh, SimplifyQuadricDecimation) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 40);
+    const int target = int(sphere->triangles_.size()) / 10;
+    for (bool parallel : {false, true}) {
+        auto mesh = sphere->SimplifyQuadricDecimation(
+                target, std::numeric_limits<double>::infinity(), 1.0,
+                parallel);
+        EXPECT_LE(int(mesh->triangles_.size()), target);
+        EXPECT_GE(int(mesh->triangles_.size()), target - 2);
+        EXPECT_TRUE(mesh->IsEdgeManifold(true));
+        for (const Eigen::Vector3d& vertex : mesh->vertices_) {
+            EXPECT_NEAR(vertex.norm(), 1.0, 0.05);
+        }
+    }
+
+    // The parallel collapses keep the topology of the mesh.
+    auto mesh = sphere->SimplifyQuadricDecimation(
+            target, std::numeric_limits<double>::infinity(), 1.0, true);
+    EXPECT_TRUE(mesh->IsVertexManifold());
+    EXPECT_TRUE(mesh->IsWatertight());
+    EXPECT_EQ(mesh->EulerPoincareCharacteristic(), 2);
+
+    // Without a target the collapses stop at the maximum error. Collapses
+    // within the faces and along the edges of a box have no error.
+    auto box = geometry::TriangleMesh::CreateBox()->SubdivideMidpoint(3);
+    for (bool parallel : {false, true}) {
+        mesh = box->SimplifyQuadricDecimation(0, 1e-12, 1.0, parallel);
+        EXPECT_EQ(mesh->triangles_.size(), 12u);
+        ExpectEQ(mesh->GetMinBound(), Eigen::Vector3d(0, 0, 0));
+        ExpectEQ(mesh->GetMaxBound(), Eigen::Vector3d(1, 1, 1));
+        EXPECT_NEAR(mesh->GetSurfaceArea(), 6.0, 1e-6);
+    }
+
+    // On an open mesh, interior edges between two boundary vertices must not
+    // be collapsed. A narrow strip has many of these edges.
+    geometry::TriangleMesh strip;
+    const int n_columns = 40;
+    const int n_rows = 3;
+    for (int i = 0; i <= n_columns; ++i) {
+        for (int j = 0; j <= n_rows; ++j) {
+            strip.vertices_.emplace_back(i, j, 0.1 * std::sin(i));
+        }
+    }
+    for (int i = 0; i < n_columns; ++i) {
+        for (int j = 0; j < n_rows; ++j) {
+            const int v0 = (n_rows + 1) * i + j;
+            strip.triangles_.emplace_back(v0, v0 + n_rows + 1,
+                                          v0 + n_rows + 2);
+            strip.triangles_.emplace_back(v0, v0 + n_rows + 2, v0 + 1);
+        }
+    }
+    mesh = strip.SimplifyQuadricDecimation(
+            4, std::numeric_limits<double>::infinity(), 1.0, true);
+    EXPECT_LT(mesh->triangles_.size(), strip.triangles_.size() / 2);
+    EXPECT_TRUE(mesh->IsEdgeManifold(true));
+    EXPECT_TRUE(mesh->IsVertexManifold());
+}
+
 TEST(TriangleMesh, HasVertices) {
     int size = 100;
 
@@ -1915,6 +1973,72 @@ TEST(TriangleMesh, CreateFromPointCloudAlphaShape) {
     ExpectMeshEQ(*mesh_es, mesh_gt);
 }
 
+TEST(TriangleMesh, CreateFromPointCloudBallPivoting) {
+    // The pivoting logs every step at the debug level.
+    utility::VerbosityContextManager verbosity(
+            utility::VerbosityLevel::Warning);
+    verbosity.enter();
+
+    auto torus = geometry::TriangleMesh::CreateTorus(1.0, 0.5, 60, 40);
+    torus->ComputeVertexNormals();
+    // Enough points for the parallel reconstruction to split the point
+    // cloud into several regions.
+    const int n_points = 20000;
+    auto pcd = torus->SamplePointsUniformly(n_points, false, 0);
+    double spacing = std::sqrt(torus->GetSurfaceArea() / n_points);
+    std::vector<double> radii = {spacing, 2 * spacing};
+
+    auto mesh_serial =
+            geometry::TriangleMesh::CreateFromPointCloudBallPivoting(*pcd,
+                                                                     radii);
+    EXPECT_EQ(mesh_serial->vertices_.size(), pcd->points_.size());
+    EXPECT_GT(mesh_serial->triangles_.size(), pcd->points_.size());
+    EXPECT_TRUE(mesh_serial->IsEdgeManifold(true));
+
+    auto mesh_parallel =
+            geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+                    *pcd, radii, true);
+    EXPECT_EQ(mesh_parallel->vertices_.size(), pcd->points_.size());
+    EXPECT_TRUE(mesh_parallel->IsEdgeManifold(true));
+    // The regions are stitched by pivoting over the seams, which may close
+    // a few triangles differently than the serial front.
+    double ratio = double(mesh_parallel->triangles_.size()) /
+                   double(mesh_serial->triangles_.size());
+    EXPECT_NEAR(ratio, 1.0, 1e-3);
+    // Both cover nearly the same points.
+    auto coverage = [&](geometry::TriangleMesh mesh) {
+        mesh.RemoveUnreferencedVertices();
+        return double(mesh.vertices_.size()) / n_points;
+    };
+    EXPECT_NEAR(coverage(*mesh_parallel), coverage(*mesh_serial), 1e-3);
+
+    // A small tetrahedron in the hole of the torus straddles the splits of
+    // the regions, so that every one of its triangles crosses a region
+    // boundary. The final pass still seeds it.
+    const double a = 0.01;
+    for (const Eigen::Vector3d& vertex :
+         {Eigen::Vector3d(a, a, a), Eigen::Vector3d(a, -a, -a),
+          Eigen::Vector3d(-a, a, -a), Eigen::Vector3d(-a, -a, a)}) {
+        pcd->points_.push_back(vertex);
+        pcd->normals_.push_back(vertex.normalized());
+    }
+    mesh_parallel = geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+            *pcd, radii, true);
+    int n_tetrahedron_triangles = 0;
+    for (const Eigen::Vector3i& triangle : mesh_parallel->triangles_) {
+        n_tetrahedron_triangles += triangle(0) >= n_points;
+    }
+    EXPECT_EQ(n_tetrahedron_triangles, 4);
+
+    geometry::PointCloud pcd_no_normals;
+    pcd_no_normals.points_ = pcd->points_;
+    EXPECT_THROW(geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+                         pcd_no_normals, radii, true),
+                 std::runtime_error);
+
+    verbosity.exit();
+}
+
 TEST(TriangleMesh, CreateMeshSphere) {
     std::vector<Eigen::Vector3d> ref_vertices = {
             {0.000000, 0.000000, 1.000000},
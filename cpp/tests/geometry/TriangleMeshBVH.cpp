@@ -0,0 +1,260 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/TriangleMeshBVH.h"
+
+#include <algorithm>
+
+#include "open3d/geometry/IntersectionTest.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+// One BVH per triangle, queried one after another as a brute-force
+// reference.
+std::vector<std::shared_ptr<geometry::TriangleMeshBVH>> CreateTriangleBVHs(
+        const geometry::TriangleMesh &mesh) {
+    std::vector<std::shared_ptr<geometry::TriangleMeshBVH>> bvhs;
+    for (const Eigen::Vector3i &triangle : mesh.triangles_) {
+        geometry::TriangleMesh single;
+        single.vertices_ = {mesh.vertices_[triangle(0)],
+                            mesh.vertices_[triangle(1)],
+                            mesh.vertices_[triangle(2)]};
+        single.triangles_ = {Eigen::Vector3i(0, 1, 2)};
+        bvhs.push_back(std::make_shared<geometry::TriangleMeshBVH>(single));
+    }
+    return bvhs;
+}
+
+// Small random triangles without shared vertices.
+geometry::TriangleMesh CreateTriangleSoup(int num_triangles, int seed) {
+    std::vector<Eigen::Vector3d> centers(num_triangles);
+    Rand(centers, Eigen::Vector3d::Zero(), Eigen::Vector3d::Constant(10.0),
+         seed);
+    std::vector<Eigen::Vector3d> offsets(3 * num_triangles);
+    Rand(offsets, Eigen::Vector3d::Constant(-1.0),
+         Eigen::Vector3d::Constant(1.0), seed + 1);
+    geometry::TriangleMesh mesh;
+    for (int tidx = 0; tidx < num_triangles; ++tidx) {
+        for (int j = 0; j < 3; ++j) {
+            mesh.vertices_.push_back(centers[tidx] + offsets[3 * tidx + j]);
+        }
+        mesh.triangles_.emplace_back(3 * tidx, 3 * tidx + 1, 3 * tidx + 2);
+    }
+    return mesh;
+}
+
+}  // namespace
+
+TEST(TriangleMeshBVH, EmptyMesh) {
+    geometry::TriangleMeshBVH bvh(geometry::TriangleMesh{});
+    EXPECT_EQ(bvh.NumTriangles(), 0u);
+    EXPECT_EQ(bvh.CastRay(Eigen::Vector3d::Zero(), Eigen::Vector3d::UnitX())
+                      .triangle_index_,
+              -1);
+    EXPECT_EQ(bvh.ComputeClosestPoint(Eigen::Vector3d::Zero()).triangle_index_,
+              -1);
+    std::vector<int> indices;
+    EXPECT_EQ(bvh.SearchAABB(Eigen::Vector3d::Zero(), Eigen::Vector3d::Ones(),
+                             indices),
+              0);
+}
+
+TEST(TriangleMeshBVH, Layout) {
+    geometry::TriangleMesh mesh = CreateTriangleSoup(1000, 0);
+    geometry::TriangleMeshBVH bvh(mesh);
+    EXPECT_EQ(sizeof(geometry::TriangleMeshBVH::Node), 32u);
+    EXPECT_EQ(bvh.NumTriangles(), mesh.triangles_.size());
+
+    // Every triangle is in exactly one leaf, inside the leaf's bounds.
+    const auto &nodes = bvh.GetNodes();
+    const std::vector<int> &triangle_indices = bvh.GetTriangleIndices();
+    ASSERT_EQ(triangle_indices.size(), mesh.triangles_.size());
+    std::vector<int> leaf_count(mesh.triangles_.size(), 0);
+    for (const auto &node : nodes) {
+        if (!node.IsLeaf()) {
+            EXPECT_GT(node.index_, 0);
+            EXPECT_LT(node.index_ + 1, int(nodes.size()));
+            continue;
+        }
+        for (int k = node.index_; k < node.index_ + node.count_; ++k) {
+            const int tidx = triangle_indices[k];
+            leaf_count[tidx]++;
+            for (int j = 0; j < 3; ++j) {
+                const Eigen::Vector3d &v =
+                        mesh.vertices_[mesh.triangles_[tidx](j)];
+                for (int a = 0; a < 3; ++a) {
+                    EXPECT_LE(double(node.min_bound_[a]), v(a));
+                    EXPECT_GE(double(node.max_bound_[a]), v(a));
+                }
+            }
+        }
+    }
+    EXPECT_EQ(leaf_count, std::vector<int>(mesh.triangles_.size(), 1));
+}
+
+TEST(TriangleMeshBVH, SearchAABB) {
+    geometry::TriangleMesh mesh = CreateTriangleSoup(500, 1);
+    geometry::TriangleMeshBVH bvh(mesh);
+    std::vector<Eigen::Vector3d> corners(40);
+    Rand(corners, Eigen::Vector3d::Zero(), Eigen::Vector3d::Constant(10.0), 2);
+    for (size_t i = 0; i < corners.size(); i += 2) {
+        const Eigen::Vector3d min_bound = corners[i].cwiseMin(corners[i + 1]);
+        const Eigen::Vector3d max_bound = corners[i].cwiseMax(corners[i + 1]);
+        std::vector<int> ref_indices;
+        for (size_t tidx = 0; tidx < mesh.triangles_.size(); ++tidx) {
+            const Eigen::Vector3i &t = mesh.triangles_[tidx];
+            const Eigen::Vector3d &v0 = mesh.vertices_[t(0)];
+            const Eigen::Vector3d &v1 = mesh.vertices_[t(1)];
+            const Eigen::Vector3d &v2 = mesh.vertices_[t(2)];
+            if (geometry::IntersectionTest::AABBAABB(
+                        v0.cwiseMin(v1).cwiseMin(v2),
+                        v0.cwiseMax(v1).cwiseMax(v2), min_bound, max_bound)) {
+                ref_indices.push_back(int(tidx));
+            }
+        }
+        std::vector<int> indices;
+        bvh.SearchAABB(min_bound, max_bound, indices);
+        std::sort(indices.begin(), indices.end());
+        EXPECT_EQ(indices, ref_indices);
+    }
+}
+
+TEST(TriangleMeshBVH, CastRays) {
+    auto mesh = geometry::TriangleMesh::CreateTorus(1.0, 0.3, 30, 20);
+    geometry::TriangleMeshBVH bvh(*mesh);
+    auto triangle_bvhs = CreateTriangleBVHs(*mesh);
+
+    std::vector<Eigen::Vector3d> origins(200);
+    std::vector<Eigen::Vector3d> targets(200);
+    Rand(origins, Eigen::Vector3d::Constant(-3.0),
+         Eigen::Vector3d::Constant(3.0), 3);
+    Rand(targets, Eigen::Vector3d::Constant(-1.0),
+         Eigen::Vector3d::Constant(1.0), 4);
+    std::vector<Eigen::Vector3d> directions(origins.size());
+    for (size_t i = 0; i < origins.size(); ++i) {
+        directions[i] = targets[i] - origins[i];
+    }
+
+    auto hits = bvh.CastRays(origins, directions);
+    int num_hits = 0;
+    for (size_t i = 0; i < origins.size(); ++i) {
+        double ref_t = std::numeric_limits<double>::infinity();
+        for (const auto &triangle_bvh : triangle_bvhs) {
+            ref_t = std::min(
+                    ref_t, triangle_bvh->CastRay(origins[i], directions[i]).t_);
+        }
+        if (std::isinf(ref_t)) {
+            EXPECT_EQ(hits[i].triangle_index_, -1);
+            EXPECT_TRUE(std::isinf(hits[i].t_));
+            continue;
+        }
+        num_hits++;
+        EXPECT_NEAR(hits[i].t_, ref_t, 1e-12);
+        ASSERT_GE(hits[i].triangle_index_, 0);
+        const Eigen::Vector3i &t = mesh->triangles_[hits[i].triangle_index_];
+        const Eigen::Vector3d point =
+                (1 - hits[i].uv_.sum()) * mesh->vertices_[t(0)] +
+                hits[i].uv_(0) * mesh->vertices_[t(1)] +
+                hits[i].uv_(1) * mesh->vertices_[t(2)];
+        const Eigen::Vector3d ray_point =
+                origins[i] + hits[i].t_ * directions[i];
+        ExpectEQ(point, ray_point, 1e-9);
+
+        // Limiting the ray parameter discards hits beyond it.
+        EXPECT_EQ(bvh.CastRay(origins[i], directions[i], 0.99 * ref_t)
+                          .triangle_index_,
+                  -1);
+    }
+    EXPECT_GT(num_hits, 20);
+}
+
+TEST(TriangleMeshBVH, ComputeClosestPoints) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    geometry::TriangleMeshBVH bvh(*mesh);
+    auto triangle_bvhs = CreateTriangleBVHs(*mesh);
+
+    std::vector<Eigen::Vector3d> queries(100);
+    Rand(queries, Eigen::Vector3d::Constant(-2.0),
+         Eigen::Vector3d::Constant(2.0), 5);
+    auto closest_points = bvh.ComputeClosestPoints(queries);
+    auto distances = bvh.ComputeDistance(queries);
+    for (size_t i = 0; i < queries.size(); ++i) {
+        double ref_distance = std::numeric_limits<double>::infinity();
+        for (const auto &triangle_bvh : triangle_bvhs) {
+            ref_distance = std::min(
+                    ref_distance,
+                    triangle_bvh->ComputeClosestPoint(queries[i]).distance_);
+        }
+        EXPECT_NEAR(closest_points[i].distance_, ref_distance, 1e-12);
+        EXPECT_EQ(distances[i], closest_points[i].distance_);
+        EXPECT_NEAR((closest_points[i].point_ - queries[i]).norm(),
+                    ref_distance, 1e-12);
+        // The closest point lies on the reported triangle.
+        EXPECT_NEAR(triangle_bvhs[closest_points[i].triangle_index_]
+                            ->ComputeClosestPoint(queries[i])
+                            .distance_,
+                    ref_distance, 1e-12);
+    }
+}
+
+TEST(TriangleMeshBVH, GetSelfIntersectingTriangles) {
+    geometry::TriangleMesh mesh = CreateTriangleSoup(300, 6);
+    std::vector<Eigen::Vector2i> ref_intersecting;
+    for (size_t tidx0 = 0; tidx0 < mesh.triangles_.size(); ++tidx0) {
+        const Eigen::Vector3i &p = mesh.triangles_[tidx0];
+        for (size_t tidx1 = tidx0 + 1; tidx1 < mesh.triangles_.size();
+             ++tidx1) {
+            const Eigen::Vector3i &q = mesh.triangles_[tidx1];
+            if (geometry::IntersectionTest::TriangleTriangle3d(
+                        mesh.vertices_[p(0)], mesh.vertices_[p(1)],
+                        mesh.vertices_[p(2)], mesh.vertices_[q(0)],
+                        mesh.vertices_[q(1)], mesh.vertices_[q(2)])) {
+                ref_intersecting.emplace_back(int(tidx0), int(tidx1));
+            }
+        }
+    }
+    EXPECT_GT(ref_intersecting.size(), 0u);
+    ExpectEQ(mesh.GetSelfIntersectingTriangles(), ref_intersecting);
+}
+
+TEST(TriangleMeshBVH, IsIntersecting) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0);
+    auto small_sphere = geometry::TriangleMesh::CreateSphere(0.5);
+    EXPECT_FALSE(sphere->IsIntersecting(*small_sphere));
+    EXPECT_FALSE(small_sphere->IsIntersecting(*sphere));
+
+    small_sphere->Translate(Eigen::Vector3d(1.0, 0.0, 0.0));
+    EXPECT_TRUE(sphere->IsIntersecting(*small_sphere));
+    EXPECT_TRUE(small_sphere->IsIntersecting(*sphere));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -26,6 +26,7 @@
 
 #include "open3d/geometry/VoxelGrid.h"
 
+#include "open3d/geometry/IntersectionTest.h"
 #include "open3d/geometry/LineSet.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/visualization/utility/DrawGeometry.h"
@@ -62,6 +63,89 @@ TEST(VoxelGrid, GetVoxel) {
              Eigen::Vector3i(0, 1, 0));
 }
 
+TEST(VoxelGrid, CreateFromTriangleMesh) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    const double voxel_size = 0.2;
+    auto voxel_grid =
+            geometry::VoxelGrid::CreateFromTriangleMesh(*mesh, voxel_size);
+
+    // Compare with testing every voxel against every triangle.
+    const Eigen::Vector3d origin = voxel_grid->origin_;
+    const Eigen::Vector3d box_half_size = Eigen::Vector3d::Constant(0.1);
+    const Eigen::Vector3d grid_size =
+            mesh->GetMaxBound() - mesh->GetMinBound() +
+            Eigen::Vector3d::Constant(voxel_size);
+    size_t num_voxels = 0;
+    for (int x = 0; x < int(std::round(grid_size(0) / voxel_size)); ++x) {
+        for (int y = 0; y < int(std::round(grid_size(1) / voxel_size)); ++y) {
+            for (int z = 0; z < int(std::round(grid_size(2) / voxel_size));
+                 ++z) {
+                const Eigen::Vector3i grid_index(x, y, z);
+                const Eigen::Vector3d box_center =
+                        origin + box_half_size +
+                        grid_index.cast<double>() * voxel_size;
+                bool intersects = false;
+                for (const Eigen::Vector3i &tria : mesh->triangles_) {
+                    intersects = intersects ||
+                                 geometry::IntersectionTest::TriangleAABB(
+                                         box_center, box_half_size,
+                                         mesh->vertices_[tria(0)],
+                                         mesh->vertices_[tria(1)],
+                                         mesh->vertices_[tria(2)]);
+                }
+                EXPECT_EQ(voxel_grid->voxels_.count(grid_index) > 0,
+                          intersects);
+                num_voxels += intersects;
+            }
+        }
+    }
+    EXPECT_EQ(voxel_grid->voxels_.size(), num_voxels);
+}
+
+TEST(VoxelGrid, CreateFromTriangleMeshSolid) {
+    // The faces of the box lie on voxel boundaries and the rays through the
+    // voxel centers hit the diagonals shared by the triangles of a face.
+    auto box = geometry::TriangleMesh::CreateBox(2.0, 2.0, 2.0);
+    auto voxel_grid = geometry::VoxelGrid::CreateFromTriangleMeshWithinBounds(
+            *box, 0.25, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(3, 3, 3),
+            true);
+    for (int x = 0; x < 16; ++x) {
+        for (int y = 0; y < 16; ++y) {
+            for (int z = 0; z < 16; ++z) {
+                // Voxels touching the faces from outside intersect them.
+                const Eigen::Vector3i grid_index(x, y, z);
+                const bool inside = x >= 3 && x < 13 && y >= 3 && y < 13 &&
+                                    z >= 3 && z < 13;
+                EXPECT_EQ(voxel_grid->voxels_.count(grid_index) > 0, inside);
+            }
+        }
+    }
+
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 40);
+    const double voxel_size = 0.1;
+    auto surface =
+            geometry::VoxelGrid::CreateFromTriangleMesh(*sphere, voxel_size);
+    auto solid = geometry::VoxelGrid::CreateFromTriangleMesh(*sphere,
+                                                            voxel_size, true);
+    for (const auto &it : surface->voxels_) {
+        EXPECT_GT(solid->voxels_.count(it.first), 0u);
+    }
+    for (int x = -12; x <= 12; ++x) {
+        for (int y = -12; y <= 12; ++y) {
+            for (int z = -12; z <= 12; ++z) {
+                const Eigen::Vector3d center =
+                        Eigen::Vector3d(x, y, z) * voxel_size;
+                const Eigen::Vector3i grid_index = solid->GetVoxel(center);
+                if (center.norm() < 1.0 - 2 * voxel_size) {
+                    EXPECT_GT(solid->voxels_.count(grid_index), 0u);
+                } else if (center.norm() > 1.0 + 2 * voxel_size) {
+                    EXPECT_EQ(solid->voxels_.count(grid_index), 0u);
+                }
+            }
+        }
+    }
+}
+
 TEST(VoxelGrid, Visualization) {
     auto voxel_grid = std::make_shared<geometry::VoxelGrid>();
     voxel_grid->origin_ = Eigen::Vector3d(0, 0, 0);
@@ -0,0 +1,117 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/PointCloudTileIO.h"
+
+#include "open3d/geometry/PointCloud.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(PointCloudTileIO, WriteAndReadTiles) {
+    geometry::PointCloud pointcloud;
+    pointcloud.points_.resize(20000);
+    pointcloud.colors_.resize(20000);
+    Rand(pointcloud.points_, Eigen::Vector3d(-5.0, -5.0, 0.0),
+         Eigen::Vector3d(5.0, 5.0, 1.0), 0);
+    Rand(pointcloud.colors_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 1);
+
+    io::PointCloudTilingOption option;
+    option.max_points_per_tile = 1000;
+    option.grid_size = 16;
+    int num_progress_calls = 0;
+    option.update_progress = [&num_progress_calls](double) {
+        ++num_progress_calls;
+        return true;
+    };
+    ASSERT_TRUE(io::WritePointCloudTiles("test_tiles", pointcloud, option));
+    EXPECT_GT(num_progress_calls, 1);
+
+    io::PointCloudTileHierarchy hierarchy;
+    ASSERT_TRUE(io::ReadPointCloudTileHierarchy("test_tiles", hierarchy));
+    EXPECT_EQ(hierarchy.num_points_, 20000);
+    EXPECT_FALSE(hierarchy.has_normals_);
+    EXPECT_TRUE(hierarchy.has_colors_);
+    ASSERT_GT(hierarchy.tiles_.size(), 1u);
+    EXPECT_EQ(hierarchy.tiles_[0].name, "r");
+    EXPECT_EQ(hierarchy.tiles_[0].parent, -1);
+
+    // Every point is stored in exactly one tile, inside the tile's cube.
+    int64_t num_points = 0;
+    for (const io::PointCloudTileHierarchy::Tile &tile : hierarchy.tiles_) {
+        SCOPED_TRACE(tile.name);
+        if (tile.parent >= 0) {
+            const io::PointCloudTileHierarchy::Tile &parent =
+                    hierarchy.tiles_[tile.parent];
+            EXPECT_EQ(tile.level, parent.level + 1);
+            EXPECT_DOUBLE_EQ(tile.spacing, parent.spacing / 2);
+            EXPECT_EQ(tile.name.substr(0, tile.name.size() - 1), parent.name);
+        }
+        // Tiles that were split keep one point per subsampling cell.
+        if (!tile.children.empty()) {
+            EXPECT_LE(tile.num_points, 16 * 16 * 16);
+        }
+        auto tile_pointcloud =
+                io::ReadPointCloudTile("test_tiles", hierarchy, tile);
+        ASSERT_NE(tile_pointcloud, nullptr);
+        ASSERT_EQ(int64_t(tile_pointcloud->points_.size()), tile.num_points);
+        EXPECT_TRUE(tile_pointcloud->HasColors());
+        const double tolerance = 1e-5;
+        for (const Eigen::Vector3d &point : tile_pointcloud->points_) {
+            ASSERT_TRUE((point.array() >=
+                         tile.bounds.min_bound_.array() - tolerance)
+                                .all());
+            ASSERT_TRUE((point.array() <=
+                         tile.bounds.max_bound_.array() + tolerance)
+                                .all());
+        }
+        num_points += tile.num_points;
+    }
+    EXPECT_EQ(num_points, 20000);
+}
+
+TEST(PointCloudTileIO, SingleTile) {
+    geometry::PointCloud pointcloud;
+    pointcloud.points_ = {{0.0, 0.0, 0.0}, {1.0, 2.0, 3.0}};
+    ASSERT_TRUE(io::WritePointCloudTiles("test_tiles_single", pointcloud));
+    io::PointCloudTileHierarchy hierarchy;
+    ASSERT_TRUE(
+            io::ReadPointCloudTileHierarchy("test_tiles_single", hierarchy));
+    ASSERT_EQ(hierarchy.tiles_.size(), 1u);
+    EXPECT_EQ(hierarchy.tiles_[0].num_points, 2);
+    ExpectEQ(hierarchy.tiles_[0].bounds.max_bound_,
+             Eigen::Vector3d(3.0, 3.0, 3.0));
+
+    EXPECT_FALSE(io::WritePointCloudTiles("test_tiles_empty",
+                                          geometry::PointCloud()));
+    EXPECT_FALSE(io::ReadPointCloudTileHierarchy("test_tiles_missing",
+                                                 hierarchy));
+}
+
+}  // namespace tests
+}  // namespace open3d
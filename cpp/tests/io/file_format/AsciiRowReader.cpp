@@ -0,0 +1,151 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/file_format/AsciiRowReader.h"
+
+#include <cstdlib>
+#include <string>
+
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(AsciiRowReader, ParseDouble) {
+    const std::vector<std::string> numbers = {
+            "0",
+            "-0",
+            "1",
+            "-17",
+            "+3.25",
+            "0.1",
+            ".5",
+            "5.",
+            "123.4567890123",
+            "-0.0000001234",
+            "1e10",
+            "1E-5",
+            "2.5e+3",
+            "6.02214076e23",
+            "1.7976931348623157e308",
+            "4.9e-324",
+            "1e400",
+            "0e500",
+            "123456789012345678901234567890",
+            "0.30000000000000004",
+            "9007199254740993",
+            "0x1p3",
+            "inf",
+            "-nan",
+    };
+    for (const std::string &number : numbers) {
+        SCOPED_TRACE(number);
+        double value;
+        const char *end =
+                io::ParseDouble(number.data(), number.data() + number.size(),
+                                value);
+        ASSERT_EQ(end, number.data() + number.size());
+        const double expected = std::strtod(number.c_str(), nullptr);
+        if (std::isnan(expected)) {
+            EXPECT_TRUE(std::isnan(value));
+        } else {
+            EXPECT_EQ(value, expected);
+            EXPECT_EQ(std::signbit(value), std::signbit(expected));
+        }
+    }
+
+    // Random numbers printed like the writers do.
+    std::vector<double> values(1000);
+    Rand(values, -1e4, 1e4, 0);
+    for (double expected : values) {
+        const std::string number = fmt::format("{:.10f}", expected);
+        double value;
+        io::ParseDouble(number.data(), number.data() + number.size(), value);
+        EXPECT_EQ(value, std::strtod(number.c_str(), nullptr));
+    }
+
+    // Parsing stops at the end of the number.
+    const std::string text = "1.5e3,x";
+    double value;
+    EXPECT_EQ(io::ParseDouble(text.data(), text.data() + text.size(), value),
+              text.data() + 5);
+    EXPECT_EQ(value, 1500);
+    EXPECT_EQ(io::ParseDouble(text.data() + 5, text.data() + text.size(),
+                              value),
+              nullptr);
+}
+
+TEST(AsciiRowReader, ParseAsciiRows) {
+    const std::string text =
+            "1 2 3\n"
+            "\t4.5  -5e1\t6 extra\r\n"
+            "\n"
+            "7 8\n"
+            "comment\n"
+            "9-10 11\n"
+            "12 13 14";
+    std::vector<double> values;
+    EXPECT_EQ(io::ParseAsciiRows(text.data(), text.data() + text.size(), 3,
+                                 true, values),
+              4);
+    ExpectEQ(values, std::vector<double>({1, 2, 3, 4.5, -50, 6, 9, -10, 11,
+                                          12, 13, 14}));
+
+    values.clear();
+    EXPECT_EQ(io::ParseAsciiRows(text.data(), text.data() + text.size(), 3,
+                                 false, values),
+              7);
+    ExpectEQ(values, std::vector<double>({1, 2, 3, 4.5, -50, 6, 0, 0, 0, 0, 0,
+                                          0, 0, 0, 0, 9, -10, 11, 12, 13, 14}));
+}
+
+TEST(AsciiRowReader, ParseAsciiRowsParallel) {
+    // Enough lines for several chunks.
+    std::vector<double> expected(3 * 500000);
+    Rand(expected, -100.0, 100.0, 0);
+    std::string text;
+    for (size_t i = 0; i < expected.size(); i += 3) {
+        text += fmt::format("{:.6f} {:.6f} {:.6f}\n", expected[i],
+                            expected[i + 1], expected[i + 2]);
+    }
+    std::vector<double> values;
+    EXPECT_EQ(io::ParseAsciiRows(text.data(), text.data() + text.size(), 3,
+                                 true, values),
+              int64_t(expected.size() / 3));
+
+    std::vector<double> parallel_values = {42};
+    EXPECT_EQ(io::ParseAsciiRowsParallel(text.data(),
+                                         text.data() + text.size(), 3, true,
+                                         parallel_values),
+              int64_t(expected.size() / 3));
+    ASSERT_EQ(parallel_values.size(), values.size() + 1);
+    EXPECT_EQ(parallel_values[0], 42);
+    EXPECT_TRUE(std::equal(values.begin(), values.end(),
+                           parallel_values.begin() + 1));
+}
+
+}  // namespace tests
+}  // namespace open3d
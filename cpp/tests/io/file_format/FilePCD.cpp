@@ -24,6 +24,11 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdio>
+#include <cstring>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/io/PointCloudIO.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -59,5 +64,94 @@ TEST(FilePCD, DISABLED_ReadPointCloudFromPCD) { NotImplemented(); }
 
 TEST(FilePCD, DISABLED_WritePointCloudToPCD) { NotImplemented(); }
 
+TEST(FilePCD, WriteAndReadLargeBinary) {
+    // More than one compression chunk.
+    geometry::PointCloud pointcloud;
+    pointcloud.points_.resize(100000);
+    pointcloud.normals_.resize(100000);
+    pointcloud.colors_.resize(100000);
+    Rand(pointcloud.points_, Eigen::Vector3d(-10.0, -10.0, -10.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+    Rand(pointcloud.normals_, Eigen::Vector3d(-1.0, -1.0, -1.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 1);
+    for (size_t i = 0; i < pointcloud.colors_.size(); ++i) {
+        pointcloud.colors_[i] = Eigen::Vector3d(i % 256, (i / 256) % 256,
+                                                (i * 7) % 256) /
+                                255.0;
+    }
+
+    for (bool compressed : {false, true}) {
+        SCOPED_TRACE(compressed);
+        EXPECT_TRUE(io::WritePointCloud("test_large.pcd", pointcloud,
+                                        {false, compressed, false}));
+        geometry::PointCloud read_pointcloud;
+        EXPECT_TRUE(io::ReadPointCloud("test_large.pcd", read_pointcloud,
+                                       {"auto", false, false, false}));
+        ASSERT_EQ(read_pointcloud.points_.size(), pointcloud.points_.size());
+        ASSERT_EQ(read_pointcloud.normals_.size(), pointcloud.points_.size());
+        ASSERT_EQ(read_pointcloud.colors_.size(), pointcloud.points_.size());
+        for (size_t i = 0; i < pointcloud.points_.size(); ++i) {
+            ASSERT_TRUE(read_pointcloud.points_[i].isApprox(
+                    pointcloud.points_[i].cast<float>().cast<double>(), 0));
+            ASSERT_TRUE(read_pointcloud.normals_[i].isApprox(
+                    pointcloud.normals_[i].cast<float>().cast<double>(), 0));
+            ASSERT_LT((read_pointcloud.colors_[i] - pointcloud.colors_[i])
+                              .cwiseAbs()
+                              .maxCoeff(),
+                      1e-9);
+        }
+    }
+}
+
+TEST(FilePCD, ReadBinaryFieldTypes) {
+    // x, y and z as doubles, normals as 16 bit integers and packed colors.
+    const char *header =
+            "# .PCD v0.7 - Point Cloud Data file format\n"
+            "VERSION 0.7\n"
+            "FIELDS x y z normal_x normal_y normal_z rgb\n"
+            "SIZE 8 8 8 2 2 2 4\n"
+            "TYPE F F F I I I U\n"
+            "COUNT 1 1 1 1 1 1 1\n"
+            "WIDTH 2\n"
+            "HEIGHT 1\n"
+            "VIEWPOINT 0 0 0 1 0 0 0\n"
+            "POINTS 2\n"
+            "DATA binary\n";
+    FILE *file = fopen("test_types.pcd", "wb");
+    ASSERT_NE(file, nullptr);
+    fputs(header, file);
+    for (int i = 0; i < 2; ++i) {
+        const double point[3] = {0.1 + i, -2.5 * i, 1e10};
+        const int16_t normal[3] = {int16_t(-i), 1, int16_t(300 * i)};
+        const uint8_t bgra[4] = {uint8_t(10 * i), 20, 255, 0};
+        fwrite(point, sizeof(point), 1, file);
+        fwrite(normal, sizeof(normal), 1, file);
+        fwrite(bgra, sizeof(bgra), 1, file);
+    }
+    fclose(file);
+
+    geometry::PointCloud pointcloud;
+    EXPECT_TRUE(io::ReadPointCloud("test_types.pcd", pointcloud,
+                                   {"auto", false, false, false}));
+    ASSERT_EQ(pointcloud.points_.size(), 2u);
+    ExpectEQ(pointcloud.points_,
+             std::vector<Eigen::Vector3d>({{0.1, 0.0, 1e10},
+                                           {1.1, -2.5, 1e10}}));
+    ExpectEQ(pointcloud.normals_,
+             std::vector<Eigen::Vector3d>({{0, 1, 0}, {-1, 1, 300}}));
+    ExpectEQ(pointcloud.colors_,
+             std::vector<Eigen::Vector3d>({{1.0, 20 / 255.0, 0.0},
+                                           {1.0, 20 / 255.0, 10 / 255.0}}));
+
+    // Truncated data is rejected.
+    file = fopen("test_types.pcd", "wb");
+    ASSERT_NE(file, nullptr);
+    fputs(header, file);
+    fputs("too short", file);
+    fclose(file);
+    EXPECT_FALSE(io::ReadPointCloud("test_types.pcd", pointcloud,
+                                    {"auto", false, false, false}));
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -24,11 +24,89 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/io/TriangleMeshIO.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
 namespace tests {
 
+namespace {
+
+template <typename T>
+void AppendBigEndian(std::string &bytes, T value) {
+    char buffer[sizeof(T)];
+    std::memcpy(buffer, &value, sizeof(T));
+    const uint16_t one = 1;
+    if (*reinterpret_cast<const char *>(&one) == 1) {
+        std::reverse(buffer, buffer + sizeof(T));
+    }
+    bytes.append(buffer, sizeof(T));
+}
+
+// A unit square with a triangle and a quad, preceded by an element with a
+// list property that has to be skipped.
+void WriteSquarePLY(const std::string &filename, bool ascii) {
+    const float vertices[4][3] = {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}};
+    const uint8_t colors[4][3] = {
+            {255, 0, 0}, {0, 255, 0}, {0, 0, 255}, {51, 102, 153}};
+    const int faces[2][4] = {{0, 1, 2, -1}, {0, 1, 2, 3}};
+    std::string data;
+    data += "ply\n";
+    data += ascii ? "format ascii 1.0\n" : "format binary_big_endian 1.0\n";
+    data += "comment written by a test\n";
+    data += "element material 2\n";
+    data += "property list uchar short ids\n";
+    data += "element vertex 4\n";
+    data += "property float x\nproperty float y\nproperty float z\n";
+    data += "property short extra\n";
+    data += "property uchar red\nproperty uchar green\nproperty uchar blue\n";
+    data += "element face 2\n";
+    data += "property list uchar int vertex_indices\n";
+    data += "end_header\n";
+    if (ascii) {
+        data += "1 7\n2 8 9\n";
+        for (int i = 0; i < 4; ++i) {
+            data += fmt::format("{} {} {} {} {} {} {}\n", vertices[i][0],
+                                vertices[i][1], vertices[i][2], -i,
+                                colors[i][0], colors[i][1], colors[i][2]);
+        }
+        data += "3 0 1 2\n4 0 1 2 3\n";
+    } else {
+        AppendBigEndian<uint8_t>(data, 1);
+        AppendBigEndian<int16_t>(data, 7);
+        AppendBigEndian<uint8_t>(data, 2);
+        AppendBigEndian<int16_t>(data, 8);
+        AppendBigEndian<int16_t>(data, 9);
+        for (int i = 0; i < 4; ++i) {
+            for (int k = 0; k < 3; ++k) {
+                AppendBigEndian<float>(data, vertices[i][k]);
+            }
+            AppendBigEndian<int16_t>(data, int16_t(-i));
+            for (int k = 0; k < 3; ++k) {
+                AppendBigEndian<uint8_t>(data, colors[i][k]);
+            }
+        }
+        for (int f = 0; f < 2; ++f) {
+            const int length = faces[f][3] < 0 ? 3 : 4;
+            AppendBigEndian<uint8_t>(data, uint8_t(length));
+            for (int k = 0; k < length; ++k) {
+                AppendBigEndian<int32_t>(data, faces[f][k]);
+            }
+        }
+    }
+    std::ofstream file(filename, std::ios::binary);
+    file.write(data.data(), data.size());
+}
+
+}  // namespace
+
 TEST(FilePLY, DISABLED_ReadVertexCallback) { NotImplemented(); }
 
 TEST(FilePLY, DISABLED_AdvanceConsoleProgress) { NotImplemented(); }
@@ -49,5 +127,72 @@ TEST(FilePLY, DISABLED_WriteTriangleMeshToPLY) { NotImplemented(); }
 
 TEST(FilePLY, DISABLED_ResetConsoleProgress) { NotImplemented(); }
 
+TEST(FilePLY, ReadPointCloudFromBinaryPLY) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(1000);
+    pcd.normals_.resize(1000);
+    Rand(pcd.points_, Eigen::Vector3d(-10, -10, -10),
+         Eigen::Vector3d(10, 10, 10), 0);
+    Rand(pcd.normals_, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(1, 1, 1),
+         1);
+    for (size_t i = 0; i < pcd.points_.size(); ++i) {
+        pcd.colors_.push_back(Eigen::Vector3d(i % 256, (i * 7) % 256,
+                                              (i * 13) % 256) /
+                              255.0);
+    }
+    const std::string filename = "test_binary.ply";
+    ASSERT_TRUE(io::WritePointCloudToPLY(filename, pcd, {false, false}));
+
+    geometry::PointCloud pcd_read;
+    ASSERT_TRUE(io::ReadPointCloudFromPLY(filename, pcd_read, {}));
+    ExpectEQ(pcd_read.points_, pcd.points_);
+    ExpectEQ(pcd_read.normals_, pcd.normals_);
+    ExpectEQ(pcd_read.colors_, pcd.colors_);
+}
+
+TEST(FilePLY, ReadBigEndianPLY) {
+    // The ASCII file is read by rply, the binary one column by column.
+    WriteSquarePLY("test_square_ascii.ply", true);
+    WriteSquarePLY("test_square_binary.ply", false);
+
+    geometry::PointCloud pcd_ascii, pcd_binary;
+    ASSERT_TRUE(io::ReadPointCloudFromPLY("test_square_ascii.ply", pcd_ascii,
+                                          {}));
+    ASSERT_TRUE(io::ReadPointCloudFromPLY("test_square_binary.ply",
+                                          pcd_binary, {}));
+    EXPECT_EQ(pcd_binary.points_.size(), 4u);
+    ExpectEQ(pcd_binary.points_, pcd_ascii.points_);
+    ExpectEQ(pcd_binary.colors_, pcd_ascii.colors_);
+    EXPECT_FALSE(pcd_binary.HasNormals());
+
+    geometry::TriangleMesh mesh_ascii, mesh_binary;
+    ASSERT_TRUE(io::ReadTriangleMeshFromPLY("test_square_ascii.ply",
+                                            mesh_ascii, false, false));
+    ASSERT_TRUE(io::ReadTriangleMeshFromPLY("test_square_binary.ply",
+                                            mesh_binary, false, false));
+    EXPECT_EQ(mesh_binary.triangles_.size(), 3u);
+    ExpectEQ(mesh_binary.vertices_, mesh_ascii.vertices_);
+    ExpectEQ(mesh_binary.vertex_colors_, mesh_ascii.vertex_colors_);
+    ExpectEQ(mesh_binary.triangles_, mesh_ascii.triangles_);
+}
+
+TEST(FilePLY, ReadTruncatedBinaryPLY) {
+    geometry::PointCloud pcd;
+    pcd.points_ = {{0, 0, 0}, {1, 2, 3}};
+    const std::string filename = "test_truncated.ply";
+    ASSERT_TRUE(io::WritePointCloudToPLY(filename, pcd, {false, false}));
+    std::string data;
+    {
+        std::ifstream file(filename, std::ios::binary);
+        data.assign(std::istreambuf_iterator<char>(file), {});
+    }
+    {
+        std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+        file.write(data.data(), data.size() - 8);
+    }
+    geometry::PointCloud pcd_read;
+    EXPECT_FALSE(io::ReadPointCloudFromPLY(filename, pcd_read, {}));
+}
+
 }  // namespace tests
 }  // namespace open3d
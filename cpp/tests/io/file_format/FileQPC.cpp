@@ -0,0 +1,223 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+#include <numeric>
+#include <set>
+#include <tuple>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/io/file_format/FileQPC.h"
+#include "open3d/utility/FileSystem.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+// Reading returns the points in Morton order, so compare sorted copies.
+geometry::PointCloud SortedByPosition(const geometry::PointCloud &pointcloud) {
+    std::vector<size_t> order(pointcloud.points_.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        const Eigen::Vector3d &pa = pointcloud.points_[a];
+        const Eigen::Vector3d &pb = pointcloud.points_[b];
+        return std::tie(pa(0), pa(1), pa(2)) < std::tie(pb(0), pb(1), pb(2));
+    });
+    geometry::PointCloud sorted;
+    for (size_t i : order) {
+        sorted.points_.push_back(pointcloud.points_[i]);
+        if (pointcloud.HasNormals()) {
+            sorted.normals_.push_back(pointcloud.normals_[i]);
+        }
+        if (pointcloud.HasColors()) {
+            sorted.colors_.push_back(pointcloud.colors_[i]);
+        }
+    }
+    return sorted;
+}
+
+}  // namespace
+
+TEST(FileQPC, WriteAndReadOnGrid) {
+    // Distinct points on the quantization grid are stored exactly. More than
+    // one chunk.
+    const int64_t num_points = 50000;
+    std::vector<Eigen::Vector3i> cells(num_points);
+    Rand(cells, Eigen::Vector3i(-1000, -1000, -1000),
+         Eigen::Vector3i(1000, 1000, 1000), 0);
+    std::set<std::tuple<int, int, int>> unique_cells;
+    geometry::PointCloud pointcloud;
+    for (const Eigen::Vector3i &cell : cells) {
+        if (unique_cells.insert({cell(0), cell(1), cell(2)}).second) {
+            pointcloud.points_.push_back(cell.cast<double>() * 0.5);
+        }
+    }
+    pointcloud.normals_.resize(pointcloud.points_.size());
+    pointcloud.colors_.resize(pointcloud.points_.size());
+    Rand(pointcloud.normals_, Eigen::Vector3d(-1.0, -1.0, -1.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 1);
+    Rand(pointcloud.colors_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 2);
+    pointcloud.NormalizeNormals();
+
+    io::WritePointCloudOption write_option;
+    write_option.quantization_precision = 0.5;
+    ASSERT_TRUE(io::WritePointCloud("test.qpc", pointcloud, write_option));
+    geometry::PointCloud read_pointcloud;
+    ASSERT_TRUE(io::ReadPointCloud("test.qpc", read_pointcloud,
+                                   {"auto", false, false, false}));
+    ASSERT_EQ(read_pointcloud.points_.size(), pointcloud.points_.size());
+    ASSERT_EQ(read_pointcloud.normals_.size(), pointcloud.points_.size());
+    ASSERT_EQ(read_pointcloud.colors_.size(), pointcloud.points_.size());
+
+    const geometry::PointCloud expected = SortedByPosition(pointcloud);
+    const geometry::PointCloud actual = SortedByPosition(read_pointcloud);
+    ExpectEQ(actual.points_, expected.points_);
+    for (size_t i = 0; i < expected.points_.size(); ++i) {
+        ASSERT_LE((actual.normals_[i] - expected.normals_[i])
+                          .cwiseAbs()
+                          .maxCoeff(),
+                  0.5 / 32767.0 + 1e-12);
+        ASSERT_LE((actual.colors_[i] - expected.colors_[i])
+                          .cwiseAbs()
+                          .maxCoeff(),
+                  0.5 / 255.0 + 1e-12);
+    }
+}
+
+TEST(FileQPC, DefaultPrecision) {
+    geometry::PointCloud pointcloud;
+    pointcloud.points_.resize(100000);
+    Rand(pointcloud.points_, Eigen::Vector3d(-10.0, -10.0, -10.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+    ASSERT_TRUE(io::WritePointCloud("test.qpc", pointcloud));
+
+    // Positions only, quantized to 21 bits per axis and entropy coded, are
+    // far smaller than 24 bytes per point.
+    std::vector<char> bytes;
+    ASSERT_TRUE(utility::filesystem::FReadToBuffer("test.qpc", bytes, nullptr));
+    EXPECT_LT(bytes.size(), pointcloud.points_.size() * 12);
+
+    geometry::PointCloud read_pointcloud;
+    ASSERT_TRUE(io::ReadPointCloud("test.qpc", read_pointcloud));
+    ASSERT_EQ(read_pointcloud.points_.size(), pointcloud.points_.size());
+    EXPECT_FALSE(read_pointcloud.HasNormals());
+    EXPECT_FALSE(read_pointcloud.HasColors());
+
+    // Quantization preserves the order of the coordinates on each axis, so
+    // the sorted coordinates pair up.
+    const Eigen::Vector3d extent = pointcloud.GetMaxBound() -
+                                   pointcloud.GetMinBound();
+    const double tolerance = extent.maxCoeff() / io::kQPCDefaultNumCells;
+    for (int axis = 0; axis < 3; ++axis) {
+        std::vector<double> expected, actual;
+        for (size_t i = 0; i < pointcloud.points_.size(); ++i) {
+            expected.push_back(pointcloud.points_[i](axis));
+            actual.push_back(read_pointcloud.points_[i](axis));
+        }
+        std::sort(expected.begin(), expected.end());
+        std::sort(actual.begin(), actual.end());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            ASSERT_NEAR(actual[i], expected[i], tolerance);
+        }
+    }
+}
+
+TEST(FileQPC, UpdateProgressCallback) {
+    geometry::PointCloud pointcloud;
+    pointcloud.points_.resize(100000);
+    Rand(pointcloud.points_, Eigen::Vector3d(-1.0, -1.0, -1.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+
+    int num_calls = 0;
+    double last_percentage = 0.0;
+    auto update_progress = [&](double percentage) {
+        ++num_calls;
+        last_percentage = percentage;
+        return true;
+    };
+    io::WritePointCloudOption write_option;
+    write_option.update_progress = update_progress;
+    ASSERT_TRUE(io::WritePointCloud("test.qpc", pointcloud, write_option));
+    EXPECT_GT(num_calls, 1);
+    EXPECT_EQ(last_percentage, 100.0);
+
+    num_calls = 0;
+    last_percentage = 0.0;
+    io::ReadPointCloudOption read_option;
+    read_option.update_progress = update_progress;
+    geometry::PointCloud read_pointcloud;
+    ASSERT_TRUE(io::ReadPointCloud("test.qpc", read_pointcloud, read_option));
+    EXPECT_GT(num_calls, 1);
+    EXPECT_EQ(last_percentage, 100.0);
+}
+
+TEST(FileQPC, RejectInvalid) {
+    geometry::PointCloud pointcloud;
+    EXPECT_FALSE(io::WritePointCloud("test.qpc", pointcloud));
+
+    pointcloud.points_ = {{0.0, 0.0, 0.0},
+                          {std::numeric_limits<double>::quiet_NaN(), 0.0,
+                           0.0}};
+    EXPECT_FALSE(io::WritePointCloud("test.qpc", pointcloud));
+
+    // Truncated and corrupted files.
+    pointcloud.points_.resize(20000);
+    Rand(pointcloud.points_, Eigen::Vector3d(-1.0, -1.0, -1.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+    ASSERT_TRUE(io::WritePointCloud("test.qpc", pointcloud));
+    std::vector<char> bytes;
+    ASSERT_TRUE(utility::filesystem::FReadToBuffer("test.qpc", bytes, nullptr));
+
+    geometry::PointCloud read_pointcloud;
+    FILE *file = fopen("test_invalid.qpc", "wb");
+    ASSERT_NE(file, nullptr);
+    fwrite(bytes.data(), 1, bytes.size() / 2, file);
+    fclose(file);
+    EXPECT_FALSE(io::ReadPointCloud("test_invalid.qpc", read_pointcloud));
+
+    std::vector<char> corrupted = bytes;
+    std::fill(corrupted.end() - 64, corrupted.end(), char(0xff));
+    file = fopen("test_invalid.qpc", "wb");
+    ASSERT_NE(file, nullptr);
+    fwrite(corrupted.data(), 1, corrupted.size(), file);
+    fclose(file);
+    EXPECT_FALSE(io::ReadPointCloud("test_invalid.qpc", read_pointcloud));
+
+    file = fopen("test_invalid.qpc", "wb");
+    ASSERT_NE(file, nullptr);
+    fputs("not a qpc file", file);
+    fclose(file);
+    EXPECT_FALSE(io::ReadPointCloud("test_invalid.qpc", read_pointcloud));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -26,10 +26,13 @@
 
 #include "open3d/io/rpc/RemoteFunctions.h"
 
+#include <algorithm>
 #include <random>
 
+#include "open3d/core/Tensor.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/io/rpc/ArrayTransport.h"
 #include "open3d/io/rpc/BufferConnection.h"
 #include "open3d/io/rpc/Connection.h"
 #include "open3d/io/rpc/DummyReceiver.h"
@@ -237,5 +240,86 @@ TEST(RemoteFunctions, SendGarbage) {
     receiver.Stop();
 }
 
+namespace {
+/// Receiver which checks the received vertices against the expected values.
+class CheckVerticesReceiver : public DummyReceiver {
+public:
+    CheckVerticesReceiver(const std::string& address,
+                          int timeout,
+                          const std::vector<float>& expected)
+        : DummyReceiver(address, timeout), expected_(expected) {}
+
+    std::shared_ptr<zmq::message_t> ProcessMessage(
+            const messages::Request& req,
+            const messages::SetMeshData& msg,
+            const MsgpackObject& obj) override {
+        const messages::Array& vertices = msg.data.vertices;
+        if (vertices.data.size != expected_.size() * sizeof(float)) {
+            return nullptr;
+        }
+        if (!std::equal(expected_.begin(), expected_.end(),
+                        vertices.Ptr<float>())) {
+            return nullptr;
+        }
+        return CreateStatusOKMsg();
+    }
+
+private:
+    std::vector<float> expected_;
+};
+}  // namespace
+
+TEST(RemoteFunctions, ArrayTransports) {
+    // Repetitive values such that compression kicks in.
+    const int64_t num_vertices = 4096;
+    std::vector<float> values(num_vertices * 3);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = float(i % 7);
+    }
+    core::Tensor vertices(values, {num_vertices, 3}, core::Dtype::Float32);
+
+    std::vector<std::pair<ArrayTransport, bool>> configs = {
+            {ArrayTransport::Inline, false},
+            {ArrayTransport::Inline, true},
+            {ArrayTransport::Frames, false},
+            {ArrayTransport::Frames, true},
+            {ArrayTransport::SharedMemory, false},
+            {ArrayTransport::SharedMemory, true}};
+    for (const auto& config : configs) {
+        CheckVerticesReceiver receiver(connection_address, 500, values);
+        receiver.Start();
+
+        auto connection =
+                std::make_shared<Connection>(connection_address, 500, 500);
+        connection->SetArrayTransport(config.first, config.second);
+        EXPECT_TRUE(SetMeshData(vertices, "", 0, "", {},
+                                core::Tensor({0}, core::Dtype::Int32), {},
+                                core::Tensor({0}, core::Dtype::Int32), {}, {},
+                                connection));
+        receiver.Stop();
+    }
+}
+
+TEST(RemoteFunctions, UnpackInvalidArrays) {
+    std::vector<std::shared_ptr<zmq::message_t>> frames;
+    ArrayUnpacker unpacker(frames);
+    const char payload[16] = {};
+
+    // Overflowing, negative and implausibly large shapes of compressed data
+    // are rejected before the data is allocated.
+    std::vector<std::vector<int64_t>> shapes = {
+            {int64_t(1) << 40, int64_t(1) << 30}, {-4, 1}, {1 << 20, 3}};
+    for (const auto& shape : shapes) {
+        messages::Array arr;
+        arr.type = messages::TypeStr<float>();
+        arr.shape = shape;
+        arr.data = msgpack::type::raw_ref(payload, sizeof(payload));
+        arr.compression = "lzf";
+        std::string errstr;
+        EXPECT_FALSE(unpacker.Unpack(arr, errstr));
+        EXPECT_FALSE(errstr.empty());
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -24,10 +24,16 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/color_map/ColorMapOptimization.h"
+
 #include "open3d/camera/PinholeCameraTrajectory.h"
 #include "open3d/geometry/Image.h"
+#include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/io/ImageIO.h"
+#include "open3d/io/PinholeCameraTrajectoryIO.h"
+#include "open3d/pipelines/color_map/TriangleMeshAndImageUtilities.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -1131,5 +1137,70 @@ TEST(ColorMapOptimization, DISABLED_ColorMapOptimization) {
         ExpectEQ(ref_triangle_normals[i], mesh->triangle_normals_[i]);
 }
 
+TEST(ColorMapOptimization, CreateVertexToImageVisibility) {
+    std::vector<std::vector<int>> visibility_image_to_vertex = {
+            {0, 2, 3}, {}, {1, 2}, {0, 3, 4}};
+    std::vector<std::vector<int>> visibility_vertex_to_image =
+            pipelines::color_map::CreateVertexToImageVisibility(
+                    visibility_image_to_vertex, 6);
+    std::vector<std::vector<int>> ref = {{0, 3}, {2}, {0, 2}, {0, 3}, {3}, {}};
+    EXPECT_EQ(visibility_vertex_to_image, ref);
+}
+
+TEST(ColorMapOptimization, StreamingMatchesInMemory) {
+    const int n_camera = 5;
+    camera::PinholeCameraTrajectory camera;
+    ASSERT_TRUE(io::ReadPinholeCameraTrajectory(
+            std::string(TEST_DATA_DIR) + "/RGBD/trajectory.log", camera));
+    camera.parameters_.resize(n_camera);
+
+    std::vector<std::string> color_filenames, depth_filenames;
+    std::vector<std::shared_ptr<geometry::RGBDImage>> images_rgbd;
+    for (int i = 0; i < n_camera; i++) {
+        color_filenames.push_back(fmt::format(
+                "{}/RGBD/color/{:05d}.jpg", std::string(TEST_DATA_DIR), i));
+        depth_filenames.push_back(fmt::format(
+                "{}/RGBD/depth/{:05d}.png", std::string(TEST_DATA_DIR), i));
+        geometry::Image color, depth;
+        ASSERT_TRUE(io::ReadImage(color_filenames.back(), color));
+        ASSERT_TRUE(io::ReadImage(depth_filenames.back(), depth));
+        images_rgbd.push_back(geometry::RGBDImage::CreateFromColorAndDepth(
+                color, depth, 1000.0, 3.0, false));
+    }
+
+    // Use the points seen by the first camera as mesh vertices.
+    std::shared_ptr<geometry::PointCloud> pcd =
+            geometry::PointCloud::CreateFromRGBDImage(
+                    *images_rgbd[0], camera.parameters_[0].intrinsic_,
+                    camera.parameters_[0].extrinsic_)
+                    ->UniformDownSample(50);
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = pcd->points_;
+
+    for (bool non_rigid : {false, true}) {
+        pipelines::color_map::ColorMapOptimizationOption option;
+        option.non_rigid_camera_coordinate_ = non_rigid;
+        option.maximum_iteration_ = 3;
+
+        geometry::TriangleMesh mesh_in_memory = mesh;
+        camera::PinholeCameraTrajectory camera_in_memory = camera;
+        pipelines::color_map::ColorMapOptimization(
+                mesh_in_memory, images_rgbd, camera_in_memory, option);
+
+        // A budget of one byte holds one camera at a time.
+        geometry::TriangleMesh mesh_streaming = mesh;
+        camera::PinholeCameraTrajectory camera_streaming = camera;
+        pipelines::color_map::ColorMapOptimization(
+                mesh_streaming, color_filenames, depth_filenames,
+                camera_streaming, option, 1);
+
+        for (int i = 0; i < n_camera; i++) {
+            ExpectEQ(camera_in_memory.parameters_[i].extrinsic_,
+                     camera_streaming.parameters_[i].extrinsic_);
+        }
+        ExpectEQ(mesh_in_memory.vertex_colors_, mesh_streaming.vertex_colors_);
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -24,6 +24,14 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/registration/FastGlobalRegistration.h"
+
+#include <Eigen/Geometry>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/pipelines/registration/Feature.h"
+#include "open3d/pipelines/registration/Registration.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -39,5 +47,33 @@ TEST(FastGlobalRegistration, DISABLED_Constructor) { NotImplemented(); }
 
 TEST(FastGlobalRegistration, DISABLED_MemberData) { NotImplemented(); }
 
+TEST(FastGlobalRegistration, FastGlobalRegistration) {
+    geometry::PointCloud pcd;
+    io::ReadPointCloud(std::string(TEST_DATA_DIR) + "/ColoredICP/frag_115.ply",
+                       pcd);
+    auto target = pcd.VoxelDownSample(0.05);
+    target->EstimateNormals(geometry::KDTreeSearchParamHybrid(0.1, 30));
+
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.5, Eigen::Vector3d(1, 2, 3).normalized())
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.3, -0.2, 0.1);
+    geometry::PointCloud source = *target;
+    source.Transform(transformation.inverse());
+
+    auto search_param = geometry::KDTreeSearchParamHybrid(0.25, 100);
+    auto source_feature =
+            pipelines::registration::ComputeFPFHFeature(source, search_param);
+    auto target_feature =
+            pipelines::registration::ComputeFPFHFeature(*target, search_param);
+    auto result = pipelines::registration::FastGlobalRegistration(
+            source, *target, *source_feature, *target_feature,
+            pipelines::registration::FastGlobalRegistrationOption());
+
+    EXPECT_GT(result.fitness_, 0.9);
+    ExpectEQ(Eigen::Matrix4d(result.transformation_), transformation, 1e-2);
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -24,6 +24,10 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/registration/Feature.h"
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/TriangleMesh.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -35,9 +39,114 @@ TEST(Feature, DISABLED_Dimension) { NotImplemented(); }
 
 TEST(Feature, DISABLED_Num) { NotImplemented(); }
 
-TEST(Feature, DISABLED_ComputeFPFHFeature) { NotImplemented(); }
+TEST(Feature, ComputeFPFHFeature) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    geometry::PointCloud pcd(mesh->vertices_);
+    pcd.normals_ = mesh->vertices_;
+
+    auto feature = pipelines::registration::ComputeFPFHFeature(
+            pcd, geometry::KDTreeSearchParamHybrid(0.5, 30));
+    ASSERT_EQ(feature->Dimension(), 33u);
+    ASSERT_EQ(feature->Num(), pcd.points_.size());
+
+    // Each of the three histograms of the SPFH and of the weighted neighbor
+    // SPFHs sums to 100.
+    for (size_t i = 0; i < feature->Num(); ++i) {
+        for (int j = 0; j < 3; ++j) {
+            EXPECT_NEAR(feature->data_.col(i).segment<11>(11 * j).sum(), 200.0,
+                        1e-3);
+        }
+    }
+
+    // The features are computed in single precision.
+    const Eigen::MatrixXf feature_float =
+            pipelines::registration::ComputeFPFHFeatureFloat(
+                    pcd, geometry::KDTreeSearchParamHybrid(0.5, 30));
+    ExpectEQ(Eigen::MatrixXd(feature_float.cast<double>()), feature->data_);
+}
 
 TEST(Feature, DISABLED_KDTreeSearchParamKNN) { NotImplemented(); }
 
+TEST(Feature, CorrespondencesFromFeatures) {
+    using pipelines::registration::CorrespondenceSet;
+    using pipelines::registration::FeatureMatchingMethod;
+    using pipelines::registration::FeatureMatchingOption;
+
+    // Every source feature is a perturbed copy of an even target feature.
+    pipelines::registration::Feature source, target;
+    target.Resize(33, 1000);
+    Rand(target.data_.data(), target.data_.size(), 0.0, 100.0, 0);
+    source.Resize(33, 500);
+    Rand(source.data_.data(), source.data_.size(), -50.0, 50.0, 1);
+    for (int i = 0; i < 500; ++i) {
+        source.data_.col(i) += target.data_.col(2 * i);
+    }
+
+    // Exhaustive search in both directions.
+    std::vector<int> source_to_target(500), target_to_source(1000);
+    for (int i = 0; i < 500; ++i) {
+        (target.data_.colwise() - source.data_.col(i))
+                .colwise()
+                .squaredNorm()
+                .minCoeff(&source_to_target[i]);
+    }
+    for (int j = 0; j < 1000; ++j) {
+        (source.data_.colwise() - target.data_.col(j))
+                .colwise()
+                .squaredNorm()
+                .minCoeff(&target_to_source[j]);
+    }
+    CorrespondenceSet ref, ref_mutual;
+    for (int i = 0; i < 500; ++i) {
+        const int j = source_to_target[i];
+        ref.emplace_back(i, j);
+        if (target_to_source[j] == i) {
+            ref_mutual.emplace_back(i, j);
+        }
+    }
+    ASSERT_GT(ref_mutual.size(), 0u);
+    ASSERT_LT(ref_mutual.size(), ref.size());
+
+    for (FeatureMatchingMethod method :
+         {FeatureMatchingMethod::KDTree, FeatureMatchingMethod::BruteForce}) {
+        const FeatureMatchingOption option(method);
+        ExpectEQ(pipelines::registration::CorrespondencesFromFeatures(
+                         source, target, false, option),
+                 ref);
+        ExpectEQ(pipelines::registration::CorrespondencesFromFeatures(
+                         source, target, true, option),
+                 ref_mutual);
+    }
+
+    // The approximate searches find most of the exact matches.
+    for (const FeatureMatchingOption &option :
+         {FeatureMatchingOption(FeatureMatchingMethod::KDTree, 0.5),
+          FeatureMatchingOption(FeatureMatchingMethod::KDForest, 0.0, 4,
+                                256)}) {
+        const CorrespondenceSet corres =
+                pipelines::registration::CorrespondencesFromFeatures(
+                        source, target, false, option);
+        ASSERT_EQ(corres.size(), ref.size());
+        int num_correct = 0;
+        for (size_t k = 0; k < corres.size(); ++k) {
+            EXPECT_EQ(corres[k](0), ref[k](0));
+            num_correct += corres[k] == ref[k];
+        }
+        EXPECT_GE(num_correct, 0.9 * ref.size());
+        num_correct = 0;
+        for (const Eigen::Vector2i &c :
+             pipelines::registration::CorrespondencesFromFeatures(
+                     source, target, true, option)) {
+            num_correct += c(1) == source_to_target[c(0)];
+        }
+        EXPECT_GE(num_correct, 0.9 * ref_mutual.size());
+    }
+
+    pipelines::registration::Feature other;
+    other.Resize(32, 10);
+    EXPECT_ANY_THROW(pipelines::registration::CorrespondencesFromFeatures(
+            source, other));
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -26,6 +26,9 @@
 
 #include "open3d/t/geometry/Image.h"
 
+#include <cmath>
+#include <numeric>
+
 #include "core/CoreTest.h"
 #include "open3d/core/TensorList.h"
 #include "tests/UnitTest.h"
@@ -152,5 +155,235 @@ TEST_P(ImagePermuteDevices, ToLegacyImage) {
                           *leg_im_3ch.PointerAt<uint16_t>(c, r, ch));
 }
 
+TEST_P(ImagePermuteDevices, To) {
+    core::Device device = GetParam();
+
+    core::Tensor t_u8(std::vector<uint8_t>{0, 128, 255}, {1, 3, 1},
+                      core::Dtype::UInt8, device);
+    t::geometry::Image im_f32 =
+            t::geometry::Image(t_u8).To(core::Dtype::Float32, 1.0 / 255.0);
+    EXPECT_EQ(im_f32.GetDtype(), core::Dtype::Float32);
+    EXPECT_TRUE(im_f32.AsTensor().AllClose(
+            core::Tensor(std::vector<float>{0, 128 / 255.0f, 1}, {1, 3, 1},
+                         core::Dtype::Float32, device)));
+
+    // Rounding and saturation.
+    core::Tensor t_f32(std::vector<float>{-1.0f, 0.4f, 0.6f, 300.0f},
+                       {2, 2, 1}, core::Dtype::Float32, device);
+    EXPECT_EQ(t::geometry::Image(t_f32)
+                      .To(core::Dtype::UInt8)
+                      .AsTensor()
+                      .ToFlatVector<uint8_t>(),
+              std::vector<uint8_t>({0, 0, 1, 255}));
+    EXPECT_EQ(t::geometry::Image(t_f32)
+                      .To(core::Dtype::UInt16, 10.0, 1.0)
+                      .AsTensor()
+                      .ToFlatVector<uint16_t>(),
+              std::vector<uint16_t>({0, 5, 7, 3001}));
+
+    EXPECT_ANY_THROW(t::geometry::Image(t_f32).To(core::Dtype::Int64));
+}
+
+TEST_P(ImagePermuteDevices, ClipTransform) {
+    core::Device device = GetParam();
+
+    core::Tensor t_depth(std::vector<uint16_t>{0, 500, 1000, 4000}, {2, 2},
+                         core::Dtype::UInt16, device);
+    t::geometry::Image depth =
+            t::geometry::Image(t_depth).ClipTransform(1000, 0, 3, -1);
+    EXPECT_EQ(depth.GetDtype(), core::Dtype::Float32);
+    EXPECT_EQ(depth.AsTensor().ToFlatVector<float>(),
+              std::vector<float>({-1.0f, 0.5f, 1.0f, -1.0f}));
+}
+
+TEST_P(ImagePermuteDevices, RGBToGray) {
+    core::Device device = GetParam();
+
+    core::Tensor t_rgb(std::vector<uint8_t>{255, 0, 0, 0, 255, 0, 0, 0, 255,
+                                            100, 100, 100},
+                       {2, 2, 3}, core::Dtype::UInt8, device);
+    t::geometry::Image gray = t::geometry::Image(t_rgb).RGBToGray();
+    EXPECT_EQ(gray.GetChannels(), 1);
+    EXPECT_EQ(gray.AsTensor().ToFlatVector<uint8_t>(),
+              std::vector<uint8_t>({76, 150, 29, 100}));
+
+    EXPECT_ANY_THROW(gray.RGBToGray());
+}
+
+TEST_P(ImagePermuteDevices, Resize) {
+    core::Device device = GetParam();
+
+    std::vector<float> vals(16);
+    std::iota(vals.begin(), vals.end(), 0.0f);
+    t::geometry::Image im(core::Tensor(vals, {4, 4, 1}, core::Dtype::Float32,
+                                       device));
+
+    t::geometry::Image im_nearest =
+            im.Resize(0.5, t::geometry::Image::InterpType::Nearest);
+    EXPECT_EQ(im_nearest.AsTensor().GetShape(), core::SizeVector({2, 2, 1}));
+    EXPECT_EQ(im_nearest.AsTensor().ToFlatVector<float>(),
+              std::vector<float>({5, 7, 13, 15}));
+
+    t::geometry::Image im_linear =
+            im.Resize(0.5, t::geometry::Image::InterpType::Linear);
+    EXPECT_EQ(im_linear.AsTensor().ToFlatVector<float>(),
+              std::vector<float>({2.5, 4.5, 10.5, 12.5}));
+
+    t::geometry::Image im_up =
+            im.Resize(2.0, t::geometry::Image::InterpType::Linear);
+    EXPECT_EQ(im_up.AsTensor().GetShape(), core::SizeVector({8, 8, 1}));
+    EXPECT_FLOAT_EQ(im_up.At(0, 0).Item<float>(), 0);
+    EXPECT_FLOAT_EQ(im_up.At(7, 7).Item<float>(), 15);
+}
+
+TEST_P(ImagePermuteDevices, FilterGaussian) {
+    core::Device device = GetParam();
+
+    // Constant images are preserved.
+    t::geometry::Image im_const(core::Tensor::Full({6, 5, 3}, 100,
+                                                   core::Dtype::UInt8, device));
+    EXPECT_TRUE(im_const.FilterGaussian(5, 2.0f).AsTensor().AllClose(
+            im_const.AsTensor()));
+
+    // Impulse response is the normalized 2D kernel.
+    core::Tensor t_impulse =
+            core::Tensor::Zeros({5, 5, 1}, core::Dtype::Float32, device);
+    t_impulse[2][2][0] = core::Tensor::Ones({}, core::Dtype::Float32, device);
+    t::geometry::Image im_filtered =
+            t::geometry::Image(t_impulse).FilterGaussian(3, 1.0f);
+    float w0 = 1.0f / (1.0f + 2.0f * std::exp(-0.5f));
+    float w1 = w0 * std::exp(-0.5f);
+    EXPECT_NEAR(im_filtered.At(2, 2).Item<float>(), w0 * w0, 1e-6);
+    EXPECT_NEAR(im_filtered.At(1, 2).Item<float>(), w0 * w1, 1e-6);
+    EXPECT_NEAR(im_filtered.At(1, 1).Item<float>(), w1 * w1, 1e-6);
+    EXPECT_NEAR(im_filtered.AsTensor().Sum({0, 1, 2}).Item<float>(), 1.0f,
+                1e-6);
+
+    EXPECT_ANY_THROW(im_const.FilterGaussian(4));
+}
+
+TEST_P(ImagePermuteDevices, FilterBilateral) {
+    core::Device device = GetParam();
+
+    // A step edge much larger than value_sigma is preserved.
+    core::Tensor t_step =
+            core::Tensor::Zeros({4, 6, 1}, core::Dtype::UInt8, device);
+    t_step.Slice(1, 3, 6) =
+            core::Tensor::Full({4, 3, 1}, 100, core::Dtype::UInt8, device);
+    t::geometry::Image im_step(t_step);
+    EXPECT_TRUE(im_step.FilterBilateral(5, 1.0f, 3.0f).AsTensor().AllClose(
+            t_step));
+
+    // With a large value_sigma, it behaves like a spatial blur.
+    t::geometry::Image im_blur = im_step.To(core::Dtype::Float32)
+                                         .FilterBilateral(3, 1000.0f, 1.0f);
+    float left = im_blur.At(0, 2).Item<float>();
+    float right = im_blur.At(0, 3).Item<float>();
+    EXPECT_GT(left, 0);
+    EXPECT_LT(right, 100);
+    EXPECT_NEAR(left + right, 100, 1e-3);
+}
+
+TEST_P(ImagePermuteDevices, FilterSobel) {
+    core::Device device = GetParam();
+
+    // Horizontal ramp: I(r, c) = c.
+    std::vector<float> vals(25);
+    for (int i = 0; i < 25; ++i) {
+        vals[i] = static_cast<float>(i % 5);
+    }
+    t::geometry::Image im(core::Tensor(vals, {5, 5, 1}, core::Dtype::Float32,
+                                       device));
+
+    t::geometry::Image dx, dy;
+    std::tie(dx, dy) = im.FilterSobel(3);
+    EXPECT_EQ(dx.GetDtype(), core::Dtype::Float32);
+    EXPECT_FLOAT_EQ(dx.At(2, 2).Item<float>(), 8);
+    // Replicated border.
+    EXPECT_FLOAT_EQ(dx.At(2, 0).Item<float>(), 4);
+    EXPECT_TRUE(dy.AsTensor().AllClose(core::Tensor::Zeros(
+            {5, 5, 1}, core::Dtype::Float32, device)));
+
+    std::tie(dx, dy) = im.FilterSobel(5);
+    EXPECT_FLOAT_EQ(dx.At(2, 2).Item<float>(), 128);
+
+    // Vertical UInt8 ramp: I(r, c) = r. Gradients are Float32.
+    std::vector<uint8_t> vals_u8(25);
+    for (int i = 0; i < 25; ++i) {
+        vals_u8[i] = static_cast<uint8_t>(i / 5);
+    }
+    t::geometry::Image im_u8(core::Tensor(vals_u8, {5, 5, 1},
+                                          core::Dtype::UInt8, device));
+    std::tie(dx, dy) = im_u8.FilterSobel(3);
+    EXPECT_EQ(dy.GetDtype(), core::Dtype::Float32);
+    EXPECT_FLOAT_EQ(dy.At(2, 2).Item<float>(), 8);
+
+    EXPECT_ANY_THROW(im.FilterSobel(4));
+}
+
+TEST_P(ImagePermuteDevices, PyrDown) {
+    core::Device device = GetParam();
+
+    t::geometry::Image im(core::Tensor::Full({6, 9, 3}, 3.0f,
+                                             core::Dtype::Float32, device));
+    t::geometry::Image im_down = im.PyrDown();
+    EXPECT_EQ(im_down.AsTensor().GetShape(), core::SizeVector({3, 4, 3}));
+    EXPECT_TRUE(im_down.AsTensor().AllClose(core::Tensor::Full(
+            {3, 4, 3}, 3.0f, core::Dtype::Float32, device)));
+}
+
+TEST_P(ImagePermuteDevices, PyrDownDepth) {
+    core::Device device = GetParam();
+
+    // clang-format off
+    core::Tensor t_depth(std::vector<float>{1, 1, 1.0f, 2.0f,
+                                            1, 1, 0.0f, 1.02f,
+                                            0, 0, 2, 2,
+                                            0, 0, 2, 2},
+                         {4, 4, 1}, core::Dtype::Float32, device);
+    // clang-format on
+    t::geometry::Image depth_down =
+            t::geometry::Image(t_depth).PyrDownDepth(0.1f, -1.0f);
+    EXPECT_EQ(depth_down.AsTensor().GetShape(), core::SizeVector({2, 2, 1}));
+    EXPECT_TRUE(depth_down.AsTensor().AllClose(
+            core::Tensor(std::vector<float>{1.0f, 1.01f, -1.0f, 2.0f},
+                         {2, 2, 1}, core::Dtype::Float32, device)));
+
+    EXPECT_ANY_THROW(t::geometry::Image(t_depth.To(core::Dtype::UInt16))
+                             .PyrDownDepth(0.1f));
+}
+
+TEST_P(ImagePermuteDevices, CreateVertexMapAndNormalMap) {
+    core::Device device = GetParam();
+
+    core::Tensor intrinsics(std::vector<double>{2, 0, 1, 0, 2, 0.5, 0, 0, 1},
+                            {3, 3}, core::Dtype::Float64, device);
+    core::Tensor t_depth(std::vector<float>{1, 1, 2, 1, 1, 0}, {2, 3, 1},
+                         core::Dtype::Float32, device);
+    t::geometry::Image vertex_map =
+            t::geometry::Image(t_depth).CreateVertexMap(intrinsics, -1.0f);
+    EXPECT_EQ(vertex_map.AsTensor().GetShape(), core::SizeVector({2, 3, 3}));
+    EXPECT_TRUE(vertex_map.At(0, 2).AllClose(core::Tensor(
+            std::vector<float>{1, -0.5, 2}, {3}, core::Dtype::Float32,
+            device)));
+    EXPECT_TRUE(vertex_map.At(1, 2).AllClose(core::Tensor::Full(
+            {3}, -1.0f, core::Dtype::Float32, device)));
+
+    // A fronto-parallel plane has normals along +z.
+    core::Tensor t_plane =
+            core::Tensor::Ones({4, 5, 1}, core::Dtype::Float32, device);
+    t::geometry::Image normal_map = t::geometry::Image(t_plane)
+                                            .CreateVertexMap(intrinsics)
+                                            .CreateNormalMap(-1.0f);
+    core::Tensor normal_z = core::Tensor(std::vector<float>{0, 0, 1}, {3},
+                                         core::Dtype::Float32, device);
+    core::Tensor invalid =
+            core::Tensor::Full({3}, -1.0f, core::Dtype::Float32, device);
+    EXPECT_TRUE(normal_map.At(0, 0).AllClose(normal_z));
+    EXPECT_TRUE(normal_map.At(2, 3).AllClose(normal_z));
+    EXPECT_TRUE(normal_map.At(3, 0).AllClose(invalid));
+    EXPECT_TRUE(normal_map.At(0, 4).AllClose(invalid));
+}
+
 }  // namespace tests
 }  // namespace open3d
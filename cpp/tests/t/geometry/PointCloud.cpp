@@ -334,5 +334,36 @@ TEST_P(PointCloudPermuteDevices, Has) {
     EXPECT_TRUE(pcd.HasPointColors());
 }
 
+TEST_P(PointCloudPermuteDevices, VoxelDownSample) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float64;
+
+    // Two points in voxel (0, 0, 0), one in voxel (1, 0, 0) with voxel size 1.
+    t::geometry::PointCloud pcd(core::Tensor(
+            std::vector<double>{0.1, 0.1, 0.1, 0.3, 0.5, 0.1, 1.5, 0.2, 0.2},
+            {3, 3}, dtype, device));
+    pcd.SetPointNormals(
+            core::Tensor(std::vector<double>{0, 0, 1, 1, 0, 0, 0, 1, 0},
+                         {3, 3}, dtype, device));
+    pcd.SetPointColors(core::Tensor(
+            std::vector<double>{0.2, 0.2, 0.2, 0.4, 0.4, 0.4, 1, 1, 1},
+            {3, 3}, dtype, device));
+
+    t::geometry::PointCloud pcd_down = pcd.VoxelDownSample(1.0);
+    EXPECT_EQ(pcd_down.GetDevice(), device);
+    EXPECT_TRUE(pcd_down.GetPoints().AllClose(
+            core::Tensor(std::vector<double>{0.2, 0.3, 0.1, 1.5, 0.2, 0.2},
+                         {2, 3}, dtype, device)));
+    EXPECT_TRUE(pcd_down.GetPointColors().AllClose(
+            core::Tensor(std::vector<double>{0.3, 0.3, 0.3, 1, 1, 1}, {2, 3},
+                         dtype, device)));
+    double s = 1.0 / std::sqrt(2.0);
+    EXPECT_TRUE(pcd_down.GetPointNormals().AllClose(
+            core::Tensor(std::vector<double>{s, 0, s, 0, 1, 0}, {2, 3}, dtype,
+                         device)));
+
+    EXPECT_ANY_THROW(pcd.VoxelDownSample(0.0));
+}
+
 }  // namespace tests
 }  // namespace open3d
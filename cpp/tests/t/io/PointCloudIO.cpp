@@ -28,6 +28,8 @@
 
 #include <gtest/gtest.h>
 
+#include <fstream>
+
 #include "open3d/core/Device.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/SizeVector.h"
@@ -76,6 +78,10 @@ const std::vector<ReadWritePCArgs> pcArgs({
          IsAscii::ASCII,
          Compressed::UNCOMPRESSED,
          {{"points", 1e-5}, {"intensities", 1e-5}}},  // 1
+        {"test.ply",
+         IsAscii::BINARY,
+         Compressed::UNCOMPRESSED,
+         {{"points", 1e-5}, {"intensities", 1e-5}}},  // 2
 });
 
 class ReadWriteTPC : public testing::TestWithParam<ReadWritePCArgs> {};
@@ -186,5 +192,74 @@ TEST(TPointCloudIO, ReadPointCloudFromPLY4) {
     EXPECT_EQ(pcd.GetPointAttr("intensity").GetLength(), 7);
 }
 
+// QPC reorders the points along a Morton curve.
+TEST(TPointCloudIO, WriteAndReadQPC) {
+    core::Device device("CPU:0");
+    t::geometry::PointCloud pc1(device);
+    pc1.SetPoints(core::Tensor(
+            std::vector<double>{0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 1},
+            {5, 3}, core::Dtype::Float64, device));
+    pc1.SetPointColors(core::Tensor(
+            std::vector<uint8_t>{0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 10,
+                                 20, 30},
+            {5, 3}, core::Dtype::UInt8, device));
+
+    open3d::io::WritePointCloudOption write_option;
+    write_option.quantization_precision = 1.0;
+    EXPECT_TRUE(t::io::WritePointCloud("test.qpc", pc1, write_option));
+    t::geometry::PointCloud pc2(device);
+    EXPECT_TRUE(t::io::ReadPointCloud("test.qpc", pc2,
+                                      {"auto", false, false, false}));
+    ASSERT_EQ(pc2.GetPoints().GetLength(), 5);
+    EXPECT_EQ(pc2.GetPointColors().GetDtype(), core::Dtype::UInt8);
+    EXPECT_FALSE(pc2.HasPointNormals());
+
+    // Points on the quantization grid are exact, so match them by position.
+    const core::Tensor points1 = pc1.GetPoints();
+    const core::Tensor points2 = pc2.GetPoints();
+    for (int64_t i = 0; i < 5; ++i) {
+        int64_t match = -1;
+        for (int64_t j = 0; j < 5; ++j) {
+            if (points2[j].AllClose(points1[i], 0, 0)) {
+                match = j;
+            }
+        }
+        ASSERT_GE(match, 0);
+        EXPECT_EQ(pc2.GetPointColors()[match].ToFlatVector<uint8_t>(),
+                  pc1.GetPointColors()[i].ToFlatVector<uint8_t>());
+    }
+
+    // Float colors in [0, 1] are read back as UInt8; compare the sums since
+    // the points are reordered.
+    const core::Tensor colors_uint8 = pc1.GetPointColors();
+    pc1.SetPointColors(colors_uint8.To(core::Dtype::Float32).Div(255.0));
+    EXPECT_TRUE(t::io::WritePointCloud("test.qpc", pc1, write_option));
+    EXPECT_TRUE(t::io::ReadPointCloud("test.qpc", pc2,
+                                      {"auto", false, false, false}));
+    EXPECT_EQ(pc2.GetPointColors().GetDtype(), core::Dtype::UInt8);
+    auto sum = [](const core::Tensor &colors) {
+        return colors.To(core::Dtype::Int64).Sum({0, 1}).Item<int64_t>();
+    };
+    EXPECT_EQ(sum(pc2.GetPointColors()), sum(colors_uint8));
+
+    // A point count that the file size cannot hold is rejected before the
+    // attributes are allocated. The count follows the magic, version and
+    // flags; the points per chunk follow the origin and precision.
+    {
+        std::fstream file("test.qpc",
+                          std::ios::in | std::ios::out | std::ios::binary);
+        const uint64_t num_points = uint64_t(1) << 31;
+        const uint32_t points_per_chunk = uint32_t(num_points);
+        file.seekp(8);
+        file.write(reinterpret_cast<const char *>(&num_points),
+                   sizeof(num_points));
+        file.seekp(48);
+        file.write(reinterpret_cast<const char *>(&points_per_chunk),
+                   sizeof(points_per_chunk));
+    }
+    EXPECT_FALSE(t::io::ReadPointCloud("test.qpc", pc2,
+                                       {"auto", false, false, false}));
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,261 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/PointCloudStream.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdio>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+t::geometry::PointCloud CreateTestPointCloud(int64_t num_points) {
+    geometry::PointCloud pointcloud;
+    pointcloud.points_.resize(num_points);
+    pointcloud.normals_.resize(num_points);
+    pointcloud.colors_.resize(num_points);
+    Rand(pointcloud.points_, Eigen::Vector3d(-10.0, -10.0, -10.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+    Rand(pointcloud.normals_, Eigen::Vector3d(-1.0, -1.0, -1.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 1);
+    Rand(pointcloud.colors_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 2);
+    return t::geometry::PointCloud::FromLegacyPointCloud(pointcloud,
+                                                         core::Dtype::Float64);
+}
+
+bool WriteInBatches(const std::string &filename,
+                    const t::geometry::PointCloud &pointcloud,
+                    int64_t batch_size,
+                    const io::WritePointCloudOption &params = {}) {
+    auto writer = t::io::PointCloudStreamWriter::Create(filename, params);
+    if (writer == nullptr) {
+        return false;
+    }
+    const int64_t num_points = pointcloud.GetPoints().GetLength();
+    for (int64_t begin = 0; begin < num_points; begin += batch_size) {
+        const int64_t end = std::min(begin + batch_size, num_points);
+        t::geometry::PointCloud batch;
+        for (const auto &it : pointcloud.GetPointAttr()) {
+            batch.SetPointAttr(it.first, it.second.Slice(0, begin, end));
+        }
+        if (!writer->Write(batch)) {
+            return false;
+        }
+    }
+    EXPECT_EQ(writer->GetNumPointsWritten(), num_points);
+    return writer->Close();
+}
+
+// Reads filename in batches and compares them with the slices of expected.
+void ExpectBatchesEqual(const std::string &filename,
+                        const t::geometry::PointCloud &expected,
+                        int64_t batch_size) {
+    auto reader = t::io::PointCloudStreamReader::Create(filename);
+    ASSERT_NE(reader, nullptr);
+    const int64_t num_points = expected.GetPoints().GetLength();
+    if (reader->GetNumPoints() >= 0) {
+        EXPECT_EQ(reader->GetNumPoints(), num_points);
+    }
+    int64_t begin = 0;
+    while (!reader->IsEOF()) {
+        t::geometry::PointCloud batch = reader->Next(batch_size);
+        if (batch.IsEmpty()) {
+            break;
+        }
+        const int64_t end = begin + batch.GetPoints().GetLength();
+        ASSERT_LE(end, num_points);
+        EXPECT_EQ(end - begin, std::min(batch_size, num_points - begin));
+        EXPECT_EQ(batch.GetPointAttr().size(), expected.GetPointAttr().size());
+        for (const auto &it : expected.GetPointAttr()) {
+            SCOPED_TRACE(it.first);
+            ASSERT_TRUE(batch.HasPointAttr(it.first));
+            EXPECT_TRUE(batch.GetPointAttr(it.first).AllClose(
+                    it.second.Slice(0, begin, end), 0, 0));
+        }
+        begin = end;
+    }
+    EXPECT_EQ(begin, num_points);
+    EXPECT_TRUE(reader->Next(batch_size).IsEmpty());
+}
+
+void ExpectAttributesClose(const t::geometry::PointCloud &pointcloud,
+                           const t::geometry::PointCloud &expected,
+                           const std::vector<std::string> &attributes,
+                           double atol) {
+    for (const std::string &attribute : attributes) {
+        SCOPED_TRACE(attribute);
+        ASSERT_TRUE(pointcloud.HasPointAttr(attribute));
+        EXPECT_TRUE(pointcloud.GetPointAttr(attribute).AllClose(
+                expected.GetPointAttr(attribute).To(
+                        pointcloud.GetPointAttr(attribute).GetDtype()),
+                0, atol));
+    }
+}
+
+}  // namespace
+
+TEST(PointCloudStream, PLY) {
+    t::geometry::PointCloud pointcloud = CreateTestPointCloud(1000);
+    pointcloud.SetPoints(pointcloud.GetPoints().To(core::Dtype::Float32));
+    pointcloud.SetPointColors(
+            (pointcloud.GetPointColors() * 255.0).To(core::Dtype::UInt8));
+    pointcloud.SetPointAttr(
+            "intensities",
+            pointcloud.GetPoints().Slice(1, 0, 1).To(core::Dtype::Float32));
+
+    for (bool write_ascii : {false, true}) {
+        SCOPED_TRACE(write_ascii);
+        EXPECT_TRUE(
+                WriteInBatches("test_stream.ply", pointcloud, 300,
+                               io::WritePointCloudOption(write_ascii)));
+        t::geometry::PointCloud read_pointcloud;
+        EXPECT_TRUE(t::io::ReadPointCloud("test_stream.ply", read_pointcloud,
+                                          {"auto", false, false, false}));
+        ExpectAttributesClose(read_pointcloud, pointcloud,
+                              {"points", "normals", "colors", "intensities"},
+                              0);
+        ExpectBatchesEqual("test_stream.ply", read_pointcloud, 128);
+    }
+}
+
+TEST(PointCloudStream, PCD) {
+    const t::geometry::PointCloud pointcloud = CreateTestPointCloud(1000);
+    for (bool write_ascii : {false, true}) {
+        SCOPED_TRACE(write_ascii);
+        EXPECT_TRUE(
+                WriteInBatches("test_stream.pcd", pointcloud, 300,
+                               io::WritePointCloudOption(write_ascii)));
+        t::geometry::PointCloud read_pointcloud;
+        EXPECT_TRUE(t::io::ReadPointCloud("test_stream.pcd", read_pointcloud,
+                                          {"auto", false, false, false}));
+        ExpectAttributesClose(read_pointcloud, pointcloud,
+                              {"points", "normals"}, 1e-5);
+        ExpectAttributesClose(read_pointcloud, pointcloud, {"colors"},
+                              0.5 / 255.0 + 1e-9);
+        ExpectBatchesEqual("test_stream.pcd", read_pointcloud, 128);
+    }
+}
+
+TEST(PointCloudStream, CompressedPCD) {
+    // binary_compressed data is read completely and returned in slices.
+    const t::geometry::PointCloud pointcloud = CreateTestPointCloud(1000);
+    EXPECT_TRUE(t::io::WritePointCloud("test_stream.pcd", pointcloud,
+                                       {false, true, false}));
+    t::geometry::PointCloud read_pointcloud;
+    EXPECT_TRUE(t::io::ReadPointCloud("test_stream.pcd", read_pointcloud,
+                                      {"auto", false, false, false}));
+    ExpectBatchesEqual("test_stream.pcd", read_pointcloud, 128);
+}
+
+TEST(PointCloudStream, TextFormats) {
+    t::geometry::PointCloud pointcloud = CreateTestPointCloud(1000);
+    pointcloud.SetPointAttr("intensities",
+                            pointcloud.GetPoints().Slice(1, 0, 1).Contiguous());
+    const std::vector<std::pair<std::string, std::string>> formats{
+            {"xyz", ""},
+            {"xyzn", "normals"},
+            {"xyzrgb", "colors"},
+            {"xyzi", "intensities"}};
+    for (const auto &format : formats) {
+        SCOPED_TRACE(format.first);
+        const std::string filename = "test_stream." + format.first;
+        EXPECT_TRUE(WriteInBatches(filename, pointcloud, 300));
+        t::geometry::PointCloud read_pointcloud;
+        EXPECT_TRUE(t::io::ReadPointCloud(filename, read_pointcloud,
+                                          {"auto", false, false, false}));
+        std::vector<std::string> attributes{"points"};
+        if (!format.second.empty()) {
+            attributes.push_back(format.second);
+        }
+        EXPECT_EQ(read_pointcloud.GetPointAttr().size(), attributes.size());
+        ExpectAttributesClose(read_pointcloud, pointcloud, attributes, 1e-9);
+        ExpectBatchesEqual(filename, read_pointcloud, 128);
+    }
+}
+
+TEST(PointCloudStream, TextSkipsInvalidLines) {
+    FILE *file = fopen("test_stream.xyz", "w");
+    ASSERT_NE(file, nullptr);
+    fprintf(file, "# comment\n0 0 0\n\n1 1 1\nx\n2 2 2\n3 3 3\r\n4 4 4");
+    fclose(file);
+
+    auto reader = t::io::PointCloudStreamReader::Create("test_stream.xyz");
+    ASSERT_NE(reader, nullptr);
+    EXPECT_EQ(reader->GetNumPoints(), -1);
+    std::vector<int64_t> sizes;
+    std::vector<double> values;
+    while (!reader->IsEOF()) {
+        t::geometry::PointCloud batch = reader->Next(2);
+        if (batch.IsEmpty()) {
+            break;
+        }
+        sizes.push_back(batch.GetPoints().GetLength());
+        for (double value : batch.GetPoints().ToFlatVector<double>()) {
+            values.push_back(value);
+        }
+    }
+    EXPECT_EQ(sizes, std::vector<int64_t>({2, 2, 1}));
+    EXPECT_EQ(values, std::vector<double>({0, 0, 0, 1, 1, 1, 2, 2, 2, 3, 3,
+                                           3, 4, 4, 4}));
+}
+
+TEST(PointCloudStream, WriteMismatchedBatch) {
+    const t::geometry::PointCloud pointcloud = CreateTestPointCloud(10);
+    t::geometry::PointCloud points_only(pointcloud.GetPoints());
+    for (const char *filename :
+         {"test_stream.ply", "test_stream.pcd", "test_stream.xyzn"}) {
+        SCOPED_TRACE(filename);
+        auto writer = t::io::PointCloudStreamWriter::Create(filename);
+        ASSERT_NE(writer, nullptr);
+        EXPECT_TRUE(writer->Write(pointcloud));
+        EXPECT_FALSE(writer->Write(points_only));
+        EXPECT_TRUE(writer->Close());
+        EXPECT_EQ(writer->GetNumPointsWritten(), 10);
+    }
+}
+
+TEST(PointCloudStream, OpenFailure) {
+    EXPECT_EQ(t::io::PointCloudStreamReader::Create("does_not_exist.ply"),
+              nullptr);
+    EXPECT_EQ(t::io::PointCloudStreamWriter::Create("test_stream.unknown"),
+              nullptr);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,217 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/sensor/RGBDFramePrefetcher.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdio>
+#include <stdexcept>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/io/ImageIO.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+// A frame whose depth image holds its index.
+t::geometry::RGBDImage CreateIndexFrame(int64_t index) {
+    t::geometry::Image image(
+            core::Tensor::Full({1, 1, 1}, index, core::Dtype::Int32));
+    return t::geometry::RGBDImage(image, image);
+}
+
+int32_t GetFrameIndex(const t::geometry::RGBDImage &frame) {
+    return frame.depth_.AsTensor().Item<int32_t>();
+}
+
+}  // namespace
+
+TEST(RGBDFramePrefetcher, ReadRGBDAssociationFile) {
+    std::vector<std::string> color_filenames, depth_filenames;
+    const std::string match_filename =
+            std::string(TEST_DATA_DIR) + "/RGBD/rgbd.match";
+    EXPECT_TRUE(t::io::ReadRGBDAssociationFile(match_filename, color_filenames,
+                                               depth_filenames));
+    ASSERT_EQ(color_filenames.size(), 5);
+    ASSERT_EQ(depth_filenames.size(), 5);
+    EXPECT_EQ(color_filenames[1],
+              std::string(TEST_DATA_DIR) + "/RGBD/color/00001.jpg");
+    EXPECT_EQ(depth_filenames[1],
+              std::string(TEST_DATA_DIR) + "/RGBD/depth/00001.png");
+
+    const std::string tum_filename = "test_association.txt";
+    FILE *file = fopen(tum_filename.c_str(), "w");
+    ASSERT_NE(file, nullptr);
+    fprintf(file, "# timestamp rgb timestamp depth\n");
+    fprintf(file, "1.0 rgb/1.png 1.01 depth/1.png\n");
+    fprintf(file, "\n");
+    fprintf(file, "2.0 /data/rgb/2.png 2.01 /data/depth/2.png\n");
+    fclose(file);
+    EXPECT_TRUE(t::io::ReadRGBDAssociationFile(tum_filename, color_filenames,
+                                               depth_filenames));
+    EXPECT_EQ(color_filenames,
+              std::vector<std::string>({"rgb/1.png", "/data/rgb/2.png"}));
+    EXPECT_EQ(depth_filenames,
+              std::vector<std::string>({"depth/1.png", "/data/depth/2.png"}));
+
+    file = fopen(tum_filename.c_str(), "w");
+    ASSERT_NE(file, nullptr);
+    fprintf(file, "rgb/1.png\n");
+    fclose(file);
+    EXPECT_FALSE(t::io::ReadRGBDAssociationFile(tum_filename, color_filenames,
+                                                depth_filenames));
+    std::remove(tum_filename.c_str());
+}
+
+TEST(RGBDFramePrefetcher, CreateFromAssociationFile) {
+    const std::string match_filename =
+            std::string(TEST_DATA_DIR) + "/RGBD/rgbd.match";
+    std::vector<std::string> color_filenames, depth_filenames;
+    t::io::ReadRGBDAssociationFile(match_filename, color_filenames,
+                                   depth_filenames);
+    auto prefetcher = t::io::RGBDFramePrefetcher::CreateFromAssociationFile(
+            match_filename, core::Device("CPU:0"), 2, 3);
+    for (size_t i = 0; i < color_filenames.size(); ++i) {
+        EXPECT_FALSE(prefetcher->IsEOF());
+        t::geometry::RGBDImage frame = prefetcher->NextFrame();
+        geometry::Image color, depth;
+        io::ReadImage(color_filenames[i], color);
+        io::ReadImage(depth_filenames[i], depth);
+        EXPECT_TRUE(frame.color_.AsTensor().AllClose(
+                t::geometry::Image::FromLegacyImage(color).AsTensor()));
+        EXPECT_TRUE(frame.depth_.AsTensor().AllClose(
+                t::geometry::Image::FromLegacyImage(depth).AsTensor()));
+    }
+    EXPECT_TRUE(prefetcher->IsEOF());
+    EXPECT_TRUE(prefetcher->NextFrame().IsEmpty());
+    EXPECT_EQ(prefetcher->GetNumFramesRead(), 5);
+}
+
+TEST(RGBDFramePrefetcher, FrameOrderAndQueueSize) {
+    const int64_t num_frames = 200;
+    const size_t queue_size = 3;
+    std::atomic<int64_t> max_index_started(-1);
+    std::atomic<int64_t> num_frames_read(0);
+    std::atomic<bool> queue_exceeded(false);
+    auto load = [&](int64_t index, t::geometry::RGBDImage &frame) {
+        // num_frames_read is incremented after NextFrame() returns, so it may
+        // lag behind by one frame.
+        if (index > num_frames_read + int64_t(queue_size)) {
+            queue_exceeded = true;
+        }
+        int64_t max_index = max_index_started;
+        while (index > max_index &&
+               !max_index_started.compare_exchange_weak(max_index, index)) {
+        }
+        frame = CreateIndexFrame(index);
+        return true;
+    };
+    t::io::RGBDFramePrefetcher prefetcher(load, num_frames, queue_size, 4);
+    for (int64_t i = 0; i < num_frames; ++i) {
+        EXPECT_EQ(GetFrameIndex(prefetcher.NextFrame()), i);
+        ++num_frames_read;
+    }
+    EXPECT_TRUE(prefetcher.IsEOF());
+    EXPECT_FALSE(queue_exceeded);
+    EXPECT_EQ(max_index_started, num_frames - 1);
+}
+
+TEST(RGBDFramePrefetcher, SequentialSourceOfUnknownLength) {
+    int64_t next_index = 0;
+    auto load = [&](int64_t index, t::geometry::RGBDImage &frame) {
+        EXPECT_EQ(index, next_index);
+        if (next_index == 10) {
+            return false;
+        }
+        frame = CreateIndexFrame(next_index++);
+        return true;
+    };
+    t::io::RGBDFramePrefetcher prefetcher(load, -1, 4, 1);
+    int64_t num_frames = 0;
+    while (!prefetcher.IsEOF()) {
+        EXPECT_EQ(GetFrameIndex(prefetcher.NextFrame()), num_frames);
+        ++num_frames;
+    }
+    EXPECT_EQ(num_frames, 10);
+    EXPECT_TRUE(prefetcher.NextFrame().IsEmpty());
+}
+
+TEST(RGBDFramePrefetcher, RethrowsLoaderErrors) {
+    auto load = [](int64_t index, t::geometry::RGBDImage &frame) {
+        if (index == 5) {
+            throw std::runtime_error("Failed to decode frame.");
+        }
+        frame = CreateIndexFrame(index);
+        return true;
+    };
+    t::io::RGBDFramePrefetcher prefetcher(load, 20, 4, 3);
+    for (int64_t i = 0; i < 5; ++i) {
+        EXPECT_EQ(GetFrameIndex(prefetcher.NextFrame()), i);
+    }
+    EXPECT_THROW(prefetcher.NextFrame(), std::runtime_error);
+    EXPECT_TRUE(prefetcher.IsEOF());
+}
+
+TEST(RGBDFramePrefetcher, IsEOFRethrowsLoaderErrors) {
+    auto load = [](int64_t index, t::geometry::RGBDImage &frame) {
+        if (index == 5) {
+            throw std::runtime_error("Failed to decode frame.");
+        }
+        frame = CreateIndexFrame(index);
+        return true;
+    };
+    t::io::RGBDFramePrefetcher prefetcher(load, -1, 4, 1);
+    int64_t num_frames = 0;
+    EXPECT_THROW(
+            {
+                while (!prefetcher.IsEOF()) {
+                    EXPECT_EQ(GetFrameIndex(prefetcher.NextFrame()),
+                              num_frames);
+                    ++num_frames;
+                }
+            },
+            std::runtime_error);
+    EXPECT_EQ(num_frames, 5);
+    // The error is only reported once.
+    EXPECT_TRUE(prefetcher.IsEOF());
+}
+
+TEST(RGBDFramePrefetcher, DestroyWhileDecoding) {
+    auto load = [](int64_t index, t::geometry::RGBDImage &frame) {
+        frame = CreateIndexFrame(index);
+        return true;
+    };
+    t::io::RGBDFramePrefetcher prefetcher(load, -1, 8, 4);
+    EXPECT_EQ(GetFrameIndex(prefetcher.NextFrame()), 0);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,167 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/odometry/RGBDOdometry.h"
+
+#include "core/CoreTest.h"
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/geometry/RGBDImage.h"
+#include "open3d/io/ImageIO.h"
+#include "open3d/pipelines/odometry/Odometry.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+class OdometryPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(Odometry,
+                         OdometryPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+static t::geometry::RGBDImage ReadRGBDImage(int index,
+                                            const core::Device &device) {
+    std::shared_ptr<geometry::Image> depth_legacy = io::CreateImageFromFile(
+            fmt::format("{}/RGBD/depth/{:05d}.png", std::string(TEST_DATA_DIR),
+                        index));
+    std::shared_ptr<geometry::Image> color_legacy = io::CreateImageFromFile(
+            fmt::format("{}/RGBD/color/{:05d}.jpg", std::string(TEST_DATA_DIR),
+                        index));
+    return t::geometry::RGBDImage(
+            t::geometry::Image::FromLegacyImage(*color_legacy, device),
+            t::geometry::Image::FromLegacyImage(*depth_legacy, device));
+}
+
+static core::Tensor CreateIntrinsicTensor() {
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    return core::eigen_converter::EigenMatrixToTensor(
+            intrinsic.intrinsic_matrix_);
+}
+
+TEST_P(OdometryPermuteDevices, CreateRGBDPyramid) {
+    core::Device device = GetParam();
+    t::geometry::RGBDImage rgbd = ReadRGBDImage(0, device);
+
+    t::pipelines::odometry::RGBDPyramid pyramid =
+            t::pipelines::odometry::CreateRGBDPyramid(
+                    rgbd, CreateIntrinsicTensor(), 3);
+    EXPECT_EQ(pyramid.NumLevels(), 3);
+    EXPECT_TRUE(pyramid.HasIntensity());
+    EXPECT_EQ(pyramid.depth_[0].GetShape(), core::SizeVector({480, 640}));
+    EXPECT_EQ(pyramid.depth_[2].GetShape(), core::SizeVector({120, 160}));
+    EXPECT_EQ(pyramid.vertex_map_[1].GetShape(),
+              core::SizeVector({240, 320, 3}));
+    EXPECT_EQ(pyramid.normal_map_[2].GetShape(),
+              core::SizeVector({120, 160, 3}));
+    EXPECT_EQ(pyramid.intensity_dx_[1].GetShape(),
+              core::SizeVector({240, 320}));
+    EXPECT_NEAR(pyramid.intrinsics_[1][0][0].Item<double>(), 525.0 / 2,
+                1e-6);
+}
+
+TEST_P(OdometryPermuteDevices, RGBDOdometryMultiScale) {
+    core::Device device = GetParam();
+    t::geometry::RGBDImage source = ReadRGBDImage(1, device);
+    t::geometry::RGBDImage target = ReadRGBDImage(0, device);
+    core::Tensor intrinsics = CreateIntrinsicTensor();
+
+    // Legacy hybrid odometry as reference.
+    camera::PinholeCameraIntrinsic intrinsic_legacy(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto source_legacy = geometry::RGBDImage::CreateFromColorAndDepth(
+            source.color_.ToLegacyImage(), source.depth_.ToLegacyImage());
+    auto target_legacy = geometry::RGBDImage::CreateFromColorAndDepth(
+            target.color_.ToLegacyImage(), target.depth_.ToLegacyImage());
+    bool success;
+    Eigen::Matrix4d trans_legacy;
+    Eigen::Matrix6d info_legacy;
+    std::tie(success, trans_legacy, info_legacy) =
+            pipelines::odometry::ComputeRGBDOdometry(
+                    *source_legacy, *target_legacy, intrinsic_legacy);
+    ASSERT_TRUE(success);
+
+    for (auto method : {t::pipelines::odometry::Method::PointToPlane,
+                        t::pipelines::odometry::Method::Intensity,
+                        t::pipelines::odometry::Method::Hybrid}) {
+        t::pipelines::odometry::OdometryResult result =
+                t::pipelines::odometry::RGBDOdometryMultiScale(
+                        source, target, intrinsics,
+                        core::Tensor::Eye(4, core::Dtype::Float64,
+                                          core::Device("CPU:0")),
+                        t::pipelines::odometry::OdometryOption(), method);
+        Eigen::Matrix4d trans = core::eigen_converter::TensorToEigenMatrixXd(
+                result.transformation_);
+
+        EXPECT_GT(result.fitness_, 0.5);
+        EXPECT_LT((trans.block<3, 1>(0, 3) - trans_legacy.block<3, 1>(0, 3))
+                          .norm(),
+                  0.02);
+        EXPECT_LT((trans.block<3, 3>(0, 0) - trans_legacy.block<3, 3>(0, 0))
+                          .norm(),
+                  0.02);
+    }
+}
+
+TEST_P(OdometryPermuteDevices, RGBDOdometryReusePyramid) {
+    core::Device device = GetParam();
+    core::Tensor intrinsics = CreateIntrinsicTensor();
+    t::pipelines::odometry::OdometryOption option;
+    int num_levels =
+            static_cast<int>(option.iteration_number_per_pyramid_level_.size());
+
+    // Frame-to-frame tracking: the source pyramid of one step is the target
+    // of the next one.
+    t::pipelines::odometry::RGBDPyramid prev =
+            t::pipelines::odometry::CreateRGBDPyramid(
+                    ReadRGBDImage(0, device), intrinsics, num_levels, option);
+    for (int i = 1; i < 3; ++i) {
+        t::geometry::RGBDImage curr_rgbd = ReadRGBDImage(i, device);
+        t::pipelines::odometry::RGBDPyramid curr =
+                t::pipelines::odometry::CreateRGBDPyramid(
+                        curr_rgbd, intrinsics, num_levels, option);
+
+        t::pipelines::odometry::OdometryResult result_pyramid =
+                t::pipelines::odometry::RGBDOdometryMultiScale(
+                        curr, prev,
+                        core::Tensor::Eye(4, core::Dtype::Float64,
+                                          core::Device("CPU:0")),
+                        option);
+        t::pipelines::odometry::OdometryResult result_image =
+                t::pipelines::odometry::RGBDOdometryMultiScale(
+                        curr_rgbd, ReadRGBDImage(i - 1, device), intrinsics,
+                        core::Tensor::Eye(4, core::Dtype::Float64,
+                                          core::Device("CPU:0")),
+                        option);
+        EXPECT_TRUE(result_pyramid.transformation_.AllClose(
+                result_image.transformation_));
+        EXPECT_DOUBLE_EQ(result_pyramid.fitness_, result_image.fitness_);
+        prev = curr;
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,77 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/Feature.h"
+
+#include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/pipelines/registration/Feature.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+class FeaturePermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(Feature,
+                         FeaturePermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(FeaturePermuteDevices, ComputeFPFHFeature) {
+    core::Device device = GetParam();
+
+    auto mesh = open3d::geometry::TriangleMesh::CreateSphere(1.0, 20);
+    open3d::geometry::PointCloud pcd_legacy(mesh->vertices_);
+    pcd_legacy.normals_ = mesh->vertices_;
+    t::geometry::PointCloud pcd = t::geometry::PointCloud::FromLegacyPointCloud(
+            pcd_legacy, core::Dtype::Float64, device);
+
+    const auto search_param =
+            open3d::geometry::KDTreeSearchParamHybrid(0.5, 30);
+    core::Tensor feature =
+            t::pipelines::registration::ComputeFPFHFeature(pcd, search_param);
+    EXPECT_EQ(feature.GetShape(),
+              core::SizeVector({int64_t(pcd_legacy.points_.size()), 33}));
+    EXPECT_EQ(feature.GetDtype(), core::Dtype::Float32);
+    EXPECT_EQ(feature.GetDevice(), device);
+
+    auto feature_legacy = pipelines::registration::ComputeFPFHFeature(
+            pcd_legacy, search_param);
+    Eigen::MatrixXd feature_eigen =
+            core::eigen_converter::TensorToEigenMatrixXd(feature.T());
+    ExpectEQ(feature_eigen, feature_legacy->data_, 1e-4);
+}
+
+TEST_P(FeaturePermuteDevices, ComputeFPFHFeatureWithoutNormals) {
+    core::Device device = GetParam();
+    t::geometry::PointCloud pcd(
+            core::Tensor::Zeros({10, 3}, core::Dtype::Float32, device));
+    EXPECT_ANY_THROW(t::pipelines::registration::ComputeFPFHFeature(pcd));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,284 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/Registration.h"
+
+#include <Eigen/Geometry>
+#include <cmath>
+
+#include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+class RegistrationPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(Registration,
+                         RegistrationPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+/// Samples the surface z = 0.1 sin(3x) cos(2y) on a grid, with analytic
+/// normals. The bumps make both point-to-point and point-to-plane ICP well
+/// constrained.
+static t::geometry::PointCloud CreateBumpySurface(const core::Device &device,
+                                                  core::Dtype dtype) {
+    const int64_t resolution = 60;
+    std::vector<double> points;
+    std::vector<double> normals;
+    for (int64_t v = 0; v < resolution; ++v) {
+        for (int64_t u = 0; u < resolution; ++u) {
+            double x = -1.0 + 2.0 * u / (resolution - 1);
+            double y = -1.0 + 2.0 * v / (resolution - 1);
+            double z = 0.1 * std::sin(3 * x) * std::cos(2 * y);
+            double dzdx = 0.3 * std::cos(3 * x) * std::cos(2 * y);
+            double dzdy = -0.2 * std::sin(3 * x) * std::sin(2 * y);
+            Eigen::Vector3d n = Eigen::Vector3d(-dzdx, -dzdy, 1).normalized();
+            points.insert(points.end(), {x, y, z});
+            normals.insert(normals.end(), {n(0), n(1), n(2)});
+        }
+    }
+    int64_t num_points = resolution * resolution;
+    t::geometry::PointCloud pcd(
+            core::Tensor(points, {num_points, 3}, core::Dtype::Float64)
+                    .To(dtype)
+                    .Copy(device));
+    pcd.SetPointNormals(
+            core::Tensor(normals, {num_points, 3}, core::Dtype::Float64)
+                    .To(dtype)
+                    .Copy(device));
+    return pcd;
+}
+
+/// \param scale Scales both the rotation angles and the translation.
+static Eigen::Matrix4d CreateSmallTransformation(double scale = 1.0) {
+    Eigen::Matrix4d T = Eigen::Matrix4d::Identity();
+    T.block<3, 3>(0, 0) =
+            (Eigen::AngleAxisd(0.04 * scale, Eigen::Vector3d::UnitZ()) *
+             Eigen::AngleAxisd(-0.03 * scale, Eigen::Vector3d::UnitX()))
+                    .toRotationMatrix();
+    T.block<3, 1>(0, 3) = scale * Eigen::Vector3d(0.03, -0.02, 0.01);
+    return T;
+}
+
+/// Returns a copy of pcd with the points moved by T.
+static t::geometry::PointCloud TransformPoints(
+        const t::geometry::PointCloud &pcd, const Eigen::Matrix4d &T) {
+    core::Tensor points = pcd.GetPoints().Copy(core::Device("CPU:0"));
+    core::Dtype dtype = points.GetDtype();
+    Eigen::MatrixXd p = core::eigen_converter::TensorToEigenMatrixXd(
+            points.To(core::Dtype::Float64));
+    p = ((T.block<3, 3>(0, 0) * p.transpose()).colwise() +
+         T.block<3, 1>(0, 3))
+                .transpose();
+    return t::geometry::PointCloud(
+            core::eigen_converter::EigenMatrixToTensor(p).To(dtype).Copy(
+                    pcd.GetPoints().GetDevice()));
+}
+
+TEST_P(RegistrationPermuteDevices, EvaluateRegistration) {
+    core::Device device = GetParam();
+    t::geometry::PointCloud target =
+            CreateBumpySurface(device, core::Dtype::Float32);
+
+    t::pipelines::registration::RegistrationResult result =
+            t::pipelines::registration::EvaluateRegistration(target, target,
+                                                             0.05);
+    EXPECT_DOUBLE_EQ(result.fitness_, 1.0);
+    EXPECT_NEAR(result.inlier_rmse_, 0.0, 1e-6);
+    EXPECT_EQ(result.correspondence_set_.first.GetLength(),
+              target.GetPoints().GetLength());
+
+    // Moving the source far away leaves no correspondences.
+    Eigen::Matrix4d far = Eigen::Matrix4d::Identity();
+    far(2, 3) = 10.0;
+    result = t::pipelines::registration::EvaluateRegistration(
+            target, target, 0.05,
+            core::eigen_converter::EigenMatrixToTensor(far));
+    EXPECT_DOUBLE_EQ(result.fitness_, 0.0);
+    EXPECT_EQ(result.correspondence_set_.first.GetLength(), 0);
+}
+
+TEST_P(RegistrationPermuteDevices, ICPPointToPoint) {
+    core::Device device = GetParam();
+    for (core::Dtype dtype : {core::Dtype::Float32, core::Dtype::Float64}) {
+        t::geometry::PointCloud target = CreateBumpySurface(device, dtype);
+        // Point-to-point ICP slides along the sampling grid for larger
+        // offsets, so keep the displacement below half the grid spacing.
+        Eigen::Matrix4d T = CreateSmallTransformation(0.2);
+        t::geometry::PointCloud source = TransformPoints(target, T.inverse());
+
+        t::pipelines::registration::RegistrationResult result =
+                t::pipelines::registration::RegistrationICP(
+                        source, target, 0.2,
+                        core::Tensor::Eye(4, core::Dtype::Float64,
+                                          core::Device("CPU:0")),
+                        t::pipelines::registration::
+                                TransformationEstimationPointToPoint(),
+                        t::pipelines::registration::ICPConvergenceCriteria(
+                                1e-8, 1e-8, 100));
+
+        Eigen::Matrix4d estimated =
+                core::eigen_converter::TensorToEigenMatrixXd(
+                        result.transformation_);
+        EXPECT_TRUE(estimated.isApprox(T, 1e-3));
+        EXPECT_GT(result.fitness_, 0.99);
+        EXPECT_LT(result.inlier_rmse_, 1e-3);
+    }
+}
+
+TEST_P(RegistrationPermuteDevices, ICPPointToPlane) {
+    core::Device device = GetParam();
+    for (core::Dtype dtype : {core::Dtype::Float32, core::Dtype::Float64}) {
+        t::geometry::PointCloud target = CreateBumpySurface(device, dtype);
+        Eigen::Matrix4d T = CreateSmallTransformation();
+        t::geometry::PointCloud source = TransformPoints(target, T.inverse());
+
+        t::pipelines::registration::RegistrationResult result =
+                t::pipelines::registration::RegistrationICP(
+                        source, target, 0.2,
+                        core::Tensor::Eye(4, core::Dtype::Float64,
+                                          core::Device("CPU:0")),
+                        t::pipelines::registration::
+                                TransformationEstimationPointToPlane());
+
+        Eigen::Matrix4d estimated =
+                core::eigen_converter::TensorToEigenMatrixXd(
+                        result.transformation_);
+        EXPECT_TRUE(estimated.isApprox(T, 1e-3));
+        EXPECT_GT(result.fitness_, 0.99);
+        EXPECT_LT(result.inlier_rmse_, 1e-3);
+    }
+
+    // Point-to-plane requires target normals.
+    t::geometry::PointCloud no_normals(
+            CreateBumpySurface(device, core::Dtype::Float32).GetPoints());
+    EXPECT_ANY_THROW(t::pipelines::registration::RegistrationICP(
+            no_normals, no_normals, 0.2,
+            core::Tensor::Eye(4, core::Dtype::Float64, core::Device("CPU:0")),
+            t::pipelines::registration::
+                    TransformationEstimationPointToPlane()));
+}
+
+TEST_P(RegistrationPermuteDevices, ICPReuseTargetIndex) {
+    core::Device device = GetParam();
+    t::geometry::PointCloud target =
+            CreateBumpySurface(device, core::Dtype::Float32);
+    core::Tensor target_points = target.GetPoints().Copy(core::Device("CPU:0"));
+    core::nns::NearestNeighborSearch target_nns(target_points);
+    ASSERT_TRUE(target_nns.KnnIndex());
+
+    Eigen::Matrix4d T = CreateSmallTransformation();
+    for (int i = 0; i < 2; ++i) {
+        Eigen::Matrix4d source_pose = i == 0 ? T : Eigen::Matrix4d(T * T);
+        t::geometry::PointCloud source =
+                TransformPoints(target, source_pose.inverse());
+        t::pipelines::registration::RegistrationResult with_index =
+                t::pipelines::registration::RegistrationICP(
+                        source, target, target_nns, 0.3);
+        t::pipelines::registration::RegistrationResult without_index =
+                t::pipelines::registration::RegistrationICP(source, target,
+                                                            0.3);
+
+        EXPECT_TRUE(with_index.transformation_.AllClose(
+                without_index.transformation_));
+        EXPECT_DOUBLE_EQ(with_index.fitness_, without_index.fitness_);
+        EXPECT_DOUBLE_EQ(with_index.inlier_rmse_, without_index.inlier_rmse_);
+    }
+}
+
+TEST_P(RegistrationPermuteDevices, CreatePointCloudPyramid) {
+    core::Device device = GetParam();
+    t::geometry::PointCloud pcd =
+            CreateBumpySurface(device, core::Dtype::Float32);
+
+    t::pipelines::registration::PointCloudPyramid pyramid =
+            t::pipelines::registration::CreatePointCloudPyramid(
+                    pcd, {0.2, 0.1, 0.1, -1});
+    EXPECT_EQ(pyramid.NumLevels(), 4);
+    EXPECT_TRUE(pyramid.HasIndex());
+    EXPECT_LT(pyramid.point_clouds_[0].GetPoints().GetLength(),
+              pyramid.point_clouds_[1].GetPoints().GetLength());
+    EXPECT_EQ(pyramid.point_clouds_[1].GetPoints().GetLength(),
+              pyramid.point_clouds_[2].GetPoints().GetLength());
+    EXPECT_EQ(pyramid.nns_[1], pyramid.nns_[2]);
+    EXPECT_EQ(pyramid.point_clouds_[3].GetPoints().GetLength(),
+              pcd.GetPoints().GetLength());
+    EXPECT_TRUE(pyramid.point_clouds_[0].HasPointNormals());
+    EXPECT_EQ(pyramid.point_clouds_[0].GetDevice(), core::Device("CPU:0"));
+
+    pyramid = t::pipelines::registration::CreatePointCloudPyramid(
+            pcd, {0.2, -1}, false);
+    EXPECT_EQ(pyramid.NumLevels(), 2);
+    EXPECT_FALSE(pyramid.HasIndex());
+}
+
+TEST_P(RegistrationPermuteDevices, MultiScaleICP) {
+    core::Device device = GetParam();
+    t::geometry::PointCloud target =
+            CreateBumpySurface(device, core::Dtype::Float32);
+    Eigen::Matrix4d T = CreateSmallTransformation();
+    t::geometry::PointCloud source = TransformPoints(target, T.inverse());
+
+    std::vector<double> voxel_sizes = {0.1, 0.05, -1};
+    std::vector<t::pipelines::registration::ICPConvergenceCriteria> criterias(
+            3, t::pipelines::registration::ICPConvergenceCriteria(1e-8, 1e-8,
+                                                                  50));
+    std::vector<double> max_correspondence_distances = {0.3, 0.15, 0.05};
+    core::Tensor init =
+            core::Tensor::Eye(4, core::Dtype::Float64, core::Device("CPU:0"));
+
+    t::pipelines::registration::TransformationEstimationPointToPlane
+            point_to_plane;
+    t::pipelines::registration::RegistrationResult result =
+            t::pipelines::registration::RegistrationMultiScaleICP(
+                    source, target, voxel_sizes, criterias,
+                    max_correspondence_distances, init, point_to_plane);
+    Eigen::Matrix4d estimated = core::eigen_converter::TensorToEigenMatrixXd(
+            result.transformation_);
+    EXPECT_TRUE(estimated.isApprox(T, 1e-3));
+    EXPECT_GT(result.fitness_, 0.99);
+
+    // Reusing the target pyramid gives the same result.
+    t::pipelines::registration::PointCloudPyramid target_pyramid =
+            t::pipelines::registration::CreatePointCloudPyramid(target,
+                                                                voxel_sizes);
+    t::pipelines::registration::RegistrationResult result_pyramid =
+            t::pipelines::registration::RegistrationMultiScaleICP(
+                    source, target_pyramid, criterias,
+                    max_correspondence_distances, init, point_to_plane);
+    EXPECT_TRUE(result_pyramid.transformation_.AllClose(
+            result.transformation_));
+    EXPECT_DOUBLE_EQ(result_pyramid.fitness_, result.fitness_);
+
+    // One criteria and distance per level.
+    EXPECT_ANY_THROW(t::pipelines::registration::RegistrationMultiScaleICP(
+            source, target_pyramid, {criterias[0]},
+            max_correspondence_distances, init, point_to_plane));
+}
+
+}  // namespace tests
+}  // namespace open3d
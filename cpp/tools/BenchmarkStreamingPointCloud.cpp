@@ -0,0 +1,235 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "open3d/Open3D.h"
+#include "open3d/visualization/rendering/Scene.h"
+
+void PrintHelp() {
+    using namespace open3d;
+    PrintOpen3DVersion();
+    // clang-format off
+    utility::LogInfo("Usage:");
+    utility::LogInfo("    > BenchmarkStreamingPointCloud [options]");
+    utility::LogInfo("      Streams a synthetic scanning sensor into a point cloud on screen and");
+    utility::LogInfo("      reports frame and update times.");
+    utility::LogInfo("");
+    utility::LogInfo("Options:");
+    utility::LogInfo("    --help, -h                : Print help information.");
+    utility::LogInfo("    --verbose n               : Set verbose level (0-4).");
+    utility::LogInfo("    --width n                 : Sensor columns. Default 1024.");
+    utility::LogInfo("    --height n                : Sensor rows. Default 1024.");
+    utility::LogInfo("    --rows_per_frame n        : Rows the sensor scans per frame. Default 64.");
+    utility::LogInfo("    --frames n                : Number of frames to measure. Default 600.");
+    utility::LogInfo("    --full                    : Upload the whole cloud every frame instead");
+    utility::LogInfo("                                of only the scanned rows.");
+    // clang-format on
+}
+
+namespace {
+
+using namespace open3d;
+
+// A sensor that scans a rippling height field row by row, writing the
+// positions and colors of the scanned rows into a point cloud.
+class ScanningSensor {
+public:
+    ScanningSensor(int width, int height, int rows_per_frame)
+        : width_(width), height_(height), rows_per_frame_(rows_per_frame) {
+        cloud_.SetPoints(core::Tensor::Zeros({int64_t(width) * height, 3},
+                                             core::Dtype::Float32));
+        cloud_.SetPointColors(core::Tensor::Zeros({int64_t(width) * height, 3},
+                                                  core::Dtype::Float32));
+        for (int row = 0; row < height_; ++row) {
+            ScanRow(row);
+        }
+    }
+
+    // Scans the next rows and returns the first vertex and number of vertices
+    // that changed.
+    std::pair<int64_t, int64_t> Scan() {
+        const int first_row = next_row_;
+        const int n_rows = std::min(rows_per_frame_, height_ - first_row);
+#pragma omp parallel for schedule(static)
+        for (int row = first_row; row < first_row + n_rows; ++row) {
+            ScanRow(row);
+        }
+        next_row_ = (first_row + n_rows) % height_;
+        if (next_row_ == 0) {
+            time_ += 0.1f;
+        }
+        return {int64_t(first_row) * width_, int64_t(n_rows) * width_};
+    }
+
+    const t::geometry::PointCloud &GetPointCloud() const { return cloud_; }
+
+private:
+    void ScanRow(int row) {
+        auto *points = static_cast<float *>(cloud_.GetPoints().GetDataPtr());
+        auto *colors =
+                static_cast<float *>(cloud_.GetPointColors().GetDataPtr());
+        for (int col = 0; col < width_; ++col) {
+            const float x = float(col) / float(width_) - 0.5f;
+            const float y = float(row) / float(height_) - 0.5f;
+            const float r = std::sqrt(x * x + y * y);
+            const float z = 0.05f * std::sin(40.f * r - 4.f * time_);
+            const int64_t idx = int64_t(row) * width_ + col;
+            points[3 * idx] = x;
+            points[3 * idx + 1] = y;
+            points[3 * idx + 2] = z;
+            colors[3 * idx] = 0.5f + 10.f * z;
+            colors[3 * idx + 1] = 0.5f;
+            colors[3 * idx + 2] = 0.5f - 10.f * z;
+        }
+    }
+
+    t::geometry::PointCloud cloud_;
+    int width_;
+    int height_;
+    int rows_per_frame_;
+    int next_row_ = 0;
+    float time_ = 0.f;
+};
+
+void PrintTimes(const std::string &name, std::vector<double> times) {
+    if (times.empty()) {
+        return;
+    }
+    std::sort(times.begin(), times.end());
+    const double mean = std::accumulate(times.begin(), times.end(), 0.0) /
+                        double(times.size());
+    utility::LogInfo("{}: mean {:.3f} ms, median {:.3f} ms, 95% {:.3f} ms, "
+                     "max {:.3f} ms",
+                     name, mean, times[times.size() / 2],
+                     times[times.size() * 95 / 100], times.back());
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    using namespace open3d;
+    using namespace open3d::visualization;
+
+    if (utility::ProgramOptionExists(argc, argv, "--help") ||
+        utility::ProgramOptionExists(argc, argv, "-h")) {
+        PrintHelp();
+        return 0;
+    }
+
+    int verbose = utility::GetProgramOptionAsInt(argc, argv, "--verbose", 2);
+    utility::SetVerbosityLevel((utility::VerbosityLevel)verbose);
+    const int width = utility::GetProgramOptionAsInt(argc, argv, "--width",
+                                                     1024);
+    const int height = utility::GetProgramOptionAsInt(argc, argv, "--height",
+                                                      1024);
+    const int rows_per_frame = std::max(
+            1, utility::GetProgramOptionAsInt(argc, argv, "--rows_per_frame",
+                                              64));
+    const size_t n_frames = size_t(
+            utility::GetProgramOptionAsInt(argc, argv, "--frames", 600));
+    const bool full = utility::ProgramOptionExists(argc, argv, "--full");
+    if (width <= 0 || height <= 0) {
+        utility::LogWarning("The sensor size must be positive.");
+        return 1;
+    }
+
+    auto sensor = std::make_shared<ScanningSensor>(width, height,
+                                                   rows_per_frame);
+
+    auto &app = gui::Application::GetInstance();
+    app.Initialize(argc, const_cast<const char **>(argv));
+    auto window = std::make_shared<gui::Window>("BenchmarkStreamingPointCloud",
+                                                1280, 960);
+    auto scene_widget = std::make_shared<gui::SceneWidget>();
+    scene_widget->SetScene(
+            std::make_shared<rendering::Open3DScene>(window->GetRenderer()));
+    window->AddChild(scene_widget);
+
+    rendering::Material material;
+    material.shader = "defaultUnlit";
+    material.point_size = 2.f;
+    scene_widget->GetScene()->AddGeometry("sensor", &sensor->GetPointCloud(),
+                                          material, false);
+    scene_widget->SetupCamera(60.0f,
+                              scene_widget->GetScene()->GetBoundingBox(),
+                              {0.f, 0.f, 0.f});
+
+    const uint32_t update_flags = rendering::Scene::kUpdatePointsFlag |
+                                  rendering::Scene::kUpdateColorsFlag;
+    auto frame_times = std::make_shared<std::vector<double>>();
+    auto update_times = std::make_shared<std::vector<double>>();
+    auto last_tick = std::make_shared<double>(-1.0);
+    window->SetOnTickEvent([=]() {
+        const double now = utility::Timer::GetSystemTimeInMilliseconds();
+        if (*last_tick >= 0.0) {
+            frame_times->push_back(now - *last_tick);
+        }
+        *last_tick = now;
+
+        if (frame_times->size() >= n_frames) {
+            utility::LogInfo("{} points, {} upload of {} rows per frame",
+                             int64_t(width) * height,
+                             full ? "full" : "partial", rows_per_frame);
+            PrintTimes("Frame", *frame_times);
+            PrintTimes("Update", *update_times);
+            gui::Application::GetInstance().Quit();
+            return false;
+        }
+
+        const auto range = sensor->Scan();
+        auto *scene = scene_widget->GetScene()->GetScene();
+        utility::Timer timer;
+        timer.Start();
+        if (full) {
+            scene->UpdateGeometry("sensor", sensor->GetPointCloud(),
+                                  update_flags);
+        } else {
+            const auto &cloud = sensor->GetPointCloud();
+            t::geometry::PointCloud rows(
+                    cloud.GetPoints().Slice(0, range.first,
+                                            range.first + range.second));
+            rows.SetPointColors(cloud.GetPointColors().Slice(
+                    0, range.first, range.first + range.second));
+            scene->UpdateGeometry("sensor", rows, update_flags,
+                                  size_t(range.first));
+        }
+        timer.Stop();
+        update_times->push_back(timer.GetDuration());
+        scene_widget->ForceRedraw();
+        return true;
+    });
+
+    app.AddWindow(window);
+    // When Run() ends, Filament will be stopped, so we can't be holding on
+    // to any GUI objects.
+    window.reset();
+    scene_widget.reset();
+    app.Run();
+    return 0;
+}
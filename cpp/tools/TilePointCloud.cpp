@@ -0,0 +1,88 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/Open3D.h"
+#include "open3d/utility/ProgressReporters.h"
+
+void PrintHelp() {
+    using namespace open3d;
+    PrintOpen3DVersion();
+    // clang-format off
+    utility::LogInfo("Usage:");
+    utility::LogInfo("    > TilePointCloud source_file target_directory [options]");
+    utility::LogInfo("      Split a point cloud into a level of detail tile hierarchy for");
+    utility::LogInfo("      ViewPointCloudTiles.");
+    utility::LogInfo("");
+    utility::LogInfo("Options:");
+    utility::LogInfo("    --help, -h                : Print help information.");
+    utility::LogInfo("    --verbose n               : Set verbose level (0-4).");
+    utility::LogInfo("    --max_points_per_tile n   : Do not subdivide tiles with at most n points.");
+    utility::LogInfo("                                Default 200000.");
+    utility::LogInfo("    --grid_size n             : Keep one point per cell of an n^3 grid in each");
+    utility::LogInfo("                                tile. Default 128.");
+    utility::LogInfo("    --max_level n             : Maximum depth of the octree. Default 20.");
+    utility::LogInfo("    --precision p             : Quantization step of the positions. Default 0,");
+    utility::LogInfo("                                which picks one per tile.");
+    // clang-format on
+}
+
+int main(int argc, char **argv) {
+    using namespace open3d;
+
+    if (argc < 3 || utility::ProgramOptionExists(argc, argv, "--help") ||
+        utility::ProgramOptionExists(argc, argv, "-h")) {
+        PrintHelp();
+        return 0;
+    }
+
+    int verbose = utility::GetProgramOptionAsInt(argc, argv, "--verbose", 2);
+    utility::SetVerbosityLevel((utility::VerbosityLevel)verbose);
+
+    io::PointCloudTilingOption option;
+    option.max_points_per_tile = utility::GetProgramOptionAsInt(
+            argc, argv, "--max_points_per_tile",
+            int(option.max_points_per_tile));
+    option.grid_size = utility::GetProgramOptionAsInt(argc, argv, "--grid_size",
+                                                      option.grid_size);
+    option.max_level = utility::GetProgramOptionAsInt(argc, argv, "--max_level",
+                                                      option.max_level);
+    option.quantization_precision =
+            utility::GetProgramOptionAsDouble(argc, argv, "--precision", 0.0);
+
+    geometry::PointCloud pointcloud;
+    if (!io::ReadPointCloud(argv[1], pointcloud,
+                            {"auto", true, true, verbose >= 2})) {
+        utility::LogWarning("Failed to read {}.", argv[1]);
+        return 1;
+    }
+    option.update_progress =
+            utility::ConsoleProgressUpdater("Writing tiles", verbose >= 2);
+    if (!io::WritePointCloudTiles(argv[2], pointcloud, option)) {
+        utility::LogWarning("Failed to write tiles to {}.", argv[2]);
+        return 1;
+    }
+    return 0;
+}
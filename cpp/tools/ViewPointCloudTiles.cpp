@@ -0,0 +1,126 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/Open3D.h"
+
+void PrintHelp() {
+    using namespace open3d;
+    PrintOpen3DVersion();
+    // clang-format off
+    utility::LogInfo("Usage:");
+    utility::LogInfo("    > ViewPointCloudTiles tile_directory [options]");
+    utility::LogInfo("      View a tile hierarchy written by TilePointCloud, loading tiles as");
+    utility::LogInfo("      the camera moves.");
+    utility::LogInfo("");
+    utility::LogInfo("Options:");
+    utility::LogInfo("    --help, -h                : Print help information.");
+    utility::LogInfo("    --verbose n               : Set verbose level (0-4).");
+    utility::LogInfo("    --width n                 : Window width. Default 1280.");
+    utility::LogInfo("    --height n                : Window height. Default 960.");
+    utility::LogInfo("    --point_size n            : Point size in pixels. Default 2.");
+    utility::LogInfo("    --max_error pixels        : Maximum projected point spacing. Default 2.");
+    utility::LogInfo("    --max_gpu_memory mb       : GPU memory cap of the shown tiles. Default 512.");
+    utility::LogInfo("    --max_cpu_memory mb       : Memory cap of the loaded tiles. Default 2048.");
+    // clang-format on
+}
+
+int main(int argc, char **argv) {
+    using namespace open3d;
+    using namespace open3d::visualization;
+
+    if (argc < 2 || utility::ProgramOptionExists(argc, argv, "--help") ||
+        utility::ProgramOptionExists(argc, argv, "-h")) {
+        PrintHelp();
+        return 0;
+    }
+
+    int verbose = utility::GetProgramOptionAsInt(argc, argv, "--verbose", 2);
+    utility::SetVerbosityLevel((utility::VerbosityLevel)verbose);
+
+    const std::string directory = argv[1];
+    io::PointCloudTileHierarchy hierarchy;
+    if (!io::ReadPointCloudTileHierarchy(directory, hierarchy)) {
+        utility::LogWarning("Failed to read the tile hierarchy of {}.",
+                            directory);
+        return 1;
+    }
+
+    rendering::PointCloudTileStreamer::Options options;
+    options.max_screen_space_error = utility::GetProgramOptionAsDouble(
+            argc, argv, "--max_error", options.max_screen_space_error);
+    options.max_gpu_memory =
+            size_t(utility::GetProgramOptionAsInt(argc, argv,
+                                                  "--max_gpu_memory", 512))
+            << 20;
+    options.max_cpu_memory =
+            size_t(utility::GetProgramOptionAsInt(argc, argv,
+                                                  "--max_cpu_memory", 2048))
+            << 20;
+    rendering::Material material;
+    material.shader = hierarchy.has_normals_ ? "defaultLit" : "defaultUnlit";
+    material.point_size = float(
+            utility::GetProgramOptionAsInt(argc, argv, "--point_size", 2));
+
+    auto &app = gui::Application::GetInstance();
+    app.Initialize(argc, const_cast<const char **>(argv));
+    auto window = std::make_shared<gui::Window>(
+            "ViewPointCloudTiles - " + directory,
+            utility::GetProgramOptionAsInt(argc, argv, "--width", 1280),
+            utility::GetProgramOptionAsInt(argc, argv, "--height", 960));
+    auto scene_widget = std::make_shared<gui::SceneWidget>();
+    scene_widget->SetScene(
+            std::make_shared<rendering::Open3DScene>(window->GetRenderer()));
+    window->AddChild(scene_widget);
+
+    auto streamer = std::make_shared<rendering::PointCloudTileStreamer>(
+            *scene_widget->GetScene(), "tiles", directory, hierarchy, material,
+            options);
+    const geometry::AxisAlignedBoundingBox &bounds = streamer->GetBoundingBox();
+    scene_widget->SetupCamera(60.0f, bounds,
+                              bounds.GetCenter().cast<float>());
+
+    // Tiles finish loading between frames, so poll on every tick.
+    window->SetOnTickEvent([scene_widget, streamer]() {
+        if (!streamer->Update(*scene_widget->GetScene()->GetCamera(),
+                              scene_widget->GetFrame().height)) {
+            return false;
+        }
+        utility::LogDebug("Showing {:d} tiles with {:d} points.",
+                          streamer->GetNumShownTiles(),
+                          streamer->GetNumShownPoints());
+        scene_widget->ForceRedraw();
+        return true;
+    });
+
+    app.AddWindow(window);
+    // When Run() ends, Filament will be stopped, so we can't be holding on
+    // to any GUI objects.
+    window.reset();
+    scene_widget.reset();
+    streamer.reset();
+    app.Run();
+    return 0;
+}
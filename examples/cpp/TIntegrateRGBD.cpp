@@ -111,17 +111,13 @@ int main(int argc, char** argv) {
                                            {"color", core::Dtype::UInt16}},
                                           3.0f / 512.f, 0.04f, 16, 100, device);
 
+    // Decode the images on background threads while integrating.
+    auto prefetcher = t::io::RGBDFramePrefetcher::CreateFromImagePairs(
+            color_filenames, depth_filenames, device);
     for (size_t i = 0; i < trajectory->parameters_.size(); ++i) {
-        // Load image
-        std::shared_ptr<geometry::Image> depth_legacy =
-                io::CreateImageFromFile(depth_filenames[i]);
-        std::shared_ptr<geometry::Image> color_legacy =
-                io::CreateImageFromFile(color_filenames[i]);
-
-        t::geometry::Image depth =
-                t::geometry::Image::FromLegacyImage(*depth_legacy, device);
-        t::geometry::Image color =
-                t::geometry::Image::FromLegacyImage(*color_legacy, device);
+        t::geometry::RGBDImage rgbd = prefetcher->NextFrame();
+        const t::geometry::Image &depth = rgbd.depth_;
+        const t::geometry::Image &color = rgbd.color_;
 
         Eigen::Matrix4f extrinsic =
                 trajectory->parameters_[i].extrinsic_.cast<float>();